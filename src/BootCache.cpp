@@ -0,0 +1,174 @@
+/**
+ * @file BootCache.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the BootCache class.
+ */
+
+#include "BootCache.h"
+
+#if defined MS_BOOT_CACHE
+
+#if defined __AVR__
+#include <avr/eeprom.h>
+#endif
+
+// The layout of the cache image:
+// | 0-1 | a magic number, so blank or foreign EEPROM is never trusted |
+// | 2-5 | the configuration hash the records belong to                |
+// | 6   | the number of bytes of records                              |
+// | 7   | a checksum of the records                                   |
+// | 8-  | the records: a 2 byte key, a 1 byte length, then the data   |
+#define BOOT_CACHE_MAGIC 0xB007
+#define BOOT_CACHE_HEADER_BYTES 8
+#define BOOT_CACHE_NOT_FOUND 0xFF
+
+// Initialize the static members
+uint8_t  BootCache::_image[MS_BOOT_CACHE_BYTES];
+uint32_t BootCache::_configHash = 0;
+bool     BootCache::_begun      = false;
+bool     BootCache::_warm       = false;
+bool     BootCache::_dirty      = false;
+
+
+bool BootCache::begin(uint32_t configHash) {
+    if (_begun) { return _warm; }
+    _begun      = true;
+    _configHash = configHash;
+#if defined __AVR__
+    eeprom_read_block(_image, (const void*)MS_BOOT_CACHE_EEPROM_ADDRESS,
+                      MS_BOOT_CACHE_BYTES);
+#else
+    memset(_image, 0, MS_BOOT_CACHE_BYTES);
+#endif
+    uint16_t magic;
+    uint32_t savedHash;
+    memcpy(&magic, &_image[0], 2);
+    memcpy(&savedHash, &_image[2], 4);
+    _warm = magic == BOOT_CACHE_MAGIC && savedHash == configHash &&
+        usedBytes() <= MS_BOOT_CACHE_BYTES - BOOT_CACHE_HEADER_BYTES &&
+        _image[7] == checksum();
+
+    if (_warm) {
+        MS_DBG(F("Warm boot; the boot cache holds"), usedBytes(),
+               F("bytes of records"));
+        _dirty = false;
+    } else {
+        MS_DBG(F("Cold boot; the boot cache is empty"));
+        clear();
+    }
+    return _warm;
+}
+
+
+bool BootCache::isWarm(void) {
+    return _warm;
+}
+
+
+bool BootCache::read(uint16_t key, void* data, uint8_t length) {
+    uint8_t at = findRecord(key);
+    if (at == BOOT_CACHE_NOT_FOUND || _image[at + 2] != length) {
+        return false;
+    }
+    memcpy(data, &_image[at + 3], length);
+    return true;
+}
+
+
+bool BootCache::write(uint16_t key, const void* data, uint8_t length) {
+    uint8_t at = findRecord(key);
+    // Don't touch anything if the record is already there and unchanged
+    if (at != BOOT_CACHE_NOT_FOUND && _image[at + 2] == length &&
+        memcmp(&_image[at + 3], data, length) == 0) {
+        return true;
+    }
+    forget(key);
+    uint8_t used = usedBytes();
+    if (BOOT_CACHE_HEADER_BYTES + used + 3 + length > MS_BOOT_CACHE_BYTES) {
+        MS_DBG(F("No room in the boot cache for"), length, F("bytes"));
+        return false;
+    }
+    at = BOOT_CACHE_HEADER_BYTES + used;
+    memcpy(&_image[at], &key, 2);
+    _image[at + 2] = length;
+    memcpy(&_image[at + 3], data, length);
+    _image[6] = used + 3 + length;
+    _dirty    = true;
+    return true;
+}
+
+
+bool BootCache::forget(uint16_t key) {
+    uint8_t at = findRecord(key);
+    if (at == BOOT_CACHE_NOT_FOUND) { return false; }
+    // Slide the records after this one down over it
+    uint8_t recordLength = 3 + _image[at + 2];
+    uint8_t end          = BOOT_CACHE_HEADER_BYTES + usedBytes();
+    memmove(&_image[at], &_image[at + recordLength], end - at - recordLength);
+    _image[6] = usedBytes() - recordLength;
+    _dirty    = true;
+    return true;
+}
+
+
+void BootCache::clear(void) {
+    uint16_t magic = BOOT_CACHE_MAGIC;
+    memset(_image, 0, MS_BOOT_CACHE_BYTES);
+    memcpy(&_image[0], &magic, 2);
+    memcpy(&_image[2], &_configHash, 4);
+    _dirty = true;
+}
+
+
+void BootCache::commit(void) {
+    if (!_dirty) { return; }
+    _image[7] = checksum();
+#if defined __AVR__
+    // Only the changed bytes are written, to spare the EEPROM
+    eeprom_update_block(_image, (void*)MS_BOOT_CACHE_EEPROM_ADDRESS,
+                        BOOT_CACHE_HEADER_BYTES + usedBytes());
+#endif
+    MS_DBG(F("Saved"), usedBytes(), F("bytes of records to the boot cache"));
+    _dirty = false;
+}
+
+
+uint32_t BootCache::hash(uint32_t hash, const void* data, uint8_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (uint8_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+
+uint8_t BootCache::findRecord(uint16_t key) {
+    uint8_t at  = BOOT_CACHE_HEADER_BYTES;
+    uint8_t end = BOOT_CACHE_HEADER_BYTES + usedBytes();
+    while (at + 3 <= end) {
+        uint16_t recordKey;
+        memcpy(&recordKey, &_image[at], 2);
+        if (recordKey == key) { return at; }
+        at += 3 + _image[at + 2];
+    }
+    return BOOT_CACHE_NOT_FOUND;
+}
+
+
+uint8_t BootCache::usedBytes(void) {
+    return _image[6];
+}
+
+
+uint8_t BootCache::checksum(void) {
+    uint8_t sum = 0x5A;
+    for (uint8_t i = 0; i < usedBytes(); i++) {
+        sum = (sum << 1 | sum >> 7) ^ _image[BOOT_CACHE_HEADER_BYTES + i];
+    }
+    return sum;
+}
+
+#endif  // MS_BOOT_CACHE
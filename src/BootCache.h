@@ -0,0 +1,160 @@
+/**
+ * @file BootCache.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the BootCache class, which keeps what sensors discover
+ * during setup so that later boots can skip the discovery.
+ *
+ * Setting up some sensors means searching or asking for things that don't
+ * change from one boot to the next - the address of a DS18 on a bus, the
+ * identification of an SDI-12 sensor, or the output settings an Atlas sensor
+ * keeps in its own memory.  After a watchdog reset in the field, doing all of
+ * that again can cost tens of seconds.  Sensors save what they found with
+ * Sensor::writeBootCache() and look for it first with
+ * Sensor::readBootCache().
+ *
+ * The cache is keyed by a hash of the sensors set up by
+ * VariableArray::setupSensors().  When the sensors change, the hash changes
+ * and the whole cache is thrown away (a cold boot).  If a sensor fails to set
+ * up from the cache, its entry is forgotten and it is set up again from
+ * scratch.  Call BootCache::clear() to force a cold boot after swapping a
+ * sensor for an identical one.
+ *
+ * The cache is kept in EEPROM on AVR boards.  Boards without EEPROM keep it
+ * in RAM only, so every boot is a cold boot.  The cache is only compiled in
+ * with the build flag ```-D MS_BOOT_CACHE```; without it, sensors always go
+ * through their full setup.
+ */
+
+// Header Guards
+#ifndef SRC_BOOTCACHE_H_
+#define SRC_BOOTCACHE_H_
+
+// Debugging Statement
+// #define MS_BOOTCACHE_DEBUG
+
+#ifdef MS_BOOTCACHE_DEBUG
+#define MS_DEBUGGING_STD "BootCache"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+
+#if defined MS_BOOT_CACHE
+
+/**
+ * @brief The number of bytes set aside for the cache, including its header;
+ * at most 255.
+ *
+ * This can be changed by setting the build flag MS_BOOT_CACHE_BYTES when
+ * compiling.
+ */
+#ifndef MS_BOOT_CACHE_BYTES
+#define MS_BOOT_CACHE_BYTES 128
+#endif
+/**
+ * @brief The first EEPROM address used for the cache.
+ *
+ * This can be changed by setting the build flag MS_BOOT_CACHE_EEPROM_ADDRESS
+ * when compiling.
+ */
+#ifndef MS_BOOT_CACHE_EEPROM_ADDRESS
+#define MS_BOOT_CACHE_EEPROM_ADDRESS 0
+#endif
+
+/**
+ * @brief The BootCache class holds small records saved by sensors during
+ * setup, kept across resets.
+ *
+ * All members are static; there is only one cache.
+ *
+ * @ingroup base_classes
+ */
+class BootCache {
+ public:
+    /**
+     * @brief Load the cache, keeping it only if it was saved for the same
+     * configuration.
+     *
+     * Only the first call loads the cache.  Later calls - such as from the
+     * setup of a second logger's variable array - leave it as it is.
+     *
+     * @param configHash A hash of the current configuration; see hash()
+     * @return **bool** True if the cache was kept (a warm boot).
+     */
+    static bool begin(uint32_t configHash);
+    /**
+     * @brief Check whether the cache was kept at the last begin().
+     *
+     * @return **bool** True on a warm boot.
+     */
+    static bool isWarm(void);
+
+    /**
+     * @brief Get a record.
+     *
+     * @param key The key of the record
+     * @param data The buffer to copy the record into
+     * @param length The expected length of the record; a record of any other
+     * length is ignored
+     * @return **bool** True if the record was found.
+     */
+    static bool read(uint16_t key, void* data, uint8_t length);
+    /**
+     * @brief Add or replace a record.
+     *
+     * The record is only kept across resets after commit().
+     *
+     * @param key The key of the record
+     * @param data The record
+     * @param length The length of the record
+     * @return **bool** True if there was room for the record.
+     */
+    static bool write(uint16_t key, const void* data, uint8_t length);
+    /**
+     * @brief Remove a record.
+     *
+     * @param key The key of the record
+     * @return **bool** True if there was a record to remove.
+     */
+    static bool forget(uint16_t key);
+    /**
+     * @brief Remove every record, forcing a cold boot next time.
+     */
+    static void clear(void);
+    /**
+     * @brief Save any changes so they are kept across resets.
+     *
+     * Only the bytes that changed are written.
+     */
+    static void commit(void);
+
+    /**
+     * @brief Add some bytes to an FNV-1a hash.
+     *
+     * Start with a hash of 2166136261.
+     *
+     * @param hash The hash so far
+     * @param data The bytes to add
+     * @param length The number of bytes
+     * @return **uint32_t** The updated hash
+     */
+    static uint32_t hash(uint32_t hash, const void* data, uint8_t length);
+
+ private:
+    static uint8_t  _image[MS_BOOT_CACHE_BYTES];
+    static uint32_t _configHash;
+    static bool     _begun;
+    static bool     _warm;
+    static bool     _dirty;
+
+    static uint8_t findRecord(uint16_t key);
+    static uint8_t usedBytes(void);
+    static uint8_t checksum(void);
+};
+
+#endif  // MS_BOOT_CACHE
+
+#endif  // SRC_BOOTCACHE_H_
@@ -0,0 +1,138 @@
+/**
+ * @file CalendarCache.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the CalendarCache class.
+ */
+
+#include "CalendarCache.h"
+
+#define SECONDS_PER_DAY 86400UL
+
+// Writes a number as two digits and returns the next place in the buffer
+static char* putTwoDigits(char* buffer, uint8_t value) {
+    buffer[0] = '0' + value / 10;
+    buffer[1] = '0' + value % 10;
+    return buffer + 2;
+}
+
+
+CalendarCache::CalendarCache() {
+    _epoch        = 0;
+    _dayStart     = 0;
+    _year         = 1970;
+    _month        = 1;
+    _date         = 1;
+    _hour         = 0;
+    _minute       = 0;
+    _second       = 0;
+    _converted    = false;
+    _iso8601[0]   = '\0';
+    _iso8601Valid = false;
+    _csv[0]       = '\0';
+    _csvValid     = false;
+}
+
+
+void CalendarCache::setEpoch(uint32_t epochTime) {
+    if (_converted && epochTime == _epoch) { return; }
+    // Only work out the date again if the day has changed
+    if (!_converted || epochTime < _dayStart ||
+        epochTime - _dayStart >= SECONDS_PER_DAY) {
+        _dayStart = epochTime - epochTime % SECONDS_PER_DAY;
+        convertDate(epochTime / SECONDS_PER_DAY);
+    }
+    uint32_t secondOfDay = epochTime - _dayStart;
+    _hour                = secondOfDay / 3600;
+    _minute              = (secondOfDay % 3600) / 60;
+    _second              = secondOfDay % 60;
+    _epoch               = epochTime;
+    _converted           = true;
+}
+
+
+const char* CalendarCache::formatISO8601(uint32_t epochTime, int8_t timeZone,
+                                         uint16_t milliseconds,
+                                         bool     withMillis) {
+    if (!withMillis) { milliseconds = 0; }
+    if (_iso8601Valid && epochTime == _iso8601Epoch &&
+        milliseconds == _iso8601Millis && timeZone == _iso8601TimeZone) {
+        return _iso8601;
+    }
+    setEpoch(epochTime);
+    char* end = printDateTime(_iso8601, 'T', milliseconds, withMillis);
+    if (timeZone == 0) {
+        *end++ = 'Z';
+    } else {
+        *end++ = timeZone > 0 ? '+' : '-';
+        end    = putTwoDigits(end, timeZone > 0 ? timeZone : -timeZone);
+        *end++ = ':';
+        *end++ = '0';
+        *end++ = '0';
+    }
+    *end             = '\0';
+    _iso8601Epoch    = epochTime;
+    _iso8601Millis   = milliseconds;
+    _iso8601TimeZone = timeZone;
+    _iso8601Valid    = true;
+    return _iso8601;
+}
+
+
+const char* CalendarCache::formatCSV(uint32_t epochTime, uint16_t milliseconds,
+                                     bool withMillis) {
+    if (!withMillis) { milliseconds = 0; }
+    if (_csvValid && epochTime == _csvEpoch && milliseconds == _csvMillis) {
+        return _csv;
+    }
+    setEpoch(epochTime);
+    *printDateTime(_csv, ' ', milliseconds, withMillis) = '\0';
+    _csvEpoch  = epochTime;
+    _csvMillis = milliseconds;
+    _csvValid  = true;
+    return _csv;
+}
+
+
+// Converts a number of days since January 1, 1970 into a year, month, and day
+// This is the "civil from days" algorithm by Howard Hinnant, which works in
+// 400 year eras starting on March 1 so that leap days fall at the end of a year
+void CalendarCache::convertDate(uint32_t days) {
+    uint32_t dayOfEra  = (days + 719468UL) % 146097UL;
+    uint32_t era       = (days + 719468UL) / 146097UL;
+    uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 -
+                          dayOfEra / 146096) /
+        365;
+    uint16_t dayOfYear = dayOfEra -
+        (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    uint8_t monthFromMarch = (5 * dayOfYear + 2) / 153;
+    _date  = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+    _month = monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9;
+    _year  = yearOfEra + era * 400 + (_month <= 2 ? 1 : 0);
+}
+
+
+// Prints "YYYY-MM-DD?hh:mm:ss[.mmm]" and returns the end of what was printed
+char* CalendarCache::printDateTime(char* buffer, char separator,
+                                   uint16_t milliseconds, bool withMillis) {
+    buffer    = putTwoDigits(buffer, _year / 100);
+    buffer    = putTwoDigits(buffer, _year % 100);
+    *buffer++ = '-';
+    buffer    = putTwoDigits(buffer, _month);
+    *buffer++ = '-';
+    buffer    = putTwoDigits(buffer, _date);
+    *buffer++ = separator;
+    buffer    = putTwoDigits(buffer, _hour);
+    *buffer++ = ':';
+    buffer    = putTwoDigits(buffer, _minute);
+    *buffer++ = ':';
+    buffer    = putTwoDigits(buffer, _second);
+    if (withMillis) {
+        milliseconds %= 1000;
+        *buffer++ = '.';
+        *buffer++ = '0' + milliseconds / 100;
+        buffer    = putTwoDigits(buffer, milliseconds % 100);
+    }
+    return buffer;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file CalendarCache.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the CalendarCache class, which converts epoch times to
+ * calendar fields and formatted date strings and keeps the results.
+ *
+ * Building a DateTime from an epoch time means working out the year, month,
+ * and day from scratch every time.  Over a logging cycle the same marked time
+ * is converted for the SD card, for the file timestamps, and again for every
+ * publisher.  A CalendarCache holds the last conversion: asking again for the
+ * same time costs nothing, and a later time on the same day only needs the
+ * hours, minutes, and seconds worked out.  The ISO8601 and CSV strings are
+ * kept in fixed buffers and only rebuilt when the time changes.
+ */
+
+// Header Guards
+#ifndef SRC_CALENDARCACHE_H_
+#define SRC_CALENDARCACHE_H_
+
+#include <stdint.h>
+
+/**
+ * @brief The size of the buffer for an ISO8601 string, with milliseconds and
+ * the time zone: "YYYY-MM-DDThh:mm:ss.mmm+hh:00" and a terminating NULL.
+ */
+#define CALENDAR_ISO8601_BUFFER_SIZE 30
+/**
+ * @brief The size of the buffer for a CSV date string, with milliseconds:
+ * "YYYY-MM-DD hh:mm:ss.mmm" and a terminating NULL.
+ */
+#define CALENDAR_CSV_BUFFER_SIZE 24
+
+/**
+ * @brief The CalendarCache class converts an epoch time into calendar fields
+ * and formatted strings, reusing its last conversion where it can.
+ *
+ * Epoch times are the number of seconds since January 1, 1970, in whatever
+ * time zone the caller is working in; no offset is applied.
+ *
+ * @ingroup base_classes
+ */
+class CalendarCache {
+ public:
+    /**
+     * @brief Construct a new, empty Calendar Cache object.
+     */
+    CalendarCache();
+
+    /**
+     * @brief Convert an epoch time into calendar fields.
+     *
+     * Nothing is done if the time is the one already held.  If it falls on the
+     * same day, only the time of day is worked out again.
+     *
+     * @param epochTime The number of seconds since 1970.
+     */
+    void setEpoch(uint32_t epochTime);
+
+    /**
+     * @brief Get the epoch time last converted.
+     *
+     * @return **uint32_t** The number of seconds since 1970.
+     */
+    uint32_t epoch(void) {
+        return _epoch;
+    }
+    /**
+     * @brief Get the year, such as 2020.
+     *
+     * @return **uint16_t** The year
+     */
+    uint16_t year(void) {
+        return _year;
+    }
+    /**
+     * @brief Get the month, from 1 to 12.
+     *
+     * @return **uint8_t** The month
+     */
+    uint8_t month(void) {
+        return _month;
+    }
+    /**
+     * @brief Get the day of the month, from 1 to 31.
+     *
+     * @return **uint8_t** The day of the month
+     */
+    uint8_t date(void) {
+        return _date;
+    }
+    /**
+     * @brief Get the hour, from 0 to 23.
+     *
+     * @return **uint8_t** The hour
+     */
+    uint8_t hour(void) {
+        return _hour;
+    }
+    /**
+     * @brief Get the minute, from 0 to 59.
+     *
+     * @return **uint8_t** The minute
+     */
+    uint8_t minute(void) {
+        return _minute;
+    }
+    /**
+     * @brief Get the second, from 0 to 59.
+     *
+     * @return **uint8_t** The second
+     */
+    uint8_t second(void) {
+        return _second;
+    }
+
+    /**
+     * @brief Get an epoch time as an ISO8601 formatted string.
+     *
+     * The string is only rebuilt if the time, milliseconds, or time zone
+     * differ from the last call.
+     *
+     * @param epochTime The number of seconds since 1970.
+     * @param timeZone The time zone offset to add, in hours; 0 gives a "Z".
+     * @param milliseconds The millisecond within the second, from 0 to 999.
+     * @param withMillis True to include the milliseconds in the string.
+     * @return **const char\*** The string, valid until the next call.
+     */
+    const char* formatISO8601(uint32_t epochTime, int8_t timeZone,
+                              uint16_t milliseconds = 0,
+                              bool     withMillis   = false);
+    /**
+     * @brief Get an epoch time as a "YYYY-MM-DD hh:mm:ss" string for a CSV
+     * file.
+     *
+     * The string is only rebuilt if the time or milliseconds differ from the
+     * last call.
+     *
+     * @param epochTime The number of seconds since 1970.
+     * @param milliseconds The millisecond within the second, from 0 to 999.
+     * @param withMillis True to add the milliseconds to the string.
+     * @return **const char\*** The string, valid until the next call.
+     */
+    const char* formatCSV(uint32_t epochTime, uint16_t milliseconds = 0,
+                          bool withMillis = false);
+
+ private:
+    uint32_t _epoch;
+    uint32_t _dayStart;
+    uint16_t _year;
+    uint8_t  _month;
+    uint8_t  _date;
+    uint8_t  _hour;
+    uint8_t  _minute;
+    uint8_t  _second;
+    bool     _converted;
+
+    char     _iso8601[CALENDAR_ISO8601_BUFFER_SIZE];
+    uint32_t _iso8601Epoch;
+    uint16_t _iso8601Millis;
+    int8_t   _iso8601TimeZone;
+    bool     _iso8601Valid;
+
+    char     _csv[CALENDAR_CSV_BUFFER_SIZE];
+    uint32_t _csvEpoch;
+    uint16_t _csvMillis;
+    bool     _csvValid;
+
+    void  convertDate(uint32_t days);
+    char* printDateTime(char* buffer, char separator, uint16_t milliseconds,
+                        bool withMillis);
+};
+
+#endif  // SRC_CALENDARCACHE_H_
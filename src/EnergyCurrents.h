@@ -0,0 +1,141 @@
+/**
+ * @file EnergyCurrents.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the default currents of the supported logger boards and
+ * modems, used for the [energy estimates](@ref logger_energy).
+ *
+ * The values are rounded from the manufacturers' datasheets.  The active
+ * currents of the modems are the average currents while transmitting, so a
+ * modem that spends most of its awake time registering will draw less.  To get
+ * better numbers for a deployment, measure them with a TIINA219 and set them
+ * with Logger::setCurrents() and loggerModem::setCurrents().
+ *
+ * This file has only defines and no Arduino dependencies, so the same values
+ * can be used by a host program like tools/battery_life.
+ */
+
+// Header Guards
+#ifndef SRC_ENERGYCURRENTS_H_
+#define SRC_ENERGYCURRENTS_H_
+
+/**
+ * @anchor board_mayfly_current
+ * @name EnviroDIY Mayfly
+ * The currents of an EnviroDIY Mayfly, from the datasheets of its parts
+ */
+/**@{*/
+/// @brief The Mayfly awake: the ATmega1284P at 8MHz draws about 4 mA, and
+/// writes to the SD card and the LEDs bring the average up to about 10 mA.
+#define MAYFLY_AWAKE_CURRENT_MA 10
+/// @brief The Mayfly asleep: the two regulators, the DS3231, and the idle SD
+/// card draw about 0.4 mA; the sleeping processor draws almost nothing.
+#define MAYFLY_SLEEP_CURRENT_MA 0.4
+/**@}*/
+
+/**
+ * @anchor board_default_current
+ * @name Board Defaults
+ * The currents a Logger starts with; these are 0 for boards without values
+ */
+/**@{*/
+#if defined(ARDUINO_AVR_ENVIRODIY_MAYFLY)
+/// @brief The default Logger awake current
+#define LOGGER_AWAKE_CURRENT_MA MAYFLY_AWAKE_CURRENT_MA
+/// @brief The default Logger sleep current
+#define LOGGER_SLEEP_CURRENT_MA MAYFLY_SLEEP_CURRENT_MA
+#else
+/// @brief The default Logger awake current
+#define LOGGER_AWAKE_CURRENT_MA 0
+/// @brief The default Logger sleep current
+#define LOGGER_SLEEP_CURRENT_MA 0
+#endif
+/**@}*/
+
+/**
+ * @anchor modem_xbee3_ltem_current
+ * @name Digi XBee3 Cellular LTE-M
+ * Used by DigiXBeeLTEBypass, DigiXBeeCellularTransparent, and
+ * DigiXBeeCellularAPI
+ */
+/**@{*/
+/// @brief loggerModem::_activeCurrent_mA; about 190 mA transmitting
+#define XBEE3_LTEM_ACTIVE_CURRENT_MA 190
+/// @brief loggerModem::_idleCurrent_mA; about 10 µA in pin sleep
+#define XBEE3_LTEM_IDLE_CURRENT_MA 0.01
+/// @brief loggerModem::_sleepCurrent_mA; about 10 µA in pin sleep
+#define XBEE3_LTEM_SLEEP_CURRENT_MA 0.01
+/**@}*/
+
+/**
+ * @anchor modem_xbee_3g_current
+ * @name Digi XBee Cellular 3G
+ * Used by DigiXBee3GBypass
+ */
+/**@{*/
+/// @brief loggerModem::_activeCurrent_mA; about 500 mA transmitting
+#define XBEE_3G_ACTIVE_CURRENT_MA 500
+/// @brief loggerModem::_idleCurrent_mA; about 10 µA in pin sleep
+#define XBEE_3G_IDLE_CURRENT_MA 0.01
+/// @brief loggerModem::_sleepCurrent_mA; about 10 µA in pin sleep
+#define XBEE_3G_SLEEP_CURRENT_MA 0.01
+/**@}*/
+
+/**
+ * @anchor modem_xbee_wifi_current
+ * @name Digi XBee Wi-Fi (S6B)
+ * Used by DigiXBeeWifi
+ */
+/**@{*/
+/// @brief loggerModem::_activeCurrent_mA; about 309 mA transmitting 802.11b
+#define XBEE_WIFI_ACTIVE_CURRENT_MA 309
+/// @brief loggerModem::_idleCurrent_mA; under 6 µA in pin sleep
+#define XBEE_WIFI_IDLE_CURRENT_MA 0.006
+/// @brief loggerModem::_sleepCurrent_mA; under 6 µA in pin sleep
+#define XBEE_WIFI_SLEEP_CURRENT_MA 0.006
+/**@}*/
+
+/**
+ * @anchor modem_sim800_current
+ * @name SIMCom SIM800
+ * Used by SIMComSIM800
+ */
+/**@{*/
+/// @brief loggerModem::_activeCurrent_mA; about 450 mA for GPRS data
+#define SIM800_ACTIVE_CURRENT_MA 450
+/// @brief loggerModem::_idleCurrent_mA; about 1 mA in sleep mode
+#define SIM800_IDLE_CURRENT_MA 1
+/// @brief loggerModem::_sleepCurrent_mA; about 60 µA powered down
+#define SIM800_SLEEP_CURRENT_MA 0.06
+/**@}*/
+
+/**
+ * @anchor modem_sim7000_current
+ * @name SIMCom SIM7000
+ * Used by SIMComSIM7000
+ */
+/**@{*/
+/// @brief loggerModem::_activeCurrent_mA; about 200 mA for LTE-M data
+#define SIM7000_ACTIVE_CURRENT_MA 200
+/// @brief loggerModem::_idleCurrent_mA; about 1 mA in sleep mode
+#define SIM7000_IDLE_CURRENT_MA 1
+/// @brief loggerModem::_sleepCurrent_mA; about 9 µA in power saving mode
+#define SIM7000_SLEEP_CURRENT_MA 0.009
+/**@}*/
+
+/**
+ * @anchor modem_esp8266_current
+ * @name Espressif ESP8266
+ * Used by EspressifESP8266
+ */
+/**@{*/
+/// @brief loggerModem::_activeCurrent_mA; about 170 mA transmitting 802.11b
+#define ESP8266_ACTIVE_CURRENT_MA 170
+/// @brief loggerModem::_idleCurrent_mA; about 20 µA in deep sleep
+#define ESP8266_IDLE_CURRENT_MA 0.02
+/// @brief loggerModem::_sleepCurrent_mA; about 20 µA in deep sleep
+#define ESP8266_SLEEP_CURRENT_MA 0.02
+/**@}*/
+
+#endif  // SRC_ENERGYCURRENTS_H_
@@ -0,0 +1,82 @@
+/**
+ * @file EnergyProjection.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the arithmetic used to project the charge a logger will use
+ * and how long its battery will last.
+ *
+ * These functions are plain arithmetic with no hardware calls or Arduino
+ * dependencies, so they can be compiled into a host program to simulate a
+ * logger configuration before it is deployed.  For example, a logger that is
+ * awake for 20s at 25mA every 15 minutes and draws 0.3mA while asleep will use:
+ * @code{.cpp}
+ * float perCycle = energyChargePerCycle(25, 20, 0.3, 15);
+ * float perDay   = energyChargePerDay(perCycle, 15);
+ * float days     = energyBatteryLifeDays(2000, perDay);
+ * @endcode
+ *
+ * The program in tools/battery_life does this for a whole logger
+ * configuration, with the board and modem currents from EnergyCurrents.h.
+ *
+ * On a running logger the same functions are used by the EnergyModel
+ * pseudo-sensor with the measured awake time and the currents set for the
+ * board, each sensor, and the modem.
+ */
+
+// Header Guards
+#ifndef SRC_ENERGYPROJECTION_H_
+#define SRC_ENERGYPROJECTION_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Estimate the charge used in a single logging cycle.
+ *
+ * @param awakeCurrent_mA The average current while awake, in mA
+ * @param awakeTime_s The time awake in each cycle, in seconds
+ * @param sleepCurrent_mA The current while asleep, in mA
+ * @param loggingIntervalMinutes The logging interval in minutes
+ * @return **float** The charge used per cycle in mAh
+ */
+static inline float energyChargePerCycle(float    awakeCurrent_mA,
+                                         float    awakeTime_s,
+                                         float    sleepCurrent_mA,
+                                         uint16_t loggingIntervalMinutes) {
+    float asleep_s = loggingIntervalMinutes * 60.0f - awakeTime_s;
+    if (asleep_s < 0) { asleep_s = 0; }
+    return (awakeCurrent_mA * awakeTime_s + sleepCurrent_mA * asleep_s) /
+        3600.0f;
+}
+
+/**
+ * @brief Convert the charge used per cycle into the charge used per day.
+ *
+ * @param chargePerCycle_mAh The charge used in each cycle, in mAh
+ * @param loggingIntervalMinutes The logging interval in minutes
+ * @return **float** The charge used per day in mAh
+ */
+static inline float energyChargePerDay(float    chargePerCycle_mAh,
+                                       uint16_t loggingIntervalMinutes) {
+    if (loggingIntervalMinutes == 0) { return 0; }
+    return chargePerCycle_mAh * (1440.0f / loggingIntervalMinutes);
+}
+
+/**
+ * @brief Project how many days a battery will last.
+ *
+ * This does not account for self-discharge, temperature, or the cut-off
+ * voltage of the regulator, so treat it as an upper bound.
+ *
+ * @param batteryCapacity_mAh The usable capacity of the battery, in mAh
+ * @param chargePerDay_mAh The charge used per day, in mAh
+ * @return **float** The projected battery life in days; -9999 if the charge
+ * used per day is not positive.
+ */
+static inline float energyBatteryLifeDays(float batteryCapacity_mAh,
+                                          float chargePerDay_mAh) {
+    if (chargePerDay_mAh <= 0) { return -9999; }
+    return batteryCapacity_mAh / chargePerDay_mAh;
+}
+
+#endif  // SRC_ENERGYPROJECTION_H_
@@ -0,0 +1,181 @@
+/**
+ * @file FixedPointMath.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains small fixed-point (Q16.16) helpers used by the sensor
+ * conversion kernels on processors without a floating point unit.
+ *
+ * A Q16.16 number is a signed 32-bit integer where the top 16 bits are the
+ * integer part and the bottom 16 bits are the fraction.  That gives a range of
+ * -32768 to +32767.99998 with a resolution of about 0.000015.
+ *
+ * On 8-bit AVR boards every floating point multiply or divide is done in
+ * software and takes hundreds of clock cycles.  To switch the conversions in
+ * ProcessorStats (battery), AnalogElecConductivity, ExternalVoltage,
+ * CampbellOBS3, and ApogeeSQ212 to integer math, add the build flag:
+ * - ```-D MS_USE_FIXED_POINT```
+ *
+ * Values are still converted to float before they are handed to the
+ * variables, so nothing outside of the sensor conversions changes.
+ */
+
+// Header Guards
+#ifndef SRC_FIXEDPOINTMATH_H_
+#define SRC_FIXEDPOINTMATH_H_
+
+#include <stdint.h>
+
+/**
+ * @brief A signed Q16.16 fixed-point number.
+ */
+typedef int32_t fixed_q16_t;
+
+/**
+ * @brief The number of fractional bits in a #fixed_q16_t
+ */
+#define FIXED_Q16_FRAC_BITS 16
+/**
+ * @brief The value 1.0 as a #fixed_q16_t
+ */
+#define FIXED_Q16_ONE ((fixed_q16_t)1 << FIXED_Q16_FRAC_BITS)
+/**
+ * @brief The largest magnitude that can safely be converted into a
+ * #fixed_q16_t
+ */
+#define FIXED_Q16_MAX_MAGNITUDE 32767.0f
+
+/**
+ * @brief Convert a float into a Q16.16 fixed-point number, rounding to the
+ * nearest value.
+ *
+ * When the input is a compile-time constant the compiler folds this into a
+ * constant, so it costs nothing at run time.
+ *
+ * @param value The float to convert; must be within ±#FIXED_Q16_MAX_MAGNITUDE
+ * @return **fixed_q16_t** The fixed-point value
+ */
+static inline fixed_q16_t floatToFixed(float value) {
+    return (fixed_q16_t)(value * (float)FIXED_Q16_ONE +
+                         (value >= 0 ? 0.5f : -0.5f));
+}
+
+/**
+ * @brief Convert a Q16.16 fixed-point number back to a float.
+ *
+ * @param value The fixed-point value
+ * @return **float** The value as a float
+ */
+static inline float fixedToFloat(fixed_q16_t value) {
+    return (float)value * (1.0f / (float)FIXED_Q16_ONE);
+}
+
+/**
+ * @brief Multiply two Q16.16 fixed-point numbers.
+ *
+ * The multiplication is split into 16-bit halves so that it never needs a
+ * 64-bit intermediate, which is very slow on 8-bit processors.  The caller is
+ * responsible for making sure the product fits in a #fixed_q16_t.
+ *
+ * @param a The first factor
+ * @param b The second factor
+ * @return **fixed_q16_t** The product
+ */
+static inline fixed_q16_t fixedMul(fixed_q16_t a, fixed_q16_t b) {
+    bool     negative = (a < 0) != (b < 0);
+    uint32_t ua       = a < 0 ? (uint32_t)(-a) : (uint32_t)a;
+    uint32_t ub       = b < 0 ? (uint32_t)(-b) : (uint32_t)b;
+
+    uint32_t aHi = ua >> 16;
+    uint32_t aLo = ua & 0xFFFF;
+    uint32_t bHi = ub >> 16;
+    uint32_t bLo = ub & 0xFFFF;
+
+    uint32_t product = ((aHi * bHi) << 16) + aHi * bLo + aLo * bHi +
+        ((aLo * bLo + 0x8000) >> 16);
+    return negative ? -(fixed_q16_t)product : (fixed_q16_t)product;
+}
+
+/**
+ * @brief Check if a float can be held by a #fixed_q16_t
+ *
+ * @param value The value to check
+ * @return **bool** True if the value is within ±#FIXED_Q16_MAX_MAGNITUDE
+ */
+static inline bool fitsInFixed(float value) {
+    return value < FIXED_Q16_MAX_MAGNITUDE && value > -FIXED_Q16_MAX_MAGNITUDE;
+}
+
+/**
+ * @brief Convert raw counts from a TI ADS1x15 set to a gain of one (±4.096V)
+ * into volts as a Q16.16 number.
+ *
+ * For the 16-bit ADS1115 each count is 0.125mV, which is 1024/125 in Q16.16.
+ * For the 12-bit ADS1015 (build flag MS_USE_ADS1015) each count is 2mV, which
+ * is 16384/125 in Q16.16.  The products fit in 32 bits for any reading.
+ *
+ * @param counts The raw single-ended reading from the ADC
+ * @return **fixed_q16_t** The voltage in volts
+ */
+static inline fixed_q16_t adsGainOneCountsToFixedVolts(int16_t counts) {
+#ifndef MS_USE_ADS1015
+    return ((fixed_q16_t)counts * 1024L) / 125;
+#else
+    // The library returns the 12-bit result right-aligned in 16 bits, so
+    // negative readings have to be sign-extended from bit 11
+    int16_t signedCounts = counts > 2047 ? counts - 4096 : counts;
+    return ((fixed_q16_t)signedCounts * 16384L) / 125;
+#endif
+}
+
+/**
+ * @brief Multiply a raw analog reading by a Q16.16 scale, as ProcessorStats
+ * does for the battery voltage.
+ *
+ * The reading is an integer, so this is a single integer multiply.  The
+ * caller must make sure that the scale times the largest reading fits in a
+ * #fixed_q16_t.
+ *
+ * @param counts The raw reading from analogRead()
+ * @param multiplier The volts per count
+ * @return **fixed_q16_t** The scaled reading
+ */
+static inline fixed_q16_t analogCountsToFixed(uint16_t counts,
+                                              fixed_q16_t multiplier) {
+    return (fixed_q16_t)counts * multiplier;
+}
+
+/**
+ * @brief Convert the constant part of the AnalogElecConductivity calculation
+ * into the Q24.8 scale used by analogEcFromCounts().
+ *
+ * @param ecScale 1000000 / (Rseries * K), in µS/cm
+ * @param adcRange The range of the ADC, one more than its largest reading
+ * @return **uint32_t** The scale as a Q24.8 number, or 0 if it isn't positive
+ * or is too large for its product with a reading to fit in 32 bits
+ */
+static inline uint32_t analogEcScaleToFixed(float ecScale, uint32_t adcRange) {
+    if (ecScale > 0 && ecScale * 256 * adcRange < 4294967295.0f) {
+        return (uint32_t)(ecScale * 256 + 0.5f);
+    }
+    return 0;
+}
+
+/**
+ * @brief Calculate the conductivity from a raw AnalogElecConductivity
+ * reading.
+ *
+ * This is ecScale * (adcRange - counts) / counts: one integer multiply and one
+ * integer divide.  The division truncates.
+ *
+ * @param counts The raw reading; must be between 1 and adcRange - 1
+ * @param adcRange The range of the ADC, one more than its largest reading
+ * @param scaleFixed The scale from analogEcScaleToFixed()
+ * @return **uint32_t** The conductivity in µS/cm as a Q24.8 number
+ */
+static inline uint32_t analogEcFromCounts(uint32_t counts, uint32_t adcRange,
+                                          uint32_t scaleFixed) {
+    return ((adcRange - counts) * scaleFixed) / counts;
+}
+
+#endif  // SRC_FIXEDPOINTMATH_H_
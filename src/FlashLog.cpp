@@ -0,0 +1,428 @@
+/**
+ * @file FlashLog.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the FlashLog class.
+ */
+
+#include "FlashLog.h"
+
+// The layout of a sector:
+// | 0-1 | a magic number, so a blank or foreign sector is never trusted |
+// | 2-5 | the sequence number of the sector                              |
+// | 6-7 | unused                                                         |
+// | 8-  | the records                                                    |
+// The layout of a record:
+// | 0   | the state                 |
+// | 1-2 | the length of the line    |
+// | 3-4 | the CRC-16 of the line    |
+// | 5-  | the line, with no newline |
+#define FLASH_LOG_MAGIC 0x4C4D
+#define FLASH_LOG_SECTOR_HEADER_BYTES 8
+#define FLASH_LOG_RECORD_HEADER_BYTES 5
+
+// The record states; each clears one more bit
+#define FLASH_LOG_STATE_BLANK 0xFF
+#define FLASH_LOG_STATE_COMMITTED 0x7F
+#define FLASH_LOG_STATE_MOVED 0x3F
+
+// What checkRecord() found
+#define FLASH_LOG_RECORD_OK 0
+#define FLASH_LOG_RECORD_END 1
+#define FLASH_LOG_RECORD_TORN 2
+
+#define FLASH_LOG_CRC_START 0xFFFF
+
+// The bytes read from the flash at a time when copying a line to a stream
+#define FLASH_LOG_READ_CHUNK 32
+
+
+FlashLog::FlashLog(FlashDevice* device) {
+    _device       = device;
+    _sectorSize   = 0;
+    _sectorCount  = 0;
+    _begun        = false;
+    _headSector   = 0;
+    _headSequence = 0;
+    _writeOffset  = 0;
+    _recording    = false;
+    _recordStart  = 0;
+    _recordLength = 0;
+    _recordCRC    = FLASH_LOG_CRC_START;
+    _buffered     = 0;
+    _readStep     = 0;
+    _readOffset   = FLASH_LOG_SECTOR_HEADER_BYTES;
+    _pendingCount = 0;
+    _droppedCount = 0;
+}
+// Destructor
+FlashLog::~FlashLog() {}
+
+
+bool FlashLog::begin(void) {
+    _begun = false;
+    if (_device == NULL || !_device->begin()) {
+        PRINTOUT(F("Flash for the fallback log did not respond!"));
+        return false;
+    }
+    _sectorSize   = _device->getSectorSize();
+    _sectorCount  = _device->getSectorCount();
+    _pendingCount = 0;
+    _recording    = false;
+
+    // The sector with the highest sequence number is the one being written
+    bool foundHead = false;
+    for (uint16_t sector = 0; sector < _sectorCount; sector++) {
+        uint32_t sequence;
+        if (!isStarted(sector, &sequence)) { continue; }
+        _pendingCount += countPending(sector);
+        if (!foundHead || sequence > _headSequence) {
+            _headSector   = sector;
+            _headSequence = sequence;
+            foundHead     = true;
+        }
+    }
+
+    if (!foundHead) {
+        // Nothing written yet; the first record will start sector 0
+        _headSector   = _sectorCount - 1;
+        _headSequence = 0;
+        _writeOffset  = _sectorSize;
+    } else {
+        // Pick up after the last whole record, but only if nothing at all has
+        // been written past it - a power cut may have left a line without its
+        // header.
+        uint16_t end;
+        countPending(_headSector, &end);
+        _writeOffset = end;
+        uint8_t chunk[16];
+        for (uint16_t offset = end; offset < _sectorSize;
+             offset += sizeof(chunk)) {
+            uint16_t length = _sectorSize - offset;
+            if (length > sizeof(chunk)) { length = sizeof(chunk); }
+            _device->read(address(_headSector, offset), chunk, length);
+            for (uint16_t i = 0; i < length; i++) {
+                if (chunk[i] != 0xFF) { _writeOffset = _sectorSize; }
+            }
+            if (_writeOffset == _sectorSize) { break; }
+        }
+    }
+    _device->sleep();
+    _begun = true;
+    rewind();
+    MS_DBG(F("Flash log has"), _pendingCount, F("lines waiting in"),
+           _sectorCount, F("sectors"));
+    return true;
+}
+
+
+bool FlashLog::beginRecord(void) {
+    if (!_begun) { return false; }
+    if (_writeOffset + FLASH_LOG_RECORD_HEADER_BYTES + MS_FLASH_LOG_MAX_RECORD >
+        _sectorSize) {
+        if (!startSector()) { return false; }
+    }
+    // The header is left blank until the line is done
+    _recordStart  = _writeOffset;
+    _writeOffset  = _recordStart + FLASH_LOG_RECORD_HEADER_BYTES;
+    _recordLength = 0;
+    _recordCRC    = FLASH_LOG_CRC_START;
+    _buffered     = 0;
+    _recording    = true;
+    return true;
+}
+
+
+bool FlashLog::endRecord(void) {
+    if (!_recording) { return false; }
+    _recording = false;
+    bool success = flushBuffer();
+
+    if (!success || _recordLength == 0 ||
+        _recordLength > MS_FLASH_LOG_MAX_RECORD) {
+        MS_DBG(F("Discarding a flash log line of"), _recordLength,
+               F("characters"));
+        // Mark it moved, so it will be skipped over
+        uint8_t header[FLASH_LOG_RECORD_HEADER_BYTES] = {
+            FLASH_LOG_STATE_MOVED, 0, 0, 0, 0};
+        uint16_t length = _recordLength > MS_FLASH_LOG_MAX_RECORD
+            ? MS_FLASH_LOG_MAX_RECORD
+            : _recordLength;
+        header[1] = length & 0xFF;
+        header[2] = length >> 8;
+        _device->program(address(_headSector, _recordStart), header,
+                         FLASH_LOG_RECORD_HEADER_BYTES);
+        _writeOffset = _recordStart + FLASH_LOG_RECORD_HEADER_BYTES + length;
+        _device->sleep();
+        return false;
+    }
+
+    // Write the length and CRC, then commit the record
+    uint8_t lengthAndCRC[4] = {
+        (uint8_t)(_recordLength & 0xFF), (uint8_t)(_recordLength >> 8),
+        (uint8_t)(_recordCRC & 0xFF), (uint8_t)(_recordCRC >> 8)};
+    success = _device->program(address(_headSector, _recordStart + 1),
+                               lengthAndCRC, sizeof(lengthAndCRC)) &&
+        setState(_headSector, _recordStart, FLASH_LOG_STATE_COMMITTED);
+    _device->sleep();
+    if (success) { _pendingCount++; }
+    return success;
+}
+
+
+size_t FlashLog::write(uint8_t c) {
+    // Each record is a single line, so line endings are dropped
+    if (!_recording || c == '\r' || c == '\n') { return 0; }
+    // Keep counting past the limit, so endRecord() knows to drop the line
+    if (_recordLength++ >= MS_FLASH_LOG_MAX_RECORD) { return 0; }
+    _recordCRC           = updateCRC(_recordCRC, c);
+    _buffer[_buffered++] = c;
+    if (_buffered == MS_FLASH_LOG_WRITE_BUFFER) { flushBuffer(); }
+    return 1;
+}
+
+
+void FlashLog::rewind(void) {
+    _readStep   = 0;
+    _readOffset = FLASH_LOG_SECTOR_HEADER_BYTES;
+}
+
+
+uint16_t FlashLog::readRecord(char* buffer, uint16_t size) {
+    if (!_begun || size == 0) { return 0; }
+    uint32_t start;
+    uint16_t length;
+    uint16_t crc;
+    while (nextRecord(size - 1, &start, &length, &crc)) {
+        _device->read(start, (uint8_t*)buffer, length);
+        buffer[length]     = '\0';
+        uint16_t actualCRC = FLASH_LOG_CRC_START;
+        for (uint16_t i = 0; i < length; i++) {
+            actualCRC = updateCRC(actualCRC, buffer[i]);
+        }
+        if (actualCRC == crc) {
+            _device->sleep();
+            return length;
+        }
+        MS_DBG(F("Skipping a flash log line with a bad CRC"));
+    }
+    _device->sleep();
+    return 0;
+}
+
+
+uint16_t FlashLog::readRecord(Print* stream) {
+    if (!_begun) { return 0; }
+    uint8_t  chunk[FLASH_LOG_READ_CHUNK];
+    uint32_t start;
+    uint16_t length;
+    uint16_t crc;
+    while (nextRecord(MS_FLASH_LOG_MAX_RECORD, &start, &length, &crc)) {
+        // Check the whole line before any of it is copied
+        uint16_t actualCRC = FLASH_LOG_CRC_START;
+        for (uint16_t done = 0; done < length; done += sizeof(chunk)) {
+            uint16_t count = length - done;
+            if (count > sizeof(chunk)) { count = sizeof(chunk); }
+            _device->read(start + done, chunk, count);
+            for (uint16_t i = 0; i < count; i++) {
+                actualCRC = updateCRC(actualCRC, chunk[i]);
+            }
+        }
+        if (actualCRC != crc) {
+            MS_DBG(F("Skipping a flash log line with a bad CRC"));
+            continue;
+        }
+        for (uint16_t done = 0; done < length; done += sizeof(chunk)) {
+            uint16_t count = length - done;
+            if (count > sizeof(chunk)) { count = sizeof(chunk); }
+            _device->read(start + done, chunk, count);
+            stream->write(chunk, count);
+        }
+        _device->sleep();
+        return length;
+    }
+    _device->sleep();
+    return 0;
+}
+
+
+bool FlashLog::nextRecord(uint16_t maxLength, uint32_t* start,
+                          uint16_t* length, uint16_t* crc) {
+    // The oldest sector is the one after the head
+    while (_readStep < _sectorCount) {
+        uint16_t sector = (_headSector + 1 + _readStep) % _sectorCount;
+        bool     isHead = _readStep == _sectorCount - 1;
+        uint8_t  state;
+        if ((isHead && _readOffset >= _writeOffset) || !isStarted(sector) ||
+            checkRecord(sector, _readOffset, &state, length, crc) !=
+                FLASH_LOG_RECORD_OK) {
+            if (isHead) { break; }
+            _readStep++;
+            _readOffset = FLASH_LOG_SECTOR_HEADER_BYTES;
+            continue;
+        }
+
+        uint16_t offset = _readOffset;
+        _readOffset += FLASH_LOG_RECORD_HEADER_BYTES + *length;
+        if (state != FLASH_LOG_STATE_COMMITTED || *length > maxLength) {
+            continue;
+        }
+        *start = address(sector, offset + FLASH_LOG_RECORD_HEADER_BYTES);
+        return true;
+    }
+    return false;
+}
+
+
+void FlashLog::markRead(void) {
+    if (!_begun) { return; }
+    for (uint16_t step = 0; step <= _readStep && step < _sectorCount;
+         step++) {
+        uint16_t sector = (_headSector + 1 + step) % _sectorCount;
+        if (!isStarted(sector)) { continue; }
+        uint16_t offset = FLASH_LOG_SECTOR_HEADER_BYTES;
+        uint8_t  state;
+        uint16_t length;
+        uint16_t crc;
+        while ((step < _readStep || offset < _readOffset) &&
+               checkRecord(sector, offset, &state, &length, &crc) ==
+                   FLASH_LOG_RECORD_OK) {
+            if (state == FLASH_LOG_STATE_COMMITTED &&
+                setState(sector, offset, FLASH_LOG_STATE_MOVED) &&
+                _pendingCount > 0) {
+                _pendingCount--;
+            }
+            offset += FLASH_LOG_RECORD_HEADER_BYTES + length;
+        }
+    }
+    _device->sleep();
+    rewind();
+}
+
+
+uint32_t FlashLog::address(uint16_t sector, uint16_t offset) {
+    return (uint32_t)sector * _sectorSize + offset;
+}
+
+
+bool FlashLog::isStarted(uint16_t sector, uint32_t* sequence) {
+    uint8_t header[6];
+    _device->read(address(sector, 0), header, sizeof(header));
+    if ((header[0] | header[1] << 8) != FLASH_LOG_MAGIC) { return false; }
+    if (sequence != NULL) {
+        *sequence = (uint32_t)header[2] | (uint32_t)header[3] << 8 |
+            (uint32_t)header[4] << 16 | (uint32_t)header[5] << 24;
+    }
+    return true;
+}
+
+
+uint8_t FlashLog::checkRecord(uint16_t sector, uint16_t offset,
+                              uint8_t* state, uint16_t* length,
+                              uint16_t* crc) {
+    if (offset + FLASH_LOG_RECORD_HEADER_BYTES > _sectorSize) {
+        return FLASH_LOG_RECORD_END;
+    }
+    uint8_t header[FLASH_LOG_RECORD_HEADER_BYTES];
+    _device->read(address(sector, offset), header, sizeof(header));
+    *state  = header[0];
+    *length = header[1] | header[2] << 8;
+    *crc    = header[3] | header[4] << 8;
+    if (*state == FLASH_LOG_STATE_BLANK && *length == 0xFFFF &&
+        *crc == 0xFFFF) {
+        return FLASH_LOG_RECORD_END;
+    }
+    // A record that was never committed, or whose length can't be right, was
+    // cut off; nothing after it in the sector can be trusted
+    if (*state == FLASH_LOG_STATE_BLANK || *length > MS_FLASH_LOG_MAX_RECORD ||
+        offset + FLASH_LOG_RECORD_HEADER_BYTES + *length > _sectorSize) {
+        return FLASH_LOG_RECORD_TORN;
+    }
+    return FLASH_LOG_RECORD_OK;
+}
+
+
+uint16_t FlashLog::countPending(uint16_t sector, uint16_t* end) {
+    uint16_t count  = 0;
+    uint16_t offset = FLASH_LOG_SECTOR_HEADER_BYTES;
+    uint8_t  state;
+    uint16_t length;
+    uint16_t crc;
+    uint8_t  found;
+    while ((found = checkRecord(sector, offset, &state, &length, &crc)) ==
+           FLASH_LOG_RECORD_OK) {
+        if (state == FLASH_LOG_STATE_COMMITTED) { count++; }
+        offset += FLASH_LOG_RECORD_HEADER_BYTES + length;
+    }
+    if (end != NULL) {
+        *end = found == FLASH_LOG_RECORD_TORN ? _sectorSize : offset;
+    }
+    return count;
+}
+
+
+bool FlashLog::startSector(void) {
+    uint16_t next = (_headSector + 1) % _sectorCount;
+    // The next sector is the oldest; anything still waiting in it is lost
+    if (isStarted(next)) {
+        uint16_t lost = countPending(next);
+        if (lost > 0) {
+            PRINTOUT(F("Flash log is full;"), lost,
+                     F("lines that were never moved are lost"));
+            _droppedCount += lost;
+            _pendingCount -= lost < _pendingCount ? lost : _pendingCount;
+        }
+    }
+    // Clear the magic number first; if the erase is cut off part way, what is
+    // left of the sector must not look like a started one
+    uint8_t cleared[2] = {0, 0};
+    _device->program(address(next, 0), cleared, sizeof(cleared));
+    if (!_device->eraseSector(address(next, 0))) {
+        MS_DBG(F("Unable to erase flash log sector"), next);
+        return false;
+    }
+    uint32_t sequence                              = _headSequence + 1;
+    uint8_t  header[FLASH_LOG_SECTOR_HEADER_BYTES] = {
+        FLASH_LOG_MAGIC & 0xFF,     FLASH_LOG_MAGIC >> 8,
+        (uint8_t)(sequence & 0xFF), (uint8_t)(sequence >> 8),
+        (uint8_t)(sequence >> 16),  (uint8_t)(sequence >> 24),
+        0xFF,                       0xFF};
+    // The magic number goes last, so a sector whose sequence number was cut
+    // off part way never looks started; a half written sequence number would
+    // be far too high and make it the head
+    if (!_device->program(address(next, 2), header + 2, sizeof(header) - 2) ||
+        !_device->program(address(next, 0), header, 2)) {
+        return false;
+    }
+    _headSector   = next;
+    _headSequence = sequence;
+    _writeOffset  = FLASH_LOG_SECTOR_HEADER_BYTES;
+    // The reading order depends on the head, so start reading over
+    rewind();
+    return true;
+}
+
+
+bool FlashLog::flushBuffer(void) {
+    if (_buffered == 0) { return true; }
+    bool success = _device->program(address(_headSector, _writeOffset),
+                                    _buffer, _buffered);
+    _writeOffset += _buffered;
+    _buffered = 0;
+    return success;
+}
+
+
+bool FlashLog::setState(uint16_t sector, uint16_t offset, uint8_t state) {
+    return _device->program(address(sector, offset), &state, 1);
+}
+
+
+uint16_t FlashLog::updateCRC(uint16_t crc, uint8_t data) {
+    crc ^= (uint16_t)data << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
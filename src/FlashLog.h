@@ -0,0 +1,456 @@
+/**
+ * @file FlashLog.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the FlashDevice and FlashLog classes, which keep data lines
+ * in flash memory while the SD card cannot be written.
+ *
+ * SD cards are the most common failure in the field.  Without somewhere else
+ * to put them, every line logged while the card is missing or broken is lost.
+ * When a FlashLog is given to Logger::setFallbackLog(), lines that can't be
+ * written to the SD card go into the flash instead.  Once the card can be
+ * written again, those lines are copied into the data file, ahead of the new
+ * line, and marked as moved.
+ *
+ * The flash is used as a ring of sectors, each written from start to end and
+ * only erased when the ring comes back around to it.  That spreads the erases
+ * evenly over every sector.  When the ring is full, the oldest sector is
+ * erased and the lines that had not been moved yet are lost.
+ *
+ * Flash bits can only be changed from 1 to 0 without an erase, so each line is
+ * written in a way that a power cut can't leave a half-written line looking
+ * whole:
+ * - the line is written after a blank record header
+ * - its length and a CRC are written into the header
+ * - finally, one bit of the header's state byte is cleared to commit it.
+ *
+ * When the log is started, a record that was never committed closes its
+ * sector, and writing picks up in the next one.  Moving a line to the SD card
+ * clears one more bit of the state byte.  A power cut between writing the SD
+ * card and marking the lines can only cause lines to be copied twice, never
+ * lost.
+ *
+ * The flash itself is reached through a FlashDevice; see SPIFlash.h for SPI
+ * NOR flash chips.
+ */
+
+// Header Guards
+#ifndef SRC_FLASHLOG_H_
+#define SRC_FLASHLOG_H_
+
+// Debugging Statement
+// #define MS_FLASHLOG_DEBUG
+
+#ifdef MS_FLASHLOG_DEBUG
+#define MS_DEBUGGING_STD "FlashLog"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+
+/**
+ * @brief The longest line kept in the flash log, in characters.  Longer lines
+ * are dropped.
+ *
+ * This can be changed by setting the build flag MS_FLASH_LOG_MAX_RECORD when
+ * compiling.
+ */
+#ifndef MS_FLASH_LOG_MAX_RECORD
+#define MS_FLASH_LOG_MAX_RECORD 250
+#endif
+/**
+ * @brief The number of bytes gathered in RAM before they are written to the
+ * flash.
+ *
+ * This can be changed by setting the build flag MS_FLASH_LOG_WRITE_BUFFER
+ * when compiling.
+ */
+#ifndef MS_FLASH_LOG_WRITE_BUFFER
+#define MS_FLASH_LOG_WRITE_BUFFER 32
+#endif
+/**
+ * @brief The most lines moved from the flash log to the SD card in one
+ * logging cycle.
+ *
+ * After a long outage the log can hold thousands of lines.  Moving them a
+ * batch at a time keeps each cycle short; the rest wait for the next cycles.
+ *
+ * This can be changed by setting the build flag MS_FLASH_LOG_COPY_LINES when
+ * compiling.
+ */
+#ifndef MS_FLASH_LOG_COPY_LINES
+#define MS_FLASH_LOG_COPY_LINES 50
+#endif
+
+/**
+ * @brief The FlashDevice class is the interface to a flash memory used by a
+ * FlashLog.
+ *
+ * Addresses start at 0 for the first byte given to the log.  A device must
+ * only ever clear bits when programming, and set a whole sector back to 0xFF
+ * when erasing it.
+ *
+ * @ingroup base_classes
+ */
+class FlashDevice {
+ public:
+    /**
+     * @brief Destroy the Flash Device object - no action taken.
+     */
+    virtual ~FlashDevice() {}
+
+    /**
+     * @brief Start communication with the flash.
+     *
+     * @return **bool** True if the flash answered.
+     */
+    virtual bool begin(void) = 0;
+    /**
+     * @brief Read bytes from the flash.
+     *
+     * @param address The address of the first byte
+     * @param data The buffer to read into
+     * @param length The number of bytes
+     */
+    virtual void read(uint32_t address, uint8_t* data, uint16_t length) = 0;
+    /**
+     * @brief Program bytes into the flash.  Bytes can only be programmed once
+     * after each erase.
+     *
+     * @param address The address of the first byte
+     * @param data The bytes to program
+     * @param length The number of bytes
+     * @return **bool** True if the bytes were programmed.
+     */
+    virtual bool program(uint32_t address, const uint8_t* data,
+                         uint16_t length) = 0;
+    /**
+     * @brief Erase one sector.
+     *
+     * @param address The address of the first byte of the sector
+     * @return **bool** True if the sector was erased.
+     */
+    virtual bool eraseSector(uint32_t address) = 0;
+    /**
+     * @brief Put the flash into its lowest power state until the next read,
+     * program, or erase.
+     */
+    virtual void sleep(void) {}
+
+    /**
+     * @brief Get the size of a sector.
+     *
+     * @return **uint16_t** The number of bytes in a sector
+     */
+    virtual uint16_t getSectorSize(void) = 0;
+    /**
+     * @brief Get the number of sectors given to the log.
+     *
+     * @return **uint16_t** The number of sectors; at least 2.
+     */
+    virtual uint16_t getSectorCount(void) = 0;
+};
+
+
+/**
+ * @brief The FlashLog class keeps lines of data in a ring of flash sectors
+ * until they can be moved to the SD card.
+ *
+ * A line is written by calling beginRecord(), printing the line to the
+ * FlashLog like to any other stream, and calling endRecord().  Lines are read
+ * back in the order they were written with readRecord(), and marked as moved
+ * with markRead().
+ *
+ * @ingroup base_classes
+ */
+class FlashLog : public Stream {
+ public:
+    /**
+     * @brief Construct a new Flash Log object.
+     *
+     * @param device The flash to keep the log in
+     */
+    explicit FlashLog(FlashDevice* device);
+    /**
+     * @brief Destroy the Flash Log object - no action taken.
+     */
+    virtual ~FlashLog();
+
+    /**
+     * @brief Start the flash and find where the log left off.
+     *
+     * @return **bool** True if the flash answered.
+     */
+    bool begin(void);
+
+    /**
+     * @brief Start a new line.
+     *
+     * If there isn't room for a line of #MS_FLASH_LOG_MAX_RECORD characters
+     * left in the current sector, this moves on to the next sector, erasing
+     * it.
+     *
+     * @return **bool** True if the line was started.
+     */
+    bool beginRecord(void);
+    /**
+     * @brief Finish and commit the line started by beginRecord().
+     *
+     * @return **bool** True if the line was kept; false if it was empty, too
+     * long, or couldn't be written.
+     */
+    bool endRecord(void);
+
+    /**
+     * @brief Add a character to the current line.
+     *
+     * Carriage returns and new lines are dropped; each record is one line.
+     *
+     * @param c The character
+     * @return **size_t** 1 if the character was added
+     */
+    size_t write(uint8_t c) override;
+    using Print::write;
+    /**
+     * @brief The log can't be read as a stream; use readRecord().
+     *
+     * @return **int** Always 0
+     */
+    int available(void) override {
+        return 0;
+    }
+    /**
+     * @brief The log can't be read as a stream; use readRecord().
+     *
+     * @return **int** Always -1
+     */
+    int read(void) override {
+        return -1;
+    }
+    /**
+     * @brief The log can't be read as a stream; use readRecord().
+     *
+     * @return **int** Always -1
+     */
+    int peek(void) override {
+        return -1;
+    }
+
+    /**
+     * @brief Check whether there are lines that haven't been moved yet.
+     *
+     * @return **bool** True if there are lines waiting.
+     */
+    bool hasRecords(void) {
+        return _pendingCount > 0;
+    }
+    /**
+     * @brief Get the number of lines that haven't been moved yet.
+     *
+     * @return **uint16_t** The number of lines waiting
+     */
+    uint16_t getRecordCount(void) {
+        return _pendingCount;
+    }
+    /**
+     * @brief Get the number of lines lost because the ring filled before they
+     * were moved.
+     *
+     * @return **uint16_t** The number of lines lost since begin()
+     */
+    uint16_t getDroppedCount(void) {
+        return _droppedCount;
+    }
+
+    /**
+     * @brief Go back to reading from the oldest line that hasn't been moved.
+     */
+    void rewind(void);
+    /**
+     * @brief Read the next line that hasn't been moved.
+     *
+     * Lines that fail their CRC are skipped.
+     *
+     * @param buffer The buffer to copy the line into; the line is ended with a
+     * NULL.
+     * @param size The size of the buffer; at least #MS_FLASH_LOG_MAX_RECORD +
+     * 1
+     * @return **uint16_t** The length of the line; 0 once there are no more.
+     */
+    uint16_t readRecord(char* buffer, uint16_t size);
+    /**
+     * @brief Copy the next line that hasn't been moved straight to a stream,
+     * such as a file, without a buffer for the whole line.
+     *
+     * The line is read from the flash a little at a time, once to check its
+     * CRC and again to copy it, so nothing is copied from a line that fails.
+     * Lines that fail their CRC are skipped.  No newline is added.
+     *
+     * @param stream The stream to copy the line to
+     * @return **uint16_t** The length of the line; 0 once there are no more.
+     */
+    uint16_t readRecord(Print* stream);
+    /**
+     * @brief Mark every line read since the last rewind() as moved, and
+     * rewind.
+     */
+    void markRead(void);
+
+ protected:
+    /**
+     * @brief Internal reference to the flash
+     */
+    FlashDevice* _device;
+    /**
+     * @brief The number of bytes in each sector
+     */
+    uint16_t _sectorSize;
+    /**
+     * @brief The number of sectors in the ring
+     */
+    uint16_t _sectorCount;
+    /**
+     * @brief True once the flash has answered.
+     */
+    bool _begun;
+
+    /**
+     * @brief The sector being written
+     */
+    uint16_t _headSector;
+    /**
+     * @brief The sequence number of the sector being written; each sector
+     * started gets the next number.
+     */
+    uint32_t _headSequence;
+    /**
+     * @brief The offset of the next byte to write in the head sector
+     */
+    uint16_t _writeOffset;
+
+    /**
+     * @brief True between beginRecord() and endRecord()
+     */
+    bool _recording;
+    /**
+     * @brief The offset of the header of the line being written
+     */
+    uint16_t _recordStart;
+    /**
+     * @brief The number of characters in the line being written
+     */
+    uint16_t _recordLength;
+    /**
+     * @brief The CRC of the line being written, so far
+     */
+    uint16_t _recordCRC;
+    /**
+     * @brief Bytes waiting to be written to the flash
+     */
+    uint8_t _buffer[MS_FLASH_LOG_WRITE_BUFFER];
+    /**
+     * @brief The number of bytes in #_buffer
+     */
+    uint8_t _buffered;
+
+    /**
+     * @brief The number of sectors past the oldest that the reading has
+     * reached
+     */
+    uint16_t _readStep;
+    /**
+     * @brief The offset of the next record to read in that sector
+     */
+    uint16_t _readOffset;
+
+    /**
+     * @brief The number of lines waiting to be moved
+     */
+    uint16_t _pendingCount;
+    /**
+     * @brief The number of lines lost when the ring filled
+     */
+    uint16_t _droppedCount;
+
+    /**
+     * @brief Get the address of a byte in a sector.
+     *
+     * @param sector The sector
+     * @param offset The offset of the byte in the sector
+     * @return **uint32_t** The address in the flash
+     */
+    uint32_t address(uint16_t sector, uint16_t offset);
+    /**
+     * @brief Check whether a sector has been started by the log.
+     *
+     * @param sector The sector
+     * @param sequence Filled with the sector's sequence number; optional
+     * @return **bool** True if the sector has a valid header.
+     */
+    bool isStarted(uint16_t sector, uint32_t* sequence = NULL);
+    /**
+     * @brief Read and check the header of the record at an offset.
+     *
+     * @param sector The sector
+     * @param offset The offset of the record
+     * @param state Filled with the record's state byte
+     * @param length Filled with the length of the line
+     * @param crc Filled with the CRC of the line
+     * @return **uint8_t** Whether the record is whole, missing, or torn
+     */
+    uint8_t checkRecord(uint16_t sector, uint16_t offset, uint8_t* state,
+                        uint16_t* length, uint16_t* crc);
+    /**
+     * @brief Find the next line that hasn't been moved and move the reading
+     * past it.
+     *
+     * @param maxLength The longest line wanted; longer lines are skipped
+     * @param start Filled with the address of the line in the flash
+     * @param length Filled with the length of the line
+     * @param crc Filled with the CRC of the line
+     * @return **bool** True if there was a line.
+     */
+    bool nextRecord(uint16_t maxLength, uint32_t* start, uint16_t* length,
+                    uint16_t* crc);
+    /**
+     * @brief Count the lines waiting to be moved in a sector.
+     *
+     * @param sector The sector
+     * @param end Filled with the offset where the records stop; optional
+     * @return **uint16_t** The number of lines waiting
+     */
+    uint16_t countPending(uint16_t sector, uint16_t* end = NULL);
+    /**
+     * @brief Erase the next sector in the ring and start writing in it.
+     *
+     * @return **bool** True if the sector was started.
+     */
+    bool startSector(void);
+    /**
+     * @brief Write out the bytes in #_buffer.
+     *
+     * @return **bool** True if the bytes were written.
+     */
+    bool flushBuffer(void);
+    /**
+     * @brief Set a record's state byte.
+     *
+     * @param sector The sector
+     * @param offset The offset of the record
+     * @param state The new state
+     * @return **bool** True if the state was written.
+     */
+    bool setState(uint16_t sector, uint16_t offset, uint8_t state);
+    /**
+     * @brief Add a byte to a CRC-16/CCITT.
+     *
+     * @param crc The CRC so far
+     * @param data The byte
+     * @return **uint16_t** The new CRC
+     */
+    static uint16_t updateCRC(uint16_t crc, uint8_t data);
+};
+
+#endif  // SRC_FLASHLOG_H_
@@ -21,6 +21,51 @@
 // For all i2c communication, including with the real time clock
 #include <Wire.h>
 
+#if defined MS_SAMD_DS3231 || not defined ARDUINO_ARCH_SAMD
+/// The I2C address of the DS3231 real time clock
+#define DS3231_I2C_ADDRESS 0x68
+/// The DS3231 register holding the day/date match for alarm 1
+#define DS3231_ALARM1_DATE_REG 0x0A
+#endif
+
+// Linker symbols used to work out how RAM is being used
+#if defined(__AVR__)
+extern int   __heap_start;
+extern char* __brkval;
+#if defined(MS_MEMORY_REPORT)
+/// The value free RAM is painted with at boot to find the stack high-water
+#define MS_STACK_CANARY 0xC5
+/// Turn the value of a macro into a string, for use in inline assembly
+#define MS_ASM_STRING(x) MS_ASM_STRING_(x)
+/// Helper for MS_ASM_STRING() - turns the macro's text into a string
+#define MS_ASM_STRING_(x) #x
+extern uint8_t _end;
+extern uint8_t __stack;
+// Paint all of the RAM between the end of the static data and the top of the
+// stack with the canary value.  This runs in .init1, before the stack is used
+// and before any constructors, so it must not call anything or use the stack.
+void paintStackCanary(void) __attribute__((naked, used, section(".init1")));
+void paintStackCanary(void) {
+    __asm volatile(
+        "    ldi r30, lo8(_end)\n"
+        "    ldi r31, hi8(_end)\n"
+        "    ldi r24, lo8(" MS_ASM_STRING(MS_STACK_CANARY) ")\n"
+        "    ldi r25, hi8(__stack)\n"
+        "    rjmp 2f\n"
+        "1:  st Z+, r24\n"
+        "2:  cpi r30, lo8(__stack)\n"
+        "    cpc r31, r25\n"
+        "    brlo 1b\n"
+        "    breq 1b" ::);
+}
+#endif
+#elif defined(ARDUINO_ARCH_SAMD)
+extern "C" char* sbrk(int incr);
+extern uint32_t  __data_start__;
+extern uint32_t  __bss_end__;
+extern uint32_t  __end__;
+#endif
+
 
 // Initialize the static timezone
 int8_t Logger::_loggerTimeZone = 0;
@@ -29,6 +74,24 @@ int8_t Logger::_loggerRTCOffset = 0;
 // Initialize the static timestamps
 uint32_t Logger::markedEpochTime    = 0;
 uint32_t Logger::markedEpochTimeUTC = 0;
+uint16_t Logger::markedMillis       = 0;
+#if defined MS_MILLISECOND_TIMESTAMPS
+// Initialize the tie between the processor millis and the RTC
+volatile uint32_t Logger::_secondEdgeMillis   = 0;
+uint32_t          Logger::_secondEdgeEpoch    = 0;
+volatile bool     Logger::_secondEdgeCaptured = false;
+bool              Logger::_secondEdgeKnown    = false;
+#endif
+// Initialize the static calendars
+CalendarCache Logger::_markedCalendar;
+CalendarCache Logger::_clockCalendar;
+
+// Whether the fraction of a second is printed with timestamps
+#if defined MS_MILLISECOND_TIMESTAMPS
+#define LOGGER_PRINT_MILLIS true
+#else
+#define LOGGER_PRINT_MILLIS false
+#endif
 // Initialize the testing/logging flags
 volatile bool Logger::isLoggingNow = false;
 volatile bool Logger::isTestingNow = false;
@@ -70,6 +133,32 @@ Logger::Logger(const char* loggerID, uint16_t loggingIntervalMinutes,
     // Start with no modem attached
     _logModem = NULL;
 
+    // Start with the board's datasheet currents, if they are known
+    _awakeCurrent_mA     = LOGGER_AWAKE_CURRENT_MA;
+    _sleepCurrent_mA     = LOGGER_SLEEP_CURRENT_MA;
+    _boardChargeUsed_mAh = 0;
+    _awakeTime_ms        = 0;
+    _millisWoke          = 0;
+
+    // The SD card hasn't been powered yet
+    _millisSDCardOn     = 0;
+    _SDCardOnTime_ms    = 0;
+    _SDCardTimeSaved_ms = 0;
+
+    // Start with no fallback for the SD card
+    _flashLog = NULL;
+
+    // Start with no records kept for the publishers
+    _cacheCount = 0;
+    _replaySlot = -1;
+
+    // Start with no power policy
+    _batteryVar = NULL;
+    setPowerTierThresholds(MS_POWER_SD_ONLY_V, MS_POWER_REDUCED_V,
+                           MS_POWER_CRITICAL_V, MS_POWER_HYSTERESIS_V);
+    _reducedIntervalMultiplier = MS_POWER_REDUCED_MULTIPLIER;
+    _powerTier                 = POWER_TIER_FULL;
+
     // Clear arrays
     for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
         dataPublishers[i] = NULL;
@@ -105,6 +194,32 @@ Logger::Logger(const char* loggerID, uint16_t loggingIntervalMinutes,
     // Start with no modem attached
     _logModem = NULL;
 
+    // Start with the board's datasheet currents, if they are known
+    _awakeCurrent_mA     = LOGGER_AWAKE_CURRENT_MA;
+    _sleepCurrent_mA     = LOGGER_SLEEP_CURRENT_MA;
+    _boardChargeUsed_mAh = 0;
+    _awakeTime_ms        = 0;
+    _millisWoke          = 0;
+
+    // The SD card hasn't been powered yet
+    _millisSDCardOn     = 0;
+    _SDCardOnTime_ms    = 0;
+    _SDCardTimeSaved_ms = 0;
+
+    // Start with no fallback for the SD card
+    _flashLog = NULL;
+
+    // Start with no records kept for the publishers
+    _cacheCount = 0;
+    _replaySlot = -1;
+
+    // Start with no power policy
+    _batteryVar = NULL;
+    setPowerTierThresholds(MS_POWER_SD_ONLY_V, MS_POWER_REDUCED_V,
+                           MS_POWER_CRITICAL_V, MS_POWER_HYSTERESIS_V);
+    _reducedIntervalMultiplier = MS_POWER_REDUCED_MULTIPLIER;
+    _powerTier                 = POWER_TIER_FULL;
+
     // Clear arrays
     for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
         dataPublishers[i] = NULL;
@@ -134,6 +249,35 @@ Logger::Logger() {
     // Start with no modem attached
     _logModem = NULL;
 
+    // Start with no variable array
+    _internalArray = NULL;
+
+    // Start with the board's datasheet currents, if they are known
+    _awakeCurrent_mA     = LOGGER_AWAKE_CURRENT_MA;
+    _sleepCurrent_mA     = LOGGER_SLEEP_CURRENT_MA;
+    _boardChargeUsed_mAh = 0;
+    _awakeTime_ms        = 0;
+    _millisWoke          = 0;
+
+    // The SD card hasn't been powered yet
+    _millisSDCardOn     = 0;
+    _SDCardOnTime_ms    = 0;
+    _SDCardTimeSaved_ms = 0;
+
+    // Start with no fallback for the SD card
+    _flashLog = NULL;
+
+    // Start with no records kept for the publishers
+    _cacheCount = 0;
+    _replaySlot = -1;
+
+    // Start with no power policy
+    _batteryVar = NULL;
+    setPowerTierThresholds(MS_POWER_SD_ONLY_V, MS_POWER_REDUCED_V,
+                           MS_POWER_CRITICAL_V, MS_POWER_HYSTERESIS_V);
+    _reducedIntervalMultiplier = MS_POWER_REDUCED_MULTIPLIER;
+    _powerTier                 = POWER_TIER_FULL;
+
     // Clear arrays
     for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
         dataPublishers[i] = NULL;
@@ -178,23 +322,36 @@ void Logger::setSDCardPwr(int8_t SDCardPowerPin) {
 void Logger::turnOnSDcard(bool waitToSettle) {
     if (_SDCardPowerPin >= 0) {
         digitalWrite(_SDCardPowerPin, HIGH);
+        _millisSDCardOn = millis();
         // TODO(SRGDamia1):  figure out how long to wait
         if (waitToSettle) { delay(6); }
     }
 }
 void Logger::turnOffSDcard(bool waitForHousekeeping) {
     if (_SDCardPowerPin >= 0) {
+        if (waitForHousekeeping && sd.card() != NULL) {
+            // Specs say up to 1s for internal housekeeping after each write,
+            // but the card holds its data out line low only until it's done
+            uint32_t start = millis();
+            while (sd.card()->isBusy() &&
+                   millis() - start < MS_SD_BUSY_TIMEOUT_MS &&
+                   TaskWatch::yield()) {}
+            MS_DBG(F("SD card was busy for"), millis() - start,
+                   F("ms after writing"));
+        }
         // TODO(SRGDamia1): set All SPI pins to INPUT?
         // TODO(SRGDamia1): set ALL SPI pins HIGH (~30k pullup)
         pinMode(_SDCardPowerPin, OUTPUT);
         digitalWrite(_SDCardPowerPin, LOW);
-        // TODO(SRGDamia1):  wait in lower power mode
-        if (waitForHousekeeping) {
-            // Specs say up to 1s for internal housekeeping after each write
-            delay(1000);
-        }
+        _SDCardOnTime_ms = millis() - _millisSDCardOn;
     }
 }
+uint32_t Logger::getSDCardOnTime(void) {
+    return _SDCardOnTime_ms;
+}
+int32_t Logger::getSDCardTimeSaved(void) {
+    return _SDCardTimeSaved_ms;
+}
 
 
 // Sets up a pin for the slave select (chip select) of the SD card
@@ -264,6 +421,14 @@ void Logger::setLoggerPins(int8_t mcuWakePin, int8_t SDCardSSPin,
 // Assigns the variable array object
 void Logger::setVariableArray(VariableArray* inputArray) {
     _internalArray = inputArray;
+    // Records kept for another array don't fit this one, and the record
+    // numbers start over, so every publisher has to start over too
+    _cacheCount = 0;
+    for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
+        if (dataPublishers[i] != NULL) {
+            dataPublishers[i]->resetSentRecords();
+        }
+    }
 }
 
 
@@ -302,7 +467,19 @@ String Logger::getVarUUIDAtI(uint8_t position_i) {
 // This returns the current value of the variable as a string with the
 // correct number of significant figures
 String Logger::getValueStringAtI(uint8_t position_i) {
-    return _internalArray->arrayOfVars[position_i]->getValueString();
+    if (_replaySlot < 0) {
+        return _internalArray->arrayOfVars[position_i]->getValueString();
+    }
+    // Format a kept value the same way the variable formats its own
+    float value =
+        _cacheValues[_replaySlot * getArrayVarCount() + position_i];
+    uint8_t resolution =
+        _internalArray->arrayOfVars[position_i]->getResolution();
+    if (resolution == 0) {
+        return String(static_cast<int16_t>(value));
+    } else {
+        return String(value, resolution);
+    }
 }
 
 
@@ -369,17 +546,117 @@ void Logger::registerDataPublisher(dataPublisher* publisher) {
 
 void Logger::publishDataToRemotes(void) {
     MS_DBG(F("Sending out remote data."));
+    // Make sure the current values are among the records to send
+    cacheRecord();
 
     for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
-        if (dataPublishers[i] != NULL) {
-            PRINTOUT(F("\nSending data to ["), i, F("]"),
-                     dataPublishers[i]->getEndpoint());
-            // dataPublishers[i]->publishData(_logModem->getClient());
-            dataPublishers[i]->publishData();
-            watchDogTimer.resetWatchDog();
+        if (dataPublishers[i] == NULL) { continue; }
+        if (!dataPublishers[i]->isSendDue()) {
+            MS_DBG(F("Not yet time to send data to ["), i, F("]"));
+            continue;
         }
+        PRINTOUT(F("\nSending data to ["), i, F("]"),
+                 dataPublishers[i]->getEndpoint());
+        // Give each record kept its own share of time
+        uint32_t records = 1 + getNewestCachedRecord() -
+            getOldestCachedRecord();
+        MS_PROFILE_START(publishTimer);
+        TaskWatch::begin(F("Publishing"), MS_TASK_PUBLISH_MS * records);
+        dataPublishers[i]->publishCachedData();
+        TaskWatch::end();
+        MS_PROFILE_STOP(publishTimer, (profilerPhase)(PROFILE_PUBLISH_0 + i));
     }
 }
+
+
+// This checks if any publisher is due to send
+bool Logger::isPublishDue(void) {
+    bool hasPublishers = false;
+    for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
+        if (dataPublishers[i] == NULL) { continue; }
+        if (dataPublishers[i]->isSendDue()) { return true; }
+        hasPublishers = true;
+    }
+    return !hasPublishers;
+}
+
+
+// This checks if the clock is due to be synced at noon or isn't sane
+bool Logger::isClockSyncDue(void) {
+    return (Logger::markedEpochTime != 0 &&
+            Logger::markedEpochTime % 86400 == 43200) ||
+        !isRTCSane(Logger::markedEpochTime);
+}
+
+
+// This keeps the current values for the publishers that send in batches
+void Logger::cacheRecord(void) {
+    uint8_t capacity = getCacheCapacity();
+    if (capacity == 0) { return; }
+    // Only keep each marked time once
+    uint8_t slot = publishCacheSlot(_cacheCount, capacity);
+    if (_cacheCount > 0 && _cacheEpoch[slot] == Logger::markedEpochTime &&
+        _cacheMillis[slot] == Logger::markedMillis) {
+        return;
+    }
+    slot                 = publishCacheSlot(_cacheCount + 1, capacity);
+    _cacheEpoch[slot]    = Logger::markedEpochTime;
+    _cacheEpochUTC[slot] = Logger::markedEpochTimeUTC;
+    _cacheMillis[slot]   = Logger::markedMillis;
+    for (uint8_t i = 0; i < getArrayVarCount(); i++) {
+        _cacheValues[slot * getArrayVarCount() + i] =
+            _internalArray->arrayOfVars[i]->getValue();
+    }
+    _cacheCount++;
+}
+
+
+uint32_t Logger::getOldestCachedRecord(void) {
+    return publishCacheOldest(_cacheCount, getCacheCapacity());
+}
+
+
+uint32_t Logger::getNewestCachedRecord(void) {
+    return getCacheCapacity() == 0 ? 0 : _cacheCount;
+}
+
+
+// This swaps in the marked time and values of a kept record
+bool Logger::replayCachedRecord(uint32_t recordNumber) {
+    if (recordNumber == 0 || recordNumber < getOldestCachedRecord() ||
+        recordNumber > getNewestCachedRecord()) {
+        return false;
+    }
+    if (_replaySlot < 0) {
+        _liveEpoch    = Logger::markedEpochTime;
+        _liveEpochUTC = Logger::markedEpochTimeUTC;
+        _liveMillis   = Logger::markedMillis;
+    }
+    _replaySlot = publishCacheSlot(recordNumber, getCacheCapacity());
+
+    Logger::markedEpochTime    = _cacheEpoch[_replaySlot];
+    Logger::markedEpochTimeUTC = _cacheEpochUTC[_replaySlot];
+    Logger::markedMillis       = _cacheMillis[_replaySlot];
+    return true;
+}
+
+
+// This puts back the live marked time and values
+void Logger::endReplay(void) {
+    if (_replaySlot < 0) { return; }
+    _replaySlot                = -1;
+    Logger::markedEpochTime    = _liveEpoch;
+    Logger::markedEpochTimeUTC = _liveEpochUTC;
+    Logger::markedMillis       = _liveMillis;
+}
+
+
+// Protected helper function - This works out how many records fit in the cache
+uint8_t Logger::getCacheCapacity(void) {
+    if (_internalArray == NULL) { return 0; }
+    return publishCacheCapacity(getArrayVarCount(), MS_PUBLISH_CACHE_RECORDS,
+                                MS_PUBLISH_CACHE_VALUES);
+}
 void Logger::sendDataToRemotes(void) {
     publishDataToRemotes();
 }
@@ -531,9 +808,33 @@ String Logger::formatDateTime_ISO8601(DateTime& dt) {
 // It assumes the supplied date/time is in the LOGGER's timezone and adds
 // the LOGGER's offset as the time zone offset in the string.
 String Logger::formatDateTime_ISO8601(uint32_t epochTime) {
-    // Create a DateTime object from the epochTime
-    DateTime dt = dtFromEpoch(epochTime);
-    return formatDateTime_ISO8601(dt);
+    // The marked time has a calendar of its own, so that formatting other
+    // times in between doesn't throw its conversion away
+    CalendarCache& calendar = epochTime == Logger::markedEpochTime
+        ? _markedCalendar
+        : _clockCalendar;
+    return String(calendar.formatISO8601(epochTime, _loggerTimeZone));
+}
+
+
+// This converts an epoch time (unix time) and the millisecond within that
+// second into a ISO8601 formatted string
+String Logger::formatDateTime_ISO8601(uint32_t epochTime,
+                                      uint16_t milliseconds) {
+    CalendarCache& calendar = epochTime == Logger::markedEpochTime
+        ? _markedCalendar
+        : _clockCalendar;
+    return String(calendar.formatISO8601(epochTime, _loggerTimeZone,
+                                         milliseconds, LOGGER_PRINT_MILLIS));
+}
+
+
+// This returns the marked time as a ISO8601 formatted string, only building
+// the string once per marked time
+const char* Logger::formatMarkedTime_ISO8601(void) {
+    return _markedCalendar.formatISO8601(Logger::markedEpochTime,
+                                         _loggerTimeZone, Logger::markedMillis,
+                                         LOGGER_PRINT_MILLIS);
 }
 
 
@@ -565,6 +866,10 @@ bool Logger::setRTClock(uint32_t UTCEpochSeconds) {
     if (abs(set_logTZ - cur_logTZ) > 5) {
         setNowEpoch(set_rtcTZ);
         PRINTOUT(F("Clock set!"));
+#if defined MS_MILLISECOND_TIMESTAMPS
+        // Setting the clock moves the start of its seconds
+        syncMillisToRTC();
+#endif
         return true;
     } else {
         PRINTOUT(F("Clock already within 5 seconds of time."));
@@ -595,12 +900,60 @@ bool Logger::isRTCSane(uint32_t epochTime) {
 // sensor was updated, just a single marked time.  By custom, this should be
 // called before updating the sensors, not after.
 void Logger::markTime(void) {
-    Logger::markedEpochTime    = getNowEpoch();
+    Logger::markedEpochTime = getNowEpoch();
+    Logger::markedMillis    = 0;
+#if defined MS_MILLISECOND_TIMESTAMPS
+    if (_secondEdgeKnown) {
+        // Count the time from the start of a known RTC second.  The RTC
+        // second is always kept; only the milliseconds come from the count.
+        // The RTC may tick over between reading it and reading millis(), so
+        // when the count is one second off the milliseconds are clamped to
+        // the matching end of the RTC second.
+        uint32_t sinceEdge = millis() - _secondEdgeMillis;
+        uint32_t counted   = _secondEdgeEpoch + sinceEdge / 1000;
+        if (counted == markedEpochTime) {
+            Logger::markedMillis = sinceEdge % 1000;
+        } else if (counted + 1 == markedEpochTime) {
+            // The RTC second has only just started
+            Logger::markedMillis = 0;
+        } else if (counted == markedEpochTime + 1) {
+            // The RTC second was about to end
+            Logger::markedMillis = 999;
+        } else {
+            MS_DBG(F("The millisecond count has drifted from the RTC by"),
+                   (int32_t)(counted - markedEpochTime), F("s"));
+            _secondEdgeKnown = false;
+        }
+    }
+#endif
     Logger::markedEpochTimeUTC = markedEpochTime -
         ((uint32_t)_loggerRTCOffset) * 3600;
 }
 
 
+#if defined MS_MILLISECOND_TIMESTAMPS
+// This waits for the RTC second to change and notes the processor time it
+// happened
+bool Logger::syncMillisToRTC(void) {
+    uint32_t start = millis();
+    uint32_t first = getNowEpoch();
+    while (millis() - start < 1100) {
+        uint32_t now = getNowEpoch();
+        if (now != first) {
+            _secondEdgeMillis = millis();
+            _secondEdgeEpoch  = now;
+            _secondEdgeKnown  = true;
+            MS_DBG(F("RTC second"), now, F("started at"), _secondEdgeMillis,
+                   F("ms"));
+            return true;
+        }
+    }
+    MS_DBG(F("The RTC second did not change!"));
+    return false;
+}
+#endif
+
+
 // This checks to see if the CURRENT time is an even interval of the logging
 // rate
 bool Logger::checkInterval(void) {
@@ -693,6 +1046,14 @@ bool Logger::checkMarkedInterval(void) {
 }
 
 
+// This calculates the next even interval of the logging rate strictly after the
+// given time
+uint32_t Logger::getNextIntervalEpoch(uint32_t currentEpoch,
+                                      uint16_t intervalMinutes) {
+    return wakeAlarmNextInterval(currentEpoch, intervalMinutes);
+}
+
+
 // ============================================================================
 //  Public Functions for sleeping the logger
 // ============================================================================
@@ -703,28 +1064,132 @@ bool Logger::checkMarkedInterval(void) {
 // funcions.)
 void Logger::wakeISR(void) {
     // MS_DBG(F("\nClock interrupt!"));
+#if defined MS_MILLISECOND_TIMESTAMPS
+    // The clock alarm fires at the start of a second, so note when.  Only the
+    // first change counts; the pin changes again when the alarm is cleared.
+    if (!_secondEdgeCaptured) {
+        _secondEdgeMillis   = millis();
+        _secondEdgeCaptured = true;
+    }
+#endif
+}
+
+
+// Returns the time this logger next needs to wake, or 0 for every minute
+uint32_t Logger::getNextWakeEpoch(void) {
+    return wakeAlarmNextWake(getNowEpoch(), getTierLoggingInterval());
+}
+
+
+// Sets the clock alarm for the given time, or for every minute
+bool Logger::setWakeAlarm(uint32_t next_logTZ) {
+    uint32_t now_logTZ = getNowEpoch();
+    // If the clock isn't sane, the interval math is meaningless.  If the next
+    // interval is only a second or two away, it may pass before the alarm is
+    // written.  In both cases, fall back to waking every minute and using
+    // checkInterval().
+    uint32_t next_rtcTZ = wakeAlarmEpochAt(now_logTZ, next_logTZ,
+                                           isRTCSane(now_logTZ),
+                                           _loggerRTCOffset);
+    bool     exactAlarm = next_rtcTZ != 0;
+
+#if defined MS_SAMD_DS3231 || not defined ARDUINO_ARCH_SAMD
+
+    if (exactAlarm) {
+        MS_DBG(F("Setting alarm on DS3231 RTC for"),
+               formatDateTime_ISO8601(next_logTZ));
+        DateTime alarmDT = dtFromEpoch(next_rtcTZ);
+        // This sets alarm 1 to match the hour, minute, and second - and to
+        // ignore the date.
+        rtc.enableInterrupts(alarmDT.hour(), alarmDT.minute(),
+                             alarmDT.second());
+        // Overwrite the alarm 1 day/date register with the date (A1M4 = 0,
+        // DY/DT = 0) so the alarm matches on the full date and time.
+        Wire.beginTransmission(DS3231_I2C_ADDRESS);
+        Wire.write(DS3231_ALARM1_DATE_REG);
+        Wire.write(((alarmDT.date() / 10) << 4) | (alarmDT.date() % 10));
+        Wire.endTransmission();
+    }
+    // Make sure the interval didn't pass while we were setting the alarm
+    if (exactAlarm && getNowEpoch() >= next_logTZ) { exactAlarm = false; }
+    if (!exactAlarm) {
+        // Unfortunately, because of the way the alarm on the DS3231 is set up,
+        // it cannot interrupt repeatedly on any frequencies other than every
+        // second, minute, hour, day, or date.  When we can't set an alarm for
+        // the exact time of the next interval, we set the alarm for every
+        // minute and use the checkInterval function.
+        MS_DBG(F("Setting alarm on DS3231 RTC for every minute."));
+        rtc.enableInterrupts(EveryMinute);
+    }
+
+#elif defined ARDUINO_ARCH_SAMD
+
+    // Make sure interrupts are enabled for the clock
+    NVIC_EnableIRQ(RTC_IRQn);       // enable RTC interrupt
+    NVIC_SetPriority(RTC_IRQn, 0);  // highest priority
+
+    zero_sleep_rtc.attachInterrupt(wakeISR);
+    // We're setting the alarm to go off one second before the interval (or
+    // at 59 seconds past the minute) instead of on the interval itself
+    // because there seems to be a bit of a wake-up delay.
+    if (exactAlarm) {
+        MS_DBG(F("Setting alarm on SAMD built-in RTC for"),
+               formatDateTime_ISO8601(next_logTZ - 1));
+        zero_sleep_rtc.setAlarmEpoch(next_rtcTZ - 1);
+        zero_sleep_rtc.enableAlarm(zero_sleep_rtc.MATCH_YYMMDDHHMMSS);
+    }
+    // Make sure the alarm time didn't pass while we were setting the alarm
+    if (exactAlarm && getNowEpoch() >= next_logTZ - 1) { exactAlarm = false; }
+    if (!exactAlarm) {
+        MS_DBG(F("Setting alarm on SAMD built-in RTC for every minute."));
+        zero_sleep_rtc.setAlarmSeconds(59);
+        zero_sleep_rtc.enableAlarm(zero_sleep_rtc.MATCH_SS);
+    }
+
+#endif
+
+    return exactAlarm;
+}
+
+
+// This is handed to TaskWatch so it can feed the watchdog of this logger
+void Logger::feedWatchDog(void* logger) {
+    static_cast<Logger*>(logger)->watchDogTimer.resetWatchDog();
+}
+
+
+// Puts the system to sleep until this logger's next interval
+void Logger::systemSleep(void) {
+    systemSleep(getNextWakeEpoch());
 }
 
 
 // Puts the system to sleep to conserve battery life.
 // This DOES NOT sleep or wake the sensors!!
-void Logger::systemSleep(void) {
+void Logger::systemSleep(uint32_t wake_logTZ) {
     // Don't go to sleep unless there's a wake pin!
     if (_mcuWakePin < 0) {
         MS_DBG(F("Use a non-negative wake pin to request sleep!"));
+        // Without sleep, each pass through here is the end of one cycle and the
+        // start of the next
+        MS_PROFILE(WakeProfiler::endCycle());
+        MS_PROFILE(WakeProfiler::beginCycle());
         return;
     }
 
-#if defined MS_SAMD_DS3231 || not defined ARDUINO_ARCH_SAMD
+    MS_PROFILE_START(sleepTimer);
+
+#if defined MS_MILLISECOND_TIMESTAMPS
+    // The millisecond count stops while asleep, so the tie to the RTC is lost
+    // until the clock alarm makes a new one
+    _secondEdgeCaptured = false;
+    _secondEdgeKnown    = false;
+#endif
+
+    // Set the clock alarm for the next time to wake
+    setWakeAlarm(wake_logTZ);
 
-    // Unfortunately, because of the way the alarm on the DS3231 is set up, it
-    // cannot interrupt on any frequencies other than every second, minute,
-    // hour, day, or date.  We could set it to alarm hourly every 5 minutes past
-    // the hour, but not every 5 minutes.  This is why we set the alarm for
-    // every minute and use the checkInterval function.  This is a hardware
-    // limitation of the DS3231; it is not due to the libraries or software.
-    MS_DBG(F("Setting alarm on DS3231 RTC for every minute."));
-    rtc.enableInterrupts(EveryMinute);
+#if defined MS_SAMD_DS3231 || not defined ARDUINO_ARCH_SAMD
 
     // Clear the last interrupt flag in the RTC status register
     // The next timed interrupt will not be sent until this is cleared
@@ -734,22 +1199,6 @@ void Logger::systemSleep(void) {
     pinMode(_mcuWakePin, INPUT_PULLUP);
     enableInterrupt(_mcuWakePin, wakeISR, CHANGE);
 
-#elif defined ARDUINO_ARCH_SAMD
-
-    // Make sure interrupts are enabled for the clock
-    NVIC_EnableIRQ(RTC_IRQn);       // enable RTC interrupt
-    NVIC_SetPriority(RTC_IRQn, 0);  // highest priority
-
-    // Alarms on the RTC built into the SAMD21 appear to be identical to those
-    // in the DS3231.  See more notes below.
-    // We're setting the alarm seconds to 59 and then seting it to go off
-    // whenever the seconds match the 59.  I'm using 59 instead of 00
-    // because there seems to be a bit of a wake-up delay
-    MS_DBG(F("Setting alarm on SAMD built-in RTC for every minute."));
-    zero_sleep_rtc.attachInterrupt(wakeISR);
-    zero_sleep_rtc.setAlarmSeconds(59);
-    zero_sleep_rtc.enableAlarm(zero_sleep_rtc.MATCH_SS);
-
 #endif
 
     // Send one last message before shutting down serial ports
@@ -781,6 +1230,11 @@ void Logger::systemSleep(void) {
     digitalWrite(SCL, LOW);
 #endif
 
+    // This is the end of the time awake
+    MS_PROFILE_STOP(sleepTimer, PROFILE_SLEEP);
+    MS_PROFILE(WakeProfiler::endCycle());
+    addAwakeTime();
+
 #if defined ARDUINO_ARCH_SAMD
 
     // Disable the watch-dog timer
@@ -862,6 +1316,11 @@ void Logger::systemSleep(void) {
     // ---------------------------------------------------------------------
     // -- The portion below this happens on wake up, after any wake ISR's --
 
+    // This is the start of the next time awake
+    MS_PROFILE(WakeProfiler::beginCycle());
+    MS_PROFILE_START(wakeTimer);
+    _millisWoke = millis();
+
 #if defined ARDUINO_ARCH_SAMD
     // Reattach the USB after waking
     // Enable systick interrupt
@@ -929,6 +1388,17 @@ void Logger::systemSleep(void) {
     zero_sleep_rtc.disableAlarm();
 #endif
 
+#if defined MS_MILLISECOND_TIMESTAMPS
+    // Find the RTC second the alarm fired at the start of
+    if (_secondEdgeCaptured) {
+        _secondEdgeEpoch = getNowEpoch() -
+            (millis() - _secondEdgeMillis) / 1000;
+        _secondEdgeKnown = true;
+    }
+#endif
+
+    MS_PROFILE_STOP(wakeTimer, PROFILE_WAKE);
+
     // Wake-up message
     MS_DBG(F("\n\n\n... zzzZZ Processor is now awake!"));
 
@@ -957,9 +1427,13 @@ void Logger::setFileName(const char* fileName) {
 // the begin() function is called.
 void Logger::generateAutoFileName(void) {
     // Generate the file name from logger ID and date
+    // Only the date (the first 10 characters) of the timestamp is used
+    char date[11];
+    strncpy(date, _clockCalendar.formatCSV(getNowEpoch()), 10);
+    date[10]        = '\0';
     String fileName = String(_loggerID);
     fileName += "_";
-    fileName += formatDateTime_ISO8601(getNowEpoch()).substring(0, 10);
+    fileName += date;
     fileName += ".csv";
     setFileName(fileName);
     _fileName = fileName;
@@ -971,16 +1445,16 @@ void Logger::generateAutoFileName(void) {
  *
  * THIS IS NOT A FUNCTION, it is a pre-processor macro
  */
-#define STREAM_CSV_ROW(firstCol, function)                       \
-    stream->print("\"");                                         \
-    stream->print(firstCol);                                     \
-    stream->print("\",");                                        \
-    for (uint8_t i = 0; i < getArrayVarCount(); i++) {           \
-        stream->print("\"");                                     \
-        stream->print(function);                                 \
-        stream->print("\"");                                     \
-        if (i + 1 != getArrayVarCount()) { stream->print(","); } \
-    }                                                            \
+#define STREAM_CSV_ROW(firstCol, printStatement)                   \
+    stream->print('"');                                            \
+    stream->print(firstCol);                                       \
+    stream->print(F("\","));                                       \
+    for (uint8_t i = 0; i < getArrayVarCount(); i++) {             \
+        stream->print('"');                                        \
+        printStatement;                                            \
+        stream->print('"');                                        \
+        if (i + 1 != getArrayVarCount()) { stream->print(','); }   \
+    }                                                              \
     stream->println();
 
 // This sends a file header out over an Arduino stream
@@ -1002,15 +1476,18 @@ void Logger::printFileHeader(Stream* stream) {
     }
 
     // Next line will be the parent sensor names
-    STREAM_CSV_ROW(F("Sensor Name:"), getParentSensorNameAtI(i))
+    STREAM_CSV_ROW(F("Sensor Name:"), stream->print(getParentSensorNameAtI(i)))
     // Next comes the ODM2 variable name
-    STREAM_CSV_ROW(F("Variable Name:"), getVarNameAtI(i))
+    STREAM_CSV_ROW(F("Variable Name:"),
+                   _internalArray->arrayOfVars[i]->printVarName(stream))
     // Next comes the ODM2 unit name
-    STREAM_CSV_ROW(F("Result Unit:"), getVarUnitAtI(i))
+    STREAM_CSV_ROW(F("Result Unit:"),
+                   _internalArray->arrayOfVars[i]->printVarUnit(stream))
     // Next comes the variable UUIDs
     // We'll only add UUID's if we see a UUID for the first variable
     if (getVarUUIDAtI(0).length() > 1) {
-        STREAM_CSV_ROW(F("Result UUID:"), getVarUUIDAtI(i))
+        STREAM_CSV_ROW(F("Result UUID:"),
+                       _internalArray->arrayOfVars[i]->printVarUUID(stream))
     }
 
     // We'll finish up the the custom variable codes
@@ -1020,17 +1497,17 @@ void Logger::printFileHeader(Stream* stream) {
     } else if (_loggerTimeZone < 0) {
         dtRowHeader += _loggerTimeZone;
     }
-    STREAM_CSV_ROW(dtRowHeader, getVarCodeAtI(i));
+    STREAM_CSV_ROW(dtRowHeader,
+                   _internalArray->arrayOfVars[i]->printVarCode(stream));
 }
 
 
 // This prints a comma separated list of volues of sensor data - including the
 // time -  out over an Arduino stream
 void Logger::printSensorDataCSV(Stream* stream) {
-    String csvString = "";
-    dtFromEpoch(Logger::markedEpochTime).addToString(csvString);
-    csvString += ',';
-    stream->print(csvString);
+    stream->print(_markedCalendar.formatCSV(
+        Logger::markedEpochTime, Logger::markedMillis, LOGGER_PRINT_MILLIS));
+    stream->print(',');
     for (uint8_t i = 0; i < getArrayVarCount(); i++) {
         stream->print(getValueStringAtI(i));
         if (i + 1 != getArrayVarCount()) { stream->print(','); }
@@ -1063,11 +1540,24 @@ bool Logger::initializeSDCard(void) {
 
 // Protected helper function - This sets a timestamp on a file
 void Logger::setFileTimestamp(File fileToStamp, uint8_t stampFlag) {
-    fileToStamp.timestamp(
-        stampFlag, dtFromEpoch(getNowEpoch()).year(),
-        dtFromEpoch(getNowEpoch()).month(), dtFromEpoch(getNowEpoch()).date(),
-        dtFromEpoch(getNowEpoch()).hour(), dtFromEpoch(getNowEpoch()).minute(),
-        dtFromEpoch(getNowEpoch()).second());
+    // Read the clock once; stamps a second or two apart in the same write only
+    // need the time of day worked out again
+    _clockCalendar.setEpoch(getNowEpoch());
+    fileToStamp.timestamp(stampFlag, _clockCalendar.year(),
+                          _clockCalendar.month(), _clockCalendar.date(),
+                          _clockCalendar.hour(), _clockCalendar.minute(),
+                          _clockCalendar.second());
+}
+
+
+// This compares the time the SD card was on with the time it would have been on
+// if it were powered for the whole cycle
+void Logger::reportSDCardTimeSaved(uint32_t millisCycleStart) {
+    if (_SDCardPowerPin < 0) { return; }
+    _SDCardTimeSaved_ms = static_cast<int32_t>(millis() - millisCycleStart) -
+        static_cast<int32_t>(_SDCardOnTime_ms);
+    PRINTOUT(F("SD card was on for"), _SDCardOnTime_ms, F("ms, saving"),
+             _SDCardTimeSaved_ms, F("ms"));
 }
 
 
@@ -1077,7 +1567,10 @@ bool Logger::openFile(String& filename, bool createFile,
                       bool writeDefaultHeader) {
     // Initialise the SD card
     // skip everything else if there's no SD card, otherwise it might hang
-    if (!initializeSDCard()) return false;
+    MS_PROFILE_START(sdInitTimer);
+    bool sdReady = initializeSDCard();
+    MS_PROFILE_STOP(sdInitTimer, PROFILE_SD_INIT);
+    if (!sdReady) return false;
 
     // Convert the string filename to a character file name for SdFat
     uint8_t fileNameLength = filename.length() + 1;
@@ -1199,6 +1692,7 @@ bool Logger::logToSD(void) {
     if (_fileName == "") generateAutoFileName();
 
     // First attempt to open the file without creating a new one
+    MS_PROFILE_START(sdOpenTimer);
     if (!openFile(_fileName, false, false)) {
         // Next try to create a new file, bail if we couldn't create it
         // Generate a filename with the current date, if the file name isn't set
@@ -1206,11 +1700,17 @@ bool Logger::logToSD(void) {
         // Do add a default header to the new file!
         if (!openFile(_fileName, true, true)) {
             PRINTOUT(F("Unable to write to SD card!"));
+            logToFallback();
             return false;
         }
     }
+    MS_PROFILE_STOP(sdOpenTimer, PROFILE_SD_OPEN);
+
+    // Put any lines kept while the card was unavailable ahead of this one
+    uint16_t movedLines = copyFallbackToSD();
 
     // Write the data
+    MS_PROFILE_START(sdWriteTimer);
     printSensorDataCSV(&logFile);
 // Echo the line to the serial port
 #if defined(STANDARD_SERIAL_OUTPUT)
@@ -1223,11 +1723,88 @@ bool Logger::logToSD(void) {
     setFileTimestamp(logFile, T_WRITE);
     // Set access date time
     setFileTimestamp(logFile, T_ACCESS);
+    MS_PROFILE_STOP(sdWriteTimer, PROFILE_SD_WRITE);
     // Close the file to save it
     // logFile.sync();
+    MS_PROFILE_START(sdCloseTimer);
+    bool closed = logFile.close();
+    MS_PROFILE_STOP(sdCloseTimer, PROFILE_SD_CLOSE);
+    // Only once the file is safely closed are the lines in the flash done with
+    if (closed && movedLines > 0) {
+        _flashLog->markRead();
+        PRINTOUT(movedLines,
+                 F("lines moved from the flash log to the SD card"));
+    }
+    return true;
+}
+
+
+// This sets the flash log used when the SD card can't be written
+void Logger::setFallbackLog(FlashLog* flashLog) {
+    _flashLog = flashLog;
+}
+
+
+// Protected helper function - This writes the most recent values to the flash
+// log instead of the SD card
+bool Logger::logToFallback(void) {
+    if (_flashLog == NULL) { return false; }
+    if (!_flashLog->beginRecord()) {
+        PRINTOUT(F("Unable to write to the flash log either!"));
+        return false;
+    }
+    printSensorDataCSV(_flashLog);
+    if (!_flashLog->endRecord()) {
+        PRINTOUT(F("Unable to write to the flash log either!"));
+        return false;
+    }
+    PRINTOUT(F("Line saved to the flash log;"), _flashLog->getRecordCount(),
+             F("lines are waiting for the SD card"));
+    return true;
+}
+
+
+// Protected helper function - This copies the lines waiting in the flash log
+// into the open data file
+uint16_t Logger::copyFallbackToSD(void) {
+    if (_flashLog == NULL || !_flashLog->hasRecords()) { return 0; }
+    uint16_t movedLines = 0;
+    _flashLog->rewind();
+    // Each line goes straight from the flash to the file, a little at a time.
+    // Only a batch is moved each cycle, and the copy stops early if the
+    // cycle runs out of time; the rest are moved in later cycles.
+    while (movedLines < MS_FLASH_LOG_COPY_LINES && TaskWatch::yield() &&
+           _flashLog->readRecord(&logFile) > 0) {
+        logFile.println();
+        movedLines++;
+    }
+    return movedLines;
+}
+
+
+#if defined MS_WAKE_PROFILER
+// Protected helper function - This writes the wake profiler summary to its own
+// file on the SD card
+bool Logger::writeProfileRecord(void) {
+    // The card was already initialized for the data file, so just open this one
+    if (!logFile.open(MS_PROFILER_FILE_NAME, O_CREAT | O_WRITE | O_AT_END)) {
+        MS_DBG(F("Unable to open"), F(MS_PROFILER_FILE_NAME));
+        return false;
+    }
+    // Add the column headers to a new file
+    if (logFile.fileSize() == 0) { WakeProfiler::printHeader(&logFile); }
+
+    logFile.print(formatMarkedTime_ISO8601());
+    logFile.print(',');
+    WakeProfiler::printRecord(&logFile);
+
+    setFileTimestamp(logFile, T_WRITE);
+    setFileTimestamp(logFile, T_ACCESS);
     logFile.close();
+    MS_DBG(F("Wrote wake profile record to"), F(MS_PROFILER_FILE_NAME));
     return true;
 }
+#endif
 
 
 // ===================================================================== //
@@ -1358,6 +1935,336 @@ void Logger::testingMode() {
 }
 
 
+// This streams sensor values as fast as the sensors allow
+void Logger::streamingMode(streamFormat format, uint16_t period_ms,
+                           uint32_t maxRecords) {
+#if defined(STANDARD_SERIAL_OUTPUT)
+    // Flag to notify that we're in testing mode
+    Logger::isTestingNow = true;
+
+    PRINTOUT(F("------------------------------------------"));
+    PRINTOUT(F("Entering sensor streaming mode"));
+
+    // Power up and wake all of the sensors once and leave them on
+    TaskWatch::startCycle();
+    _internalArray->sensorsPowerUp();
+    _internalArray->sensorsWake();
+    TaskWatch::yield();
+
+    // Send the column names so the records can be labeled
+    STANDARD_SERIAL_OUTPUT.print(F("sequence,millis"));
+    for (uint8_t i = 0; i < getArrayVarCount(); i++) {
+        STANDARD_SERIAL_OUTPUT.print(',');
+        STANDARD_SERIAL_OUTPUT.print(getVarCodeAtI(i));
+    }
+    STANDARD_SERIAL_OUTPUT.println();
+
+    // Ignore anything typed before streaming started
+    while (STANDARD_SERIAL_OUTPUT.available()) {
+        STANDARD_SERIAL_OUTPUT.read();
+    }
+
+    uint16_t sequence   = 0;
+    uint32_t nRecords   = 0;
+    uint32_t lastRecord = millis();
+    while ((maxRecords == 0 || nRecords < maxRecords) &&
+           !STANDARD_SERIAL_OUTPUT.available()) {
+        // Each pass is its own cycle, so a sensor that hangs within one pass
+        // still lets the watchdog reset the board
+        TaskWatch::startCycle();
+        uint8_t nNewResults = _internalArray->pollSensors();
+        bool    due         = nNewResults > 0;
+        if (period_ms > 0) { due = millis() - lastRecord >= period_ms; }
+        if (due) {
+            lastRecord += period_ms;
+            // Don't try to catch up after falling behind; just skip ahead
+            if (millis() - lastRecord >= period_ms) { lastRecord = millis(); }
+            _internalArray->streamSensorData(&STANDARD_SERIAL_OUTPUT, format,
+                                             sequence++);
+            nRecords++;
+        }
+        TaskWatch::yield();
+    }
+    while (STANDARD_SERIAL_OUTPUT.available()) {
+        STANDARD_SERIAL_OUTPUT.read();
+    }
+
+    // Put sensors to sleep
+    _internalArray->sensorsSleep();
+    _internalArray->sensorsPowerDown();
+
+    PRINTOUT(F("Exiting streaming mode after"), nRecords, F("records"));
+    PRINTOUT(F("------------------------------------------"));
+    TaskWatch::yield();
+
+    // Unset testing mode flag
+    Logger::isTestingNow = false;
+#endif
+}
+
+
+// ===================================================================== //
+// Public functions for reporting memory use
+// ===================================================================== //
+
+// This gets the size of the initialized and zeroed static data
+uint32_t Logger::getStaticRAM(void) {
+#if defined(__AVR__)
+    return (uint32_t)((uint16_t)&__heap_start - RAMSTART);
+#elif defined(ARDUINO_ARCH_SAMD)
+    return (uint32_t)((char*)&__bss_end__ - (char*)&__data_start__);
+#else
+    return 0;
+#endif
+}
+
+
+// This gets the distance from the start of the heap to the heap break
+uint32_t Logger::getHeapHighWater(void) {
+#if defined(__AVR__)
+    char* heapTop = __brkval == 0 ? (char*)&__heap_start : __brkval;
+    return (uint32_t)(heapTop - (char*)&__heap_start);
+#elif defined(ARDUINO_ARCH_SAMD)
+    return (uint32_t)(sbrk(0) - (char*)&__end__);
+#else
+    return 0;
+#endif
+}
+
+
+// This gets the distance from the heap break to the current stack pointer
+uint32_t Logger::getFreeRAM(void) {
+#if defined(__AVR__)
+    uint8_t stackTop;
+    char*   heapTop = __brkval == 0 ? (char*)&__heap_start : __brkval;
+    return (uint32_t)((char*)&stackTop - heapTop);
+#elif defined(ARDUINO_ARCH_SAMD)
+    return (uint32_t)((char*)__get_MSP() - sbrk(0));
+#else
+    return 0;
+#endif
+}
+
+
+// This counts the painted bytes between the heap and the stack that have never
+// been touched
+uint32_t Logger::getStackHeadroom(void) {
+#if defined(__AVR__) && defined(MS_MEMORY_REPORT)
+    uint8_t* p = (uint8_t*)(__brkval == 0 ? (char*)&__heap_start : __brkval);
+    uint32_t untouched = 0;
+    while (p <= &__stack && *p == MS_STACK_CANARY) {
+        untouched++;
+        p++;
+    }
+    return untouched;
+#else
+    return getFreeRAM();
+#endif
+}
+
+
+// This prints out a report of RAM use
+void Logger::printMemoryReport(Stream* stream) {
+    stream->println(F("RAM Use Report"));
+    stream->print(F("  Static data (.data + .bss): "));
+    stream->println(getStaticRAM());
+    stream->print(F("  Heap high-water:            "));
+    stream->println(getHeapHighWater());
+    stream->print(F("  Free RAM now:               "));
+    stream->println(getFreeRAM());
+    stream->print(F("  Stack headroom:             "));
+    stream->println(getStackHeadroom());
+
+    stream->print(F("  Logger object:              "));
+    stream->println(sizeof(Logger));
+
+    if (_internalArray != NULL) {
+        stream->print(F("  Variables ("));
+        stream->print(getArrayVarCount());
+        stream->print(F(" x "));
+        stream->print(sizeof(Variable));
+        stream->print(F("):            "));
+        stream->println(getArrayVarCount() * sizeof(Variable));
+    }
+    // The sensor result arrays are part of the sensor objects
+    stream->print(F("  Sensor result arrays:       "));
+    stream->println(Sensor::getResultArrayBytes());
+
+    uint8_t numPublishers = 0;
+    for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
+        if (dataPublishers[i] != NULL) { numPublishers++; }
+    }
+    if (numPublishers > 0) {
+        stream->print(F("  Publisher send buffer:      "));
+        stream->println(MS_SEND_BUFFER_SIZE);
+    }
+}
+
+
+// ===================================================================== //
+// Public functions for estimating energy use
+// ===================================================================== //
+
+// This sets the currents drawn by the logger board
+void Logger::setCurrents(float awakeCurrent_mA, float sleepCurrent_mA) {
+    _awakeCurrent_mA = awakeCurrent_mA;
+    _sleepCurrent_mA = sleepCurrent_mA;
+}
+
+
+// This adds the time since waking to the running totals
+void Logger::addAwakeTime(void) {
+    uint32_t awakeFor = millis() - _millisWoke;
+    _awakeTime_ms += awakeFor;
+    _boardChargeUsed_mAh += _awakeCurrent_mA * awakeFor / 3600000.0f;
+}
+
+
+// These return the running totals
+uint32_t Logger::getAwakeTime(void) {
+    // Include the time in the current wake
+    return _awakeTime_ms + (millis() - _millisWoke);
+}
+float Logger::getBoardChargeUsed(void) {
+    return _boardChargeUsed_mAh +
+        _awakeCurrent_mA * (millis() - _millisWoke) / 3600000.0f;
+}
+float Logger::getSensorChargeUsed(void) {
+    if (_internalArray == NULL) { return 0; }
+    return _internalArray->getSensorChargeUsed();
+}
+float Logger::getModemChargeUsed(void) {
+    if (_logModem == NULL) { return 0; }
+    return _logModem->getChargeUsed();
+}
+float Logger::getBaselineCurrent(void) {
+    float current = _sleepCurrent_mA;
+    if (_internalArray != NULL) {
+        current += _internalArray->getSensorBaselineCurrent();
+    }
+    if (_logModem != NULL) { current += _logModem->getBaselineCurrent(); }
+    return current;
+}
+
+
+// This prints out a report of the currents and charge used
+void Logger::printEnergyReport(Stream* stream) {
+    stream->println(F("Energy Use Report"));
+    stream->print(F("The logger board draws "));
+    stream->print(_awakeCurrent_mA);
+    stream->print(F(" mA awake and "));
+    stream->print(_sleepCurrent_mA);
+    stream->print(F(" mA asleep; used "));
+    stream->print(getBoardChargeUsed(), 4);
+    stream->print(F(" mAh in "));
+    stream->print(getAwakeTime());
+    stream->println(F(" ms awake"));
+    if (_internalArray != NULL) { _internalArray->printSensorEnergy(stream); }
+    if (_logModem != NULL) {
+        stream->print(_logModem->getModemName());
+        stream->print(F(" used "));
+        stream->print(_logModem->getChargeUsed(), 4);
+        stream->println(F(" mAh while powered"));
+    }
+    stream->print(F("Total current while asleep: "));
+    stream->print(getBaselineCurrent(), 3);
+    stream->println(F(" mA"));
+}
+
+
+// ===================================================================== //
+// Public functions for the battery power policy
+// ===================================================================== //
+
+// This sets the battery variable and the interval multiplier
+void Logger::setPowerPolicy(Variable* batteryVoltage,
+                            uint8_t   reducedIntervalMultiplier) {
+    _batteryVar = batteryVoltage;
+    _reducedIntervalMultiplier =
+        reducedIntervalMultiplier > 0 ? reducedIntervalMultiplier : 1;
+}
+
+
+// This sets the voltage thresholds for each tier
+void Logger::setPowerTierThresholds(float sdOnly_V, float reduced_V,
+                                    float critical_V, float hysteresis_V) {
+    _powerThresholds.sdOnly_V     = sdOnly_V;
+    _powerThresholds.reduced_V    = reduced_V;
+    _powerThresholds.critical_V   = critical_V;
+    _powerThresholds.hysteresis_V = hysteresis_V;
+}
+
+
+// This gets the logging interval for the current tier
+uint16_t Logger::getTierLoggingInterval(void) {
+    if (_powerTier < POWER_TIER_REDUCED) { return _loggingIntervalMinutes; }
+    uint32_t interval = ((uint32_t)_loggingIntervalMinutes) *
+        _reducedIntervalMultiplier;
+    return interval > 0xFFFF ? 0xFFFF : (uint16_t)interval;
+}
+
+
+// This reads the battery, updates the tier, and checks if it's time to log
+bool Logger::checkPowerTier(void) {
+    if (_batteryVar == NULL) { return true; }
+
+    // Read the battery without updating its sensor, so the sensor is only
+    // measured (and powered) once, by the logging cycle itself
+    float battery_V = _batteryVar->getInstantValue();
+    if (battery_V != -9999 &&
+        _batteryVar->getVarUnit() == String(F("millivolt"))) {
+        battery_V /= 1000;
+    }
+    MS_DBG(F("Battery is at"), battery_V, F("V"));
+
+    powerTier newTier = selectPowerTier(_powerTier, battery_V,
+                                        &_powerThresholds);
+    if (newTier != _powerTier) {
+        PRINTOUT(F("Battery at"), battery_V, F("V; changing from power tier"),
+                 _powerTier, F("to"), newTier);
+        writePowerTierRecord(newTier, battery_V);
+        _powerTier = newTier;
+    }
+
+    if (_powerTier == POWER_TIER_CRITICAL) {
+        PRINTOUT(F("Battery is critically low; skipping measurements."));
+        return false;
+    }
+    // In the reduced tier, only log on the longer interval
+    uint32_t interval_s = ((uint32_t)getTierLoggingInterval()) * 60;
+    return Logger::markedEpochTime % interval_s == 0;
+}
+
+
+// This writes a tier change to its own file
+bool Logger::writePowerTierRecord(powerTier newTier, float battery_V) {
+    bool success = false;
+    turnOnSDcard(true);
+    if (initializeSDCard() &&
+        logFile.open(MS_POWER_LOG_FILE_NAME, O_CREAT | O_WRITE | O_AT_END)) {
+        // Add the column headers to a new file
+        if (logFile.fileSize() == 0) {
+            logFile.println(F("Date and Time,Battery (V),Old Tier,New Tier"));
+        }
+        logFile.print(formatMarkedTime_ISO8601());
+        logFile.print(',');
+        logFile.print(battery_V, 3);
+        logFile.print(',');
+        logFile.print(_powerTier);
+        logFile.print(',');
+        logFile.println(newTier);
+
+        setFileTimestamp(logFile, T_WRITE);
+        setFileTimestamp(logFile, T_ACCESS);
+        logFile.close();
+        MS_DBG(F("Wrote power tier change to"), F(MS_POWER_LOG_FILE_NAME));
+        success = true;
+    }
+    turnOffSDcard(true);
+    return success;
+}
+
+
 // ===================================================================== //
 // Convience functions to call several of the above functions
 // ===================================================================== //
@@ -1386,6 +2293,8 @@ void Logger::begin() {
     watchDogTimer.setupWatchDog((uint32_t)(5 * 60 * 3));
     // Enable the watchdog
     watchDogTimer.enableWatchDog();
+    // Let tasks that are on time feed it
+    TaskWatch::setWatchDog(feedWatchDog, this);
 
     // Set pin modes for sd card power
     if (_SDCardPowerPin >= 0) {
@@ -1451,6 +2360,9 @@ void Logger::begin() {
 
     // Print out the current time
     PRINTOUT(F("Current RTC time is:"), formatDateTime_ISO8601(getNowEpoch()));
+#if defined MS_MILLISECOND_TIMESTAMPS
+    syncMillisToRTC();
+#endif
 
     // Reset the watchdog
     watchDogTimer.resetWatchDog();
@@ -1464,46 +2376,76 @@ void Logger::begin() {
              _internalArray->getCalculatedVariableCount(),
              F("are calculated."));
 
+    // Make sure each publisher's records fit in the cache until it sends
+    for (uint8_t i = 0; i < MAX_NUMBER_SENDERS; i++) {
+        if (dataPublishers[i] != NULL) {
+            dataPublishers[i]->checkSendFrequency();
+        }
+    }
+
     if (_samplingFeatureUUID != NULL) {
         PRINTOUT(F("Sampling feature UUID is:"), _samplingFeatureUUID);
     }
 
+    // Start the fallback for the SD card and see if anything is waiting in it
+    if (_flashLog != NULL && _flashLog->begin()) {
+        PRINTOUT(F("The flash log has"), _flashLog->getRecordCount(),
+                 F("lines waiting for the SD card."));
+    }
+    watchDogTimer.resetWatchDog();
+
+#if defined(MS_MEMORY_REPORT) && defined(STANDARD_SERIAL_OUTPUT)
+    printMemoryReport(&STANDARD_SERIAL_OUTPUT);
+#endif
+
     PRINTOUT(F("Logger portion of setup finished.\n"));
+
+    // Start timing the first wake cycle
+    MS_PROFILE(WakeProfiler::beginCycle());
 }
 
 
 // This is a one-and-done to log data
 void Logger::logData(void) {
-    // Reset the watchdog
-    watchDogTimer.resetWatchDog();
+    // Feed the watchdog and clear any task left open by the last cycle
+    TaskWatch::startCycle();
 
     // Assuming we were woken up by the clock, check if the current time is an
-    // even interval of the logging interval
-    if (checkInterval()) {
+    // even interval of the logging interval and that the battery can support
+    // logging now
+    if (checkInterval() && checkPowerTier()) {
         // Flag to notify that we're in already awake and logging a point
         Logger::isLoggingNow = true;
-        // Reset the watchdog
-        watchDogTimer.resetWatchDog();
+        // Feed the watchdog
+        TaskWatch::yield();
 
         // Print a line to show new reading
         PRINTOUT(F("------------------------------------------"));
         // Turn on the LED to show we're taking a reading
         alertOn();
-        // Power up the SD Card
-        // TODO(SRGDamia1):  Decide how much delay is needed between turning on
-        // the card and writing to it.  Could we turn it on just before writing?
-        turnOnSDcard(false);
+        // Mark when the SD card would have been powered for the whole cycle
+        uint32_t cycleStart = millis();
 
         // Do a complete sensor update
         MS_DBG(F("    Running a complete sensor update..."));
-        watchDogTimer.resetWatchDog();
+        TaskWatch::yield();
+        MS_PROFILE_START(updateTimer);
         _internalArray->completeUpdate();
-        watchDogTimer.resetWatchDog();
+        MS_PROFILE_STOP(updateTimer, PROFILE_SENSOR_UPDATE);
+        TaskWatch::yield();
 
+        // Power up the SD Card just before writing to it; opening the file
+        // waits for the card to be ready
+        turnOnSDcard(false);
         // Create a csv data record and save it to the log file
         logToSD();
-        // Cut power from the SD card, waiting for housekeeping
+#if defined MS_WAKE_PROFILER
+        // Write out the wake profile, if enough cycles have been timed
+        if (WakeProfiler::recordDue()) { writeProfileRecord(); }
+#endif
+        // Cut power from the SD card as soon as it's done with housekeeping
         turnOffSDcard(true);
+        reportSDCardTimeSaved(cycleStart);
 
         // Turn off the LED
         alertOff();
@@ -1522,25 +2464,24 @@ void Logger::logData(void) {
 }
 // This is a one-and-done to log data
 void Logger::logDataAndPublish(void) {
-    // Reset the watchdog
-    watchDogTimer.resetWatchDog();
+    // Feed the watchdog and clear any task left open by the last cycle
+    TaskWatch::startCycle();
 
     // Assuming we were woken up by the clock, check if the current time is an
-    // even interval of the logging interval
-    if (checkInterval()) {
+    // even interval of the logging interval and that the battery can support
+    // logging now
+    if (checkInterval() && checkPowerTier()) {
         // Flag to notify that we're in already awake and logging a point
         Logger::isLoggingNow = true;
-        // Reset the watchdog
-        watchDogTimer.resetWatchDog();
+        // Feed the watchdog
+        TaskWatch::yield();
 
         // Print a line to show new reading
         PRINTOUT(F("------------------------------------------"));
         // Turn on the LED to show we're taking a reading
         alertOn();
-        // Power up the SD Card
-        // TODO(SRGDamia1):  Decide how much delay is needed between turning on
-        // the card and writing to it.  Could we turn it on just before writing?
-        turnOnSDcard(false);
+        // Mark when the SD card would have been powered for the whole cycle
+        uint32_t cycleStart = millis();
 
         // Do a complete update on the variable array.
         // This this includes powering all of the sensors, getting updated
@@ -1548,57 +2489,88 @@ void Logger::logDataAndPublish(void) {
         // NOTE:  The wake function for each sensor should force sensor setup
         // to run if the sensor was not previously set up.
         MS_DBG(F("Running a complete sensor update..."));
-        watchDogTimer.resetWatchDog();
+        TaskWatch::yield();
+        MS_PROFILE_START(updateTimer);
         _internalArray->completeUpdate();
-        watchDogTimer.resetWatchDog();
+        MS_PROFILE_STOP(updateTimer, PROFILE_SENSOR_UPDATE);
+        TaskWatch::yield();
 
+        // Power up the SD Card just before writing to it; opening the file
+        // waits for the card to be ready
+        turnOnSDcard(false);
         // Create a csv data record and save it to the log file
         logToSD();
-
-        if (_logModem != NULL) {
+#if defined MS_WAKE_PROFILER
+        // Write out the wake profile, if enough cycles have been timed
+        if (WakeProfiler::recordDue()) { writeProfileRecord(); }
+#endif
+        // Cut power from the SD card as soon as it's done with housekeeping,
+        // rather than leaving it on while publishing
+        turnOffSDcard(true);
+        // Keep the record for the publishers that only send every few
+        // intervals
+        cacheRecord();
+
+        if (_logModem != NULL && _powerTier != POWER_TIER_FULL) {
+            MS_DBG(F("Battery is low; not publishing data."));
+        } else if (_logModem != NULL && !isPublishDue() &&
+                   !isClockSyncDue()) {
+            MS_DBG(F("No publishers are due; not waking the modem."));
+        } else if (_logModem != NULL) {
             MS_DBG(F("Waking up"), _logModem->getModemName(), F("..."));
-            if (_logModem->modemWake()) {
+            TaskWatch::begin(F("Modem connection"), MS_TASK_CONNECT_MS);
+            MS_PROFILE_START(modemWakeTimer);
+            bool modemAwake = _logModem->modemWake();
+            MS_PROFILE_STOP(modemWakeTimer, PROFILE_MODEM_WAKE);
+            bool connected = false;
+            if (modemAwake) {
                 // Connect to the network
-                watchDogTimer.resetWatchDog();
                 MS_DBG(F("Connecting to the Internet..."));
-                if (_logModem->connectInternet()) {
+                MS_PROFILE_START(attachTimer);
+                connected = _logModem->connectInternet();
+                MS_PROFILE_STOP(attachTimer, PROFILE_MODEM_ATTACH);
+            }
+            // A connection that came too late is treated as a failure
+            connected &= TaskWatch::end();
+            if (modemAwake) {
+                if (connected) {
                     // Publish data to remotes
-                    watchDogTimer.resetWatchDog();
+                    TaskWatch::yield();
                     publishDataToRemotes();
-                    watchDogTimer.resetWatchDog();
+                    TaskWatch::yield();
 
-                    if ((Logger::markedEpochTime != 0 &&
-                         Logger::markedEpochTime % 86400 == 43200) ||
-                        !isRTCSane(Logger::markedEpochTime)) {
+                    if (isClockSyncDue()) {
                         // Sync the clock at noon
                         MS_DBG(F("Running a daily clock sync..."));
+                        MS_PROFILE_START(clockSyncTimer);
                         setRTClock(_logModem->getNISTTime());
-                        watchDogTimer.resetWatchDog();
+                        MS_PROFILE_STOP(clockSyncTimer, PROFILE_CLOCK_SYNC);
+                        TaskWatch::yield();
                     }
 
                     // Update the modem metadata
                     MS_DBG(F("Updating modem metadata..."));
+                    MS_PROFILE_START(metadataTimer);
                     _logModem->updateModemMetadata();
+                    MS_PROFILE_STOP(metadataTimer, PROFILE_MODEM_METADATA);
 
                     // Disconnect from the network
                     MS_DBG(F("Disconnecting from the Internet..."));
+                    MS_PROFILE_START(disconnectTimer);
                     _logModem->disconnectInternet();
+                    MS_PROFILE_STOP(disconnectTimer, PROFILE_MODEM_DISCONNECT);
                 } else {
                     MS_DBG(F("Could not connect to the internet!"));
-                    watchDogTimer.resetWatchDog();
+                    TaskWatch::yield();
                 }
             }
             // Turn the modem off
+            MS_PROFILE_START(modemSleepTimer);
             _logModem->modemSleepPowerDown();
+            MS_PROFILE_STOP(modemSleepTimer, PROFILE_MODEM_SLEEP);
         }
 
-
-        // TODO(SRGDamia1):  Do some sort of verification that minimum 1 sec has
-        // passed for internal SD card housekeeping before cutting power It
-        // seems very unlikely based on my testing that less than one second
-        // would be taken up in publishing data to remotes
-        // Cut power from the SD card - without additional housekeeping wait
-        turnOffSDcard(false);
+        reportSDCardTimeSaved(cycleStart);
 
         // Turn off the LED
         alertOff();
@@ -26,6 +26,12 @@
 #undef MS_DEBUGGING_STD
 #include "VariableArray.h"
 #include "LoggerModem.h"
+#include "WakeProfiler.h"
+#include "PowerPolicy.h"
+#include "CalendarCache.h"
+#include "WakeAlarm.h"
+#include "FlashLog.h"
+#include "PublishCache.h"
 
 // Bring in the libraries to handle the processor sleep/standby modes
 // The SAMD library can also the built-in clock on those modules
@@ -58,6 +64,47 @@
  */
 #define MAX_NUMBER_SENDERS 4
 
+/**
+ * @brief The longest time to wait for the SD card to finish its internal
+ * housekeeping after a write before cutting its power.
+ *
+ * The card reports that it is busy by holding its data out line low, so the
+ * power is usually cut well before this.  The SD specification allows up to
+ * one second.
+ *
+ * This can be changed by setting the build flag MS_SD_BUSY_TIMEOUT_MS when
+ * compiling.
+ */
+#ifndef MS_SD_BUSY_TIMEOUT_MS
+#define MS_SD_BUSY_TIMEOUT_MS 1000
+#endif
+
+/**
+ * @brief The default time between records in streaming mode, in ms.
+ *
+ * A value of 0 sends a record whenever any sensor has a new result.
+ *
+ * This can be changed by setting the build flag MS_STREAM_PERIOD_MS when
+ * compiling.
+ */
+#ifndef MS_STREAM_PERIOD_MS
+#define MS_STREAM_PERIOD_MS 100
+#endif
+
+/**
+ * @def MS_MILLISECOND_TIMESTAMPS
+ * @brief Set this build flag to stamp records with the millisecond as well as
+ * the second they were marked.
+ *
+ * The millisecond is counted by the processor from the start of an RTC
+ * second: the clock alarm that wakes the logger fires at the start of a
+ * second, and Logger::syncMillisToRTC() watches for one when the logger
+ * starts or its clock is set.  The second itself always comes from the RTC.
+ * With this set, the ISO8601 timestamps on the SD card and sent to the
+ * publishers gain three decimal places of seconds; without it,
+ * Logger::markedMillis is always 0 and nothing changes.
+ */
+
 
 class dataPublisher;  // Forward declaration
 
@@ -85,6 +132,11 @@ class Logger {
      * proper formats for sending it.
      */
     friend class dataPublisher;
+    /**
+     * @brief The LoggerGroup class runs the logging cycles of several loggers
+     * together.
+     */
+    friend class LoggerGroup;
 
  public:
     /**
@@ -205,6 +257,9 @@ class Logger {
      * Optionally waits for the card to "settle."  Has no effect if a pin has
      * not been set to control power to the SD card.
      *
+     * The settling delay isn't needed before opening a file; initializing the
+     * card polls it until it is ready.
+     *
      * @param waitToSettle True to add a short (6ms) delay between powering on
      * the card and beginning initialization.  Defaults to true.
      */
@@ -213,13 +268,32 @@ class Logger {
      * @brief Cut power to the SD card by setting the SDCardPowerPin `LOW`.
      *
      * Optionally waits for the card to do "housekeeping" before cutting the
-     * power.  Has o effect if a pin has not been set to control power to the SD
-     * card.
+     * power.  Has no effect if a pin has not been set to control power to the
+     * SD card.
      *
-     * @param waitForHousekeeping True to add a 1 second delay between to allow
-     * any on-chip writing to complete before cutting power.  Defaults to true.
+     * @param waitForHousekeeping True to wait - for up to
+     * #MS_SD_BUSY_TIMEOUT_MS - until the card stops reporting that it is busy
+     * before cutting power.  Defaults to true.
      */
     void turnOffSDcard(bool waitForHousekeeping = true);
+    /**
+     * @brief Get how long the SD card was powered the last time it was turned
+     * off.
+     *
+     * @return **uint32_t** The time the card was on, in ms
+     */
+    uint32_t getSDCardOnTime(void);
+    /**
+     * @brief Get how much less time the SD card was powered in the last
+     * logging cycle than if it had been powered for the whole cycle.
+     *
+     * The card is only powered while data is written to it.  It used to be
+     * powered from before the sensors were updated until after data was
+     * published.
+     *
+     * @return **int32_t** The time saved, in ms
+     */
+    int32_t getSDCardTimeSaved(void);
 
     /**
      * @brief Set a pin for the slave select (chip select) of the SD card.
@@ -491,9 +565,68 @@ class Logger {
      */
     void registerDataPublisher(dataPublisher* publisher);
     /**
-     * @brief Publish data to all registered data publishers.
+     * @brief Publish data to all registered data publishers that are due to
+     * send.
+     *
+     * Each publisher sends every record kept since it last sent - see
+     * dataPublisher::setSendFrequency().
      */
     void publishDataToRemotes(void);
+    /**
+     * @brief Check if any publisher is due to send this interval.
+     *
+     * If no publishers are registered, the modem is always needed, so this is
+     * always true.
+     *
+     * @return **bool** True if a publisher is due to send.
+     */
+    bool isPublishDue(void);
+    /**
+     * @brief Check if the clock is due to be synced this interval - at noon,
+     * or whenever the marked time isn't sane.
+     *
+     * The modem is woken when either this or isPublishDue() is true.
+     *
+     * @return **bool** True if the clock is due to be synced.
+     */
+    static bool isClockSyncDue(void);
+
+    /**
+     * @brief Keep the current values and marked time for the publishers that
+     * only send every few logging intervals.
+     *
+     * Each marked time is only kept once, however many times this is called.
+     */
+    void cacheRecord(void);
+    /**
+     * @brief Get the number of the oldest record still kept.
+     *
+     * Records are numbered from 1 in the order they were kept.
+     *
+     * @return **uint32_t** The record number; 0 if no records are kept.
+     */
+    uint32_t getOldestCachedRecord(void);
+    /**
+     * @brief Get the number of the newest record kept.
+     *
+     * @return **uint32_t** The record number; 0 if no records are kept.
+     */
+    uint32_t getNewestCachedRecord(void);
+    /**
+     * @brief Swap the marked time and variable values for those of a kept
+     * record, so a publisher can send it.
+     *
+     * The swap lasts until endReplay().
+     *
+     * @param recordNumber The number of the record
+     * @return **bool** True if the record is still kept.
+     */
+    bool replayCachedRecord(uint32_t recordNumber);
+    /**
+     * @brief Put back the marked time and variable values after
+     * replayCachedRecord().
+     */
+    void endReplay(void);
     /**
      * @brief Retained for backwards compatibility.
      *
@@ -516,6 +649,53 @@ class Logger {
      * @brief An array of all of the attached data publishers
      */
     dataPublisher* dataPublishers[MAX_NUMBER_SENDERS];
+
+    /**
+     * @brief The marked times of the kept records
+     */
+    uint32_t _cacheEpoch[MS_PUBLISH_CACHE_RECORDS];
+    /**
+     * @brief The marked UTC times of the kept records
+     */
+    uint32_t _cacheEpochUTC[MS_PUBLISH_CACHE_RECORDS];
+    /**
+     * @brief The marked milliseconds of the kept records
+     */
+    uint16_t _cacheMillis[MS_PUBLISH_CACHE_RECORDS];
+    /**
+     * @brief The variable values of the kept records, one record after
+     * another
+     */
+    float _cacheValues[MS_PUBLISH_CACHE_VALUES];
+    /**
+     * @brief The number of records kept since the logger started; the number
+     * of the newest record
+     */
+    uint32_t _cacheCount;
+    /**
+     * @brief The slot of the record being replayed; -1 when the live values
+     * are in use
+     */
+    int8_t _replaySlot;
+    /**
+     * @brief The live marked time, kept while a record is replayed
+     */
+    uint32_t _liveEpoch;
+    /**
+     * @brief The live marked UTC time, kept while a record is replayed
+     */
+    uint32_t _liveEpochUTC;
+    /**
+     * @brief The live marked milliseconds, kept while a record is replayed
+     */
+    uint16_t _liveMillis;
+    /**
+     * @brief Get the number of records that fit in the cache with this many
+     * variables.
+     *
+     * @return **uint8_t** The number of records that fit
+     */
+    uint8_t getCacheCapacity(void);
     /**@}*/
 
     // ===================================================================== //
@@ -663,6 +843,30 @@ class Logger {
      * @return **String** An ISO8601 formatted String.
      */
     static String formatDateTime_ISO8601(uint32_t epochTime);
+    /**
+     * @brief Convert an epoch time (unix time) and a millisecond within that
+     * second into a ISO8601 formatted string.
+     *
+     * The milliseconds are only included when the build flag
+     * MS_MILLISECOND_TIMESTAMPS is set.
+     *
+     * @param epochTime The number of seconds since 1970.
+     * @param milliseconds The millisecond within the second, from 0 to 999.
+     * @return **String** An ISO8601 formatted String.
+     */
+    static String formatDateTime_ISO8601(uint32_t epochTime,
+                                         uint16_t milliseconds);
+    /**
+     * @brief Get the marked time as an ISO8601 formatted string.
+     *
+     * The string is only built once for each marked time, however many
+     * publishers ask for it.  The milliseconds are included when the build
+     * flag MS_MILLISECOND_TIMESTAMPS is set.
+     *
+     * @return **const char\*** An ISO8601 formatted string, valid until the
+     * time is next marked.
+     */
+    static const char* formatMarkedTime_ISO8601(void);
 
     /**
      * @brief Veify that the input value is sane and if so sets the real time
@@ -705,6 +909,18 @@ class Logger {
      * this should be called before updating the sensors, not after.
      */
     static void markTime(void);
+#if defined MS_MILLISECOND_TIMESTAMPS
+    /**
+     * @brief Tie the processor's millisecond count to the RTC by waiting for
+     * the RTC's second to change.
+     *
+     * Until this is done, or the logger is woken by its clock alarm, marked
+     * times are whole seconds.  This waits for up to 1.1 seconds.
+     *
+     * @return **bool** True if the start of a second was seen.
+     */
+    static bool syncMillisToRTC(void);
+#endif
 
     /**
      * @brief Check if the CURRENT time is an even interval of the logging rate
@@ -728,6 +944,22 @@ class Logger {
      */
     bool checkMarkedInterval(void);
 
+    /**
+     * @brief Calculate the first even interval of the logging rate that is
+     * strictly after the given epoch time.
+     *
+     * This is the time the RTC alarm is programmed for before the logger goes
+     * to sleep.  Both the input and the result are in the same timezone.
+     *
+     * @param currentEpoch The number of seconds since 1970 to start from.
+     * @param intervalMinutes The logging interval in minutes.  An interval of
+     * 0 is treated as 1 minute.
+     * @return **uint32_t** The number of seconds since 1970 of the next
+     * logging interval.
+     */
+    static uint32_t getNextIntervalEpoch(uint32_t currentEpoch,
+                                         uint16_t intervalMinutes);
+
  protected:
     /**
      * @brief The static timezone data is being logged in.
@@ -744,6 +976,37 @@ class Logger {
      * same offset.
      */
     static int8_t _loggerRTCOffset;
+#if defined MS_MILLISECOND_TIMESTAMPS
+    /**
+     * @brief The processor time at the start of the RTC second
+     * #_secondEdgeEpoch, in ms.
+     */
+    static volatile uint32_t _secondEdgeMillis;
+    /**
+     * @brief The RTC second, in the logger's time zone, that started at
+     * #_secondEdgeMillis.
+     */
+    static uint32_t _secondEdgeEpoch;
+    /**
+     * @brief True once wakeISR() has noted the time of the clock alarm.
+     */
+    static volatile bool _secondEdgeCaptured;
+    /**
+     * @brief True while #_secondEdgeMillis and #_secondEdgeEpoch can be
+     * trusted - that is, the processor's millisecond count has not stopped
+     * since they were taken.
+     */
+    static bool _secondEdgeKnown;
+#endif
+    /**
+     * @brief The calendar and formatted strings for the marked time.
+     */
+    static CalendarCache _markedCalendar;
+    /**
+     * @brief The calendar for any other time - usually the current time for
+     * file names and timestamps.
+     */
+    static CalendarCache _clockCalendar;
     /**@}*/
 
     // ===================================================================== //
@@ -769,9 +1032,65 @@ class Logger {
      * @brief Put the mcu to sleep to conserve battery life and handle
      * post-interrupt wake actions
      *
+     * The clock alarm is set for the next even interval of the logging rate,
+     * so the processor does not wake up until it is time to log.  If the clock
+     * time is not sane, the alarm is set to go off every minute instead.
+     *
      * @note This DOES NOT sleep or wake the sensors!!
+     *
+     * @note If more than one logger shares the board, use a LoggerGroup, which
+     * wakes at the earliest next interval of any of them.
      */
     void systemSleep(void);
+    /**
+     * @brief Put the mcu to sleep until the given time.
+     *
+     * This is systemSleep() with the wake time chosen by the caller; a
+     * LoggerGroup uses it to wake at the earliest next interval of all of its
+     * loggers.  If the clock time is not sane or the time is too close, the
+     * alarm is set to go off every minute instead.
+     *
+     * @param wake_logTZ The time to wake in the logger's timezone, or 0 to
+     * wake every minute
+     */
+    void systemSleep(uint32_t wake_logTZ);
+
+ protected:
+    /**
+     * @brief Get the time this logger next needs to wake.
+     *
+     * This is the start of the next interval of the logging interval for the
+     * current power tier.
+     *
+     * @return **uint32_t** The time in the logger's timezone, or 0 if the
+     * interval is only a minute and the logger should wake every minute.
+     */
+    uint32_t getNextWakeEpoch(void);
+    /**
+     * @brief Program the RTC alarm to wake the processor.
+     *
+     * If the RTC time is sane, the alarm is set with a full date, hour, minute,
+     * and second match for the given time.  Otherwise, or if that time is too
+     * close to reliably set an alarm for, the alarm is set to go off every
+     * minute.
+     *
+     * @param next_logTZ The time to wake in the logger's timezone, or 0 to
+     * wake every minute
+     * @return **bool** True if the alarm was set for the exact time, false if
+     * the every-minute alarm is being used.
+     */
+    bool setWakeAlarm(uint32_t next_logTZ);
+    /**
+     * @brief Reset the watchdog of a logger.
+     *
+     * This is given to TaskWatch::setWatchDog(), which calls it whenever every
+     * open task is within its deadline.
+     *
+     * @param logger A pointer to the logger
+     */
+    static void feedWatchDog(void* logger);
+
+ public:
 
 #if defined(ARDUINO_ARCH_SAMD)
     /**
@@ -921,6 +1240,18 @@ class Logger {
      */
     bool logToSD(void);
 
+    /**
+     * @brief Set a flash log to keep data lines in while the SD card can't be
+     * written.
+     *
+     * Lines kept in the flash are copied into the data file, ahead of the new
+     * line, the next time logToSD() can open it.  The flash log is started by
+     * begin(); if it is set after that, call FlashLog::begin() yourself.
+     *
+     * @param flashLog The flash log; NULL to stop using one.
+     */
+    void setFallbackLog(FlashLog* flashLog);
+
  protected:
     // The SD card and file
     /**
@@ -973,6 +1304,69 @@ class Logger {
      * @return **bool** True if a file was successfully opened or created.
      */
     bool openFile(String& filename, bool createFile, bool writeDefaultHeader);
+
+    /**
+     * @brief Work out and print how much less time the SD card was powered
+     * this cycle than it would have been if powered for the whole cycle.
+     *
+     * This must be called at the point the card would have been turned off.
+     *
+     * @param millisCycleStart The processor time the card would have been
+     * turned on
+     */
+    void reportSDCardTimeSaved(uint32_t millisCycleStart);
+    /**
+     * @brief The processor time when the SD card was last powered.
+     */
+    uint32_t _millisSDCardOn;
+    /**
+     * @brief The time the SD card was powered the last time it was turned
+     * off, in ms.
+     */
+    uint32_t _SDCardOnTime_ms;
+    /**
+     * @brief The time saved in the last cycle by powering the SD card only to
+     * write, in ms.
+     */
+    int32_t _SDCardTimeSaved_ms;
+
+    /**
+     * @brief An internal reference to the flash log used when the SD card
+     * can't be written.
+     */
+    FlashLog* _flashLog;
+    /**
+     * @brief Write the most recent values to the flash log in place of the SD
+     * card.
+     *
+     * @return **bool** True if the line was kept in the flash.
+     */
+    bool logToFallback(void);
+    /**
+     * @brief Copy any lines waiting in the flash log into the open data file.
+     *
+     * The lines are not marked as moved until the file has been closed.  At
+     * most #MS_FLASH_LOG_COPY_LINES are copied each cycle, and fewer if the
+     * cycle runs out of time, so after a long outage the older lines reach
+     * the file over several cycles, after some newer ones.
+     *
+     * @return **uint16_t** The number of lines copied
+     */
+    uint16_t copyFallbackToSD(void);
+
+#if defined MS_WAKE_PROFILER
+    /**
+     * @brief Write the summary of the last few wake cycles from the
+     * WakeProfiler to #MS_PROFILER_FILE_NAME on the SD card, then reset the
+     * profiler counters.
+     *
+     * This must be called while the SD card is powered and has already been
+     * initialized - ie, right after logToSD().
+     *
+     * @return **bool** True if the record was written
+     */
+    bool writeProfileRecord(void);
+#endif
     /**@}*/
 
     // ===================================================================== //
@@ -1007,8 +1401,321 @@ class Logger {
      * from the internet, and the logger goes back to sleep.
      */
     virtual void testingMode();
+
+    /**
+     * @brief Execute streaming mode, for reading sensors as fast as they
+     * allow on the bench.
+     *
+     * All sensors are powered and woken once and left on.  They are then
+     * polled in a tight loop with VariableArray::pollSensors(), each starting
+     * a new measurement as soon as the last is collected.  Every period, the
+     * latest value of every variable is sent to the "main" output - ie
+     * Serial - as a line of CSV or as a binary frame with a CRC.  See
+     * StreamFrame.h for the frame layout and tools/stream_capture for a host
+     * program that decodes the frames and shows live statistics.
+     *
+     * A header line of the variable codes is sent first in either format.
+     * Nothing is written to the SD card and the modem is not used.
+     * Streaming stops after the requested number of records or as soon as any
+     * character is received on the main output, after which the sensors are
+     * put to sleep and powered down.
+     *
+     * @note In binary format, leave debugging off or send it to another port.
+     * A decoder will skip over the text, but a busy debugging stream slows the
+     * records down.
+     *
+     * @param format The format to send the records in; optional with a
+     * default value of #STREAM_CSV.
+     * @param period_ms The time between records, in ms; 0 to send a record
+     * whenever any sensor has a new result.  Optional with a default value of
+     * #MS_STREAM_PERIOD_MS.
+     * @param maxRecords The number of records to send before stopping; 0 to
+     * stream until a character is received.  Optional with a default value of
+     * 0.
+     */
+    virtual void streamingMode(streamFormat format     = STREAM_CSV,
+                               uint16_t     period_ms  = MS_STREAM_PERIOD_MS,
+                               uint32_t     maxRecords = 0);
+    /**@}*/
+
+    // ===================================================================== //
+    /**
+     * @anchor logger_memory
+     * @name Memory Use
+     * Public functions for reporting how RAM is being used
+     */
+    /**@{*/
+    // ===================================================================== //
+
+    /**
+     * @brief Get the amount of RAM used by static and global data - that is,
+     * the initialized (.data) and zeroed (.bss) sections.
+     *
+     * @return **uint32_t** The static RAM in bytes; 0 if not known for this
+     * processor.
+     */
+    static uint32_t getStaticRAM(void);
+    /**
+     * @brief Get the amount of RAM between the start of the heap and the heap
+     * break.
+     *
+     * The heap break only moves back down when the top-most block is freed, so
+     * this is very close to the high-water mark of the heap.
+     *
+     * @return **uint32_t** The heap size in bytes; 0 if not known for this
+     * processor.
+     */
+    static uint32_t getHeapHighWater(void);
+    /**
+     * @brief Get the amount of RAM currently free between the top of the heap
+     * and the bottom of the stack.
+     *
+     * @return **uint32_t** The free RAM in bytes; 0 if not known for this
+     * processor.
+     */
+    static uint32_t getFreeRAM(void);
+    /**
+     * @brief Get the smallest amount of RAM there has ever been between the
+     * heap and the stack.
+     *
+     * On AVR boards with the build flag MS_MEMORY_REPORT defined, all free RAM
+     * is painted with a known value at boot, before any constructors run, and
+     * this counts how many of those bytes have not yet been touched by either
+     * the heap or the stack.  Otherwise, this is the same as getFreeRAM().
+     *
+     * @return **uint32_t** The stack headroom in bytes
+     */
+    static uint32_t getStackHeadroom(void);
+    /**
+     * @brief Print a report of how RAM is being used.
+     *
+     * This prints the static RAM, heap high-water mark, and stack headroom and
+     * the approximate RAM used by the logger, variables, sensor result arrays,
+     * and publishers.
+     *
+     * If the build flag MS_MEMORY_REPORT is defined, this report is printed at
+     * the end of begin().  Printing it again after the first full logging and
+     * publishing cycle will give the most useful heap and stack numbers.
+     *
+     * @param stream An Arduino stream instance
+     */
+    void printMemoryReport(Stream* stream);
+    /**@}*/
+
+    // ===================================================================== //
+    /**
+     * @anchor logger_energy
+     * @name Energy Use
+     * Public functions for estimating the charge drawn from the battery
+     *
+     * The logger board is modeled with an awake current and a sleep current.
+     * Each sensor and the modem have their own currents, set with
+     * Sensor::setCurrents() and loggerModem::setCurrents().  The charge used
+     * while awake is counted from the processor clock; the charge used while
+     * asleep is estimated by an EnergyModel from the real time clock.
+     */
+    /**@{*/
+    // ===================================================================== //
+
+    /**
+     * @brief Set the currents drawn by the logger board itself.
+     *
+     * A Mayfly starts with the values in EnergyCurrents.h; other boards start
+     * at 0.
+     *
+     * @param awakeCurrent_mA The current while the processor is awake, in mA
+     * @param sleepCurrent_mA The current while the processor is asleep, in mA
+     */
+    void setCurrents(float awakeCurrent_mA, float sleepCurrent_mA);
+    /**
+     * @brief Get the total time the processor has been awake since the logger
+     * started.
+     *
+     * @return **uint32_t** The time awake in milliseconds
+     */
+    uint32_t getAwakeTime(void);
+    /**
+     * @brief Get the charge the logger board has used while awake since the
+     * logger started.
+     *
+     * @return **float** The charge used in mAh
+     */
+    float getBoardChargeUsed(void);
+    /**
+     * @brief Get the charge all of the sensors have used while on since the
+     * logger started.
+     *
+     * @return **float** The charge used in mAh
+     */
+    float getSensorChargeUsed(void);
+    /**
+     * @brief Get the charge the modem has used while powered since the logger
+     * started.
+     *
+     * @return **float** The charge used in mAh; 0 if there is no modem.
+     */
+    float getModemChargeUsed(void);
+    /**
+     * @brief Get the total current drawn while the processor is asleep.
+     *
+     * This is the board sleep current plus the sleep current of every sensor
+     * and modem whose power is not switched by the logger.
+     *
+     * @return **float** The baseline current in mA
+     */
+    float getBaselineCurrent(void);
+    /**
+     * @brief Print the currents and charge used by the board, each sensor,
+     * and the modem.
+     *
+     * @param stream An Arduino stream instance
+     */
+    void printEnergyReport(Stream* stream);
+
+ protected:
+    /**
+     * @brief Add the time since the processor woke to #_awakeTime_ms and the
+     * charge used to #_boardChargeUsed_mAh.
+     *
+     * This is called just before the processor goes to sleep.
+     */
+    void addAwakeTime(void);
+    /**
+     * @brief The current drawn by the logger board while awake, in mA.
+     */
+    float _awakeCurrent_mA;
+    /**
+     * @brief The current drawn by the logger board while asleep, in mA.
+     */
+    float _sleepCurrent_mA;
+    /**
+     * @brief The running total of charge used by the board while awake, in
+     * mAh.
+     */
+    float _boardChargeUsed_mAh;
+    /**
+     * @brief The running total of time the processor has been awake, in ms.
+     */
+    uint32_t _awakeTime_ms;
+    /**
+     * @brief The processor time when the processor last woke.
+     */
+    uint32_t _millisWoke;
+    /**@}*/
+
+ public:
+    // ===================================================================== //
+    /**
+     * @anchor logger_power_policy
+     * @name Battery Power Policy
+     * Public functions for changing what the logger does as the battery runs
+     * down
+     *
+     * When a battery voltage variable is given, it is read at the start of
+     * each logging interval and the logger picks one of the power tiers in
+     * PowerPolicy.h:
+     * - #POWER_TIER_FULL - log and publish as usual
+     * - #POWER_TIER_SD_ONLY - log to the SD card, but do not wake the modem
+     * - #POWER_TIER_REDUCED - log to the SD card only, and only at a multiple
+     * of the logging interval
+     * - #POWER_TIER_CRITICAL - take no measurements; only wake at the longer
+     * interval to check whether the battery has recovered
+     *
+     * Each tier change is printed and written, with the battery voltage, to
+     * the file #MS_POWER_LOG_FILE_NAME on the SD card.
+     */
+    /**@{*/
+    // ===================================================================== //
+
+    /**
+     * @brief Set the variable used to check the battery and turn on the power
+     * policy.
+     *
+     * The battery is read with Variable::getInstantValue(), before the
+     * sensors are updated.  ProcessorStats_Battery is read straight from the
+     * battery pin.  Other sensor variables give the value from the last
+     * logging cycle, and a calculated variable (like Modem_BatteryVoltage)
+     * gives the last value stored.  Values in millivolts are converted to
+     * volts.
+     *
+     * @param batteryVoltage The battery voltage variable; NULL to turn off the
+     * power policy.
+     * @param reducedIntervalMultiplier The number of logging intervals between
+     * readings in the reduced and critical tiers; optional with a default value
+     * of #MS_POWER_REDUCED_MULTIPLIER.
+     */
+    void setPowerPolicy(
+        Variable* batteryVoltage,
+        uint8_t   reducedIntervalMultiplier = MS_POWER_REDUCED_MULTIPLIER);
+    /**
+     * @brief Set the battery voltages at which the logger changes power tiers.
+     *
+     * @param sdOnly_V Below this, the logger stops publishing
+     * @param reduced_V Below this, the logging interval is lengthened
+     * @param critical_V Below this, no measurements are taken
+     * @param hysteresis_V How far above a threshold the battery must recover
+     * before moving back up a tier; optional with a default value of
+     * #MS_POWER_HYSTERESIS_V.
+     */
+    void setPowerTierThresholds(float sdOnly_V, float reduced_V,
+                                float critical_V,
+                                float hysteresis_V = MS_POWER_HYSTERESIS_V);
+    /**
+     * @brief Get the current power tier.
+     *
+     * @return **powerTier** The current power tier
+     */
+    powerTier getPowerTier(void) {
+        return _powerTier;
+    }
+
+ protected:
+    /**
+     * @brief Read the battery, update the power tier, and check if the current
+     * interval should be logged in that tier.
+     *
+     * This must be called after the time has been marked.
+     *
+     * @return **bool** True if measurements should be taken this interval
+     */
+    bool checkPowerTier(void);
+    /**
+     * @brief Get the logging interval for the current power tier.
+     *
+     * @return **uint16_t** The interval between readings in minutes
+     */
+    uint16_t getTierLoggingInterval(void);
+    /**
+     * @brief Write a power tier change to the file #MS_POWER_LOG_FILE_NAME on
+     * the SD card.
+     *
+     * @param newTier The tier being moved to
+     * @param battery_V The battery voltage that caused the change
+     * @return **bool** True if the record was written
+     */
+    bool writePowerTierRecord(powerTier newTier, float battery_V);
+    /**
+     * @brief The variable used to check the battery; NULL if there is no power
+     * policy.
+     */
+    Variable* _batteryVar;
+    /**
+     * @brief The battery voltages at which the power tier changes.
+     */
+    powerTierThresholds _powerThresholds;
+    /**
+     * @brief The number of logging intervals between readings in the reduced
+     * and critical tiers.
+     */
+    uint8_t _reducedIntervalMultiplier;
+    /**
+     * @brief The current power tier.
+     */
+    powerTier _powerTier;
     /**@}*/
 
+ public:
+
     // ===================================================================== //
     /**
      * @anchor logger_conv
@@ -1081,6 +1788,14 @@ class Logger {
      */
     static uint32_t markedEpochTimeUTC;
 
+    /**
+     * @brief The millisecond within the marked second, from 0 to 999.
+     *
+     * This is always 0 unless the build flag MS_MILLISECOND_TIMESTAMPS is set
+     * and the processor's millisecond count has been tied to the RTC.
+     */
+    static uint16_t markedMillis;
+
     // These are flag fariables noting the current state (logging/testing)
     // NOTE:  if the logger isn't currently logging or testing or in the middle
     // of set-up, it's probably sleeping
@@ -0,0 +1,260 @@
+/**
+ * @file LoggerGroup.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the LoggerGroup class.
+ */
+
+#include "LoggerGroup.h"
+
+
+// Constructors
+LoggerGroup::LoggerGroup()
+    : _loggerCount(0), _loggerList(NULL), _dueVariables(NULL) {}
+LoggerGroup::LoggerGroup(uint8_t loggerCount, Logger* loggerList[])
+    : _loggerCount(loggerCount),
+      _loggerList(loggerList),
+      _dueVariables(NULL) {}
+// Destructor
+LoggerGroup::~LoggerGroup() {
+    delete[] _dueVariables;
+}
+
+
+void LoggerGroup::begin(uint8_t loggerCount, Logger* loggerList[]) {
+    _loggerCount = loggerCount;
+    _loggerList  = loggerList;
+    begin();
+}
+void LoggerGroup::begin(void) {
+    // Make room for every variable of every logger, once
+    uint16_t nVariables = 0;
+    for (uint8_t i = 0; i < _loggerCount; i++) {
+        nVariables += _loggerList[i]->getArrayVarCount();
+    }
+    delete[] _dueVariables;
+    _dueVariables = new Variable*[nVariables];
+    MS_DBG(F("Grouped"), _loggerCount, F("loggers with"), nVariables,
+           F("variables in all"));
+}
+
+
+uint8_t LoggerGroup::getLoggerCount(void) {
+    return _loggerCount;
+}
+
+
+void LoggerGroup::logData(void) {
+    runCycle(false);
+}
+void LoggerGroup::logDataAndPublish(void) {
+    runCycle(true);
+}
+
+
+void LoggerGroup::runCycle(bool publish) {
+    if (_loggerCount == 0) { return; }
+    Logger* lead = _loggerList[0];
+
+    // Feed the watchdog and clear any task left open by the last cycle
+    TaskWatch::startCycle();
+
+    // Mark the time once, so every logger checks the same instant
+    Logger::markTime();
+    if (!Logger::isRTCSane(Logger::markedEpochTime)) {
+        PRINTOUT(F("The current clock timestamp is not valid!"));
+    }
+
+    // Find the loggers that are due and whose battery can support logging now
+    bool    due[_loggerCount];
+    uint8_t nDue = 0;
+    for (uint8_t i = 0; i < _loggerCount; i++) {
+        due[i] = _loggerList[i]->checkMarkedInterval() &&
+            _loggerList[i]->checkPowerTier();
+        if (due[i]) { nDue++; }
+    }
+
+    if (nDue > 0) {
+        // Flag to notify that we're in already awake and logging a point
+        Logger::isLoggingNow = true;
+        TaskWatch::yield();
+
+        // Print a line to show new reading
+        PRINTOUT(F("------------------------------------------"));
+        PRINTOUT(nDue, F("of"), _loggerCount, F("loggers are due"));
+        // Turn on the LED to show we're taking a reading
+        lead->alertOn();
+        // Mark when the SD card would have been powered for the whole cycle
+        uint32_t cycleStart = millis();
+
+        // Measure every due sensor once
+        MS_PROFILE_START(updateTimer);
+        updateDueSensors(due);
+        MS_PROFILE_STOP(updateTimer, PROFILE_SENSOR_UPDATE);
+        TaskWatch::yield();
+
+        // Power up the SD card once and write every due logger's record
+        lead->turnOnSDcard(false);
+        for (uint8_t i = 0; i < _loggerCount; i++) {
+            if (due[i]) {
+                _loggerList[i]->logToSD();
+                _loggerList[i]->cacheRecord();
+                TaskWatch::yield();
+            }
+        }
+#if defined MS_WAKE_PROFILER
+        // Write out the wake profile, if enough cycles have been timed
+        if (WakeProfiler::recordDue()) { lead->writeProfileRecord(); }
+#endif
+        lead->turnOffSDcard(true);
+
+        if (publish) { publishDue(due); }
+
+        lead->reportSDCardTimeSaved(cycleStart);
+
+        // Turn off the LED
+        lead->alertOff();
+        // Print a line to show reading ended
+        PRINTOUT(F("------------------------------------------\n"));
+
+        // Unset flag
+        Logger::isLoggingNow = false;
+    }
+
+    // Check if it was instead the testing interrupt that woke us up
+    if (Logger::startTesting) lead->testingMode();
+
+    // Sleep until the earliest next interval of any logger in the group, so a
+    // logger with a shorter interval than the lead is never skipped
+    uint32_t wake_logTZ = lead->getNextWakeEpoch();
+    for (uint8_t i = 1; i < _loggerCount; i++) {
+        wake_logTZ = wakeAlarmEarliest(wake_logTZ,
+                                       _loggerList[i]->getNextWakeEpoch());
+    }
+    lead->systemSleep(wake_logTZ);
+}
+
+
+void LoggerGroup::updateDueSensors(const bool due[]) {
+    // Collect one measured variable for each sensor any due logger uses
+    uint8_t nDueVariables = 0;
+    for (uint8_t i = 0; i < _loggerCount; i++) {
+        if (!due[i]) { continue; }
+        VariableArray* array = _loggerList[i]->_internalArray;
+        for (uint8_t j = 0; j < array->getVariableCount(); j++) {
+            Variable* var = array->arrayOfVars[j];
+            if (var->isCalculated) { continue; }
+            bool seen = false;
+            for (uint8_t k = 0; k < nDueVariables && !seen; k++) {
+                seen = _dueVariables[k]->parentSensor == var->parentSensor;
+            }
+            if (!seen) { _dueVariables[nDueVariables++] = var; }
+        }
+    }
+    MS_DBG(F("Updating"), nDueVariables, F("sensors for the due loggers..."));
+
+    // Update them all together, so they share one power plan
+    _dueArray.setVariables(nDueVariables, _dueVariables);
+    _dueArray.completeUpdate();
+
+    // A sensor only notifies the last variable registered for each of its
+    // results, so hand the results to every due logger's variables directly
+    for (uint8_t i = 0; i < _loggerCount; i++) {
+        if (!due[i]) { continue; }
+        VariableArray* array = _loggerList[i]->_internalArray;
+        for (uint8_t j = 0; j < array->getVariableCount(); j++) {
+            Variable* var = array->arrayOfVars[j];
+            if (!var->isCalculated) { var->onSensorUpdate(var->parentSensor); }
+        }
+    }
+}
+
+
+void LoggerGroup::publishDue(const bool due[]) {
+    // Use the modem of the first due logger that has one, has the power, and
+    // has a publisher due to send
+    Logger* modemLogger = NULL;
+    for (uint8_t i = 0; i < _loggerCount && modemLogger == NULL; i++) {
+        if (due[i] && _loggerList[i]->_logModem != NULL) {
+            if (_loggerList[i]->_powerTier != POWER_TIER_FULL) {
+                MS_DBG(F("Battery is low; not publishing data."));
+            } else if (_loggerList[i]->isPublishDue()) {
+                modemLogger = _loggerList[i];
+            }
+        }
+    }
+    // The clock sync needs a modem even when no publisher is due, and any
+    // logger's modem will do
+    if (modemLogger == NULL && Logger::isClockSyncDue()) {
+        for (uint8_t i = 0; i < _loggerCount && modemLogger == NULL; i++) {
+            if (_loggerList[i]->_logModem != NULL &&
+                _loggerList[i]->_powerTier == POWER_TIER_FULL) {
+                modemLogger = _loggerList[i];
+            }
+        }
+    }
+    if (modemLogger == NULL) { return; }
+    loggerModem* modem = modemLogger->_logModem;
+
+    MS_DBG(F("Waking up"), modem->getModemName(), F("..."));
+    TaskWatch::begin(F("Modem connection"), MS_TASK_CONNECT_MS);
+    MS_PROFILE_START(modemWakeTimer);
+    bool modemAwake = modem->modemWake();
+    MS_PROFILE_STOP(modemWakeTimer, PROFILE_MODEM_WAKE);
+    bool connected = false;
+    if (modemAwake) {
+        // Connect to the network
+        MS_DBG(F("Connecting to the Internet..."));
+        MS_PROFILE_START(attachTimer);
+        connected = modem->connectInternet();
+        MS_PROFILE_STOP(attachTimer, PROFILE_MODEM_ATTACH);
+    }
+    // A connection that came too late is treated as a failure
+    connected &= TaskWatch::end();
+
+    if (connected) {
+        // Publish for every due logger on this modem
+        for (uint8_t i = 0; i < _loggerCount; i++) {
+            if (!due[i]) { continue; }
+            if (_loggerList[i]->_logModem == modem &&
+                _loggerList[i]->_powerTier == POWER_TIER_FULL) {
+                TaskWatch::yield();
+                _loggerList[i]->publishDataToRemotes();
+            } else if (_loggerList[i]->_logModem != NULL) {
+                MS_DBG(F("Logger"), i, F("uses another modem or is low on"),
+                       F("power; not publishing its data."));
+            }
+        }
+        TaskWatch::yield();
+
+        if (Logger::isClockSyncDue()) {
+            // Sync the clock at noon
+            MS_DBG(F("Running a daily clock sync..."));
+            MS_PROFILE_START(clockSyncTimer);
+            modemLogger->setRTClock(modem->getNISTTime());
+            MS_PROFILE_STOP(clockSyncTimer, PROFILE_CLOCK_SYNC);
+            TaskWatch::yield();
+        }
+
+        // Update the modem metadata
+        MS_DBG(F("Updating modem metadata..."));
+        MS_PROFILE_START(metadataTimer);
+        modem->updateModemMetadata();
+        MS_PROFILE_STOP(metadataTimer, PROFILE_MODEM_METADATA);
+
+        // Disconnect from the network
+        MS_DBG(F("Disconnecting from the Internet..."));
+        MS_PROFILE_START(disconnectTimer);
+        modem->disconnectInternet();
+        MS_PROFILE_STOP(disconnectTimer, PROFILE_MODEM_DISCONNECT);
+    } else if (modemAwake) {
+        MS_DBG(F("Could not connect to the internet!"));
+        TaskWatch::yield();
+    }
+
+    // Turn the modem off
+    MS_PROFILE_START(modemSleepTimer);
+    modem->modemSleepPowerDown();
+    MS_PROFILE_STOP(modemSleepTimer, PROFILE_MODEM_SLEEP);
+}
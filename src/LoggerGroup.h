@@ -0,0 +1,167 @@
+/**
+ * @file LoggerGroup.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the LoggerGroup class, which runs the logging cycles of
+ * several loggers that share sensors, an SD card, and a modem as one cycle.
+ *
+ * When two loggers run their own cycles - as in the double_logger example -
+ * and both are due in the same minute, any sensor in both arrays is powered
+ * and measured twice, the SD card is powered up twice, and the modem connects
+ * twice.  A group instead:
+ * - finds every logger due at the marked time,
+ * - measures each sensor used by any of them just once, with a single
+ * VariableArray::completeUpdate() over all of their sensors, and hands the
+ * results to the variables of every due logger,
+ * - powers the SD card once and writes each due logger's file in turn, and
+ * - wakes and connects the modem once and publishes for each due logger.
+ *
+ * Build the loggers as usual - each with its own variable array, logging
+ * interval, and file name - then group them and let the group run the loop:
+ * @code{.cpp}
+ * Logger*     loggers[] = {&logger1min, &logger5min};
+ * LoggerGroup group(2, loggers);
+ *
+ * void loop() {
+ *     group.logDataAndPublish();
+ * }
+ * @endcode
+ *
+ * The first logger in the group leads: its SD card power pin, wake pin, and
+ * watchdog are used for the whole group.  The loggers can have any intervals,
+ * in any order; the group sets the clock alarm for the earliest next interval
+ * of any of them, using the interval of each logger's current power tier.  If
+ * any logger is on a 1 minute interval, the group wakes every minute.
+ */
+
+// Header Guards
+#ifndef SRC_LOGGERGROUP_H_
+#define SRC_LOGGERGROUP_H_
+
+// Debugging Statement
+// #define MS_LOGGERGROUP_DEBUG
+
+#ifdef MS_LOGGERGROUP_DEBUG
+#define MS_DEBUGGING_STD "LoggerGroup"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "LoggerBase.h"
+
+/**
+ * @brief The LoggerGroup class coordinates the logging cycles of several
+ * Logger objects so that shared hardware is only used once per cycle.
+ *
+ * @ingroup base_classes
+ */
+class LoggerGroup {
+ public:
+    /**
+     * @brief Construct a new, empty, Logger Group object.
+     */
+    LoggerGroup();
+    /**
+     * @brief Construct a new Logger Group object.
+     *
+     * @param loggerCount The number of loggers in the group
+     * @param loggerList An array of pointers to the loggers.  The first logger
+     * leads the group's hardware; its interval does not need to be the
+     * shortest.
+     */
+    LoggerGroup(uint8_t loggerCount, Logger* loggerList[]);
+    /**
+     * @brief Destroy the Logger Group object.
+     */
+    virtual ~LoggerGroup();
+
+    /**
+     * @brief Set the loggers in the group.
+     *
+     * Call this in setup, after calling begin() on every logger, so that the
+     * loggers' variable arrays are known.
+     *
+     * @param loggerCount The number of loggers in the group.  Supercedes any
+     * value given in the constructor.
+     * @param loggerList An array of pointers to the loggers.  Supercedes any
+     * value given in the constructor.
+     */
+    void begin(uint8_t loggerCount, Logger* loggerList[]);
+    /**
+     * @brief Size the group's internal lists for the loggers given in the
+     * constructor.
+     *
+     * Call this in setup, after calling begin() on every logger.
+     */
+    void begin(void);
+
+    /**
+     * @brief Get the number of loggers in the group.
+     *
+     * @return **uint8_t** The number of loggers
+     */
+    uint8_t getLoggerCount(void);
+
+    /**
+     * @brief Run one logging cycle for every logger that is due, saving the
+     * data to the SD card only, then put the processor to sleep.
+     *
+     * This is the group version of Logger::logData().
+     */
+    void logData(void);
+    /**
+     * @brief Run one logging cycle for every logger that is due, saving the
+     * data to the SD card and publishing it over a single modem session, then
+     * put the processor to sleep.
+     *
+     * This is the group version of Logger::logDataAndPublish().  Only the
+     * modem of the first due logger that has one is used; due loggers with a
+     * different modem are not published.
+     */
+    void logDataAndPublish(void);
+
+ protected:
+    /**
+     * @brief The number of loggers in the group.
+     */
+    uint8_t _loggerCount;
+    /**
+     * @brief The loggers in the group; the first one leads.
+     */
+    Logger** _loggerList;
+    /**
+     * @brief One measured variable for each sensor due in this cycle.
+     *
+     * This is sized in begin() to hold every variable of every logger, so it
+     * never has to grow.
+     */
+    Variable** _dueVariables;
+    /**
+     * @brief The variable array used to update the due sensors together.
+     */
+    VariableArray _dueArray;
+
+    /**
+     * @brief Run one logging cycle for the due loggers.
+     *
+     * @param publish True to also publish the data.
+     */
+    void runCycle(bool publish);
+    /**
+     * @brief Measure each sensor used by any due logger once and pass the
+     * results to the variables of all of them.
+     *
+     * @param due Whether each logger is due in this cycle.
+     */
+    void updateDueSensors(const bool due[]);
+    /**
+     * @brief Publish the data of every due logger over one modem session.
+     *
+     * @param due Whether each logger is due in this cycle.
+     */
+    void publishDue(const bool due[]);
+};
+
+#endif  // SRC_LOGGERGROUP_H_
@@ -16,6 +16,7 @@ float   loggerModem::_priorModemTemp      = -9999;
 float   loggerModem::_priorBatteryState   = -9999;
 float   loggerModem::_priorBatteryPercent = -9999;
 float   loggerModem::_priorBatteryVoltage = -9999;
+uint8_t loggerModem::_requestedMetadata   = 0;
 // float loggerModem::_priorActivationDuration = -9999;
 // float loggerModem::_priorPoweredDuration = -9999;
 
@@ -36,7 +37,9 @@ loggerModem::loggerModem(int8_t powerPin, int8_t statusPin, bool statusLevel,
       _disconnetTime_ms(max_disconnetTime_ms),
       _wakeDelayTime_ms(wakeDelayTime_ms),
       _max_atresponse_time_ms(max_atresponse_time_ms), _modemLEDPin(-1),
-      _millisPowerOn(0), _lastNISTrequest(0), _hasBeenSetup(false),
+      _millisPowerOn(0), _millisModemAwake(0), _activeCurrent_mA(0),
+      _idleCurrent_mA(0), _sleepCurrent_mA(0), _chargeUsed_mAh(0),
+      _millisChargeCounted(0), _lastNISTrequest(0), _hasBeenSetup(false),
       _pinModesSet(false), _modemName("unspecified modem") {}
 
 
@@ -90,6 +93,9 @@ void loggerModem::modemPowerDown(void) {
         // MS_DBG(F("Total modem power-on time (s):"),
         //        String(loggerModem::_priorPoweredDuration, 3));
 
+        // Count the charge used while it was powered
+        addChargeUsed();
+
         MS_DBG(F("Turning off power to"), getModemName(), F("with pin"),
                _powerPin);
         digitalWrite(_powerPin, LOW);
@@ -103,6 +109,52 @@ void loggerModem::modemPowerDown(void) {
     }
 }
 
+// These functions get and set the currents used for the energy estimates
+void loggerModem::setCurrents(float activeCurrent_mA, float idleCurrent_mA,
+                              float sleepCurrent_mA) {
+    _activeCurrent_mA = activeCurrent_mA;
+    _idleCurrent_mA   = idleCurrent_mA;
+    _sleepCurrent_mA  = sleepCurrent_mA;
+}
+float loggerModem::getBaselineCurrent(void) {
+    // A modem on a power pin draws nothing while the power is off
+    return _powerPin >= 0 ? 0 : _sleepCurrent_mA;
+}
+float loggerModem::getChargeUsed(void) {
+    return _chargeUsed_mAh;
+}
+
+// This adds the charge used since the last count to the running total
+void loggerModem::addChargeUsed(void) {
+    uint32_t now = millis();
+    // Only count time since the last count; comparing the elapsed times keeps
+    // this safe over a millis() roll-over.
+    uint32_t countable = _millisChargeCounted != 0 ? now - _millisChargeCounted
+                                                   : now;
+
+    uint32_t activeFor = 0;
+    if (_millisModemAwake != 0) {
+        activeFor = now - _millisModemAwake;
+        if (activeFor > countable) { activeFor = countable; }
+    }
+    // Modems without a power pin are only counted while they are awake; the
+    // time between cycles is covered by the baseline current.
+    uint32_t idleFor = 0;
+    if (_powerPin >= 0 && _millisPowerOn != 0) {
+        uint32_t poweredFor = now - _millisPowerOn;
+        if (poweredFor > countable) { poweredFor = countable; }
+        if (poweredFor > activeFor) { idleFor = poweredFor - activeFor; }
+    }
+
+    _chargeUsed_mAh += (_activeCurrent_mA * activeFor +
+                        _idleCurrent_mA * idleFor) /
+        3600000.0f;
+    _millisChargeCounted = now;
+    MS_DBG(getModemName(), F("was awake for"), activeFor,
+           F("ms and idle for"), idleFor, F("ms; total charge used:"),
+           String(_chargeUsed_mAh, 4), F("mAh"));
+}
+
 bool loggerModem::modemSetup(void) {
     // NOTE:  Set flag FIRST to stop infinite loop between modemSetup() and
     // modemWake()
@@ -121,7 +173,9 @@ bool loggerModem::modemSetup(void) {
     // Check if the modem was awake, wake it if not
     bool wasAwake = isModemAwake();
     if (!wasAwake) {
-        while (millis() - _millisPowerOn < _wakeDelayTime_ms) {}
+        while (millis() - _millisPowerOn < _wakeDelayTime_ms) {
+            TaskWatch::yield();
+        }
         MS_DBG(F("Waking up the modem for setup ..."));
         success &= modemWake();
     } else {
@@ -184,11 +238,15 @@ bool loggerModem::modemSleep(void) {
                F("is already off!  Will not run sleep function."));
         // loggerModem::_priorActivationDuration = 0;
     } else {
+        // Count the charge used while it was awake
+        addChargeUsed();
         // Run the sleep function
         MS_DBG(F("Running given sleep function for"), getModemName());
         success &= modemSleepFxn();
         modemLEDOff();
     }
+    // Unset the wake time
+    _millisModemAwake = 0;
     return success;
 }
 
@@ -210,7 +268,9 @@ bool loggerModem::modemSleepPowerDown(void) {
                    _statusPin, F("going"), !_statusLevel ? F("HIGH") : F("LOW"),
                    F("..."));
             while (millis() - start < _disconnetTime_ms &&
-                   digitalRead(_statusPin) == static_cast<int>(_statusLevel)) {}
+                   digitalRead(_statusPin) == static_cast<int>(_statusLevel)) {
+                TaskWatch::yield();
+            }
             if (digitalRead(_statusPin) == static_cast<int>(_statusLevel)) {
                 MS_DBG(F("... "), getModemName(),
                        F("did not successfully shut down!"));
@@ -221,7 +281,7 @@ bool loggerModem::modemSleepPowerDown(void) {
         } else if (_disconnetTime_ms > 0) {
             MS_DBG(F("Waiting"), _disconnetTime_ms,
                    F("ms for graceful shutdown."));
-            while (millis() - start < _disconnetTime_ms) {}
+            while (millis() - start < _disconnetTime_ms) { TaskWatch::yield(); }
         }
 
         // loggerModem::_priorPoweredDuration =
@@ -229,6 +289,9 @@ bool loggerModem::modemSleepPowerDown(void) {
         // MS_DBG(F("Total modem power-on time (s):"),
         //        String(loggerModem::_priorPoweredDuration, 3));
 
+        // Count the charge used while it was powered
+        addChargeUsed();
+
         MS_DBG(F("Turning off power to"), getModemName(), F("with pin"),
                _powerPin);
         digitalWrite(_powerPin, LOW);
@@ -320,7 +383,7 @@ bool loggerModem::updateModemMetadata(void) {
     loggerModem::_priorSignalPercent  = -9999;
     loggerModem::_priorBatteryState   = -9999;
     loggerModem::_priorBatteryPercent = -9999;
-    loggerModem::_priorBatteryPercent = -9999;
+    loggerModem::_priorBatteryVoltage = -9999;
     loggerModem::_priorModemTemp      = -9999;
 
     // Initialize variable
@@ -330,44 +393,65 @@ bool loggerModem::updateModemMetadata(void) {
     int8_t   bpercent = -99;
     uint16_t volt     = 9999;
 
-    // Try for up to 15 seconds to get a valid signal quality
+    // Only ask the modem for what some variable will use
     uint32_t startMillis = millis();
-    do {
-        success &= getModemSignalQuality(rssi, percent);
-        loggerModem::_priorRSSI          = rssi;
-        loggerModem::_priorSignalPercent = percent;
-        if (rssi != 0 && rssi != -9999) break;
-        delay(250);
-    } while ((rssi == 0 || rssi == -9999) && millis() - startMillis < 15000L &&
-             success);
-    MS_DBG(F("CURRENT RSSI:"), rssi);
-    MS_DBG(F("CURRENT Percent signal strength:"), percent);
-
-    success &= getModemBatteryStats(state, bpercent, volt);
-    MS_DBG(F("CURRENT Modem Battery Charge State:"), state);
-    MS_DBG(F("CURRENT Modem Battery Charge Percentage:"), bpercent);
-    MS_DBG(F("CURRENT Modem Battery Voltage:"), volt);
-    if (state != 99)
-        loggerModem::_priorBatteryState = static_cast<float>(state);
-    else
-        loggerModem::_priorBatteryState = static_cast<float>(-9999);
-
-    if (bpercent != -99)
-        loggerModem::_priorBatteryPercent = static_cast<float>(bpercent);
-    else
-        loggerModem::_priorBatteryPercent = static_cast<float>(-9999);
-
-    if (volt != 9999)
-        loggerModem::_priorBatteryVoltage = static_cast<float>(volt);
-    else
-        loggerModem::_priorBatteryVoltage = static_cast<float>(-9999);
-
-    loggerModem::_priorModemTemp = getModemChipTemperature();
-    MS_DBG(F("CURRENT Modem Chip Temperature:"), loggerModem::_priorModemTemp);
+    if (isMetadataRequested(MODEM_METADATA_SIGNAL)) {
+        // Try for up to 15 seconds to get a valid signal quality
+        do {
+            success &= getModemSignalQuality(rssi, percent);
+            loggerModem::_priorRSSI          = rssi;
+            loggerModem::_priorSignalPercent = percent;
+            if (rssi != 0 && rssi != -9999) break;
+            delay(250);
+        } while ((rssi == 0 || rssi == -9999) &&
+                 millis() - startMillis < 15000L && success &&
+                 TaskWatch::yield());
+        MS_DBG(F("CURRENT RSSI:"), rssi);
+        MS_DBG(F("CURRENT Percent signal strength:"), percent);
+    }
+
+    if (isMetadataRequested(MODEM_METADATA_BATTERY)) {
+        success &= getModemBatteryStats(state, bpercent, volt);
+        MS_DBG(F("CURRENT Modem Battery Charge State:"), state);
+        MS_DBG(F("CURRENT Modem Battery Charge Percentage:"), bpercent);
+        MS_DBG(F("CURRENT Modem Battery Voltage:"), volt);
+        if (state != 99)
+            loggerModem::_priorBatteryState = static_cast<float>(state);
+        else
+            loggerModem::_priorBatteryState = static_cast<float>(-9999);
+
+        if (bpercent != -99)
+            loggerModem::_priorBatteryPercent = static_cast<float>(bpercent);
+        else
+            loggerModem::_priorBatteryPercent = static_cast<float>(-9999);
+
+        if (volt != 9999)
+            loggerModem::_priorBatteryVoltage = static_cast<float>(volt);
+        else
+            loggerModem::_priorBatteryVoltage = static_cast<float>(-9999);
+    }
+
+    if (isMetadataRequested(MODEM_METADATA_TEMPERATURE)) {
+        loggerModem::_priorModemTemp = getModemChipTemperature();
+        MS_DBG(F("CURRENT Modem Chip Temperature:"),
+               loggerModem::_priorModemTemp);
+    }
+    MS_DBG(F("Updating the modem metadata took"), millis() - startMillis,
+           F("ms"));
 
     return success;
 }
 
+
+void loggerModem::requestMetadata(uint8_t metadata) {
+    _requestedMetadata |= metadata;
+}
+
+
+bool loggerModem::isMetadataRequested(uint8_t metadata) {
+    return (_requestedMetadata & metadata) != 0;
+}
+
 float loggerModem::getModemRSSI() {
     float retVal = loggerModem::_priorRSSI;
     // MS_DBG(F("PRIOR RSSI:"), retVal);
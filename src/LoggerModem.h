@@ -34,6 +34,8 @@
 #include "ModSensorDebugger.h"
 #undef MS_DEBUGGING_STD
 #include "VariableBase.h"
+#include "TaskWatch.h"
+#include "EnergyCurrents.h"
 #include <Arduino.h>
 
 
@@ -273,6 +275,22 @@
 #endif
 /**@}*/
 
+/**
+ * @anchor modem_metadata_bits
+ * @name Modem Metadata Requests
+ * The bits passed to loggerModem::requestMetadata() by the modem variables.
+ * updateModemMetadata() only queries the modem for values that a variable will
+ * use.
+ */
+/**@{*/
+/// @brief The RSSI and percent signal strength
+#define MODEM_METADATA_SIGNAL 0x01
+/// @brief The battery charge state, percent, and voltage
+#define MODEM_METADATA_BATTERY 0x02
+/// @brief The chip temperature
+#define MODEM_METADATA_TEMPERATURE 0x04
+/**@}*/
+
 
 /* ===========================================================================
  * Functions for the modem class
@@ -649,6 +667,69 @@ class loggerModem {
 
     // static float getModemActivationDuration();
     // static float getModemPoweredDuration();
+
+    /**
+     * @brief Ask for a piece of metadata to be queried by
+     * updateModemMetadata().
+     *
+     * The modem variables call this when they are created.  Metadata that
+     * no variable asks for is not queried, saving the time the modem takes to
+     * answer.
+     *
+     * @param metadata One or more of the @ref modem_metadata_bits
+     * "metadata request bits"
+     */
+    static void requestMetadata(uint8_t metadata);
+    /**
+     * @brief Check whether any variable has asked for a piece of metadata.
+     *
+     * @param metadata One of the @ref modem_metadata_bits
+     * "metadata request bits"
+     * @return **bool** True if the metadata will be queried.
+     */
+    static bool isMetadataRequested(uint8_t metadata);
+    /**@}*/
+
+    /**
+     * @anchor modem_energy_functions
+     * @name Energy Use
+     * Functions for estimating the charge the modem draws from the battery
+     *
+     * The modem has an active current drawn while it is awake, an idle current
+     * drawn while it is powered but asleep, and a sleep current drawn between
+     * logging cycles if its power is not switched by the logger.  Each modem
+     * sub-class starts with the datasheet values in EnergyCurrents.h; the
+     * rest default to 0 until set with setCurrents().
+     */
+    /**@{*/
+    /**
+     * @brief Set the currents drawn by the modem in each state.
+     *
+     * @param activeCurrent_mA The average current while the modem is awake,
+     * including any time spent connecting and transmitting, in mA
+     * @param idleCurrent_mA The current while the modem is powered but asleep,
+     * in mA
+     * @param sleepCurrent_mA The current drawn between logging cycles if the
+     * modem power is not switched, in mA
+     */
+    void setCurrents(float activeCurrent_mA, float idleCurrent_mA,
+                     float sleepCurrent_mA);
+    /**
+     * @brief Get the current the modem draws between logging cycles.
+     *
+     * This is the sleep current for modems that are continuously powered and
+     * zero for modems with a power pin.
+     *
+     * @return **float** The baseline current in mA
+     */
+    float getBaselineCurrent(void);
+    /**
+     * @brief Get the total charge the modem has used while powered since the
+     * logger started.
+     *
+     * @return **float** The charge used in mAh
+     */
+    float getChargeUsed(void);
     /**@}*/
 
  protected:
@@ -907,6 +988,44 @@ class loggerModem {
      */
     uint32_t _millisPowerOn;
 
+    /**
+     * @brief The processor elapsed time when the modem was last woken.
+     *
+     * The #_millisModemAwake value is set in the modemWake() function.  It is
+     * un-set in the modemSleep() function.
+     */
+    uint32_t _millisModemAwake;
+
+    /**
+     * @brief Add the charge used since the last count to #_chargeUsed_mAh.
+     *
+     * This is called as the modem is put to sleep and as it is powered down.
+     */
+    void addChargeUsed(void);
+    /**
+     * @brief The current drawn by the modem while it is awake, in mA.
+     */
+    float _activeCurrent_mA;
+    /**
+     * @brief The current drawn by the modem while it is powered but asleep, in
+     * mA.
+     */
+    float _idleCurrent_mA;
+    /**
+     * @brief The current drawn by a continuously powered modem between logging
+     * cycles, in mA.
+     */
+    float _sleepCurrent_mA;
+    /**
+     * @brief The running total of charge used while powered, in mAh.
+     */
+    float _chargeUsed_mAh;
+    /**
+     * @brief The processor time up to which charge has been added to
+     * #_chargeUsed_mAh.
+     */
+    uint32_t _millisChargeCounted;
+
     /**
      * @brief The processor elapsed time when the a connection to the NIST time
      * server was last attempted.
@@ -977,6 +1096,12 @@ class loggerModem {
      * Returned by #getModemBatteryVoltage().
      */
     static float _priorBatteryVoltage;
+    /**
+     * @brief The metadata that variables have asked for
+     *
+     * Set by requestMetadata().  Checked by updateModemMetadata().
+     */
+    static uint8_t _requestedMetadata;
     // static float _priorActivationDuration;
     // static float _priorPoweredDuration;
     /**@}*/
@@ -1018,8 +1143,10 @@ class Modem_RSSI : public Variable {
     explicit Modem_RSSI(loggerModem* parentModem, const char* uuid = "",
                         const char* varCode = MODEM_RSSI_DEFAULT_CODE)
         : Variable(&parentModem->getModemRSSI, (uint8_t)MODEM_RSSI_RESOLUTION,
-                   &*MODEM_RSSI_VAR_NAME, &*MODEM_RSSI_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(MODEM_RSSI_VAR_NAME), F(MODEM_RSSI_UNIT_NAME), varCode,
+                   uuid) {
+        loggerModem::requestMetadata(MODEM_METADATA_SIGNAL);
+    }
     /**
      * @brief Destroy the Modem_RSSI object - no action needed.
      */
@@ -1051,8 +1178,10 @@ class Modem_SignalPercent : public Variable {
         const char* varCode = MODEM_PERCENT_SIGNAL_DEFAULT_CODE)
         : Variable(&parentModem->getModemSignalPercent,
                    (uint8_t)MODEM_PERCENT_SIGNAL_RESOLUTION,
-                   &*MODEM_PERCENT_SIGNAL_VAR_NAME,
-                   &*MODEM_PERCENT_SIGNAL_UNIT_NAME, varCode, uuid) {}
+                   F(MODEM_PERCENT_SIGNAL_VAR_NAME),
+                   F(MODEM_PERCENT_SIGNAL_UNIT_NAME), varCode, uuid) {
+        loggerModem::requestMetadata(MODEM_METADATA_SIGNAL);
+    }
     /**
      * @brief Destroy the Modem_SignalPercent object - no action needed.
      */
@@ -1087,8 +1216,10 @@ class Modem_BatteryState : public Variable {
         const char* varCode = MODEM_BATTERY_STATE_DEFAULT_CODE)
         : Variable(&parentModem->getModemBatteryChargeState,
                    (uint8_t)MODEM_BATTERY_STATE_RESOLUTION,
-                   &*MODEM_BATTERY_STATE_VAR_NAME,
-                   &*MODEM_BATTERY_STATE_UNIT_NAME, varCode, uuid) {}
+                   F(MODEM_BATTERY_STATE_VAR_NAME),
+                   F(MODEM_BATTERY_STATE_UNIT_NAME), varCode, uuid) {
+        loggerModem::requestMetadata(MODEM_METADATA_BATTERY);
+    }
     /**
      * @brief Destroy the Modem_BatteryState object - no action needed.
      */
@@ -1123,8 +1254,10 @@ class Modem_BatteryPercent : public Variable {
         const char* varCode = MODEM_BATTERY_PERCENT_DEFAULT_CODE)
         : Variable(&parentModem->getModemBatteryChargePercent,
                    (uint8_t)MODEM_BATTERY_PERCENT_RESOLUTION,
-                   &*MODEM_BATTERY_PERCENT_VAR_NAME,
-                   &*MODEM_BATTERY_PERCENT_UNIT_NAME, varCode, uuid) {}
+                   F(MODEM_BATTERY_PERCENT_VAR_NAME),
+                   F(MODEM_BATTERY_PERCENT_UNIT_NAME), varCode, uuid) {
+        loggerModem::requestMetadata(MODEM_METADATA_BATTERY);
+    }
     /**
      * @brief Destroy the Modem_BatteryPercent object - no action needed.
      */
@@ -1159,8 +1292,10 @@ class Modem_BatteryVoltage : public Variable {
         const char* varCode = MODEM_BATTERY_VOLTAGE_DEFAULT_CODE)
         : Variable(&parentModem->getModemBatteryVoltage,
                    (uint8_t)MODEM_BATTERY_VOLTAGE_RESOLUTION,
-                   &*MODEM_BATTERY_VOLTAGE_VAR_NAME,
-                   &*MODEM_BATTERY_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   F(MODEM_BATTERY_VOLTAGE_VAR_NAME),
+                   F(MODEM_BATTERY_VOLTAGE_UNIT_NAME), varCode, uuid) {
+        loggerModem::requestMetadata(MODEM_METADATA_BATTERY);
+    }
     /**
      * @brief Destroy the Modem_BatteryVoltage object - no action needed.
      */
@@ -1194,8 +1329,10 @@ class Modem_Temp : public Variable {
                         const char* varCode = MODEM_TEMPERATURE_DEFAULT_CODE)
         : Variable(&parentModem->getModemTemperature,
                    (uint8_t)MODEM_TEMPERATURE_RESOLUTION,
-                   &*MODEM_TEMPERATURE_VAR_NAME, &*MODEM_TEMPERATURE_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(MODEM_TEMPERATURE_VAR_NAME),
+                   F(MODEM_TEMPERATURE_UNIT_NAME), varCode, uuid) {
+        loggerModem::requestMetadata(MODEM_METADATA_TEMPERATURE);
+    }
     /**
      * @brief Destroy the Modem_Temp object - no action needed.
      */
@@ -1212,7 +1349,7 @@ class Modem_ActivationDuration : public Variable {
         const char* varCode = MODEM_ACTIVATION_DEFAULT_CODE)
         : Variable(&parentModem->getModemActivationDuration,
                    (uint8_t)MODEM_ACTIVATION_RESOLUTION,
-                   &*MODEM_ACTIVATION_VAR_NAME, &*MODEM_ACTIVATION_UNIT_NAME,
+                   F(MODEM_ACTIVATION_VAR_NAME), F(MODEM_ACTIVATION_UNIT_NAME),
                    varCode, uuid) {}
     ~Modem_ActivationDuration() {}
 };
@@ -1225,8 +1362,8 @@ class Modem_PoweredDuration : public Variable {
         loggerModem* parentModem, const char* uuid = "",
         const char* varCode = MODEM_POWERED_DEFAULT_CODE)
         : Variable(&parentModem->getModemPoweredDuration,
-                   (uint8_t)MODEM_POWERED_RESOLUTION, &*MODEM_POWERED_VAR_NAME,
-                   &*MODEM_POWERED_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)MODEM_POWERED_RESOLUTION, F(MODEM_POWERED_VAR_NAME),
+                   F(MODEM_POWERED_UNIT_NAME), varCode, uuid) {}
     ~Modem_PoweredDuration() {}
 };
 #endif
@@ -0,0 +1,159 @@
+/**
+ * @file PowerPolicy.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the battery power tiers and the function used to pick a tier
+ * from the battery voltage.
+ *
+ * The selection is plain arithmetic with no hardware calls or Arduino
+ * dependencies, so it can be compiled into a host program and run against a
+ * simulated discharge curve to check the thresholds before deploying them:
+ * @code{.cpp}
+ * powerTierThresholds thresholds = {3.55, 3.4, 3.2, 0.1};
+ * powerTier tier = POWER_TIER_FULL;
+ * for (float v = 4.2; v > 3.0; v -= 0.01) {
+ *     tier = selectPowerTier(tier, v, &thresholds);
+ *     printf("%.2f V -> tier %d\n", v, tier);
+ * }
+ * @endcode
+ *
+ * The default thresholds are for a single cell LiPo battery.  They can be
+ * changed at run time with Logger::setPowerTierThresholds() or at compile
+ * time with the build flags:
+ * - ```-D MS_POWER_SD_ONLY_V=3.55```
+ * - ```-D MS_POWER_REDUCED_V=3.4```
+ * - ```-D MS_POWER_CRITICAL_V=3.2```
+ * - ```-D MS_POWER_HYSTERESIS_V=0.1```
+ */
+
+// Header Guards
+#ifndef SRC_POWERPOLICY_H_
+#define SRC_POWERPOLICY_H_
+
+#include <stdint.h>
+
+/**
+ * @brief The battery voltage below which the logger stops publishing.
+ *
+ * This can be changed by setting the build flag MS_POWER_SD_ONLY_V when
+ * compiling.
+ */
+#ifndef MS_POWER_SD_ONLY_V
+#define MS_POWER_SD_ONLY_V 3.55
+#endif
+/**
+ * @brief The battery voltage below which the logger also lengthens its
+ * logging interval.
+ *
+ * This can be changed by setting the build flag MS_POWER_REDUCED_V when
+ * compiling.
+ */
+#ifndef MS_POWER_REDUCED_V
+#define MS_POWER_REDUCED_V 3.4
+#endif
+/**
+ * @brief The battery voltage below which the logger stops taking
+ * measurements.
+ *
+ * This can be changed by setting the build flag MS_POWER_CRITICAL_V when
+ * compiling.
+ */
+#ifndef MS_POWER_CRITICAL_V
+#define MS_POWER_CRITICAL_V 3.2
+#endif
+/**
+ * @brief How far above a threshold the battery must recover before the logger
+ * moves back up to a higher power tier.
+ *
+ * This can be changed by setting the build flag MS_POWER_HYSTERESIS_V when
+ * compiling.
+ */
+#ifndef MS_POWER_HYSTERESIS_V
+#define MS_POWER_HYSTERESIS_V 0.1
+#endif
+/**
+ * @brief The number of logging intervals between readings in the reduced and
+ * critical tiers.
+ *
+ * This can be changed by setting the build flag MS_POWER_REDUCED_MULTIPLIER
+ * when compiling.
+ */
+#ifndef MS_POWER_REDUCED_MULTIPLIER
+#define MS_POWER_REDUCED_MULTIPLIER 4
+#endif
+
+/**
+ * @brief The name of the file on the SD card that power tier changes are
+ * written to.
+ *
+ * This can be changed by setting the build flag MS_POWER_LOG_FILE_NAME when
+ * compiling.
+ */
+#ifndef MS_POWER_LOG_FILE_NAME
+#define MS_POWER_LOG_FILE_NAME "powerlog.csv"
+#endif
+
+/**
+ * @brief The power tiers, from the most to the least power used.
+ */
+typedef enum {
+    POWER_TIER_FULL = 0,  ///< Log and publish at every interval
+    POWER_TIER_SD_ONLY,   ///< Log to the SD card only; do not use the modem
+    POWER_TIER_REDUCED,   ///< Log to the SD card only, at a longer interval
+    POWER_TIER_CRITICAL   ///< Take no measurements; only check the battery
+} powerTier;
+
+/**
+ * @brief The battery voltages at which the logger changes power tiers.
+ */
+typedef struct {
+    float sdOnly_V;      ///< Below this, the logger stops publishing
+    float reduced_V;     ///< Below this, the interval is lengthened
+    float critical_V;    ///< Below this, no measurements are taken
+    float hysteresis_V;  ///< The recovery needed to move back up a tier
+} powerTierThresholds;
+
+/**
+ * @brief Get the tier for a battery voltage without any hysteresis.
+ *
+ * @param battery_V The battery voltage
+ * @param thresholds The voltage thresholds for each tier
+ * @return **powerTier** The tier for that voltage
+ */
+static inline powerTier powerTierForVoltage(
+    float battery_V, const powerTierThresholds* thresholds) {
+    if (battery_V < thresholds->critical_V) { return POWER_TIER_CRITICAL; }
+    if (battery_V < thresholds->reduced_V) { return POWER_TIER_REDUCED; }
+    if (battery_V < thresholds->sdOnly_V) { return POWER_TIER_SD_ONLY; }
+    return POWER_TIER_FULL;
+}
+
+/**
+ * @brief Pick the power tier for a new battery reading.
+ *
+ * The logger drops to a lower tier as soon as the voltage falls below that
+ * tier's threshold, but only moves back up once the voltage is at least the
+ * hysteresis above the threshold.  That keeps a battery hovering around a
+ * threshold - or sagging under load and recovering at rest - from flipping
+ * between tiers on every reading.
+ *
+ * A bad reading (-9999 or not positive) leaves the tier unchanged.
+ *
+ * @param currentTier The tier the logger is in now
+ * @param battery_V The new battery voltage
+ * @param thresholds The voltage thresholds for each tier
+ * @return **powerTier** The tier the logger should use
+ */
+static inline powerTier selectPowerTier(powerTier currentTier, float battery_V,
+                                        const powerTierThresholds* thresholds) {
+    if (battery_V <= 0) { return currentTier; }
+    powerTier dropTo = powerTierForVoltage(battery_V, thresholds);
+    if (dropTo > currentTier) { return dropTo; }
+    powerTier riseTo = powerTierForVoltage(
+        battery_V - thresholds->hysteresis_V, thresholds);
+    if (riseTo < currentTier) { return riseTo; }
+    return currentTier;
+}
+
+#endif  // SRC_POWERPOLICY_H_
@@ -0,0 +1,127 @@
+/**
+ * @file PowerSchedule.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the arithmetic used to plan when each sensor power rail is
+ * switched on and when each sensor is woken.
+ *
+ * A rail is all of the sensors sharing one power pin.  Rather than powering
+ * every rail at the start of an update and leaving each on until the slowest
+ * sensor on it is done, VariableArray::completeUpdate() works back from the
+ * time the slowest sensor of all will finish.  Each rail is switched on as late
+ * as it can be and still finish then, and each sensor is woken as late as it
+ * can be and still finish then.  Rails are powered down as soon as every sensor
+ * on them is done, so a 2 second sensor sharing a logging cycle with a 30
+ * second sensor is only on for the last 2 seconds of it.
+ *
+ * These functions are plain arithmetic with no hardware calls or Arduino
+ * dependencies, so a planned cycle can be run in virtual time in a host
+ * program.  For example, the charge saved by a sensor with a 500 ms warm-up,
+ * a 2 s stabilization, and a single 1 s measurement drawing 10 mA awake and
+ * 2 mA idle, when the slowest sensor takes 30 s, is:
+ * @code{.cpp}
+ * uint32_t active = powerScheduleActiveTime(2000, 1000, 1);
+ * uint32_t start  = powerScheduleLatestStart(30000, 500 + active);
+ * uint32_t wake   = powerScheduleLatestStart(30000, active);
+ * float    saved  = powerScheduleChargeSaved(start, wake - 500, 10, 2);
+ * @endcode
+ */
+
+// Header Guards
+#ifndef SRC_POWERSCHEDULE_H_
+#define SRC_POWERSCHEDULE_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Estimate the time a sensor is awake in an update.
+ *
+ * This is the declared stabilization time plus the declared measurement time
+ * of each reading to be averaged.  The time to talk to the sensor is not
+ * included, so the estimate is a little short for slow sensors.
+ *
+ * @param stabilization_ms The stabilization time, in ms
+ * @param measurement_ms The measurement time, in ms
+ * @param nMeasurements The number of measurements to average
+ * @return **uint32_t** The time from waking to the last result, in ms
+ */
+static inline uint32_t powerScheduleActiveTime(uint32_t stabilization_ms,
+                                               uint32_t measurement_ms,
+                                               uint8_t  nMeasurements) {
+    return stabilization_ms + measurement_ms * nMeasurements;
+}
+
+/**
+ * @brief Get the latest time a step can start and still finish with the
+ * slowest sensor.
+ *
+ * @param cycle_ms The time the slowest sensor needs, in ms
+ * @param duration_ms The time needed from the start of the step until the last
+ * result, in ms
+ * @return **uint32_t** The start time from the beginning of the update, in ms
+ */
+static inline uint32_t powerScheduleLatestStart(uint32_t cycle_ms,
+                                                uint32_t duration_ms) {
+    if (duration_ms >= cycle_ms) { return 0; }
+    return cycle_ms - duration_ms;
+}
+
+/**
+ * @brief Add up the inrush of the rails switched on within the settling time
+ * of a start time.
+ *
+ * @param start_ms The proposed start time, in ms
+ * @param nRails The length of the arrays
+ * @param starts_ms The start time of each rail, in ms
+ * @param inrush The total inrush class of each rail
+ * @param scheduled Whether each rail has been given its start time yet; rails
+ * that have not, and rails with no inrush, are ignored
+ * @param settle_ms The time for the inrush of a rail to settle, in ms
+ * @param firstStart_ms Set to the earliest start of the overlapping rails, or
+ * to the proposed start if none overlap
+ * @param lastSettled_ms Set to the latest time the overlapping rails settle,
+ * or to the proposed start if none overlap
+ * @return **uint16_t** The sum of the inrush classes of the overlapping rails
+ */
+static inline uint16_t powerScheduleInrushLoad(
+    uint32_t start_ms, uint8_t nRails, const uint32_t starts_ms[],
+    const uint8_t inrush[], const bool scheduled[], uint32_t settle_ms,
+    uint32_t* firstStart_ms, uint32_t* lastSettled_ms) {
+    uint16_t load   = 0;
+    *firstStart_ms  = start_ms;
+    *lastSettled_ms = start_ms;
+    for (uint8_t r = 0; r < nRails; r++) {
+        if (scheduled[r] && inrush[r] > 0 &&
+            starts_ms[r] + settle_ms > start_ms &&
+            start_ms + settle_ms > starts_ms[r]) {
+            load += inrush[r];
+            if (starts_ms[r] < *firstStart_ms) {
+                *firstStart_ms = starts_ms[r];
+            }
+            if (starts_ms[r] + settle_ms > *lastSettled_ms) {
+                *lastSettled_ms = starts_ms[r] + settle_ms;
+            }
+        }
+    }
+    return load;
+}
+
+/**
+ * @brief Estimate the charge saved by powering and waking a sensor late
+ * compared to powering and waking it as soon as possible.
+ *
+ * @param powerDelay_ms How much later the sensor's rail is switched on, in ms
+ * @param wakeDelay_ms How much later the sensor is woken, in ms
+ * @param active_mA The current while awake, in mA
+ * @param idle_mA The current while powered but not awake, in mA
+ * @return **float** The charge saved in mAh
+ */
+static inline float powerScheduleChargeSaved(uint32_t powerDelay_ms,
+                                             uint32_t wakeDelay_ms,
+                                             float active_mA, float idle_mA) {
+    return (idle_mA * powerDelay_ms + (active_mA - idle_mA) * wakeDelay_ms) /
+        3600000.0f;
+}
+
+#endif  // SRC_POWERSCHEDULE_H_
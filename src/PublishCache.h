@@ -0,0 +1,117 @@
+/**
+ * @file PublishCache.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the sizes of the cache of records a logger keeps for the
+ * publishers that only send every few logging intervals, and the arithmetic
+ * used to find records in it.
+ *
+ * Records are numbered from 1 in the order they were kept, and the cache is a
+ * ring: record n is in slot (n - 1) % capacity, so once the ring is full each
+ * new record replaces the oldest.  Each publisher remembers the number of the
+ * last record it sent and, at its next send, sends every record after that
+ * which is still kept.
+ *
+ * The cache holds one record for each logging interval, so a publisher that
+ * sends every X intervals needs room for X records.  Any more are replaced
+ * before they are sent.  The number of records that fit is
+ * #MS_PUBLISH_CACHE_VALUES divided by the number of variables, up to
+ * #MS_PUBLISH_CACHE_RECORDS, so to send every X intervals without losing
+ * records set:
+ * - #MS_PUBLISH_CACHE_RECORDS to at least X, and
+ * - #MS_PUBLISH_CACHE_VALUES to at least X times the number of variables.
+ *
+ * Each record takes 10 bytes of RAM for its times and 4 for each value.  Give
+ * a little more room than X if a failed send should be retried at the next
+ * one without losing the oldest records.
+ *
+ * These functions are plain arithmetic with no hardware calls or Arduino
+ * dependencies, so they can be checked in a host program; see
+ * tools/publish_cache_test.
+ */
+
+// Header Guards
+#ifndef SRC_PUBLISHCACHE_H_
+#define SRC_PUBLISHCACHE_H_
+
+#include <stdint.h>
+
+/**
+ * @brief The largest number of records kept for publishers that only send
+ * every few logging intervals.
+ *
+ * This can be changed by setting the build flag MS_PUBLISH_CACHE_RECORDS when
+ * compiling.
+ */
+#ifndef MS_PUBLISH_CACHE_RECORDS
+#define MS_PUBLISH_CACHE_RECORDS 4
+#endif
+/**
+ * @brief The number of variable values set aside for the records kept for
+ * publishers.
+ *
+ * The number of records kept is this divided by the number of variables, up
+ * to #MS_PUBLISH_CACHE_RECORDS.
+ *
+ * This can be changed by setting the build flag MS_PUBLISH_CACHE_VALUES when
+ * compiling.
+ */
+#ifndef MS_PUBLISH_CACHE_VALUES
+#define MS_PUBLISH_CACHE_VALUES 64
+#endif
+
+/**
+ * @brief Calculate the number of records that fit in the cache.
+ *
+ * @param variableCount The number of variables in each record
+ * @param maxRecords The most records kept; #MS_PUBLISH_CACHE_RECORDS
+ * @param maxValues The number of values set aside; #MS_PUBLISH_CACHE_VALUES
+ * @return **uint8_t** The number of records; 0 if not even one fits
+ */
+static inline uint8_t publishCacheCapacity(uint8_t  variableCount,
+                                           uint8_t  maxRecords,
+                                           uint16_t maxValues) {
+    if (variableCount == 0) { return 0; }
+    uint16_t capacity = maxValues / variableCount;
+    return capacity > maxRecords ? maxRecords : capacity;
+}
+
+/**
+ * @brief Find the slot a record is kept in.
+ *
+ * @param recordNumber The number of the record, from 1
+ * @param capacity The number of records that fit; not 0
+ * @return **uint8_t** The slot
+ */
+static inline uint8_t publishCacheSlot(uint32_t recordNumber,
+                                       uint8_t  capacity) {
+    return (recordNumber - 1) % capacity;
+}
+
+/**
+ * @brief Find the number of the oldest record still kept.
+ *
+ * @param recordCount The number of records kept since the logger started
+ * @param capacity The number of records that fit
+ * @return **uint32_t** The record number; 0 if no records are kept.
+ */
+static inline uint32_t publishCacheOldest(uint32_t recordCount,
+                                          uint8_t  capacity) {
+    if (recordCount == 0 || capacity == 0) { return 0; }
+    return recordCount > capacity ? recordCount - capacity + 1 : 1;
+}
+
+/**
+ * @brief Find the first record a publisher has not sent yet.
+ *
+ * @param oldest The number of the oldest record still kept
+ * @param lastSent The number of the last record the publisher sent; 0 if none
+ * @return **uint32_t** The record number to start sending from
+ */
+static inline uint32_t publishCacheFirstToSend(uint32_t oldest,
+                                               uint32_t lastSent) {
+    return oldest <= lastSent ? lastSent + 1 : oldest;
+}
+
+#endif  // SRC_PUBLISHCACHE_H_
@@ -0,0 +1,158 @@
+/**
+ * @file SPIFlash.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the SPIFlash class.
+ */
+
+#include "SPIFlash.h"
+
+// The standard JEDEC serial flash commands
+#define SPI_FLASH_WRITE_ENABLE 0x06
+#define SPI_FLASH_READ_STATUS 0x05
+#define SPI_FLASH_READ_DATA 0x03
+#define SPI_FLASH_PAGE_PROGRAM 0x02
+#define SPI_FLASH_SECTOR_ERASE 0x20
+#define SPI_FLASH_READ_ID 0x9F
+#define SPI_FLASH_POWER_DOWN 0xB9
+#define SPI_FLASH_RELEASE_POWER_DOWN 0xAB
+
+#define SPI_FLASH_STATUS_BUSY 0x01
+#define SPI_FLASH_PAGE_SIZE 256
+
+// The longest a page program or sector erase should take, with some margin
+#define SPI_FLASH_PROGRAM_TIMEOUT_MS 10
+#define SPI_FLASH_ERASE_TIMEOUT_MS 1000
+
+
+SPIFlash::SPIFlash(int8_t chipSelectPin, uint16_t sectorCount,
+                   uint16_t firstSector) {
+    _chipSelectPin = chipSelectPin;
+    _sectorCount   = sectorCount;
+    _baseAddress   = (uint32_t)firstSector * 4096;
+    _asleep        = true;
+}
+// Destructor
+SPIFlash::~SPIFlash() {}
+
+
+bool SPIFlash::begin(void) {
+    if (_chipSelectPin < 0 || _sectorCount < 2) { return false; }
+    pinMode(_chipSelectPin, OUTPUT);
+    digitalWrite(_chipSelectPin, HIGH);
+    SPI.begin();
+    _asleep = true;
+    wake();
+
+    // A chip that isn't there reads back as all 0's or all 1's
+    select(SPI_FLASH_READ_ID);
+    uint8_t manufacturer = SPI.transfer(0);
+    uint8_t memoryType   = SPI.transfer(0);
+    uint8_t capacity     = SPI.transfer(0);
+    deselect();
+    MS_DBG(F("SPI flash JEDEC ID:"), String(manufacturer, HEX),
+           String(memoryType, HEX), String(capacity, HEX));
+    return manufacturer != 0x00 && manufacturer != 0xFF;
+}
+
+
+void SPIFlash::read(uint32_t address, uint8_t* data, uint16_t length) {
+    wake();
+    select(SPI_FLASH_READ_DATA);
+    sendAddress(_baseAddress + address);
+    for (uint16_t i = 0; i < length; i++) { data[i] = SPI.transfer(0); }
+    deselect();
+}
+
+
+bool SPIFlash::program(uint32_t address, const uint8_t* data,
+                       uint16_t length) {
+    wake();
+    address += _baseAddress;
+    while (length > 0) {
+        // A page program wraps around within its page, so never cross one
+        uint16_t chunk = SPI_FLASH_PAGE_SIZE - (address % SPI_FLASH_PAGE_SIZE);
+        if (chunk > length) { chunk = length; }
+        select(SPI_FLASH_WRITE_ENABLE);
+        deselect();
+        select(SPI_FLASH_PAGE_PROGRAM);
+        sendAddress(address);
+        for (uint16_t i = 0; i < chunk; i++) { SPI.transfer(data[i]); }
+        deselect();
+        if (!waitWhileBusy(SPI_FLASH_PROGRAM_TIMEOUT_MS)) {
+            MS_DBG(F("SPI flash program timed out"));
+            return false;
+        }
+        address += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+    return true;
+}
+
+
+bool SPIFlash::eraseSector(uint32_t address) {
+    wake();
+    select(SPI_FLASH_WRITE_ENABLE);
+    deselect();
+    select(SPI_FLASH_SECTOR_ERASE);
+    sendAddress(_baseAddress + address);
+    deselect();
+    if (!waitWhileBusy(SPI_FLASH_ERASE_TIMEOUT_MS)) {
+        MS_DBG(F("SPI flash erase timed out"));
+        return false;
+    }
+    return true;
+}
+
+
+void SPIFlash::sleep(void) {
+    if (_asleep) { return; }
+    select(SPI_FLASH_POWER_DOWN);
+    deselect();
+    _asleep = true;
+}
+
+
+void SPIFlash::select(uint8_t command) {
+    SPI.beginTransaction(SPISettings(MS_SPI_FLASH_CLOCK, MSBFIRST, SPI_MODE0));
+    digitalWrite(_chipSelectPin, LOW);
+    SPI.transfer(command);
+}
+
+
+void SPIFlash::sendAddress(uint32_t address) {
+    SPI.transfer((uint8_t)(address >> 16));
+    SPI.transfer((uint8_t)(address >> 8));
+    SPI.transfer((uint8_t)address);
+}
+
+
+void SPIFlash::deselect(void) {
+    digitalWrite(_chipSelectPin, HIGH);
+    SPI.endTransaction();
+}
+
+
+void SPIFlash::wake(void) {
+    if (!_asleep) { return; }
+    select(SPI_FLASH_RELEASE_POWER_DOWN);
+    deselect();
+    // Most chips need 3-30µs to come out of deep power down
+    delayMicroseconds(30);
+    _asleep = false;
+}
+
+
+bool SPIFlash::waitWhileBusy(uint32_t timeout_ms) {
+    uint32_t start = millis();
+    uint8_t  status;
+    do {
+        select(SPI_FLASH_READ_STATUS);
+        status = SPI.transfer(0);
+        deselect();
+        if (!(status & SPI_FLASH_STATUS_BUSY)) { return true; }
+    } while (millis() - start < timeout_ms);
+    return false;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file SPIFlash.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the SPIFlash class, a FlashDevice for SPI NOR flash chips.
+ *
+ * This works with the common serial NOR flash chips that use the standard
+ * JEDEC commands and 4 KB sector erases - such as the Winbond W25Q, Adesto
+ * AT25SF, and Macronix MX25 series.  The flash can share the SPI bus with the
+ * SD card as long as it has its own chip select pin.
+ *
+ * The chip is put into deep power down between uses, where most draw only a
+ * few µA.
+ */
+
+// Header Guards
+#ifndef SRC_SPIFLASH_H_
+#define SRC_SPIFLASH_H_
+
+// Debugging Statement
+// #define MS_SPIFLASH_DEBUG
+
+#ifdef MS_SPIFLASH_DEBUG
+#define MS_DEBUGGING_STD "SPIFlash"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "FlashLog.h"
+#include <SPI.h>
+
+/**
+ * @brief The SPI clock speed used for the flash, in Hz.
+ *
+ * This can be changed by setting the build flag MS_SPI_FLASH_CLOCK when
+ * compiling.
+ */
+#ifndef MS_SPI_FLASH_CLOCK
+#define MS_SPI_FLASH_CLOCK 4000000L
+#endif
+
+/**
+ * @brief The SPIFlash class reads, programs, and erases a SPI NOR flash chip
+ * for a FlashLog.
+ *
+ * @ingroup base_classes
+ */
+class SPIFlash : public FlashDevice {
+ public:
+    /**
+     * @brief Construct a new SPIFlash object.
+     *
+     * @param chipSelectPin The pin on the mcu connected to the flash's chip
+     * select
+     * @param sectorCount The number of 4 KB sectors to give to the log; at
+     * least 2.
+     * @param firstSector The first sector given to the log, so the rest of
+     * the chip can be used for other things; optional with a default value of
+     * 0.
+     */
+    SPIFlash(int8_t chipSelectPin, uint16_t sectorCount,
+             uint16_t firstSector = 0);
+    /**
+     * @brief Destroy the SPIFlash object - no action taken.
+     */
+    virtual ~SPIFlash();
+
+    /**
+     * @copydoc FlashDevice::begin()
+     */
+    bool begin(void) override;
+    /**
+     * @copydoc FlashDevice::read()
+     */
+    void read(uint32_t address, uint8_t* data, uint16_t length) override;
+    /**
+     * @copydoc FlashDevice::program()
+     */
+    bool program(uint32_t address, const uint8_t* data,
+                 uint16_t length) override;
+    /**
+     * @copydoc FlashDevice::eraseSector()
+     */
+    bool eraseSector(uint32_t address) override;
+    /**
+     * @copydoc FlashDevice::sleep()
+     */
+    void sleep(void) override;
+
+    /**
+     * @copydoc FlashDevice::getSectorSize()
+     */
+    uint16_t getSectorSize(void) override {
+        return 4096;
+    }
+    /**
+     * @copydoc FlashDevice::getSectorCount()
+     */
+    uint16_t getSectorCount(void) override {
+        return _sectorCount;
+    }
+
+ protected:
+    /**
+     * @brief The pin on the mcu connected to the flash's chip select
+     */
+    int8_t _chipSelectPin;
+    /**
+     * @brief The number of sectors given to the log
+     */
+    uint16_t _sectorCount;
+    /**
+     * @brief The address of the first byte given to the log
+     */
+    uint32_t _baseAddress;
+    /**
+     * @brief True while the chip is in deep power down
+     */
+    bool _asleep;
+
+ private:
+    void select(uint8_t command);
+    void sendAddress(uint32_t address);
+    void deselect(void);
+    void wake(void);
+    bool waitWhileBusy(uint32_t timeout_ms);
+};
+
+#endif  // SRC_SPIFLASH_H_
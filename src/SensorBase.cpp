@@ -14,6 +14,9 @@
 //  The class and functions for interfacing with a sensor
 // ============================================================================
 
+// Initialize the static members
+uint16_t Sensor::_resultArrayBytes = 0;
+
 // The constructor
 Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
                uint32_t warmUpTime_ms, uint32_t stabilizationTime_ms,
@@ -30,6 +33,7 @@ Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
     // The "waitForWarmUp()" function verifies that enough time has passed.
     _warmUpTime_ms = warmUpTime_ms;
     _millisPowerOn = 0;
+    _inrushClass   = SENSOR_INRUSH_LOW;
 
     // This is the time needed from the when a sensor is activated until the
     // readings are stable.  The _millisSensorActivated value is *usually* set
@@ -50,12 +54,21 @@ Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
     _measurementTime_ms         = measurementTime_ms;
     _millisMeasurementRequested = 0;
 
-    // Clear arrays
-    for (uint8_t i = 0; i < MAX_NUMBER_VARS; i++) {
-        variables[i]                  = NULL;
-        sensorValues[i]               = -9999;
-        numberGoodMeasurementsMade[i] = 0;
-    }
+    // The result arrays belong to the sub-class, which gives them to
+    // setResultArrays() in its own constructor
+    sensorValues               = NULL;
+    numberGoodMeasurementsMade = NULL;
+    variables                  = NULL;
+
+    _fixedPointValues = 0;
+    _requestedResults = 0;
+
+    // The currents are unknown until set by a sub-class or the user
+    _activeCurrent_mA    = 0;
+    _idleCurrent_mA      = 0;
+    _sleepCurrent_mA     = 0;
+    _chargeUsed_mAh      = 0;
+    _millisChargeCounted = 0;
 
     // Reset the sensor status
     _sensorStatus = 0;
@@ -66,6 +79,29 @@ Sensor::Sensor(const char* sensorName, const uint8_t numReturnedVars,
 Sensor::~Sensor() {}
 
 
+uint16_t Sensor::getResultArrayBytes(void) {
+    return _resultArrayBytes;
+}
+
+
+void Sensor::attachResultArrays(float* values, uint8_t* counts,
+                                Variable** vars, uint8_t size) {
+    if (_numReturnedValues > size) { _numReturnedValues = size; }
+    sensorValues               = values;
+    numberGoodMeasurementsMade = counts;
+    variables                  = vars;
+    _resultArrayBytes += size *
+        (sizeof(float) + sizeof(uint8_t) + sizeof(Variable*));
+
+    // Clear arrays
+    for (uint8_t i = 0; i < size; i++) {
+        variables[i]                  = NULL;
+        sensorValues[i]               = -9999;
+        numberGoodMeasurementsMade[i] = 0;
+    }
+}
+
+
 // This gets the place the sensor is installed ON THE MAYFLY (ie, pin number)
 String Sensor::getSensorLocation(void) {
     String senseLoc = F("Pin");
@@ -86,6 +122,18 @@ String Sensor::getSensorNameAndLocation(void) {
 }
 
 
+// This returns the key of the sensor's record in the boot cache
+uint16_t Sensor::getBootCacheKey(void) {
+    // A 32-bit FNV-1a hash, folded to 16 bits
+    String   nameAndLocation = getSensorNameAndLocation();
+    uint32_t hash            = 2166136261UL;
+    for (uint16_t i = 0; i < nameAndLocation.length(); i++) {
+        hash = (hash ^ (uint8_t)nameAndLocation[i]) * 16777619UL;
+    }
+    return (uint16_t)(hash ^ (hash >> 16));
+}
+
+
 // This returns the number of the power pin
 int8_t Sensor::getPowerPin(void) {
     return _powerPin;
@@ -102,6 +150,25 @@ uint8_t Sensor::getNumberMeasurementsToAverage(void) {
 }
 
 
+// These get the warm-up time and get and set the inrush class used to stagger
+// the power-up of many sensors
+uint32_t Sensor::getWarmUpTime(void) {
+    return _warmUpTime_ms;
+}
+uint32_t Sensor::getStabilizationTime(void) {
+    return _stabilizationTime_ms;
+}
+uint32_t Sensor::getMeasurementTime(void) {
+    return _measurementTime_ms;
+}
+void Sensor::setInrushClass(uint8_t inrushClass) {
+    _inrushClass = inrushClass;
+}
+uint8_t Sensor::getInrushClass(void) {
+    return _inrushClass;
+}
+
+
 // This returns the 8-bit code for the current status of the sensor.
 // Bit 0 - 0=Has NOT been set up, 1=Has been setup
 // Bit 1 - 0=No attempt made to power sensor, 1=Attempt made to power sensor
@@ -180,6 +247,15 @@ bool Sensor::setup(void) {
     if (_dataPin >= 0)
         pinMode(_dataPin, INPUT);  // NOTE:  Not turning on pull-up!
 
+    // A sensor without result arrays can't be used; with no values to
+    // return, nothing else will touch the missing arrays
+    if (sensorValues == NULL) {
+        PRINTOUT(F("ERROR! There are no result arrays for"),
+                 getSensorNameAndLocation());
+        _numReturnedValues = 0;
+        return false;
+    }
+
     // Set the status bit marking that the sensor has been set up (bit 0)
     _sensorStatus |= 0b00000001;
 
@@ -187,6 +263,13 @@ bool Sensor::setup(void) {
 }
 
 
+// Most sensors need a full update to give any value
+float Sensor::getInstantValue(uint8_t resultNumber) {
+    (void)resultNumber;
+    return -9999;
+}
+
+
 // The function to wake up a sensor
 bool Sensor::wake(void) {
     MS_DBG(F("Waking"), getSensorNameAndLocation());
@@ -275,12 +358,46 @@ bool Sensor::startSingleMeasurement(void) {
 
 
 void Sensor::registerVariable(int sensorVarNum, Variable* var) {
+    if (sensorVarNum < 0 || sensorVarNum >= _numReturnedValues ||
+        variables == NULL) {
+        MS_DBG(F("ERROR! Result number"), sensorVarNum, F("is out of range for"),
+               getSensorNameAndLocation());
+        return;
+    }
     variables[sensorVarNum] = var;
+    _requestedResults |= (uint16_t)1 << sensorVarNum;
     /*MS_DBG(F("... Registration from"), getSensorNameAndLocation(), F("for"),
            var->getVarName(), F("accepted."));*/
 }
 
 
+bool Sensor::isResultRequested(uint8_t resultNumber) {
+    if (resultNumber >= _numReturnedValues) { return false; }
+    return (_requestedResults >> resultNumber) & 1;
+}
+
+
+uint16_t Sensor::getRequestedResults(void) {
+    return _requestedResults;
+}
+
+
+bool Sensor::readBootCache(void* data, uint8_t length) {
+#if defined MS_BOOT_CACHE
+    return BootCache::read(getBootCacheKey(), data, length);
+#else
+    return false;
+#endif
+}
+
+
+void Sensor::writeBootCache(const void* data, uint8_t length) {
+#if defined MS_BOOT_CACHE
+    BootCache::write(getBootCacheKey(), data, length);
+#endif
+}
+
+
 /*String Sensor::getStringValueArray(void)
 {
     String retVal = "[";
@@ -323,6 +440,7 @@ void Sensor::clearValues(void) {
         sensorValues[i]               = -9999;
         numberGoodMeasurementsMade[i] = 0;
     }
+    _fixedPointValues = 0;
 }
 
 
@@ -330,6 +448,14 @@ void Sensor::clearValues(void) {
 // averaged
 void Sensor::verifyAndAddMeasurementResult(uint8_t resultNumber,
                                            float   resultValue) {
+    // Ignore any result beyond the number of values this sensor returns
+    if (resultNumber >= _numReturnedValues) { return; }
+    // If this slot is holding a fixed-point sum, turn it back into a float
+    // before mixing in a float result
+    if (bitRead(_fixedPointValues, resultNumber) && resultValue != -9999) {
+        sensorValues[resultNumber] = fixedToFloat(getFixedSum(resultNumber));
+        bitClear(_fixedPointValues, resultNumber);
+    }
     // If the new result is good and there was were only bad results, set the
     // result value as the new result and add 1 to the good result total
     if (sensorValues[resultNumber] == -9999 && resultValue != -9999) {
@@ -364,12 +490,62 @@ void Sensor::verifyAndAddMeasurementResult(uint8_t resultNumber,
 }
 
 
+// This reads the integer sum held in place of a float in the value array
+fixed_q16_t Sensor::getFixedSum(uint8_t resultNumber) {
+    fixed_q16_t sum;
+    memcpy(&sum, &sensorValues[resultNumber], sizeof(sum));
+    return sum;
+}
+// This writes an integer sum in place of a float in the value array
+void Sensor::setFixedSum(uint8_t resultNumber, fixed_q16_t sum) {
+    memcpy(&sensorValues[resultNumber], &sum, sizeof(sum));
+}
+
+
+// This adds a good fixed-point result to the values to be averaged, keeping the
+// sum as an integer
+void Sensor::verifyAndAddFixedResult(uint8_t     resultNumber,
+                                     fixed_q16_t resultValue) {
+    // Ignore any result beyond the number of values this sensor returns
+    if (resultNumber >= _numReturnedValues) { return; }
+
+    if (numberGoodMeasurementsMade[resultNumber] == 0) {
+        // The first good result - start an integer sum
+        setFixedSum(resultNumber, resultValue);
+        bitSet(_fixedPointValues, resultNumber);
+        numberGoodMeasurementsMade[resultNumber] += 1;
+    } else if (bitRead(_fixedPointValues, resultNumber)) {
+        fixed_q16_t sum = getFixedSum(resultNumber);
+        if ((resultValue > 0 && sum > INT32_MAX - resultValue) ||
+            (resultValue < 0 && sum < INT32_MIN - resultValue)) {
+            // The sum would overflow; carry on with a float instead
+            bitClear(_fixedPointValues, resultNumber);
+            sensorValues[resultNumber] = fixedToFloat(sum) +
+                fixedToFloat(resultValue);
+        } else {
+            setFixedSum(resultNumber, sum + resultValue);
+        }
+        numberGoodMeasurementsMade[resultNumber] += 1;
+    } else {
+        // Good float results are already in place
+        verifyAndAddMeasurementResult(resultNumber,
+                                      fixedToFloat(resultValue));
+    }
+}
+
+
 void Sensor::averageMeasurements(void) {
     MS_DBG(F("Averaging results from"), getSensorNameAndLocation(), F("over"),
            _measurementsToAverage, F("reading[s]"));
     for (uint8_t i = 0; i < _numReturnedValues; i++) {
-        if (numberGoodMeasurementsMade[i] > 0)
+        if (bitRead(_fixedPointValues, i)) {
+            // Divide the integer sum first so there's only one conversion
+            sensorValues[i] = fixedToFloat(getFixedSum(i) /
+                                           numberGoodMeasurementsMade[i]);
+            bitClear(_fixedPointValues, i);
+        } else if (numberGoodMeasurementsMade[i] > 0) {
             sensorValues[i] /= numberGoodMeasurementsMade[i];
+        }
         MS_DBG(F("    ->Result #"), i, ':', sensorValues[i]);
     }
 }
@@ -378,7 +554,8 @@ void Sensor::averageMeasurements(void) {
 // This updates a sensor value by checking it's power, waking it, taking as many
 // readings as requested, then putting the sensor to sleep and powering down.
 bool Sensor::update(void) {
-    bool ret_val = true;
+    bool     ret_val     = true;
+    uint32_t updateStart = millis();
 
     // Check if the power is on, turn it on if not
     bool wasOn = checkPowerOn();
@@ -413,6 +590,9 @@ bool Sensor::update(void) {
 
     averageMeasurements();
 
+    // Count the charge used while the sensor was on
+    addChargeUsed(updateStart);
+
     // Put the sensor back to sleep if it had been activated
     if (wasActive) { sleep(); }
 
@@ -497,7 +677,7 @@ bool Sensor::isWarmedUp(bool debug) {
 // NOTE:  This is "blocking" - that is, nothing else can happen during this
 // wait.
 void Sensor::waitForWarmUp(void) {
-    while (!isWarmedUp()) {}
+    while (!isWarmedUp() && TaskWatch::yield()) {}
 }
 
 
@@ -533,7 +713,7 @@ bool Sensor::isStable(bool debug) {
 // NOTE:  This is "blocking" - that is, nothing else can happen during this
 // wait.
 void Sensor::waitForStability(void) {
-    while (!isStable()) {}
+    while (!isStable() && TaskWatch::yield()) {}
 }
 
 
@@ -570,5 +750,62 @@ bool Sensor::isMeasurementComplete(bool debug) {
 // NOTE:  This is "blocking" - that is, nothing else can happen during this
 // wait.
 void Sensor::waitForMeasurementCompletion(void) {
-    while (!isMeasurementComplete()) {}
+    while (!isMeasurementComplete() && TaskWatch::yield()) {}
+}
+
+
+// These functions get and set the currents used for the energy estimates
+void Sensor::setCurrents(float activeCurrent_mA, float idleCurrent_mA,
+                         float sleepCurrent_mA) {
+    _activeCurrent_mA = activeCurrent_mA;
+    _idleCurrent_mA   = idleCurrent_mA;
+    _sleepCurrent_mA  = sleepCurrent_mA;
+}
+float Sensor::getActiveCurrent(void) {
+    return _activeCurrent_mA;
+}
+float Sensor::getIdleCurrent(void) {
+    return _idleCurrent_mA;
+}
+float Sensor::getBaselineCurrent(void) {
+    // A sensor on a power pin draws nothing while the power is off
+    return _powerPin >= 0 ? 0 : _sleepCurrent_mA;
+}
+
+
+// This adds the charge used since the last count to the running total
+void Sensor::addChargeUsed(uint32_t cycleStart_ms) {
+    uint32_t now = millis();
+    // Only count time since the later of the start of the cycle and the last
+    // count.  Comparing the elapsed times keeps this safe over a millis()
+    // roll-over.
+    uint32_t countable = now - cycleStart_ms;
+    if (_millisChargeCounted != 0 && now - _millisChargeCounted < countable) {
+        countable = now - _millisChargeCounted;
+    }
+
+    uint32_t activeFor = 0;
+    if (bitRead(_sensorStatus, 4) && _millisSensorActivated != 0) {
+        activeFor = now - _millisSensorActivated;
+        if (activeFor > countable) { activeFor = countable; }
+    }
+    // Sensors without a power pin are only counted while they are awake; the
+    // time between cycles is covered by the baseline current.
+    uint32_t idleFor = 0;
+    if (_powerPin >= 0 && _millisPowerOn != 0) {
+        uint32_t poweredFor = now - _millisPowerOn;
+        if (poweredFor > countable) { poweredFor = countable; }
+        if (poweredFor > activeFor) { idleFor = poweredFor - activeFor; }
+    }
+
+    _chargeUsed_mAh += (_activeCurrent_mA * activeFor +
+                        _idleCurrent_mA * idleFor) /
+        3600000.0f;
+    _millisChargeCounted = now;
+    MS_DBG(getSensorNameAndLocation(), F("was active for"), activeFor,
+           F("ms and idle for"), idleFor, F("ms; total charge used:"),
+           String(_chargeUsed_mAh, 4), F("mAh"));
+}
+float Sensor::getChargeUsed(void) {
+    return _chargeUsed_mAh;
 }
@@ -33,16 +33,65 @@
 // Included Dependencies
 #include "ModSensorDebugger.h"
 #undef MS_DEBUGGING_STD
+#include "FixedPointMath.h"
+#include "TaskWatch.h"
+#include "BootCache.h"
 #include <pins_arduino.h>
 
 /**
  * @brief The largest number of variables from a single sensor
+ *
+ * The value, count, and variable arrays for each sensor are sized to the
+ * number of values that sensor returns, not to this maximum.  They are members
+ * of each sensor sub-class (see SensorResultArrays), so they are part of the
+ * sensor object and are counted in the static RAM the linker reports.
  */
 #define MAX_NUMBER_VARS 8
 
+/**
+ * @anchor sensor_inrush_classes
+ * @name Inrush Classes
+ * The relative size of the current surge when a sensor's power is switched on.
+ *
+ * These are units of the VariableArray inrush budget (#MS_INRUSH_BUDGET); the
+ * sensors switched on within #MS_INRUSH_SETTLE_MS of each other may not add up
+ * to more than the budget.
+ */
+/**@{*/
+/// @brief The sensor has no noticeable inrush current
+#define SENSOR_INRUSH_NONE 0
+/// @brief A small sensor with little input capacitance; the default
+#define SENSOR_INRUSH_LOW 1
+/// @brief A sensor with a larger input capacitance, like most RS485 sensors
+#define SENSOR_INRUSH_MEDIUM 2
+/// @brief A sensor with a large inrush, like a sonde with a wiper motor
+#define SENSOR_INRUSH_HIGH 4
+/**@}*/
+
 
 class Variable;  // Forward declaration
 
+/**
+ * @brief The value, count, and variable arrays for a sensor returning N values.
+ *
+ * Each sensor sub-class holds one of these, sized with its own NUM_VARIABLES
+ * define, and hands it to Sensor::setResultArrays() in its constructor.
+ * Because the arrays are part of the sensor object, their size is fixed when
+ * the program is compiled and shows in the linker map with the object.  On
+ * AVR boards each value takes 7 bytes: a float, a count, and a pointer.
+ *
+ * @tparam N The number of values the sensor returns
+ */
+template <uint8_t N>
+struct SensorResultArrays {
+    /// @brief The result values
+    float values[N];
+    /// @brief The number of good measurements for each value
+    uint8_t counts[N];
+    /// @brief The variable registered for each value
+    Variable* variables[N];
+};
+
 /**
  * @brief The "Sensor" class is used for all sensor-level operations - waking,
  * sleeping, and taking measurements.
@@ -111,6 +160,17 @@ class Sensor {
      */
     virtual ~Sensor();
 
+    /**
+     * @brief Get the number of bytes taken by the result arrays of every
+     * sensor created so far.
+     *
+     * These bytes are part of the sensor objects, so they are already in the
+     * static RAM the linker reports; this only breaks them out.
+     *
+     * @return **uint16_t** The bytes used for result arrays
+     */
+    static uint16_t getResultArrayBytes(void);
+
     // These functions are dependent on the constructor and return the
     // constructor values.
     /**
@@ -135,6 +195,16 @@ class Sensor {
      * - how it is connected to the mcu.
      */
     String getSensorNameAndLocation(void);
+    /**
+     * @brief Get the key this sensor's record is kept under in the boot cache.
+     *
+     * By default this is a hash of the sensor name and location.  A sensor
+     * whose location is only found during setup must override this with
+     * something known before setup.
+     *
+     * @return **uint16_t** The boot cache key
+     */
+    virtual uint16_t getBootCacheKey(void);
     /**
      * @brief Get the pin number controlling sensor power.
      *
@@ -161,6 +231,42 @@ class Sensor {
      */
     uint8_t getNumberMeasurementsToAverage(void);
 
+    /**
+     * @brief Get the time needed from when the sensor has power until it's
+     * ready to talk.
+     *
+     * @return **uint32_t** The warm-up time in milliseconds
+     */
+    uint32_t getWarmUpTime(void);
+    /**
+     * @brief Get the time needed from when the sensor is awake until its
+     * readings are stable.
+     *
+     * @return **uint32_t** The stabilization time in milliseconds
+     */
+    uint32_t getStabilizationTime(void);
+    /**
+     * @brief Get the time needed from when a measurement is started until its
+     * result can be read.
+     *
+     * @return **uint32_t** The measurement time in milliseconds
+     */
+    uint32_t getMeasurementTime(void);
+    /**
+     * @brief Set the relative size of the current surge when the sensor is
+     * powered.
+     *
+     * @param inrushClass One of the @ref sensor_inrush_classes
+     */
+    void setInrushClass(uint8_t inrushClass);
+    /**
+     * @brief Get the relative size of the current surge when the sensor is
+     * powered.
+     *
+     * @return **uint8_t** One of the @ref sensor_inrush_classes
+     */
+    uint8_t getInrushClass(void);
+
     /**
      * @brief Get the 8-bit code for the current status of the sensor.
      *
@@ -244,6 +350,18 @@ class Sensor {
      * successfully.
      */
     virtual bool update(void);
+    /**
+     * @brief Read a single result right now, without an update.
+     *
+     * This doesn't power, wake, or sleep the sensor and doesn't touch its
+     * results or status, so it can be used between logging cycles.  Only
+     * sensors that can be read with no setup at all support it.
+     *
+     * @param resultNumber The position of the result in #sensorValues
+     * @return **float** The value; -9999 if this sensor can't be read this
+     * way.
+     */
+    virtual float getInstantValue(uint8_t resultNumber);
 
     /**
      * @brief Turn on the sensor power, if applicable.
@@ -316,8 +434,12 @@ class Sensor {
 
     /**
      * @brief The array of result values for each sensor.
+     *
+     * This points into the SensorResultArrays the sub-class gave to
+     * setResultArrays(), with one entry for each of the #_numReturnedValues
+     * values the sensor returns.  It is NULL until the arrays are given.
      */
-    float sensorValues[MAX_NUMBER_VARS];
+    float* sensorValues;
 
     // This is a string with a pretty-print of the values array
     // String getStringValueArray(void);
@@ -343,6 +465,23 @@ class Sensor {
      */
     void verifyAndAddMeasurementResult(uint8_t resultNumber,
                                        int16_t resultValue);
+    /**
+     * @brief Add a good Q16.16 fixed-point result to the result array,
+     * keeping the running sum as an integer.
+     *
+     * While a result is being summed this way, its slot in #sensorValues
+     * holds the integer sum rather than a float, so there is no soft-float
+     * addition for each reading.  The sum is converted to a float only once,
+     * in averageMeasurements().  If the sum would overflow, or a float result
+     * is added to the same slot, the slot quietly goes back to being a float.
+     *
+     * Bad results should still be reported with the float version using
+     * -9999.
+     *
+     * @param resultNumber The position of the result within the result array.
+     * @param resultValue The value of the result as a Q16.16 number.
+     */
+    void verifyAndAddFixedResult(uint8_t resultNumber, fixed_q16_t resultValue);
     /**
      * @brief Average the results of all measurements by dividing the sum of
      * all measurements by the number of measurements taken.
@@ -357,8 +496,27 @@ class Sensor {
      * @param var A ponter to the Variable object.
      *
      * @note Only one variable can be assigned to each place in the array!
+     * Registrations for a position beyond the number of values the sensor
+     * returns are ignored.
      */
     void registerVariable(int sensorVarNum, Variable* var);
+    /**
+     * @brief Check whether any variable uses a result.
+     *
+     * Sensors can use this to skip the work of calculating or reading values
+     * that no variable will ever report.
+     *
+     * @param resultNumber The position of the result within the result array.
+     * @return **bool** True if a variable has been registered for the result.
+     */
+    bool isResultRequested(uint8_t resultNumber);
+    /**
+     * @brief Get the bitmask of the results that variables use.
+     *
+     * @return **uint16_t** One bit for each result, set if a variable has been
+     * registered for it.
+     */
+    uint16_t getRequestedResults(void);
     /**
      * @brief Notify attached variables of new values.
      */
@@ -429,8 +587,125 @@ class Sensor {
      */
     void waitForMeasurementCompletion(void);
 
+    /**
+     * @anchor sensor_energy_functions
+     * @name Energy Use
+     * Functions for estimating the charge the sensor draws from the battery
+     *
+     * Each sensor has three currents: an active current drawn while it is
+     * awake and measuring, an idle current drawn while it is powered but not
+     * yet awake, and a sleep current drawn between logging cycles by sensors
+     * whose power is not switched by the logger.  All default to 0 until set
+     * by a sub-class or with setCurrents().
+     */
+    /**@{*/
+    /**
+     * @brief Set the currents drawn by the sensor in each state.
+     *
+     * @param activeCurrent_mA The current while the sensor is awake, in mA
+     * @param idleCurrent_mA The current while the sensor is powered but asleep,
+     * in mA
+     * @param sleepCurrent_mA The current drawn between logging cycles if the
+     * sensor power is not switched, in mA
+     */
+    void setCurrents(float activeCurrent_mA, float idleCurrent_mA,
+                     float sleepCurrent_mA);
+    /**
+     * @brief Get the current the sensor draws while awake.
+     *
+     * @return **float** The active current in mA
+     */
+    float getActiveCurrent(void);
+    /**
+     * @brief Get the current the sensor draws while powered but not awake.
+     *
+     * @return **float** The idle current in mA
+     */
+    float getIdleCurrent(void);
+    /**
+     * @brief Get the current the sensor draws between logging cycles.
+     *
+     * This is the sleep current for sensors that are continuously powered and
+     * zero for sensors with a power pin, which are off between cycles.
+     *
+     * @return **float** The baseline current in mA
+     */
+    float getBaselineCurrent(void);
+    /**
+     * @brief Add the charge used while the sensor has been powered and awake
+     * to the running total.
+     *
+     * The time is taken from #_millisPowerOn and #_millisSensorActivated,
+     * counting only the time since the later of the last call and the given
+     * start of the cycle.  This should be called just before putting the
+     * sensor to sleep and again just before powering it down.
+     *
+     * @param cycleStart_ms The processor time when the current update began
+     */
+    void addChargeUsed(uint32_t cycleStart_ms);
+    /**
+     * @brief Get the total charge the sensor has used while powered and awake
+     * since the logger started.
+     *
+     * This does not include the charge drawn between cycles at the sleep
+     * current, which depends on time the processor does not count while
+     * asleep.
+     *
+     * @return **float** The charge used in mAh
+     */
+    float getChargeUsed(void);
+    /**@}*/
+
 
  protected:
+    /**
+     * @brief Give the sensor the arrays to keep its results in.
+     *
+     * Every sensor sub-class must call this in its constructor with a
+     * SensorResultArrays member sized to the number of values it returns.  A
+     * sensor without arrays can't keep any values, and its setup() fails.
+     *
+     * @tparam N The number of values the arrays hold
+     * @param arrays The sub-class's result arrays
+     */
+    template <uint8_t N>
+    void setResultArrays(SensorResultArrays<N>& arrays) {
+        attachResultArrays(arrays.values, arrays.counts, arrays.variables, N);
+    }
+    /**
+     * @brief Point the sensor at its result arrays and clear them.
+     *
+     * If the arrays are smaller than #_numReturnedValues, the number of
+     * returned values is cut to fit them.
+     *
+     * @param values The array for the result values
+     * @param counts The array for the number of good measurements
+     * @param vars The array for the registered variables
+     * @param size The number of entries in each array
+     */
+    void attachResultArrays(float* values, uint8_t* counts, Variable** vars,
+                            uint8_t size);
+
+    /**
+     * @brief Get what this sensor saved to the boot cache at an earlier boot.
+     *
+     * @param data The buffer to copy the record into
+     * @param length The length of the record
+     * @return **bool** True if the record was found.  This is always false
+     * unless the build flag MS_BOOT_CACHE is set.
+     */
+    bool readBootCache(void* data, uint8_t length);
+    /**
+     * @brief Save something found during setup to the boot cache, so that it
+     * can be read back instead of found again at the next boot.
+     *
+     * This does nothing unless the build flag MS_BOOT_CACHE is set.
+     *
+     * @param data The record
+     * @param length The length of the record
+     */
+    void writeBootCache(const void* data, uint8_t length);
+
     /**
      * @brief Digital pin number on the mcu receiving sensor data
      *
@@ -449,8 +724,11 @@ class Sensor {
     const char* _sensorName;
     /**
      * @brief The number of values the sensor is capable of reporting.
+     *
+     * This is never more than the size of the arrays given to
+     * setResultArrays().
      */
-    const uint8_t _numReturnedValues;
+    uint8_t _numReturnedValues;
     /**
      * @brief The number of measurements from the sensor to average.
      *
@@ -464,14 +742,43 @@ class Sensor {
     /**
      * @brief Array with the number of valid measurement values taken by the
      * sensor in the current update cycle.
+     *
+     * Like #sensorValues, this has one entry for each returned value.
      */
-    uint8_t numberGoodMeasurementsMade[MAX_NUMBER_VARS];
+    uint8_t* numberGoodMeasurementsMade;
+    /**
+     * @brief A bit mask of which entries in #sensorValues currently hold an
+     * integer Q16.16 sum instead of a float.
+     *
+     * Bit n is set by verifyAndAddFixedResult() and cleared by
+     * averageMeasurements() and clearValues().
+     */
+    uint8_t _fixedPointValues;
+    /**
+     * @brief Read the integer sum stored in place of a float in #sensorValues
+     *
+     * @param resultNumber The position of the result within the result array.
+     * @return **fixed_q16_t** The Q16.16 sum
+     */
+    fixed_q16_t getFixedSum(uint8_t resultNumber);
+    /**
+     * @brief Store an integer sum in place of a float in #sensorValues
+     *
+     * @param resultNumber The position of the result within the result array.
+     * @param sum The Q16.16 sum
+     */
+    void setFixedSum(uint8_t resultNumber, fixed_q16_t sum);
 
     /**
      * @brief The time needed from the when a sensor has power until it's ready
      * to talk.
      */
     uint32_t _warmUpTime_ms;
+    /**
+     * @brief The relative size of the current surge when the sensor is
+     * powered; one of the @ref sensor_inrush_classes.
+     */
+    uint8_t _inrushClass;
     /**
      * @brief The processor elapsed time when the power was turned on for the
      * sensor.
@@ -511,18 +818,54 @@ class Sensor {
      */
     uint32_t _millisMeasurementRequested;
 
+    /**
+     * @brief The current drawn by the sensor while it is awake, in mA.
+     */
+    float _activeCurrent_mA;
+    /**
+     * @brief The current drawn by the sensor while it is powered but not
+     * awake, in mA.
+     */
+    float _idleCurrent_mA;
+    /**
+     * @brief The current drawn by a continuously powered sensor between
+     * logging cycles, in mA.
+     */
+    float _sleepCurrent_mA;
+    /**
+     * @brief The running total of charge used while powered and awake, in mAh.
+     */
+    float _chargeUsed_mAh;
+    /**
+     * @brief The processor time up to which charge has been added to
+     * #_chargeUsed_mAh.
+     */
+    uint32_t _millisChargeCounted;
+
     /**
      * @brief An 8-bit code for the sensor status
      */
     uint8_t _sensorStatus;
 
+    /**
+     * @brief One bit for each result that a variable has been registered for.
+     *
+     * This is set by registerVariable().
+     */
+    uint16_t _requestedResults;
+
     /**
      * @brief An array for each sensor containing the variable objects tied to
-     * that sensor.  The #MAX_NUMBER_VARS cannot be determined on a per-sensor
-     * basis, because of the way memory is used on an Arduino.  It must be
-     * defined once for the whole class.
+     * that sensor.
+     *
+     * Like #sensorValues, this has one entry for each returned value.
+     */
+    Variable** variables;
+
+    /**
+     * @brief The bytes taken by the result arrays of every sensor.
      */
-    Variable* variables[MAX_NUMBER_VARS];
+    static uint16_t _resultArrayBytes;
 };
 
 #endif  // SRC_SENSORBASE_H_
@@ -0,0 +1,216 @@
+/**
+ * @file StreamFrame.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the binary framing used by Logger::streamingMode() to send
+ * sensor values to a host computer.
+ *
+ * Each frame is:
+ * | Bytes | Contents                                       |
+ * | ----- | ---------------------------------------------- |
+ * | 2     | The sync bytes, 0xA5 then 0x5A                 |
+ * | 1     | The number of values, n                        |
+ * | 2     | The frame sequence number                      |
+ * | 4     | The processor time of the frame, in ms         |
+ * | 4 * n | The values, as 32-bit IEEE floats              |
+ * | 2     | A CRC-16/CCITT-FALSE of all but the sync bytes |
+ *
+ * All multi-byte fields are little-endian, which is the native order of the
+ * AVR and SAMD boards and of most host computers.  The values are in the order
+ * of the variable array; bad values are sent as -9999, as they are everywhere
+ * else.
+ *
+ * The sync bytes and the CRC let a decoder pick frames out of a stream that
+ * also carries text, such as debugging output, and drop any frame damaged in
+ * transit.  Dropped frames show up as gaps in the sequence numbers.
+ *
+ * These functions are plain arithmetic with no hardware calls or Arduino
+ * dependencies, so the same decoder can be compiled into a host program:
+ * @code{.cpp}
+ * streamDecoder decoder;
+ * streamDecoderReset(&decoder);
+ * while (read(fd, &byte, 1) == 1) {
+ *     if (streamDecodeByte(&decoder, byte)) {
+ *         printf("%u: %f\n", decoder.sequence, decoder.values[0]);
+ *     }
+ * }
+ * @endcode
+ * See tools/stream_capture for a complete capture program.
+ */
+
+// Header Guards
+#ifndef SRC_STREAMFRAME_H_
+#define SRC_STREAMFRAME_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief The first sync byte of a frame.
+ */
+#define STREAM_SYNC_1 0xA5
+/**
+ * @brief The second sync byte of a frame.
+ */
+#define STREAM_SYNC_2 0x5A
+/**
+ * @brief The number of bytes in a frame before the values.
+ */
+#define STREAM_HEADER_BYTES 9
+/**
+ * @brief The largest number of values a decoder will accept in one frame.
+ *
+ * This only sizes the host-side decoder; the logger sends as many values as
+ * there are variables.  This can be changed by setting the build flag
+ * STREAM_MAX_VALUES when compiling.
+ */
+#ifndef STREAM_MAX_VALUES
+#define STREAM_MAX_VALUES 64
+#endif
+
+/**
+ * @brief The formats Logger::streamingMode() can send.
+ */
+typedef enum {
+    STREAM_CSV = 0,  ///< One line of comma separated text for each frame
+    STREAM_BINARY    ///< The binary frames described in StreamFrame.h
+} streamFormat;
+
+/**
+ * @brief Add one byte to a CRC-16/CCITT-FALSE.
+ *
+ * Start with a CRC of 0xFFFF.
+ *
+ * @param crc The CRC so far
+ * @param data The next byte
+ * @return **uint16_t** The updated CRC
+ */
+static inline uint16_t streamCrc16(uint16_t crc, uint8_t data) {
+    crc ^= (uint16_t)data << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021)
+                             : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+/**
+ * @brief Get the length of a frame.
+ *
+ * @param count The number of values in the frame
+ * @return **uint16_t** The length of the whole frame, in bytes
+ */
+static inline uint16_t streamFrameLength(uint8_t count) {
+    return STREAM_HEADER_BYTES + 4 * (uint16_t)count + 2;
+}
+
+/**
+ * @brief Build a frame.
+ *
+ * @param buffer The buffer to fill; it must hold streamFrameLength(count)
+ * bytes
+ * @param sequence The frame sequence number
+ * @param time_ms The processor time of the frame, in ms
+ * @param values The values to send
+ * @param count The number of values
+ * @return **uint16_t** The length of the frame, in bytes
+ */
+static inline uint16_t streamEncodeFrame(uint8_t* buffer, uint16_t sequence,
+                                         uint32_t time_ms, const float values[],
+                                         uint8_t count) {
+    uint16_t n  = 0;
+    buffer[n++] = STREAM_SYNC_1;
+    buffer[n++] = STREAM_SYNC_2;
+    buffer[n++] = count;
+    buffer[n++] = sequence & 0xFF;
+    buffer[n++] = sequence >> 8;
+    for (uint8_t b = 0; b < 4; b++) { buffer[n++] = (time_ms >> (8 * b)); }
+    for (uint8_t i = 0; i < count; i++) {
+        // Both ends are little-endian, so the float goes out as it sits
+        memcpy(&buffer[n], &values[i], 4);
+        n += 4;
+    }
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 2; i < n; i++) { crc = streamCrc16(crc, buffer[i]); }
+    buffer[n++] = crc & 0xFF;
+    buffer[n++] = crc >> 8;
+    return n;
+}
+
+/**
+ * @brief The state of a frame decoder.
+ *
+ * Once streamDecodeByte() returns true, the last frame is in the count,
+ * sequence, time_ms, and values fields.
+ */
+typedef struct {
+    /// @brief The bytes of the frame being received
+    uint8_t buffer[STREAM_HEADER_BYTES + 4 * STREAM_MAX_VALUES + 2];
+    uint16_t received;   ///< The bytes of the current frame received so far
+    uint16_t expected;   ///< The length of the current frame, once known
+    uint32_t badFrames;  ///< The number of frames dropped for a bad CRC
+    uint8_t  count;      ///< The number of values in the last frame
+    uint16_t sequence;   ///< The sequence number of the last frame
+    uint32_t time_ms;    ///< The processor time of the last frame, in ms
+    /// @brief The values of the last frame
+    float values[STREAM_MAX_VALUES];
+} streamDecoder;
+
+/**
+ * @brief Clear a decoder, ready to look for the start of a frame.
+ *
+ * @param decoder The decoder
+ */
+static inline void streamDecoderReset(streamDecoder* decoder) {
+    memset(decoder, 0, sizeof(streamDecoder));
+}
+
+/**
+ * @brief Feed one received byte to a decoder.
+ *
+ * Bytes outside of a frame are ignored.
+ *
+ * @param decoder The decoder
+ * @param data The received byte
+ * @return **bool** True if the byte completed a good frame.
+ */
+static inline bool streamDecodeByte(streamDecoder* decoder, uint8_t data) {
+    uint16_t n = decoder->received;
+    // Hunt for the sync bytes
+    if ((n == 0 && data != STREAM_SYNC_1) ||
+        (n == 1 && data != STREAM_SYNC_2)) {
+        decoder->received = (data == STREAM_SYNC_1) ? 1 : 0;
+        return false;
+    }
+    if (n == 2) {
+        if (data > STREAM_MAX_VALUES) {
+            decoder->received = 0;
+            return false;
+        }
+        decoder->expected = streamFrameLength(data);
+    }
+    decoder->buffer[n] = data;
+    decoder->received  = ++n;
+    if (n < 3 || n < decoder->expected) { return false; }
+
+    // The frame is complete; check it before taking anything from it
+    decoder->received = 0;
+    uint16_t crc      = 0xFFFF;
+    for (uint16_t i = 2; i < n - 2; i++) {
+        crc = streamCrc16(crc, decoder->buffer[i]);
+    }
+    if (crc != (decoder->buffer[n - 2] | (decoder->buffer[n - 1] << 8))) {
+        decoder->badFrames++;
+        return false;
+    }
+    const uint8_t* b  = decoder->buffer;
+    decoder->count    = b[2];
+    decoder->sequence = b[3] | (b[4] << 8);
+    decoder->time_ms  = (uint32_t)b[5] | ((uint32_t)b[6] << 8) |
+        ((uint32_t)b[7] << 16) | ((uint32_t)b[8] << 24);
+    memcpy(decoder->values, &b[STREAM_HEADER_BYTES], 4 * decoder->count);
+    return true;
+}
+
+#endif  // SRC_STREAMFRAME_H_
@@ -0,0 +1,107 @@
+/**
+ * @file TaskWatch.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the TaskWatch class.
+ */
+
+#include "TaskWatch.h"
+
+// Initialize the static members
+TaskWatch::feedFunction    TaskWatch::_feed        = NULL;
+void*                      TaskWatch::_feedContext = NULL;
+const __FlashStringHelper* TaskWatch::_name[MS_TASK_MAX_DEPTH];
+uint32_t                   TaskWatch::_started[MS_TASK_MAX_DEPTH];
+uint32_t                   TaskWatch::_deadline[MS_TASK_MAX_DEPTH];
+uint8_t                    TaskWatch::_depth           = 0;
+uint32_t                   TaskWatch::_untrackedSince  = 0;
+bool                       TaskWatch::_overdueReported = false;
+uint16_t                   TaskWatch::_cancelledCount  = 0;
+
+
+void TaskWatch::setWatchDog(feedFunction feed, void* context) {
+    _feed           = feed;
+    _feedContext    = context;
+    _untrackedSince = millis();
+}
+
+
+void TaskWatch::startCycle(void) {
+    // A task that was never ended would otherwise stay overdue for good
+    if (_depth != 0) {
+        PRINTOUT(_depth, F("tasks were left open; clearing them."));
+        _depth = 0;
+    }
+    _overdueReported = false;
+    _untrackedSince  = millis();
+    if (_feed != NULL) { _feed(_feedContext); }
+}
+
+
+void TaskWatch::begin(const __FlashStringHelper* name, uint32_t deadline_ms) {
+    if (_depth < MS_TASK_MAX_DEPTH) {
+        _name[_depth]     = name;
+        _started[_depth]  = millis();
+        _deadline[_depth] = deadline_ms;
+        MS_DBG(F("Starting"), name, F("with a deadline of"), deadline_ms,
+               F("ms"));
+    }
+    _depth++;
+    _untrackedSince = millis();
+    // Starting a task is progress
+    yield();
+}
+
+
+bool TaskWatch::end(void) {
+    if (_depth == 0) { return true; }
+    _depth--;
+    _untrackedSince = millis();
+    if (_depth >= MS_TASK_MAX_DEPTH) { return true; }
+
+    uint32_t elapsed = millis() - _started[_depth];
+    bool     onTime  = elapsed <= _deadline[_depth];
+    if (onTime) {
+        MS_DBG(_name[_depth], F("finished after"), elapsed, F("ms"));
+    } else {
+        PRINTOUT(_name[_depth], F("was cancelled after"), elapsed, F("ms"));
+        _cancelledCount++;
+    }
+    // Once the overdue tasks have ended, the rest are back on track
+    if (!isOverdue()) { _overdueReported = false; }
+    // Finishing a task is progress
+    yield();
+    return onTime;
+}
+
+
+bool TaskWatch::yield(void) {
+    if (isOverdue()) {
+        if (!_overdueReported) {
+            PRINTOUT(F("A task is overdue; no longer feeding the watchdog."));
+            _overdueReported = true;
+        }
+        return false;
+    }
+    // Waits outside of any task are left to the watchdog once they've run long
+    if (_depth == 0 && millis() - _untrackedSince > MS_TASK_UNTRACKED_MS) {
+        return true;
+    }
+    if (_feed != NULL) { _feed(_feedContext); }
+    return true;
+}
+
+
+bool TaskWatch::isOverdue(void) {
+    uint8_t tracked = _depth < MS_TASK_MAX_DEPTH ? _depth : MS_TASK_MAX_DEPTH;
+    for (uint8_t i = 0; i < tracked; i++) {
+        if (millis() - _started[i] > _deadline[i]) { return true; }
+    }
+    return false;
+}
+
+
+uint16_t TaskWatch::getCancelledCount(void) {
+    return _cancelledCount;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file TaskWatch.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the TaskWatch class, which gives each long running step of
+ * a logging cycle a deadline and feeds the watchdog only while those steps are
+ * on time.
+ *
+ * Any loop that waits - for a sensor to warm up, for a modem to answer, for a
+ * server to respond - calls TaskWatch::yield() on each pass.  As long as every
+ * open task is within its deadline, that feeds the watchdog and returns true.
+ * Once a task has run past its deadline the watchdog is no longer fed and
+ * yield() returns false, telling the loop to give up.  The stuck step is
+ * cancelled and the logger moves on to the next one instead of waiting for the
+ * watchdog to reset the whole board.  The watchdog is only a backstop for code
+ * that never yields at all.
+ *
+ * Tasks can be nested; an overdue outer task cancels every task inside it.
+ *
+ * A wait outside of any task is never cancelled, but it only feeds the
+ * watchdog for #MS_TASK_UNTRACKED_MS after the cycle started or the last task
+ * began or ended.  A sensor that never warms up outside of a task will still
+ * have the board reset by the watchdog.  Each logging cycle starts with
+ * startCycle(), which also clears any task left open by a missing end().
+ *
+ * The default deadlines can be changed with the build flags:
+ * - ```-D MS_TASK_GRACE_MS=10000```
+ * - ```-D MS_TASK_CONNECT_MS=120000```
+ * - ```-D MS_TASK_PUBLISH_MS=30000```
+ * - ```-D MS_TASK_UNTRACKED_MS=60000```
+ */
+
+// Header Guards
+#ifndef SRC_TASKWATCH_H_
+#define SRC_TASKWATCH_H_
+
+// Debugging Statement
+// #define MS_TASKWATCH_DEBUG
+
+#ifdef MS_TASKWATCH_DEBUG
+#define MS_DEBUGGING_STD "TaskWatch"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+
+/**
+ * @brief The largest number of nested tasks that are tracked.  Tasks nested
+ * deeper than this are not given deadlines of their own.
+ *
+ * This can be changed by setting the build flag MS_TASK_MAX_DEPTH when
+ * compiling.
+ */
+#ifndef MS_TASK_MAX_DEPTH
+#define MS_TASK_MAX_DEPTH 4
+#endif
+/**
+ * @brief The time allowed beyond the expected length of a sensor update before
+ * it is cancelled.
+ *
+ * This can be changed by setting the build flag MS_TASK_GRACE_MS when
+ * compiling.
+ */
+#ifndef MS_TASK_GRACE_MS
+#define MS_TASK_GRACE_MS 10000L
+#endif
+/**
+ * @brief The time allowed to wake the modem and connect to the internet.
+ *
+ * This can be changed by setting the build flag MS_TASK_CONNECT_MS when
+ * compiling.
+ */
+#ifndef MS_TASK_CONNECT_MS
+#define MS_TASK_CONNECT_MS 120000L
+#endif
+/**
+ * @brief The time allowed for each publisher to send its data.
+ *
+ * This can be changed by setting the build flag MS_TASK_PUBLISH_MS when
+ * compiling.
+ */
+#ifndef MS_TASK_PUBLISH_MS
+#define MS_TASK_PUBLISH_MS 30000L
+#endif
+/**
+ * @brief The time waits outside of any task may feed the watchdog for.
+ *
+ * This can be changed by setting the build flag MS_TASK_UNTRACKED_MS when
+ * compiling.
+ */
+#ifndef MS_TASK_UNTRACKED_MS
+#define MS_TASK_UNTRACKED_MS 60000L
+#endif
+
+/**
+ * @brief The TaskWatch class tracks the deadlines of the nested steps of a
+ * logging cycle and feeds the watchdog while they are on time.
+ *
+ * All members are static; there is only one watchdog.
+ *
+ * @ingroup base_classes
+ */
+class TaskWatch {
+ public:
+    /**
+     * @brief A function that resets the watchdog.
+     *
+     * @param context The pointer given to setWatchDog()
+     */
+    typedef void (*feedFunction)(void* context);
+
+    /**
+     * @brief Set the function used to feed the watchdog.
+     *
+     * Until this is set, yield() only checks the deadlines.
+     *
+     * @param feed The function that resets the watchdog
+     * @param context A pointer passed to the function, usually the logger
+     */
+    static void setWatchDog(feedFunction feed, void* context);
+
+    /**
+     * @brief Start a logging cycle - feed the watchdog and clear any tasks
+     * left open.
+     *
+     * Call this at the top of each logging cycle, outside of any task.
+     */
+    static void startCycle(void);
+
+    /**
+     * @brief Start a task.
+     *
+     * Every call must be matched by a call to end().
+     *
+     * @param name The name of the task, for the debugging output
+     * @param deadline_ms The time the task is allowed from now, in ms
+     */
+    static void begin(const __FlashStringHelper* name, uint32_t deadline_ms);
+    /**
+     * @brief End the innermost task.
+     *
+     * @return **bool** True if the task finished within its deadline; false if
+     * it was overdue and so was cancelled.
+     */
+    static bool end(void);
+
+    /**
+     * @brief Give the watchdog a chance to be fed from within a wait.
+     *
+     * Call this on every pass of a loop that waits.  Outside of any task, the
+     * watchdog is only fed for #MS_TASK_UNTRACKED_MS.
+     *
+     * @return **bool** True if every open task is within its deadline.  False
+     * if any is overdue; the caller should stop waiting and give up.
+     */
+    static bool yield(void);
+    /**
+     * @brief Check whether any open task has run past its deadline.
+     *
+     * @return **bool** True if a task is overdue.
+     */
+    static bool isOverdue(void);
+
+    /**
+     * @brief Get the number of tasks that have been cancelled since the
+     * logger started.
+     *
+     * @return **uint16_t** The number of cancelled tasks
+     */
+    static uint16_t getCancelledCount(void);
+
+ private:
+    static feedFunction               _feed;
+    static void*                      _feedContext;
+    static const __FlashStringHelper* _name[MS_TASK_MAX_DEPTH];
+    static uint32_t                   _started[MS_TASK_MAX_DEPTH];
+    static uint32_t                   _deadline[MS_TASK_MAX_DEPTH];
+    static uint8_t                    _depth;
+    static uint32_t                   _untrackedSince;
+    static bool                       _overdueReported;
+    static uint16_t                   _cancelledCount;
+};
+
+#endif  // SRC_TASKWATCH_H_
@@ -11,17 +11,24 @@
 
 
 // Constructors
-VariableArray::VariableArray() {}
+VariableArray::VariableArray()
+    : _projectedChargeSaved_mAh(0), _lastVarTable(NULL), _lastVarTableSize(0) {}
 VariableArray::VariableArray(uint8_t variableCount, Variable* variableList[])
-    : arrayOfVars(variableList), _variableCount(variableCount) {
-    _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
+    : arrayOfVars(variableList),
+      _variableCount(variableCount),
+      _projectedChargeSaved_mAh(0),
+      _lastVarTable(NULL),
+      _lastVarTableSize(0) {
+    mapSensors();
 }
 VariableArray::VariableArray(uint8_t variableCount, Variable* variableList[],
                              const char* uuids[])
-    : arrayOfVars(variableList), _variableCount(variableCount) {
-    _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
+    : arrayOfVars(variableList),
+      _variableCount(variableCount),
+      _projectedChargeSaved_mAh(0),
+      _lastVarTable(NULL),
+      _lastVarTableSize(0) {
+    mapSensors();
     matchUUIDs(uuids);
 }
 
@@ -33,8 +40,7 @@ void VariableArray::begin(uint8_t variableCount, Variable* variableList[],
     _variableCount = variableCount;
     arrayOfVars    = variableList;
 
-    _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
+    mapSensors();
     matchUUIDs(uuids);
     checkVariableUUIDs();
 }
@@ -42,16 +48,41 @@ void VariableArray::begin(uint8_t variableCount, Variable* variableList[]) {
     _variableCount = variableCount;
     arrayOfVars    = variableList;
 
-    _maxSamplestoAverage = countMaxToAverage();
-    _sensorCount         = getSensorCount();
+    mapSensors();
     checkVariableUUIDs();
 }
 void VariableArray::begin() {
+    mapSensors();
+    checkVariableUUIDs();
+}
+void VariableArray::setVariables(uint8_t   variableCount,
+                                 Variable* variableList[]) {
+    _variableCount = variableCount;
+    arrayOfVars    = variableList;
+    mapSensors();
+}
+
+// This works out which variables are the last from each sensor, once
+void VariableArray::mapSensors(void) {
+    if (_lastVarTable != NULL && _variableCount > _lastVarTableSize) {
+        MS_DBG(F("Too many variables for the sensor table; not using it"));
+        _lastVarTable = NULL;
+    }
+    if (_lastVarTable != NULL) {
+        // Leave the table empty while filling it, so isLastVarFromSensor()
+        // does the comparison
+        bool* table   = _lastVarTable;
+        _lastVarTable = NULL;
+        for (uint8_t i = 0; i < _variableCount; i++) {
+            table[i] = isLastVarFromSensor(i);
+        }
+        _lastVarTable = table;
+    }
     _maxSamplestoAverage = countMaxToAverage();
     _sensorCount         = getSensorCount();
-    checkVariableUUIDs();
 }
 
+
 // This counts and returns the number of calculated variables
 uint8_t VariableArray::getCalculatedVariableCount(void) {
     uint8_t numCalc = 0;
@@ -140,11 +171,24 @@ bool VariableArray::setupSensors(void) {
         }
     }
 
+#if defined MS_BOOT_CACHE
+    // Load what the sensors found at the last boot, if they're the same
+    // sensors as now
+    uint32_t configHash = 2166136261UL;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (isLastVarFromSensor(i)) {
+            uint16_t key = arrayOfVars[i]->parentSensor->getBootCacheKey();
+            configHash   = BootCache::hash(configHash, &key, sizeof(key));
+        }
+    }
+    BootCache::begin(configHash);
+#endif
+
     // We're going to keep looping through all of the sensors and check if each
     // one has been on long enough to be warmed up.  Once it has, we'll set it
     // up and increment the counter marking that's been done.
     // We keep looping until they've all been done.
-    while (nSensorsSetup < _sensorCount) {
+    while (nSensorsSetup < _sensorCount && TaskWatch::yield()) {
         for (uint8_t i = 0; i < _variableCount; i++) {
             bool sensorSuccess = false;
             if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
@@ -161,6 +205,17 @@ bool VariableArray::setupSensors(void) {
 
                     sensorSuccess =
                         arrayOfVars[i]->parentSensor->setup();  // set it up
+#if defined MS_BOOT_CACHE
+                    // If what was saved at the last boot no longer works,
+                    // forget it and set the sensor up from scratch
+                    if (!sensorSuccess &&
+                        BootCache::forget(
+                            arrayOfVars[i]->parentSensor->getBootCacheKey())) {
+                        MS_DBG(F("        ... retrying without the boot"),
+                               F("cache..."));
+                        sensorSuccess = arrayOfVars[i]->parentSensor->setup();
+                    }
+#endif
                     success &= sensorSuccess;
                     nSensorsSetup++;
 
@@ -178,6 +233,11 @@ bool VariableArray::setupSensors(void) {
     // Power down all sensor;
     // sensorsPowerDown();
 
+#if defined MS_BOOT_CACHE
+    // Save anything the sensors found for the next boot
+    BootCache::commit();
+#endif
+
     if (success) { MS_DBG(F("... Success!")); }
 
     return success;
@@ -191,12 +251,107 @@ bool VariableArray::setupSensors(void) {
 // sensor.
 void VariableArray::sensorsPowerUp(void) {
     MS_DBG(F("Powering up sensors..."));
+
+    // Collect the unique power pins with the longest warm-up and the total
+    // inrush of the sensors on each
+    bool     lastSensorVariable[_variableCount];
+    int8_t   pins[_variableCount];
+    uint32_t pinWarmUp[_variableCount];
+    uint8_t  pinInrush[_variableCount];
+    uint32_t pinStart[_variableCount];
+    bool     pinScheduled[_variableCount];
+    uint8_t  nPins = 0;
     for (uint8_t i = 0; i < _variableCount; i++) {
-        if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
-            MS_DBG(F("    Powering up"),
-                   arrayOfVars[i]->getParentSensorNameAndLocation());
+        lastSensorVariable[i] = isLastVarFromSensor(i);
+        if (!lastSensorVariable[i]) { continue; }  // Skip non-unique sensors
+        Sensor* sensor = arrayOfVars[i]->parentSensor;
+        int8_t  pin    = sensor->getPowerPin();
+        if (pin < 0) {
+            // There's no switching to stagger for sensors without a power pin
+            MS_DBG(F("    Powering up"), sensor->getSensorNameAndLocation());
+            sensor->powerUp();
+            continue;
+        }
+        uint8_t p = 0;
+        while (p < nPins && pins[p] != pin) { p++; }
+        if (p == nPins) {
+            pins[p]         = pin;
+            pinWarmUp[p]    = 0;
+            pinInrush[p]    = 0;
+            pinScheduled[p] = false;
+            nPins++;
+        }
+        if (sensor->getWarmUpTime() > pinWarmUp[p]) {
+            pinWarmUp[p] = sensor->getWarmUpTime();
+        }
+        pinInrush[p] += sensor->getInrushClass();
+    }
+    if (nPins == 0) { return; }
+
+    // Every sensor should be ready by the time the slowest one is
+    uint32_t deadline = 0;
+    for (uint8_t p = 0; p < nPins; p++) {
+        if (pinWarmUp[p] > deadline) { deadline = pinWarmUp[p]; }
+    }
 
-            arrayOfVars[i]->parentSensor->powerUp();
+    // Schedule the pins from the longest to the shortest warm-up, putting each
+    // as early as the inrush budget allows
+    for (uint8_t n = 0; n < nPins; n++) {
+        uint8_t next = 0;
+        bool    found = false;
+        for (uint8_t p = 0; p < nPins; p++) {
+            if (!pinScheduled[p] &&
+                (!found || pinWarmUp[p] > pinWarmUp[next])) {
+                next  = p;
+                found = true;
+            }
+        }
+        uint32_t latest = deadline - pinWarmUp[next];
+        uint32_t start  = 0;
+        bool     moved  = true;
+        while (moved && start < latest) {
+            // Add up the inrush of the pins switched on within the settling
+            // time of this start, and find when the last of them settles
+            uint32_t first;
+            uint32_t settled;
+            uint16_t load = pinInrush[next] +
+                powerScheduleInrushLoad(start, nPins, pinStart, pinInrush,
+                                        pinScheduled, MS_INRUSH_SETTLE_MS,
+                                        &first, &settled);
+            moved = load > MS_INRUSH_BUDGET && settled > start;
+            if (moved) { start = settled; }
+        }
+        if (start > latest) {
+            MS_DBG(F("    Power pin"), pins[next],
+                   F("can't wait for the inrush budget without delaying "
+                     "readings."));
+            start = latest;
+        }
+        pinStart[next]     = start;
+        pinScheduled[next] = true;
+    }
+
+    // Switch the pins on in order of their start times
+    uint32_t powerUpStart = millis();
+    for (uint8_t n = 0; n < nPins; n++) {
+        uint8_t next = 0;
+        bool    found = false;
+        for (uint8_t p = 0; p < nPins; p++) {
+            if (pinScheduled[p] && (!found || pinStart[p] < pinStart[next])) {
+                next  = p;
+                found = true;
+            }
+        }
+        pinScheduled[next] = false;
+        while (millis() - powerUpStart < pinStart[next]) {}
+        for (uint8_t i = 0; i < _variableCount; i++) {
+            if (lastSensorVariable[i] &&
+                arrayOfVars[i]->parentSensor->getPowerPin() == pins[next]) {
+                MS_DBG(F("    Powering up"),
+                       arrayOfVars[i]->getParentSensorNameAndLocation(),
+                       F("at"), pinStart[next], F("ms"));
+                arrayOfVars[i]->parentSensor->powerUp();
+            }
         }
     }
 }
@@ -236,7 +391,7 @@ bool VariableArray::sensorsWake(void) {
     // one has been on long enough to be warmed up.  Once it has, we'll wake it
     // up and increment the counter marking that's been done.
     // We keep looping until they've all been done.
-    while (nSensorsAwake < _sensorCount) {
+    while (nSensorsAwake < _sensorCount && TaskWatch::yield()) {
         for (uint8_t i = 0; i < _variableCount; i++) {
             if (isLastVarFromSensor(i)) {  // Skip non-unique sensors
                 // If no attempts yet made to wake the sensor up
@@ -398,7 +553,7 @@ bool VariableArray::updateAllSensors(void) {
         }
     }
 
-    while (nSensorsCompleted < _sensorCount) {
+    while (nSensorsCompleted < _sensorCount && TaskWatch::yield()) {
         for (uint8_t i = 0; i < _variableCount; i++) {
             /***
             // THIS IS PURELY FOR DEEP DEBUGGING OF THE TIMING!
@@ -521,6 +676,34 @@ bool VariableArray::updateAllSensors(void) {
 }
 
 
+// This makes one non-blocking pass over the sensors, starting and collecting
+// single measurements
+uint8_t VariableArray::pollSensors(void) {
+    uint8_t nNewResults = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (!isLastVarFromSensor(i)) { continue; }
+        Sensor* sensor = arrayOfVars[i]->parentSensor;
+        // Skip sensors that didn't wake or aren't stable yet
+        if (bitRead(sensor->getStatus(), 4) == 0 || !sensor->isStable()) {
+            continue;
+        }
+        // Start a reading if one isn't already going
+        if (bitRead(sensor->getStatus(), 5) == 0) {
+            sensor->startSingleMeasurement();
+        }
+        // Collect a finished reading in place of the last one
+        if (sensor->isMeasurementComplete()) {
+            sensor->clearValues();
+            sensor->addSingleMeasurementResult();
+            sensor->averageMeasurements();
+            sensor->notifyVariables();
+            nNewResults++;
+        }
+    }
+    return nNewResults;
+}
+
+
 // This function is an even more complete version of the updateAllSensors
 // function - it handles power up/down and wake/sleep.
 bool VariableArray::completeUpdate(void) {
@@ -653,6 +836,18 @@ bool VariableArray::completeUpdate(void) {
     uint8_t nCompletedOnPin[_variableCount];
     for (uint8_t i = 0; i < _variableCount; i++) { nCompletedOnPin[i] = 0; }
 
+#if defined MS_WAKE_PROFILER
+    // Arrays with the sensor number of each sensor's last variable and the
+    // time each sensor finished its last step, for the profiler
+    uint8_t  profileSensorNumber[_variableCount];
+    uint32_t profileLastStep[_variableCount];
+    uint8_t  profileSensorCount = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        profileSensorNumber[i] = profileSensorCount;
+        if (lastSensorVariable[i]) { profileSensorCount++; }
+    }
+#endif
+
     // Clear the initial variable arrays
     MS_DBG(F("----->> Clearing all results arrays before taking new "
              "measurements. ..."));
@@ -663,12 +858,131 @@ bool VariableArray::completeUpdate(void) {
     }
     MS_DBG(F("   ... Complete. <<-----"));
 
-    // power up all of the sensors together
-    MS_DBG(F("----->> Powering up all sensors together. ..."));
-    sensorsPowerUp();
-    MS_DBG(F("   ... Complete. <<-----"));
+    // Plan when to power each rail and wake each sensor.  Every sensor should
+    // finish with the slowest one, so each rail is switched on and each sensor
+    // is woken as late as it can be.  The arrays of rails are indexed by the
+    // powerPinIndex of the sensors on them.
+    MS_DBG(F("----->> Planning when to power and wake each sensor. ..."));
+    uint32_t activeTime[_variableCount];
+    uint32_t railOnTime[_variableCount];
+    uint8_t  railInrush[_variableCount];
+    uint32_t railStart[_variableCount];
+    bool     railScheduled[_variableCount];
+    bool     railPowered[_variableCount];
+    uint32_t wakeStart[_variableCount];
+    uint32_t cycleTime = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        railOnTime[i]    = 0;
+        railInrush[i]    = 0;
+        railStart[i]     = 0;
+        railScheduled[i] = true;
+        railPowered[i]   = false;
+    }
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (!lastSensorVariable[i]) { continue; }
+        Sensor* sensor = arrayOfVars[i]->parentSensor;
+        activeTime[i]  = powerScheduleActiveTime(
+            sensor->getStabilizationTime(), sensor->getMeasurementTime(),
+            nMeasurementsToAverage[i]);
+        // Sensors without a power pin were warmed up long ago
+        uint32_t onTime = activeTime[i];
+        if (powerPins[i] >= 0) {
+            onTime += sensor->getWarmUpTime();
+            railInrush[powerPinIndex[i]] += sensor->getInrushClass();
+            railScheduled[powerPinIndex[i]] = false;
+        }
+        if (onTime > railOnTime[powerPinIndex[i]]) {
+            railOnTime[powerPinIndex[i]] = onTime;
+        }
+        if (onTime > cycleTime) { cycleTime = onTime; }
+    }
+
+    // Schedule the rails from the latest to the earliest start, moving each
+    // earlier until the rails switched on around it fit in the inrush budget
+    for (uint8_t n = 0; n < _variableCount; n++) {
+        uint8_t next  = 0;
+        bool    found = false;
+        for (uint8_t r = 0; r < _variableCount; r++) {
+            if (!railScheduled[r] &&
+                (!found || railOnTime[r] < railOnTime[next])) {
+                next  = r;
+                found = true;
+            }
+        }
+        if (!found) { break; }
+        uint32_t start = powerScheduleLatestStart(cycleTime, railOnTime[next]);
+        bool     moved = true;
+        while (moved && start > 0) {
+            uint32_t first;
+            uint32_t settled;
+            uint16_t load = railInrush[next] +
+                powerScheduleInrushLoad(start, _variableCount, railStart,
+                                        railInrush, railScheduled,
+                                        MS_INRUSH_SETTLE_MS, &first, &settled);
+            moved = load > MS_INRUSH_BUDGET && load > railInrush[next];
+            if (moved) {
+                start = first > MS_INRUSH_SETTLE_MS
+                    ? first - MS_INRUSH_SETTLE_MS
+                    : 0;
+            }
+        }
+        railStart[next]     = start;
+        railScheduled[next] = true;
+    }
+
+    // Wake each sensor so it finishes with the slowest, and work out how much
+    // less charge that uses than powering and waking everything right away
+    _projectedChargeSaved_mAh = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (!lastSensorVariable[i]) { continue; }
+        Sensor*  sensor     = arrayOfVars[i]->parentSensor;
+        uint32_t warmUp     = 0;
+        uint32_t powerDelay = 0;
+        if (powerPins[i] >= 0) {
+            warmUp     = sensor->getWarmUpTime();
+            powerDelay = railStart[powerPinIndex[i]];
+        }
+        wakeStart[i] = powerScheduleLatestStart(cycleTime, activeTime[i]);
+        _projectedChargeSaved_mAh += powerScheduleChargeSaved(
+            powerDelay, wakeStart[i] - warmUp, sensor->getActiveCurrent(),
+            sensor->getIdleCurrent());
+        MS_DBG(F("   "), arrayOfVars[i]->getParentSensorNameAndLocation(),
+               F("will be powered at"), powerDelay, F("ms and woken at"),
+               wakeStart[i], F("ms"));
+    }
+    MS_DBG(F("   ... The update should take"), cycleTime,
+           F("ms and save about"), String(_projectedChargeSaved_mAh, 4),
+           F("mAh. <<-----"));
+
+    // Mark the start of the cycle for the energy estimates
+    uint32_t cycleStart = millis();
+
+    // Allow twice the planned time, plus some grace, before giving up on any
+    // sensors that are stuck
+    TaskWatch::begin(F("Sensor update"), 2 * cycleTime + MS_TASK_GRACE_MS);
+    while (nSensorsCompleted < _sensorCount && TaskWatch::yield()) {
+        // Switch on any rails whose time has come
+        uint32_t elapsed = millis() - cycleStart;
+        for (uint8_t r = 0; r < _variableCount; r++) {
+            if (!lastSensorVariable[r] || railPowered[powerPinIndex[r]] ||
+                elapsed < railStart[powerPinIndex[r]]) {
+                continue;
+            }
+            MS_PROFILE_START(powerUpTimer);
+            for (uint8_t k = 0; k < _variableCount; k++) {
+                if (powerPinIndex[k] == powerPinIndex[r] &&
+                    lastSensorVariable[k]) {
+                    MS_DBG(k, F("--->> Powering up"),
+                           arrayOfVars[k]->getParentSensorNameAndLocation(),
+                           F("at"), elapsed, F("ms"));
+                    arrayOfVars[k]->parentSensor->powerUp();
+                    MS_PROFILE(profileLastStep[k] = micros());
+                }
+            }
+            MS_PROFILE_STOP(powerUpTimer, PROFILE_SENSOR_POWER_UP);
+            railPowered[powerPinIndex[r]] = true;
+        }
 
-    while (nSensorsCompleted < _sensorCount) {
         for (uint8_t i = 0; i < _variableCount; i++) {
             /***
             // THIS IS PURELY FOR DEEP DEBUGGING OF THE TIMING!
@@ -704,9 +1018,12 @@ bool VariableArray::completeUpdate(void) {
             // Only do checks on sensors that still have measurements to finish
             if (lastSensorVariable[i] &&
                 nMeasurementsToAverage[i] > nMeasurementsCompleted[i]) {
-                // If no attempts yet made to wake the sensor up
+                // If no attempts yet made to wake the sensor up, and it's time
+                // to wake it
                 if (bitRead(arrayOfVars[i]->parentSensor->getStatus(), 3) ==
-                    0) {
+                        0 &&
+                    railPowered[powerPinIndex[i]] &&
+                    millis() - cycleStart >= wakeStart[i]) {
                     // and if it is already warmed up
                     if (arrayOfVars[i]->parentSensor->isWarmedUp(
                             deepDebugTiming)) {
@@ -716,9 +1033,13 @@ bool VariableArray::completeUpdate(void) {
 
                         // Make a single attempt to wake the sensor after it is
                         // warmed up
+                        MS_PROFILE(WakeProfiler::addSensorTime(
+                            profileSensorNumber[i], PROFILE_SENSOR_WARM_UP,
+                            micros() - profileLastStep[i]));
                         bool sensorSuccess_wake =
                             arrayOfVars[i]->parentSensor->wake();
                         success &= sensorSuccess_wake;
+                        MS_PROFILE(profileLastStep[i] = micros());
 
                         if (sensorSuccess_wake) {
                             MS_DBG(F("   ... wake up uccess. <<---"), i);
@@ -766,10 +1087,14 @@ bool VariableArray::completeUpdate(void) {
                                arrayOfVars[i]->getParentSensorNameAndLocation(),
                                F("..."));
 
+                        MS_PROFILE(WakeProfiler::addSensorTime(
+                            profileSensorNumber[i], PROFILE_SENSOR_STABILIZE,
+                            micros() - profileLastStep[i]));
                         bool sensorSuccess_start =
                             arrayOfVars[i]
                                 ->parentSensor->startSingleMeasurement();
                         success &= sensorSuccess_start;
+                        MS_PROFILE(profileLastStep[i] = micros());
 
                         if (sensorSuccess_start) {
                             MS_DBG(F("   ... set up succeeded. <<---"), i, '.',
@@ -795,10 +1120,18 @@ bool VariableArray::completeUpdate(void) {
                                arrayOfVars[i]->getParentSensorNameAndLocation(),
                                F("..."));
 
+                        MS_PROFILE(WakeProfiler::addSensorTime(
+                            profileSensorNumber[i], PROFILE_SENSOR_MEASURE,
+                            micros() - profileLastStep[i]));
+                        MS_PROFILE_START(readTimer);
                         bool sensorSuccess_result =
                             arrayOfVars[i]
                                 ->parentSensor->addSingleMeasurementResult();
                         success &= sensorSuccess_result;
+                        MS_PROFILE(WakeProfiler::addSensorTime(
+                            profileSensorNumber[i], PROFILE_SENSOR_READ,
+                            micros() - readTimer));
+                        MS_PROFILE(profileLastStep[i] = micros());
                         nMeasurementsCompleted[i] +=
                             1;  // increment the number of measurements that
                                 // sensor has completed
@@ -823,6 +1156,9 @@ bool VariableArray::completeUpdate(void) {
                            arrayOfVars[i]->getParentSensorNameAndLocation(),
                            F(", putting it to sleep. ..."));
 
+                    // Count the charge used while it was on
+                    arrayOfVars[i]->parentSensor->addChargeUsed(cycleStart);
+
                     // Put the completed sensor to sleep
                     bool sensorSuccess_sleep =
                         arrayOfVars[i]->parentSensor->sleep();
@@ -843,6 +1179,8 @@ bool VariableArray::completeUpdate(void) {
                         for (uint8_t k = 0; k < _variableCount; k++) {
                             if (powerPinIndex[k] == powerPinIndex[i] &&
                                 lastSensorVariable[k]) {
+                                arrayOfVars[k]->parentSensor->addChargeUsed(
+                                    cycleStart);
                                 arrayOfVars[k]->parentSensor->powerDown();
                                 MS_DBG(k, F("--->>"),
                                        arrayOfVars[k]
@@ -860,6 +1198,21 @@ bool VariableArray::completeUpdate(void) {
         }
     }
 
+    // If the update was cancelled, put away the sensors that didn't finish
+    if (!TaskWatch::end()) {
+        success = false;
+        for (uint8_t i = 0; i < _variableCount; i++) {
+            if (lastSensorVariable[i] &&
+                nMeasurementsCompleted[i] < nMeasurementsToAverage[i]) {
+                PRINTOUT(arrayOfVars[i]->getParentSensorNameAndLocation(),
+                         F("did not finish in time!"));
+                arrayOfVars[i]->parentSensor->addChargeUsed(cycleStart);
+                arrayOfVars[i]->parentSensor->sleep();
+                arrayOfVars[i]->parentSensor->powerDown();
+            }
+        }
+    }
+
     // Average measurements and notify varibles of the updates
     MS_DBG(F("----->> Averaging results and notifying all variables. ..."));
     for (uint8_t i = 0; i < _variableCount; i++) {
@@ -878,6 +1231,32 @@ bool VariableArray::completeUpdate(void) {
 }
 
 
+// This function sends the current values of all variables as one record
+void VariableArray::streamSensorData(Stream* stream, streamFormat format,
+                                     uint16_t sequence) {
+    uint32_t now = millis();
+    if (format == STREAM_BINARY) {
+        float values[_variableCount];
+        for (uint8_t i = 0; i < _variableCount; i++) {
+            values[i] = arrayOfVars[i]->getValue();
+        }
+        uint8_t  frame[streamFrameLength(_variableCount)];
+        uint16_t length = streamEncodeFrame(frame, sequence, now, values,
+                                            _variableCount);
+        stream->write(frame, length);
+    } else {
+        stream->print(sequence);
+        stream->print(',');
+        stream->print(now);
+        for (uint8_t i = 0; i < _variableCount; i++) {
+            stream->print(',');
+            stream->print(arrayOfVars[i]->getValueString());
+        }
+        stream->println();
+    }
+}
+
+
 // This function prints out the results for any connected sensors to a stream
 //  Calculated Variable results will be included
 void VariableArray::printSensorData(Stream* stream) {
@@ -920,8 +1299,58 @@ void VariableArray::printSensorData(Stream* stream) {
 }
 
 
+// These sum the energy use of every unique sensor in the array
+float VariableArray::getSensorChargeUsed(void) {
+    float charge = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (isLastVarFromSensor(i)) {
+            charge += arrayOfVars[i]->parentSensor->getChargeUsed();
+        }
+    }
+    return charge;
+}
+float VariableArray::getSensorBaselineCurrent(void) {
+    float current = 0;
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (isLastVarFromSensor(i)) {
+            current += arrayOfVars[i]->parentSensor->getBaselineCurrent();
+        }
+    }
+    return current;
+}
+
+
+// This prints the currents and charge used by each unique sensor
+void VariableArray::printSensorEnergy(Stream* stream) {
+    for (uint8_t i = 0; i < _variableCount; i++) {
+        if (isLastVarFromSensor(i)) {
+            Sensor* sensor = arrayOfVars[i]->parentSensor;
+            stream->print(sensor->getSensorNameAndLocation());
+            stream->print(F(" draws "));
+            stream->print(sensor->getActiveCurrent());
+            stream->print(F(" mA active, "));
+            stream->print(sensor->getIdleCurrent());
+            stream->print(F(" mA idle, and "));
+            stream->print(sensor->getBaselineCurrent());
+            stream->print(F(" mA between cycles; used "));
+            stream->print(sensor->getChargeUsed(), 4);
+            stream->println(F(" mAh while on"));
+        }
+    }
+}
+
+
+// This returns the charge the last complete update was planned to save
+float VariableArray::getProjectedChargeSaved(void) {
+    return _projectedChargeSaved_mAh;
+}
+
+
 // Check for unique sensors
 bool VariableArray::isLastVarFromSensor(int arrayIndex) {
+    // Use the table, if there is one
+    if (_lastVarTable != NULL) { return _lastVarTable[arrayIndex]; }
+
     /*MS_DEEP_DBG(F("Checking if"), arrayOfVars[arrayIndex]->getVarName(), '(',
            arrayIndex, F(") is the last variable from a sensor..."));*/
 
@@ -31,6 +31,30 @@
 #undef MS_DEBUGGING_DEEP
 #include "VariableBase.h"
 #include "SensorBase.h"
+#include "WakeProfiler.h"
+#include "PowerSchedule.h"
+#include "StreamFrame.h"
+
+/**
+ * @brief The largest total of @ref sensor_inrush_classes that may be switched
+ * on within #MS_INRUSH_SETTLE_MS of each other.
+ *
+ * This can be changed by setting the build flag MS_INRUSH_BUDGET when
+ * compiling.
+ */
+#ifndef MS_INRUSH_BUDGET
+#define MS_INRUSH_BUDGET 4
+#endif
+/**
+ * @brief The time in milliseconds for the current surge from switching on a
+ * power pin to settle.
+ *
+ * This can be changed by setting the build flag MS_INRUSH_SETTLE_MS when
+ * compiling.
+ */
+#ifndef MS_INRUSH_SETTLE_MS
+#define MS_INRUSH_SETTLE_MS 100
+#endif
 
 
 /**
@@ -136,6 +160,18 @@ class VariableArray {
      * outputs the results.
      */
     void begin();
+    /**
+     * @brief Swap in a different list of variables without checking or
+     * printing the UUIDs.
+     *
+     * This is for arrays that are rebuilt on every logging cycle, such as the
+     * list of sensors due in a LoggerGroup, where begin() would print the
+     * whole list every time.
+     *
+     * @param variableCount The number of variables in the array.
+     * @param variableList An array of pointers to variable objects.
+     */
+    void setVariables(uint8_t variableCount, Variable* variableList[]);
 
     /**
      * @brief Pointer to the array of variable pointers.
@@ -202,6 +238,15 @@ class VariableArray {
      * @brief Power up each sensor.
      *
      * Runs the powerUp sensor function for each unique sensor.
+     *
+     * Rather than switching every power pin on at once, the pins are switched
+     * on in a staggered order so the current surge on the supply stays small.
+     * The pin with the longest warm-up is switched on first.  Each following
+     * pin is switched on as soon as the inrush classes of the pins switched on
+     * within the last #MS_INRUSH_SETTLE_MS fit in #MS_INRUSH_BUDGET, but never
+     * so late that it would be warmed up after the first pin.  All sensors are
+     * still ready at the same time they would have been if switched on
+     * together.  This function waits until the last pin has been switched on.
      */
     void sensorsPowerUp(void);
 
@@ -251,10 +296,33 @@ class VariableArray {
      * values.  Repeatedly checks each sensor's readiness state to optimize
      * timing.
      *
+     * Before anything is powered, the update is planned from each sensor's
+     * declared warm-up, stabilization, and measurement times and number of
+     * measurements to average.  Each power pin is switched on as late as it
+     * can be and each sensor is woken as late as it can be while still
+     * finishing with the slowest sensor, and each pin is switched off as soon
+     * as every sensor on it is done.  Pins switched on close together are
+     * moved earlier to keep within #MS_INRUSH_BUDGET.  See PowerSchedule.h.
+     *
      * @return **bool** True if all steps of the update succeeded.
      */
     bool completeUpdate(void);
 
+    /**
+     * @brief Make one pass over the sensors, starting a measurement on any
+     * that is ready for one and collecting the result from any that has
+     * finished.
+     *
+     * Unlike updateAllSensors(), this does not wait for anything and does not
+     * average; each finished measurement replaces the sensor's values and is
+     * sent to its variables at once.  The sensors must already be powered and
+     * awake.  Call this in a tight loop to read every sensor as fast as it can
+     * go.
+     *
+     * @return **uint8_t** The number of sensors with a new result.
+     */
+    uint8_t pollSensors(void);
+
     /**
      * @brief Print out the results for all connected sensors to a stream
      *
@@ -268,6 +336,50 @@ class VariableArray {
      */
     void printSensorData(Stream* stream = &Serial);
 
+    /**
+     * @brief Send the current value of every variable to a stream as one
+     * compact record.
+     *
+     * Only the values are sent, in the order of the array - as a line of
+     * comma separated text or as a binary frame as described in
+     * StreamFrame.h.  Both start with the sequence number and the processor
+     * time.
+     *
+     * @param stream An Arduino Stream instance
+     * @param format The format to send the record in
+     * @param sequence The record sequence number
+     */
+    void streamSensorData(Stream* stream, streamFormat format,
+                          uint16_t sequence);
+
+    /**
+     * @brief Get the total charge all of the sensors have used while powered
+     * and awake since the logger started.
+     *
+     * @return **float** The charge used in mAh
+     */
+    float getSensorChargeUsed(void);
+    /**
+     * @brief Get the total current drawn by the continuously powered sensors
+     * between logging cycles.
+     *
+     * @return **float** The baseline current in mA
+     */
+    float getSensorBaselineCurrent(void);
+    /**
+     * @brief Print the currents and charge used by each sensor to a stream.
+     *
+     * @param stream An Arduino Stream instance
+     */
+    void printSensorEnergy(Stream* stream = &Serial);
+    /**
+     * @brief Get the charge the plan for the last complete update was
+     * expected to save compared to powering and waking every sensor at once.
+     *
+     * @return **float** The projected charge saved in mAh
+     */
+    float getProjectedChargeSaved(void);
+
  protected:
     /**
      * @brief The count of variables in the array
@@ -281,6 +393,33 @@ class VariableArray {
      * @brief The maximum number of samples to average of an single sensor.
      */
     uint8_t _maxSamplestoAverage;
+    /**
+     * @brief The charge the plan for the last complete update was expected to
+     * save, in mAh.
+     */
+    float _projectedChargeSaved_mAh;
+    /**
+     * @brief Whether each variable is the last in the array from its sensor,
+     * worked out once by mapSensors().
+     *
+     * This is NULL unless a subclass, such as StaticVariableArray, gives the
+     * array somewhere to keep the table.  Without it, the sensor of every
+     * variable after the one asked about is compared each time.
+     */
+    bool* _lastVarTable;
+    /**
+     * @brief The number of entries #_lastVarTable has room for.
+     */
+    uint8_t _lastVarTableSize;
+
+    /**
+     * @brief Work out everything about the sensors that depends only on the
+     * list of variables: the #_lastVarTable, if there is one, the number of
+     * unique sensors, and the most measurements any sensor will average.
+     *
+     * This is run whenever the list of variables is set.
+     */
+    void mapSensors(void);
 
  private:
     bool    isLastVarFromSensor(int arrayIndex);
@@ -313,4 +452,72 @@ class VariableArray {
 #endif  // DEEP_DEBUGGING_SERIAL_OUTPUT
 };
 
+
+/**
+ * @brief A variable array with its size fixed when it is compiled, which
+ * keeps its own table of which variables come from which sensor.
+ *
+ * A plain VariableArray finds the unique sensors by comparing the sensor name
+ * and location of every later variable in the array, building two Strings for
+ * each comparison.  That is done for each variable on each pass of every
+ * sensor loop - setup, waking, updating, and sleeping - so the work grows
+ * with the square of the number of variables.  This class works it out once
+ * when the variables are given and keeps the answers in a table of one bool
+ * per variable, so each check becomes a single lookup with no heap use.
+ *
+ * Only the size is fixed when compiling.  The table itself is in RAM and is
+ * filled when the array is constructed or begun, because variables are tied
+ * to their sensors by constructors that run at startup.  It costs N bytes of
+ * RAM; tools/variable_array_bench measures what it saves.
+ *
+ * The number of variables is taken from the size of the list, so it can't
+ * disagree with it.  Use it anywhere a VariableArray is used:
+ * @code{.cpp}
+ * Variable* variableList[] = { ... };
+ * const char* UUIDs[] = { ... };
+ * StaticVariableArray<sizeof(variableList) / sizeof(variableList[0])>
+ *     varArray(variableList, UUIDs);
+ * Logger dataLogger(LoggerID, loggingInterval, &varArray);
+ * @endcode
+ *
+ * @tparam N The number of variables in the array
+ *
+ * @ingroup base_classes
+ */
+template <uint8_t N>
+class StaticVariableArray : public VariableArray {
+ public:
+    /**
+     * @brief Construct a new Static Variable Array object
+     *
+     * @param variableList An array of exactly N pointers to variable objects.
+     * The pointers may be to calculated or measured variable objects.
+     */
+    explicit StaticVariableArray(Variable* (&variableList)[N])
+        : VariableArray(N, variableList) {
+        useTable();
+    }
+    /**
+     * @brief Construct a new Static Variable Array object
+     *
+     * @param variableList An array of exactly N pointers to variable objects.
+     * The pointers may be to calculated or measured variable objects.
+     * @param uuids An array of exactly N UUID's.  These are linked 1-to-1 with
+     * the variables by array position.
+     */
+    StaticVariableArray(Variable* (&variableList)[N], const char* (&uuids)[N])
+        : VariableArray(N, variableList, uuids) {
+        useTable();
+    }
+
+ private:
+    bool _table[N];
+
+    void useTable(void) {
+        _lastVarTable     = _table;
+        _lastVarTableSize = N;
+        mapSensors();
+    }
+};
+
 #endif  // SRC_VARIABLEARRAY_H_
@@ -10,6 +10,12 @@
 #include "VariableBase.h"
 #include "SensorBase.h"
 
+// Bits of _metadataInFlash
+#define VAR_NAME_IN_FLASH 0
+#define VAR_UNIT_IN_FLASH 1
+#define VAR_CODE_IN_FLASH 2
+#define VAR_UUID_IN_FLASH 3
+
 // ============================================================================
 //  The class and functions for interfacing with a specific variable.
 // ============================================================================
@@ -20,6 +26,7 @@ Variable::Variable(Sensor* parentSense, const uint8_t sensorVarNum,
                    uint8_t decimalResolution, const char* varName,
                    const char* varUnit, const char* varCode, const char* uuid)
     : _sensorVarNum(sensorVarNum) {
+    _metadataInFlash = 0;
     setVarUUID(uuid);
     setVarCode(varCode);
     setVarUnit(varUnit);
@@ -40,7 +47,8 @@ Variable::Variable(const uint8_t sensorVarNum, uint8_t decimalResolution,
                    const char* varName, const char* varUnit,
                    const char* varCode)
     : _sensorVarNum(sensorVarNum) {
-    _uuid = NULL;
+    _metadataInFlash = 0;
+    _uuid            = NULL;
     setVarCode(varCode);
     setVarUnit(varUnit);
     setVarName(varName);
@@ -64,6 +72,7 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
                    const char* varName, const char* varUnit,
                    const char* varCode, const char* uuid)
     : _sensorVarNum(0) {
+    _metadataInFlash = 0;
     setVarUUID(uuid);
     setVarCode(varCode);
     setVarUnit(varUnit);
@@ -84,7 +93,8 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
                    const char* varName, const char* varUnit,
                    const char* varCode)
     : _sensorVarNum(0) {
-    _uuid = NULL;
+    _metadataInFlash = 0;
+    _uuid            = NULL;
     setVarCode(varCode);
     setVarUnit(varUnit);
     setVarName(varName);
@@ -101,12 +111,53 @@ Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
     // MS_DBG(F("Calculated Variable object created"));
 }
 
+// The same constructors, with the variable name and unit stored in flash
+Variable::Variable(Sensor* parentSense, const uint8_t sensorVarNum,
+                   uint8_t decimalResolution, const __FlashStringHelper* varName,
+                   const __FlashStringHelper* varUnit, const char* varCode,
+                   const char* uuid)
+    : Variable(parentSense, sensorVarNum, decimalResolution,
+               reinterpret_cast<const char*>(varName),
+               reinterpret_cast<const char*>(varUnit), varCode, uuid) {
+    setVarName(varName);
+    setVarUnit(varUnit);
+}
+Variable::Variable(const uint8_t sensorVarNum, uint8_t decimalResolution,
+                   const __FlashStringHelper* varName,
+                   const __FlashStringHelper* varUnit, const char* varCode)
+    : Variable(sensorVarNum, decimalResolution,
+               reinterpret_cast<const char*>(varName),
+               reinterpret_cast<const char*>(varUnit), varCode) {
+    setVarName(varName);
+    setVarUnit(varUnit);
+}
+Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
+                   const __FlashStringHelper* varName,
+                   const __FlashStringHelper* varUnit, const char* varCode,
+                   const char* uuid)
+    : Variable(calcFxn, decimalResolution,
+               reinterpret_cast<const char*>(varName),
+               reinterpret_cast<const char*>(varUnit), varCode, uuid) {
+    setVarName(varName);
+    setVarUnit(varUnit);
+}
+Variable::Variable(float (*calcFxn)(), uint8_t decimalResolution,
+                   const __FlashStringHelper* varName,
+                   const __FlashStringHelper* varUnit, const char* varCode)
+    : Variable(calcFxn, decimalResolution,
+               reinterpret_cast<const char*>(varName),
+               reinterpret_cast<const char*>(varUnit), varCode) {
+    setVarName(varName);
+    setVarUnit(varUnit);
+}
+
 // constructor with no arguments
 Variable::Variable() : _sensorVarNum(0), _decimalResolution(0) {
-    _varName = NULL;
-    _varUnit = NULL;
-    _varCode = NULL;
-    _uuid    = NULL;
+    _varName         = NULL;
+    _varUnit         = NULL;
+    _varCode         = NULL;
+    _uuid            = NULL;
+    _metadataInFlash = 0;
 
     isCalculated = true;
     _calcFxn     = NULL;
@@ -250,42 +301,86 @@ void Variable::setResolution(uint8_t decimalResolution) {
     // places"));
 }
 
+// These get a metadata string or print it to a stream, reading it from flash
+// if that's where it's stored.
+String Variable::getMetadataString(const char* metadata, uint8_t flashBit) {
+    if (metadata == NULL) { return String(); }
+    if (bitRead(_metadataInFlash, flashBit)) {
+        return String(reinterpret_cast<const __FlashStringHelper*>(metadata));
+    }
+    return String(metadata);
+}
+size_t Variable::printMetadata(Stream* stream, const char* metadata,
+                               uint8_t flashBit) {
+    if (metadata == NULL) { return 0; }
+    if (bitRead(_metadataInFlash, flashBit)) {
+        return stream->print(
+            reinterpret_cast<const __FlashStringHelper*>(metadata));
+    }
+    return stream->print(metadata);
+}
+
 // This gets/sets the variable's name using
 // http://vocabulary.odm2.org/variablename/
 String Variable::getVarName(void) {
-    return _varName;
+    return getMetadataString(_varName, VAR_NAME_IN_FLASH);
 }
 void Variable::setVarName(const char* varName) {
     _varName = varName;
+    bitClear(_metadataInFlash, VAR_NAME_IN_FLASH);
     // MS_DBG(F("Variable name is"), _varName);
 }
+void Variable::setVarName(const __FlashStringHelper* varName) {
+    _varName = reinterpret_cast<const char*>(varName);
+    bitSet(_metadataInFlash, VAR_NAME_IN_FLASH);
+}
+size_t Variable::printVarName(Stream* stream) {
+    return printMetadata(stream, _varName, VAR_NAME_IN_FLASH);
+}
 
 // This gets/sets the variable's unit using http://vocabulary.odm2.org/units/
 String Variable::getVarUnit(void) {
-    return _varUnit;
+    return getMetadataString(_varUnit, VAR_UNIT_IN_FLASH);
 }
 void Variable::setVarUnit(const char* varUnit) {
     _varUnit = varUnit;
+    bitClear(_metadataInFlash, VAR_UNIT_IN_FLASH);
     // MS_DBG(F("Variable unit is"), _varUnit);
 }
+void Variable::setVarUnit(const __FlashStringHelper* varUnit) {
+    _varUnit = reinterpret_cast<const char*>(varUnit);
+    bitSet(_metadataInFlash, VAR_UNIT_IN_FLASH);
+}
+size_t Variable::printVarUnit(Stream* stream) {
+    return printMetadata(stream, _varUnit, VAR_UNIT_IN_FLASH);
+}
 
 // This returns a customized code for the variable
 String Variable::getVarCode(void) {
-    return _varCode;
+    return getMetadataString(_varCode, VAR_CODE_IN_FLASH);
 }
 // This sets the variable code to a new custom value
 void Variable::setVarCode(const char* varCode) {
     _varCode = varCode;
+    bitClear(_metadataInFlash, VAR_CODE_IN_FLASH);
     // MS_DBG(F("Variable code is"), _varCode);
 }
+void Variable::setVarCode(const __FlashStringHelper* varCode) {
+    _varCode = reinterpret_cast<const char*>(varCode);
+    bitSet(_metadataInFlash, VAR_CODE_IN_FLASH);
+}
+size_t Variable::printVarCode(Stream* stream) {
+    return printMetadata(stream, _varCode, VAR_CODE_IN_FLASH);
+}
 
 // This returns the variable UUID, if one has been assigned
 String Variable::getVarUUID(void) {
-    return _uuid;
+    return getMetadataString(_uuid, VAR_UUID_IN_FLASH);
 }
 // This sets the UUID
 void Variable::setVarUUID(const char* uuid) {
     _uuid = uuid;
+    bitClear(_metadataInFlash, VAR_UUID_IN_FLASH);
     // if (strlen(_uuid) == 0)
     // {
     //     MS_DBG(F("No UUID assigned"));
@@ -295,27 +390,46 @@ void Variable::setVarUUID(const char* uuid) {
     //     MS_DBG(F("Variable UUID is"), _uuid);
     // }
 }
+void Variable::setVarUUID(const __FlashStringHelper* uuid) {
+    _uuid = reinterpret_cast<const char*>(uuid);
+    bitSet(_metadataInFlash, VAR_UUID_IN_FLASH);
+}
+size_t Variable::printVarUUID(Stream* stream) {
+    return printMetadata(stream, _uuid, VAR_UUID_IN_FLASH);
+}
 // This checks that the UUID is properly formatted
 bool Variable::checkUUIDFormat(void) {
     // If no UUID, move on
-    if (strlen(_uuid) == 0) {
+    if (_uuid == NULL) { return true; }
+
+    // Work from a RAM copy of the UUID if it's stored in flash.  Copy one
+    // extra character so an over-length UUID still fails the length check.
+    char        uuidCopy[38];
+    const char* uuid = _uuid;
+    if (bitRead(_metadataInFlash, VAR_UUID_IN_FLASH)) {
+        strncpy_P(uuidCopy, _uuid, 37);
+        uuidCopy[37] = '\0';
+        uuid         = uuidCopy;
+    }
+
+    if (strlen(uuid) == 0) {
         // MS_DBG(F("No UUID assigned to"), getVarCode());
         return true;
     }
 
-    // MS_DBG(F("Variable UUID for"), getVarCode(), F("is"), _uuid);
+    // MS_DBG(F("Variable UUID for"), getVarCode(), F("is"), uuid);
     // Should be 36 characters long with dashes
-    if (strlen(_uuid) != 36) {
-        MS_DBG(F("UUID length for"), getVarCode(), '(', _uuid, ')',
-               F("is incorrect, should be 36 characters not"), strlen(_uuid));
+    if (strlen(uuid) != 36) {
+        MS_DBG(F("UUID length for"), getVarCode(), '(', uuid, ')',
+               F("is incorrect, should be 36 characters not"), strlen(uuid));
         return false;
     }
 
     // "12345678-abcd-1234-ef00-1234567890ab"
     const char* acceptableChars = "0123456789abcdefABCDEF-";
-    if (_uuid[8] != '-' || _uuid[13] != '-' || _uuid[18] != '-' ||
-        _uuid[23] != '-') {
-        MS_DBG(F("UUID format for"), getVarCode(), '(', _uuid, ')',
+    if (uuid[8] != '-' || uuid[13] != '-' || uuid[18] != '-' ||
+        uuid[23] != '-') {
+        MS_DBG(F("UUID format for"), getVarCode(), '(', uuid, ')',
                F("is incorrect, expecting dashes at positions 9, 14, 19, and "
                  "24."));
         return false;
@@ -323,14 +437,14 @@ bool Variable::checkUUIDFormat(void) {
     for (uint8_t i = 0; i < 36; i++) {
         bool isAcceptable = false;
         for (uint8_t j = 0; !isAcceptable && j < 23; j++) {
-            if (_uuid[i] == acceptableChars[j]) {
+            if (uuid[i] == acceptableChars[j]) {
                 isAcceptable = true;
                 j            = 23;  // Stop the inner loop
             }
         }
         if (!isAcceptable) {
-            MS_DBG(F("UUID for"), getVarCode(), '(', _uuid, ')',
-                   F("has a bad character"), _uuid[i], F("at"), i + 1);
+            MS_DBG(F("UUID for"), getVarCode(), '(', uuid, ')',
+                   F("has a bad character"), uuid[i], F("at"), i + 1);
             return false;
         }
     }
@@ -353,6 +467,14 @@ float Variable::getValue(bool updateValue) {
 }
 
 
+// This reads the variable without a full update of the parent sensor
+float Variable::getInstantValue(void) {
+    if (isCalculated) { return _calcFxn(); }
+    float value = parentSensor->getInstantValue(_sensorVarNum);
+    return value != -9999 ? value : _currentValue;
+}
+
+
 // This returns the current value of the variable as a string
 // with the correct number of significant figures
 String Variable::getValueString(bool updateValue) {
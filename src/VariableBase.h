@@ -98,6 +98,54 @@ class Variable {
      */
     Variable(const uint8_t sensorVarNum, uint8_t decimalResolution,
              const char* varName, const char* varUnit, const char* varCode);
+    /**
+     * @brief Construct a new Variable object for a measured variable with the
+     * variable name and unit stored in flash (PROGMEM) rather than RAM.
+     *
+     * @note This constructor is NOT inteneded to be used outside of this
+     * libraries.  It is intended to be used internally with sensors defined in
+     * this library.
+     *
+     * @param parentSense The Sensor object supplying values.
+     * @param sensorVarNum The position in the sensor's value array of this
+     * variable's value.
+     * @param decimalResolution The resolution (in decimal places) of the value.
+     * @param varName The name of the variable per the [ODM2 variable name
+     * controlled vocabulary](http://vocabulary.odm2.org/variablename/), wrapped
+     * in the F() macro.
+     * @param varUnit The unit of the variable per the [ODM2 unit controlled
+     * vocabulary](http://vocabulary.odm2.org/units/), wrapped in the F() macro.
+     * @param varCode A custom code for the variable.  This can be any short
+     * text helping to identify the variable in files.
+     * @param uuid A universally unique identifier for the variable.
+     */
+    Variable(Sensor* parentSense, const uint8_t sensorVarNum,
+             uint8_t decimalResolution, const __FlashStringHelper* varName,
+             const __FlashStringHelper* varUnit, const char* varCode,
+             const char* uuid);
+    /**
+     * @brief Construct a new Variable object for a measured variable with the
+     * variable name and unit stored in flash (PROGMEM) rather than RAM - but do
+     * not tie it to a specific sensor.
+     *
+     * @note This constructor is NOT inteneded to be used outside of this
+     * libraries.  It is intended to be used internally with sensors defined in
+     * this library.
+     *
+     * @param sensorVarNum The position in the sensor's value array of this
+     * variable's value.
+     * @param decimalResolution The resolution (in decimal places) of the value.
+     * @param varName The name of the variable per the [ODM2 variable name
+     * controlled vocabulary](http://vocabulary.odm2.org/variablename/), wrapped
+     * in the F() macro.
+     * @param varUnit The unit of the variable per the [ODM2 unit controlled
+     * vocabulary](http://vocabulary.odm2.org/units/), wrapped in the F() macro.
+     * @param varCode A custom code for the variable.  This can be any short
+     * text helping to identify the variable in files.
+     */
+    Variable(const uint8_t sensorVarNum, uint8_t decimalResolution,
+             const __FlashStringHelper* varName,
+             const __FlashStringHelper* varUnit, const char* varCode);
 
     /**
      * @brief Construct a new Variable object for a calculated variable - that
@@ -130,6 +178,42 @@ class Variable {
      */
     Variable(float (*calcFxn)(), uint8_t decimalResolution, const char* varName,
              const char* varUnit, const char* varCode);
+    /**
+     * @brief Construct a new Variable object for a calculated variable with the
+     * variable name and unit stored in flash (PROGMEM) rather than RAM.
+     *
+     * @param calcFxn Any function returning a float value
+     * @param decimalResolution The resolution (in decimal places) of the value.
+     * @param varName The name of the variable per the [ODM2 variable name
+     * controlled vocabulary](http://vocabulary.odm2.org/variablename/), wrapped
+     * in the F() macro.
+     * @param varUnit The unit of the variable per the [ODM2 unit controlled
+     * vocabulary](http://vocabulary.odm2.org/units/), wrapped in the F() macro.
+     * @param varCode A custom code for the variable.  This can be any short
+     * text helping to identify the variable in files.
+     * @param uuid A universally unique identifier for the variable.
+     */
+    Variable(float (*calcFxn)(), uint8_t decimalResolution,
+             const __FlashStringHelper* varName,
+             const __FlashStringHelper* varUnit, const char* varCode,
+             const char* uuid);
+    /**
+     * @brief Construct a new Variable object for a calculated variable with the
+     * variable name and unit stored in flash (PROGMEM) rather than RAM.
+     *
+     * @param calcFxn Any function returning a float value
+     * @param decimalResolution The resolution (in decimal places) of the value.
+     * @param varName The name of the variable per the [ODM2 variable name
+     * controlled vocabulary](http://vocabulary.odm2.org/variablename/), wrapped
+     * in the F() macro.
+     * @param varUnit The unit of the variable per the [ODM2 unit controlled
+     * vocabulary](http://vocabulary.odm2.org/units/), wrapped in the F() macro.
+     * @param varCode A custom code for the variable.  This can be any short
+     * text helping to identify the variable in files.
+     */
+    Variable(float (*calcFxn)(), uint8_t decimalResolution,
+             const __FlashStringHelper* varName,
+             const __FlashStringHelper* varUnit, const char* varCode);
     /**
      * @brief Construct a new Variable object
      */
@@ -286,6 +370,21 @@ class Variable {
      * controlled vocabulary.
      */
     void setVarName(const char* varName);
+    /**
+     * @brief Set the variable name from a string stored in flash.
+     *
+     * @param varName The name of the variable per the ODM2 variable name
+     * controlled vocabulary, wrapped in the F() macro.
+     */
+    void setVarName(const __FlashStringHelper* varName);
+    /**
+     * @brief Print the variable name directly to a stream, without creating a
+     * String.
+     *
+     * @param stream An Arduino stream instance
+     * @return **size_t** The number of characters printed
+     */
+    size_t printVarName(Stream* stream);
     /**
      * @brief Get the variable unit
      *
@@ -302,6 +401,21 @@ class Variable {
      * vocabulary.
      */
     void setVarUnit(const char* varUnit);
+    /**
+     * @brief Set the variable unit from a string stored in flash.
+     *
+     * @param varUnit The unit of the variable per the ODM2 unit controlled
+     * vocabulary, wrapped in the F() macro.
+     */
+    void setVarUnit(const __FlashStringHelper* varUnit);
+    /**
+     * @brief Print the variable unit directly to a stream, without creating a
+     * String.
+     *
+     * @param stream An Arduino stream instance
+     * @return **size_t** The number of characters printed
+     */
+    size_t printVarUnit(Stream* stream);
     /**
      * @brief Get the customized code for the variable
      *
@@ -315,19 +429,49 @@ class Variable {
      * text helping to identify the variable in files.
      */
     void setVarCode(const char* varCode);
+    /**
+     * @brief Set a customized code for the variable from a string stored in
+     * flash.
+     *
+     * @param varCode A custom code for the variable, wrapped in the F() macro.
+     */
+    void setVarCode(const __FlashStringHelper* varCode);
+    /**
+     * @brief Print the variable code directly to a stream, without creating a
+     * String.
+     *
+     * @param stream An Arduino stream instance
+     * @return **size_t** The number of characters printed
+     */
+    size_t printVarCode(Stream* stream);
     // This gets/sets the variable UUID, if one has been assigned
     /**
-     * @brief Get the customized code for the variable
+     * @brief Get the UUID for the variable
      *
-     * @return **String** The customized code for the variable
+     * @return **String** The UUID for the variable
      */
     String getVarUUID(void);
     /**
-     * @brief Set a customized code for the variable
+     * @brief Set the UUID for the variable
      *
      * @param uuid A universally unique identifier for the variable.
      */
     void setVarUUID(const char* uuid);
+    /**
+     * @brief Set the UUID for the variable from a string stored in flash.
+     *
+     * @param uuid A universally unique identifier for the variable, wrapped in
+     * the F() macro.
+     */
+    void setVarUUID(const __FlashStringHelper* uuid);
+    /**
+     * @brief Print the variable UUID directly to a stream, without creating a
+     * String.
+     *
+     * @param stream An Arduino stream instance
+     * @return **size_t** The number of characters printed
+     */
+    size_t printVarUUID(Stream* stream);
     /**
      * @brief Verify the the UUID is correctly formatted
      *
@@ -355,6 +499,16 @@ class Variable {
      * @return **String** The current value of the variable
      */
     String getValueString(bool updateValue = false);
+    /**
+     * @brief Read the variable right now, without updating the parent sensor.
+     *
+     * A sensor variable is read with Sensor::getInstantValue(); if the sensor
+     * can't be read that way, this gives the value from its last update.  A
+     * calculated variable gives the result of its calculation.
+     *
+     * @return **float** The value of the variable
+     */
+    float getInstantValue(void);
 
     /**
      * @brief Pointer to the parent sensor
@@ -381,6 +535,39 @@ class Variable {
     const char* _varUnit;
     const char* _varCode;
     const char* _uuid;
+
+    /**
+     * @brief Flags for which of the metadata strings are stored in flash
+     * (PROGMEM) rather than in RAM.
+     *
+     * - Bit 0
+     *   - 0 => The variable name is in RAM
+     *   - 1 => The variable name is in flash
+     * - Bit 1 - the same for the variable unit
+     * - Bit 2 - the same for the variable code
+     * - Bit 3 - the same for the UUID
+     */
+    uint8_t _metadataInFlash;
+
+    /**
+     * @brief Get a metadata string, reading it from flash if necessary.
+     *
+     * @param metadata The pointer to the metadata string
+     * @param flashBit The bit of #_metadataInFlash for this string
+     * @return **String** The metadata as a String
+     */
+    String getMetadataString(const char* metadata, uint8_t flashBit);
+    /**
+     * @brief Print a metadata string to a stream, reading it from flash if
+     * necessary.
+     *
+     * @param stream An Arduino stream instance
+     * @param metadata The pointer to the metadata string
+     * @param flashBit The bit of #_metadataInFlash for this string
+     * @return **size_t** The number of characters printed
+     */
+    size_t printMetadata(Stream* stream, const char* metadata,
+                         uint8_t flashBit);
 };
 
 #endif  // SRC_VARIABLEBASE_H_
@@ -0,0 +1,123 @@
+/**
+ * @file WakeAlarm.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the arithmetic used to choose the time the RTC alarm is set
+ * for before the logger goes to sleep.
+ *
+ * The logger sets the alarm for the exact start of its next logging interval
+ * when it can.  When it can't - the clock isn't sane, the interval is only a
+ * minute, or the interval is so close it might pass before the alarm is
+ * written - it wakes every minute and uses Logger::checkInterval() instead.
+ * A LoggerGroup sets the one alarm for the earliest time any of its loggers
+ * needs to wake.
+ *
+ * These functions are plain arithmetic with no hardware calls or Arduino
+ * dependencies, so they can be checked in a host program; see
+ * tools/wake_alarm_test.
+ */
+
+// Header Guards
+#ifndef SRC_WAKEALARM_H_
+#define SRC_WAKEALARM_H_
+
+#include <stdint.h>
+
+/**
+ * @brief The fewest seconds that must be left before the next interval for
+ * the alarm to be set for it.
+ *
+ * Writing the alarm takes a moment; if the interval passes first the alarm
+ * would not go off until the same time next month.
+ */
+#define WAKE_ALARM_MIN_LEAD_S 3
+
+/**
+ * @brief Calculate the first even interval of the logging rate that is
+ * strictly after the given epoch time.
+ *
+ * Both the input and the result are in the same timezone.
+ *
+ * @param currentEpoch The number of seconds since 1970 to start from
+ * @param intervalMinutes The logging interval in minutes; 0 is treated as 1
+ * @return **uint32_t** The number of seconds since 1970 of the next interval
+ */
+static inline uint32_t wakeAlarmNextInterval(uint32_t currentEpoch,
+                                             uint16_t intervalMinutes) {
+    uint32_t interval_s = ((uint32_t)intervalMinutes) * 60;
+    if (interval_s == 0) { interval_s = 60; }
+    return currentEpoch - (currentEpoch % interval_s) + interval_s;
+}
+
+/**
+ * @brief Choose the time to set the RTC alarm for, given the time to wake.
+ *
+ * @param now_logTZ The current time in the logger's timezone
+ * @param next_logTZ The time to wake in the logger's timezone, or 0 to wake
+ * every minute
+ * @param clockSane True if the current time is believable
+ * @param rtcOffsetHours The logger's timezone minus the RTC's timezone
+ * @return **uint32_t** The time to wake in the timezone of the RTC, or 0 if
+ * the logger should wake every minute instead.
+ */
+static inline uint32_t wakeAlarmEpochAt(uint32_t now_logTZ,
+                                        uint32_t next_logTZ, bool clockSane,
+                                        int8_t rtcOffsetHours) {
+    if (next_logTZ == 0 || !clockSane) { return 0; }
+    if (next_logTZ <= now_logTZ ||
+        next_logTZ - now_logTZ < WAKE_ALARM_MIN_LEAD_S) {
+        return 0;
+    }
+    // The alarm is set in the timezone of the RTC, not of the logger
+    return next_logTZ - ((uint32_t)rtcOffsetHours) * 3600;
+}
+
+/**
+ * @brief Choose the time to wake for a logging interval.
+ *
+ * @param now_logTZ The current time in the logger's timezone
+ * @param intervalMinutes The logging interval in minutes
+ * @return **uint32_t** The start of the next interval in the logger's
+ * timezone, or 0 if the interval is only a minute and the logger should wake
+ * every minute.
+ */
+static inline uint32_t wakeAlarmNextWake(uint32_t now_logTZ,
+                                         uint16_t intervalMinutes) {
+    if (intervalMinutes <= 1) { return 0; }
+    return wakeAlarmNextInterval(now_logTZ, intervalMinutes);
+}
+
+/**
+ * @brief Choose the earlier of two times to wake, for a group of loggers that
+ * share one RTC alarm.
+ *
+ * @param a The time one logger needs to wake, or 0 for every minute
+ * @param b The time another logger needs to wake, or 0 for every minute
+ * @return **uint32_t** The earlier time, or 0 if either logger needs to wake
+ * every minute.
+ */
+static inline uint32_t wakeAlarmEarliest(uint32_t a, uint32_t b) {
+    // 0 is less than any real time, so every minute wins
+    return a < b ? a : b;
+}
+
+/**
+ * @brief Choose the time to set the RTC alarm for.
+ *
+ * @param now_logTZ The current time in the logger's timezone
+ * @param intervalMinutes The logging interval in minutes
+ * @param clockSane True if the current time is believable
+ * @param rtcOffsetHours The logger's timezone minus the RTC's timezone
+ * @return **uint32_t** The start of the next interval in the timezone of the
+ * RTC, or 0 if the logger should wake every minute instead.
+ */
+static inline uint32_t wakeAlarmEpoch(uint32_t now_logTZ,
+                                      uint16_t intervalMinutes, bool clockSane,
+                                      int8_t rtcOffsetHours) {
+    return wakeAlarmEpochAt(now_logTZ,
+                            wakeAlarmNextWake(now_logTZ, intervalMinutes),
+                            clockSane, rtcOffsetHours);
+}
+
+#endif  // SRC_WAKEALARM_H_
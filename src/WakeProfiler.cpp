@@ -0,0 +1,148 @@
+/**
+ * @file WakeProfiler.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the WakeProfiler class.
+ */
+
+#include "WakeProfiler.h"
+
+#if defined MS_WAKE_PROFILER
+
+// Initialize the static counters
+uint32_t WakeProfiler::_cycleStart = 0;
+uint16_t WakeProfiler::_cycleCount = 0;
+uint32_t WakeProfiler::_phaseTotal[PROFILE_NUM_PHASES];
+uint32_t WakeProfiler::_phaseMax[PROFILE_NUM_PHASES];
+uint16_t WakeProfiler::_phaseCount[PROFILE_NUM_PHASES];
+uint32_t WakeProfiler::_sensorTotal[MS_PROFILER_MAX_SENSORS]
+                                   [PROFILE_NUM_SENSOR_STEPS];
+uint8_t WakeProfiler::_sensorsSeen = 0;
+
+
+void WakeProfiler::addPhaseTime(profilerPhase phase, uint32_t elapsed_us) {
+    _phaseTotal[phase] += elapsed_us;
+    if (elapsed_us > _phaseMax[phase]) { _phaseMax[phase] = elapsed_us; }
+    _phaseCount[phase]++;
+}
+
+
+void WakeProfiler::addSensorTime(uint8_t sensorNumber, profilerSensorStep step,
+                                 uint32_t elapsed_us) {
+    if (sensorNumber >= MS_PROFILER_MAX_SENSORS) { return; }
+    _sensorTotal[sensorNumber][step] += elapsed_us;
+    if (sensorNumber >= _sensorsSeen) { _sensorsSeen = sensorNumber + 1; }
+}
+
+
+void WakeProfiler::beginCycle(void) {
+    _cycleStart = micros();
+}
+
+
+void WakeProfiler::endCycle(void) {
+    addPhaseTime(PROFILE_CYCLE, micros() - _cycleStart);
+    _cycleCount++;
+}
+
+
+bool WakeProfiler::recordDue(void) {
+    return _cycleCount >= MS_PROFILER_RECORD_EVERY;
+}
+
+
+void WakeProfiler::printPhaseName(Stream* stream, uint8_t phase) {
+    switch (phase) {
+        case PROFILE_CYCLE: stream->print(F("Awake")); break;
+        case PROFILE_WAKE: stream->print(F("Wake")); break;
+        case PROFILE_SENSOR_POWER_UP: stream->print(F("SensorPowerUp")); break;
+        case PROFILE_SENSOR_UPDATE: stream->print(F("SensorUpdate")); break;
+        case PROFILE_SD_INIT: stream->print(F("SDInit")); break;
+        case PROFILE_SD_OPEN: stream->print(F("SDOpen")); break;
+        case PROFILE_SD_WRITE: stream->print(F("SDWrite")); break;
+        case PROFILE_SD_CLOSE: stream->print(F("SDClose")); break;
+        case PROFILE_MODEM_WAKE: stream->print(F("ModemWake")); break;
+        case PROFILE_MODEM_ATTACH: stream->print(F("ModemAttach")); break;
+        case PROFILE_PUBLISH_0:
+        case PROFILE_PUBLISH_1:
+        case PROFILE_PUBLISH_2:
+        case PROFILE_PUBLISH_3:
+            stream->print(F("Publish"));
+            stream->print(phase - PROFILE_PUBLISH_0);
+            break;
+        case PROFILE_CLOCK_SYNC: stream->print(F("ClockSync")); break;
+        case PROFILE_MODEM_METADATA: stream->print(F("ModemMetadata")); break;
+        case PROFILE_MODEM_DISCONNECT:
+            stream->print(F("ModemDisconnect"));
+            break;
+        case PROFILE_MODEM_SLEEP: stream->print(F("ModemSleep")); break;
+        case PROFILE_SLEEP: stream->print(F("Sleep")); break;
+        default: stream->print(F("Unknown")); break;
+    }
+}
+
+
+void WakeProfiler::printHeader(Stream* stream) {
+    stream->print(F("Date and Time,Cycles"));
+    for (uint8_t i = 0; i < PROFILE_NUM_PHASES; i++) {
+        stream->print(',');
+        printPhaseName(stream, i);
+        stream->print(F("Avg,"));
+        printPhaseName(stream, i);
+        stream->print(F("Max"));
+    }
+    for (uint8_t s = 0; s < MS_PROFILER_MAX_SENSORS; s++) {
+        stream->print(F(",Sensor"));
+        stream->print(s);
+        stream->print(F("WarmUp,Sensor"));
+        stream->print(s);
+        stream->print(F("Stabilize,Sensor"));
+        stream->print(s);
+        stream->print(F("Measure,Sensor"));
+        stream->print(s);
+        stream->print(F("Read"));
+    }
+    stream->println();
+}
+
+
+void WakeProfiler::printRecord(Stream* stream) {
+    stream->print(_cycleCount);
+    // The average is over the times the phase actually ran
+    for (uint8_t i = 0; i < PROFILE_NUM_PHASES; i++) {
+        stream->print(',');
+        stream->print(_phaseCount[i] > 0 ? _phaseTotal[i] / _phaseCount[i] : 0);
+        stream->print(',');
+        stream->print(_phaseMax[i]);
+    }
+    // The sensor averages are per wake cycle
+    for (uint8_t s = 0; s < MS_PROFILER_MAX_SENSORS; s++) {
+        for (uint8_t j = 0; j < PROFILE_NUM_SENSOR_STEPS; j++) {
+            stream->print(',');
+            if (s < _sensorsSeen && _cycleCount > 0) {
+                stream->print(_sensorTotal[s][j] / _cycleCount);
+            }
+        }
+    }
+    stream->println();
+    reset();
+}
+
+
+void WakeProfiler::reset(void) {
+    _cycleCount = 0;
+    for (uint8_t i = 0; i < PROFILE_NUM_PHASES; i++) {
+        _phaseTotal[i] = 0;
+        _phaseMax[i]   = 0;
+        _phaseCount[i] = 0;
+    }
+    for (uint8_t s = 0; s < MS_PROFILER_MAX_SENSORS; s++) {
+        for (uint8_t j = 0; j < PROFILE_NUM_SENSOR_STEPS; j++) {
+            _sensorTotal[s][j] = 0;
+        }
+    }
+    _sensorsSeen = 0;
+}
+
+#endif  // MS_WAKE_PROFILER
@@ -0,0 +1,219 @@
+/**
+ * @file WakeProfiler.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the WakeProfiler class and the MS_PROFILE_ macros used to
+ * time each phase of a logger's wake cycle.
+ *
+ * The profiler is only compiled in when the build flag MS_WAKE_PROFILER is
+ * defined:
+ * - ```-D MS_WAKE_PROFILER```
+ *
+ * Without that flag, every MS_PROFILE_ macro expands to nothing and none of
+ * the profiler code or counters are built into the program.
+ *
+ * With the flag defined, the time spent in each phase of logData() and
+ * logDataAndPublish() - and in each step of each sensor's update - is measured
+ * with micros() and added to a set of running counters.  Every
+ * #MS_PROFILER_RECORD_EVERY wake cycles, the averages and maximums are written
+ * as a single comma separated line to the file #MS_PROFILER_FILE_NAME on the
+ * SD card and the counters are reset.
+ *
+ * The counters are unsigned 32-bit microsecond totals, so each one will wrap
+ * after a little over 71 minutes.  Keep the number of cycles per record small
+ * enough that no single phase adds up to more than that.
+ */
+
+// Header Guards
+#ifndef SRC_WAKEPROFILER_H_
+#define SRC_WAKEPROFILER_H_
+
+// Debugging Statement
+// #define MS_WAKEPROFILER_DEBUG
+
+#ifdef MS_WAKEPROFILER_DEBUG
+#define MS_DEBUGGING_STD "WakeProfiler"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+
+#if defined MS_WAKE_PROFILER
+
+/**
+ * @brief The number of wake cycles to summarize in each record written to the
+ * SD card.
+ *
+ * This can be changed by setting the build flag MS_PROFILER_RECORD_EVERY when
+ * compiling.
+ */
+#ifndef MS_PROFILER_RECORD_EVERY
+#define MS_PROFILER_RECORD_EVERY 12
+#endif
+
+/**
+ * @brief The largest number of sensors the profiler will keep per-sensor
+ * counters for.  Any sensors beyond this are only included in the totals.
+ *
+ * This can be changed by setting the build flag MS_PROFILER_MAX_SENSORS when
+ * compiling.
+ */
+#ifndef MS_PROFILER_MAX_SENSORS
+#define MS_PROFILER_MAX_SENSORS 12
+#endif
+
+/**
+ * @brief The name of the file on the SD card the profile records are written
+ * to.
+ *
+ * This can be changed by setting the build flag MS_PROFILER_FILE_NAME when
+ * compiling.
+ */
+#ifndef MS_PROFILER_FILE_NAME
+#define MS_PROFILER_FILE_NAME "wakeprof.csv"
+#endif
+
+/**
+ * @brief The phases of a logger wake cycle that are timed.
+ */
+typedef enum {
+    PROFILE_CYCLE = 0,         ///< The whole time the processor was awake
+    PROFILE_WAKE,              ///< Restarting the processor after sleep
+    PROFILE_SENSOR_POWER_UP,   ///< Powering up all of the sensors
+    PROFILE_SENSOR_UPDATE,     ///< The complete update of all sensors
+    PROFILE_SD_INIT,           ///< Starting communication with the SD card
+    PROFILE_SD_OPEN,           ///< Opening (or creating) the data file,
+                               ///< including starting the SD card
+    PROFILE_SD_WRITE,          ///< Writing the data line
+    PROFILE_SD_CLOSE,          ///< Closing the data file
+    PROFILE_MODEM_WAKE,        ///< Waking the modem
+    PROFILE_MODEM_ATTACH,      ///< Connecting to the internet
+    PROFILE_PUBLISH_0,         ///< Publishing to the first data publisher
+    PROFILE_PUBLISH_1,         ///< Publishing to the second data publisher
+    PROFILE_PUBLISH_2,         ///< Publishing to the third data publisher
+    PROFILE_PUBLISH_3,         ///< Publishing to the fourth data publisher
+    PROFILE_CLOCK_SYNC,        ///< Synchronizing the clock with NIST
+    PROFILE_MODEM_METADATA,    ///< Updating the modem metadata
+    PROFILE_MODEM_DISCONNECT,  ///< Disconnecting from the internet
+    PROFILE_MODEM_SLEEP,       ///< Putting the modem to sleep and powering down
+    PROFILE_SLEEP,             ///< Getting the processor ready to sleep
+    PROFILE_NUM_PHASES         ///< The number of phases
+} profilerPhase;
+
+/**
+ * @brief The steps of a single sensor's update that are timed.
+ */
+typedef enum {
+    PROFILE_SENSOR_WARM_UP = 0,  ///< From power up until the sensor is woken
+    PROFILE_SENSOR_STABILIZE,    ///< From wake (or the last result) until a
+                                 ///< measurement is started
+    PROFILE_SENSOR_MEASURE,      ///< From the start of a measurement until it
+                                 ///< is complete
+    PROFILE_SENSOR_READ,         ///< Getting the result from the sensor
+    PROFILE_NUM_SENSOR_STEPS     ///< The number of sensor steps
+} profilerSensorStep;
+
+/**
+ * @brief Start a timer with the given name for a profiled phase.
+ *
+ * This declares a local variable, so the matching MS_PROFILE_STOP must be in
+ * the same scope.
+ */
+#define MS_PROFILE_START(timerName) uint32_t timerName = micros()
+/**
+ * @brief Stop the timer with the given name and add the elapsed time to a
+ * phase.
+ */
+#define MS_PROFILE_STOP(timerName, phase) \
+    WakeProfiler::addPhaseTime(phase, micros() - timerName)
+/**
+ * @brief Run a statement only when the profiler is compiled in.
+ */
+#define MS_PROFILE(statement) statement
+
+/**
+ * @brief The WakeProfiler class keeps running totals of how long the logger
+ * spends in each part of its wake cycle.
+ *
+ * All of the members are static; there is only ever one set of counters.
+ *
+ * @ingroup base_classes
+ */
+class WakeProfiler {
+ public:
+    /**
+     * @brief Add time to a phase of the wake cycle.
+     *
+     * @param phase The phase to add the time to
+     * @param elapsed_us The time spent in the phase in microseconds
+     */
+    static void addPhaseTime(profilerPhase phase, uint32_t elapsed_us);
+    /**
+     * @brief Add time to one step of a sensor's update.
+     *
+     * @param sensorNumber The position of the sensor in the variable array's
+     * list of sensors
+     * @param step The step of the update to add the time to
+     * @param elapsed_us The time spent in the step in microseconds
+     */
+    static void addSensorTime(uint8_t sensorNumber, profilerSensorStep step,
+                              uint32_t elapsed_us);
+
+    /**
+     * @brief Mark the processor waking up; the beginning of a wake cycle.
+     */
+    static void beginCycle(void);
+    /**
+     * @brief Mark the processor going back to sleep; the end of a wake cycle.
+     */
+    static void endCycle(void);
+
+    /**
+     * @brief Check if enough cycles have been profiled to write a record.
+     *
+     * @return **bool** True if a record should be written
+     */
+    static bool recordDue(void);
+    /**
+     * @brief Print the column headers for the profile records.
+     *
+     * @param stream An Arduino stream instance
+     */
+    static void printHeader(Stream* stream);
+    /**
+     * @brief Print a single line with the average and maximum time for each
+     * phase and the average time for each sensor step, then reset all of the
+     * counters.
+     *
+     * All times are in microseconds.
+     *
+     * @param stream An Arduino stream instance
+     */
+    static void printRecord(Stream* stream);
+    /**
+     * @brief Reset all of the counters.
+     */
+    static void reset(void);
+
+ private:
+    static void printPhaseName(Stream* stream, uint8_t phase);
+
+    static uint32_t _cycleStart;
+    static uint16_t _cycleCount;
+    static uint32_t _phaseTotal[PROFILE_NUM_PHASES];
+    static uint32_t _phaseMax[PROFILE_NUM_PHASES];
+    static uint16_t _phaseCount[PROFILE_NUM_PHASES];
+    static uint32_t _sensorTotal[MS_PROFILER_MAX_SENSORS]
+                                [PROFILE_NUM_SENSOR_STEPS];
+    static uint8_t  _sensorsSeen;
+};
+
+#else
+#define MS_PROFILE_START(timerName)
+#define MS_PROFILE_STOP(timerName, phase)
+#define MS_PROFILE(statement)
+#endif  // MS_WAKE_PROFILER
+
+#endif  // SRC_WAKEPROFILER_H_
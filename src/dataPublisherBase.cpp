@@ -20,28 +20,31 @@ const char* dataPublisher::hostHeader = "\r\nHost: ";
 
 // Constructors
 dataPublisher::dataPublisher() {
-    _baseLogger = NULL;
-    _inClient   = NULL;
-    _sendEveryX = 1;
-    _sendOffset = 0;
+    _baseLogger     = NULL;
+    _inClient       = NULL;
+    _sendEveryX     = 1;
+    _sendOffset     = 0;
+    _lastSentRecord = 0;
     // MS_DBG(F("dataPublisher object created"));
 }
 dataPublisher::dataPublisher(Logger& baseLogger, uint8_t sendEveryX,
                              uint8_t sendOffset) {
     _baseLogger = &baseLogger;
     _baseLogger->registerDataPublisher(this);  // register self with logger
-    _sendEveryX = sendEveryX;
-    _sendOffset = sendOffset;
-    _inClient   = NULL;
+    _sendEveryX     = sendEveryX;
+    _sendOffset     = sendOffset;
+    _inClient       = NULL;
+    _lastSentRecord = 0;
     // MS_DBG(F("dataPublisher object created"));
 }
 dataPublisher::dataPublisher(Logger& baseLogger, Client* inClient,
                              uint8_t sendEveryX, uint8_t sendOffset) {
     _baseLogger = &baseLogger;
     _baseLogger->registerDataPublisher(this);  // register self with logger
-    _sendEveryX = sendEveryX;
-    _sendOffset = sendOffset;
-    _inClient   = inClient;
+    _sendEveryX     = sendEveryX;
+    _sendOffset     = sendOffset;
+    _inClient       = inClient;
+    _lastSentRecord = 0;
     // MS_DBG(F("dataPublisher object created"));
 }
 // Destructor
@@ -62,10 +65,41 @@ void dataPublisher::attachToLogger(Logger& baseLogger) {
 
 
 // Sets the parameters for frequency of sending and any offset, if needed
-// NOTE:  These parameters are not currently used!!
 void dataPublisher::setSendFrequency(uint8_t sendEveryX, uint8_t sendOffset) {
     _sendEveryX = sendEveryX;
     _sendOffset = sendOffset;
+    checkSendFrequency();
+}
+
+
+// Warns if the logger can't keep every record between sends
+bool dataPublisher::checkSendFrequency(void) {
+    if (_sendEveryX <= 1 || _baseLogger == NULL ||
+        _baseLogger->_internalArray == NULL) {
+        return true;
+    }
+    uint8_t capacity = _baseLogger->getCacheCapacity();
+    if (_sendEveryX <= capacity) { return true; }
+    PRINTOUT(F("WARNING! A publisher sends every"), _sendEveryX,
+             F("intervals but the logger only keeps"), capacity,
+             F("records; the oldest"), _sendEveryX - capacity,
+             F("of each send will be lost."));
+    PRINTOUT(F("Set MS_PUBLISH_CACHE_RECORDS to at least"), _sendEveryX,
+             F("and MS_PUBLISH_CACHE_VALUES to at least"),
+             _sendEveryX * _baseLogger->getArrayVarCount());
+    return false;
+}
+
+
+// Checks if the marked time falls on one of this publisher's send intervals
+bool dataPublisher::isSendDue(void) {
+    if (_sendEveryX <= 1 || _baseLogger == NULL ||
+        _baseLogger->getLoggingInterval() == 0) {
+        return true;
+    }
+    uint32_t interval = Logger::markedEpochTime /
+        (60UL * _baseLogger->getLoggingInterval());
+    return interval % _sendEveryX == _sendOffset % _sendEveryX;
 }
 
 
@@ -76,6 +110,7 @@ void dataPublisher::begin(Logger& baseLogger, Client* inClient) {
 }
 void dataPublisher::begin(Logger& baseLogger) {
     attachToLogger(baseLogger);
+    checkSendFrequency();
 }
 
 
@@ -110,6 +145,17 @@ void dataPublisher::printTxBuffer(Stream* stream, bool addNewLine) {
 }
 
 
+// Adds text to the tx buffer, or only counts it when there is no stream
+void dataPublisher::appendTxBuffer(Stream* stream, const char* text,
+                                   uint32_t& size) {
+    size_t textLength = strlen(text);
+    size += textLength;
+    if (stream == NULL) { return; }
+    if (bufferFree() <= static_cast<int>(textLength)) { printTxBuffer(stream); }
+    strcat(txBuffer, text);
+}
+
+
 // This sends data on the "default" client of the modem
 int16_t dataPublisher::publishData() {
     if (_inClient == NULL) {
@@ -119,6 +165,41 @@ int16_t dataPublisher::publishData() {
         return publishData(_inClient);
     }
 }
+// This sends each record kept since the last send, one at a time
+int16_t dataPublisher::publishCachedData(void) {
+    // If the logger can't keep records, all that can be sent is the live data
+    if (_baseLogger->getNewestCachedRecord() == 0) { return publishData(); }
+
+    int16_t  retVal = 0;
+    uint32_t first  = publishCacheFirstToSend(
+        _baseLogger->getOldestCachedRecord(), _lastSentRecord);
+    for (uint32_t n = first; n <= _baseLogger->getNewestCachedRecord(); n++) {
+        if (!_baseLogger->replayCachedRecord(n)) { continue; }
+        retVal = publishData();
+        // Leave a record that wasn't taken, and the ones after it, for the
+        // next send
+        if (!wasPublished(retVal)) { break; }
+        _lastSentRecord = n;
+        // Stop if this publisher has used up its time
+        if (!TaskWatch::yield()) { break; }
+    }
+    _baseLogger->endReplay();
+    return retVal;
+}
+
+
+// Starts sending again from the oldest record kept
+void dataPublisher::resetSentRecords(void) {
+    _lastSentRecord = 0;
+}
+
+
+// Any 2xx http response code means the data was taken
+bool dataPublisher::wasPublished(int16_t result) {
+    return result >= 200 && result < 300;
+}
+
+
 // Duplicates for backwards compatibility
 int16_t dataPublisher::sendData(Client* outClient) {
     return publishData(outClient);
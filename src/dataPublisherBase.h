@@ -86,11 +86,10 @@ class dataPublisher {
      * logger.
      *
      * @param baseLogger The logger supplying the data to be published
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -107,11 +106,10 @@ class dataPublisher {
      * @param inClient An Arduino client instance to use to print data to.
      * Allows the use of any type of client and multiple clients tied to a
      * single TinyGSM modem instance
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -148,15 +146,35 @@ class dataPublisher {
      * @brief Set the parameters for frequency of sending and any offset, if
      * needed.
      *
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
-     * @note These parameters are not currently used!
+     * @note Only as many records as the logger can keep are sent at once.
+     * The logger keeps #MS_PUBLISH_CACHE_VALUES divided by its number of
+     * variables, up to #MS_PUBLISH_CACHE_RECORDS; a larger sendEveryX loses
+     * the oldest records of each send.  A warning is printed when that
+     * happens; see PublishCache.h for how to size the cache.
      */
     void setSendFrequency(uint8_t sendEveryX, uint8_t sendOffset);
+    /**
+     * @brief Check that the logger can keep every record between sends.
+     *
+     * This is run by setSendFrequency(), begin(), and Logger::begin(), once
+     * the logger's variables are known.  It prints a warning if sendEveryX is
+     * more than the records the logger's cache holds.
+     *
+     * @return **bool** True if every record can be kept.
+     */
+    bool checkSendFrequency(void);
+    /**
+     * @brief Check if this is one of the logging intervals the publisher sends
+     * on, based on the marked time.
+     *
+     * @return **bool** True if the publisher should send now.
+     */
+    bool isSendDue(void);
 
     /**
      * @brief Begin the publisher - linking it to the client and logger.
@@ -234,6 +252,30 @@ class dataPublisher {
      * response code or a result code from PubSubClient.
      */
     virtual int16_t publishData();
+    /**
+     * @brief Send every record the logger has kept since this publisher last
+     * sent.
+     *
+     * By default, each record is sent with publishData() in turn, with the
+     * logger's marked time and values swapped for those of the record.  The
+     * first record that isn't accepted stops the sending; it and every record
+     * after it are sent again next time.  Publishers whose endpoints accept
+     * several records in one request can override this to send them all
+     * together.
+     *
+     * This depends on an internet connection already having been made.
+     *
+     * @return **int16_t** The result of sending the last record sent.  May be
+     * an http response code or a result code from PubSubClient.
+     */
+    virtual int16_t publishCachedData(void);
+    /**
+     * @brief Forget which of the logger's kept records have been sent, so
+     * sending starts again from the oldest one kept.
+     *
+     * The logger calls this when it starts its records over.
+     */
+    virtual void resetSentRecords(void);
 
     /**
      * @brief Retained for backwards compatibility.
@@ -301,17 +343,42 @@ class dataPublisher {
      * the print
      */
     static void printTxBuffer(Stream* stream, bool addNewLine = false);
+    /**
+     * @brief Add text to the TX buffer, writing the buffer out first if the
+     * text doesn't fit, and count its characters.
+     *
+     * This lets the same code work out the content length of a request body
+     * and then stream it.
+     *
+     * @param stream A pointer to an Arduino Stream instance to use to print
+     * data; NULL to only count the characters.
+     * @param text The text to add
+     * @param size The running count of characters
+     */
+    static void appendTxBuffer(Stream* stream, const char* text,
+                               uint32_t& size);
 
     /**
-     * @brief Unimplemented; intended for future use to enable caching and bulk
-     * publishing.
+     * @brief The number of logging intervals between sends.
      */
     uint8_t _sendEveryX;
     /**
-     * @brief Unimplemented; intended for future use to enable publishing data
-     * at a time slightly delayed from when it is collected.
+     * @brief Which interval in each group of #_sendEveryX to send on.
      */
     uint8_t _sendOffset;
+    /**
+     * @brief The number of the last of the logger's cached records this
+     * publisher sent.
+     */
+    uint32_t _lastSentRecord;
+    /**
+     * @brief Check if the result of publishData() means the endpoint took the
+     * data.
+     *
+     * @param result The result returned by publishData()
+     * @return **bool** True for any 2xx http response code.
+     */
+    virtual bool wasPublished(int16_t result);
 
     // Basic chunks of HTTP
     /**
@@ -25,6 +25,8 @@ DigiXBee3GBypass::DigiXBee3GBypass(Stream* modemStream, int8_t powerPin,
       gsmModem(*modemStream),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(XBEE_3G_ACTIVE_CURRENT_MA, XBEE_3G_IDLE_CURRENT_MA,
+                XBEE_3G_SLEEP_CURRENT_MA);
     _apn = apn;
 }
 
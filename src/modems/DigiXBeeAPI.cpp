@@ -0,0 +1,574 @@
+/**
+ * @file DigiXBeeAPI.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the DigiXBeeAPI and DigiXBeeAPIClient classes.
+ */
+
+// Included Dependencies
+#include "DigiXBeeAPI.h"
+
+// Frame delimiters and escaping
+#define XBEE_API_START_DELIMITER 0x7E
+#define XBEE_API_ESCAPE 0x7D
+#define XBEE_API_XON 0x11
+#define XBEE_API_XOFF 0x13
+
+// Frame types
+#define XBEE_API_AT_COMMAND 0x08
+#define XBEE_API_TX_IPV4 0x20
+#define XBEE_API_AT_RESPONSE 0x88
+#define XBEE_API_TX_STATUS 0x89
+#define XBEE_API_MODEM_STATUS 0x8A
+#define XBEE_API_RX_IPV4 0xB0
+
+// The frame type, frame ID, address, ports, protocol, and options before TX
+// socket data
+#define XBEE_API_TX_IPV4_HEADER 12
+// The frame type, address, ports, protocol, and status before RX socket data
+#define XBEE_API_RX_IPV4_HEADER 11
+// The frame type, frame ID, command, and status before an AT response value
+#define XBEE_API_AT_RESPONSE_HEADER 5
+
+#define XBEE_API_PROTOCOL_TCP 0x01
+#define XBEE_API_CLOSE_SOCKET 0x02
+
+#define XBEE_API_STATUS_OK 0x00
+#define XBEE_API_STATUS_WAITING 0xFF
+
+// Where the reader is in an incoming frame
+#define XBEE_API_RX_IDLE 0
+#define XBEE_API_RX_LENGTH_HI 1
+#define XBEE_API_RX_LENGTH_LO 2
+#define XBEE_API_RX_DATA 3
+#define XBEE_API_RX_CHECKSUM 4
+
+
+// Constructor
+DigiXBeeAPI::DigiXBeeAPI(Stream* modemStream, uint8_t apiMode) {
+    _stream      = modemStream;
+    _apiMode     = apiMode;
+    _nextFrameId = 1;
+    _nextSlot    = 0;
+    for (uint8_t i = 0; i < MS_XBEE_API_MAX_PENDING; i++) {
+        _pending[i].frameId = 0;
+    }
+    _txFrameId   = 0;
+    _txStatus    = XBEE_API_STATUS_OK;
+    _socketHead  = 0;
+    _socketCount = 0;
+    _rxState     = XBEE_API_RX_IDLE;
+    _rxEscaped   = false;
+    _rxLength    = 0;
+    _rxIndex     = 0;
+    _rxSum       = 0;
+}
+// Destructor
+DigiXBeeAPI::~DigiXBeeAPI() {}
+
+
+bool DigiXBeeAPI::enableAPIMode(void) {
+    // Only probe once; in transparent mode the frame goes out as data
+    uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+    uint8_t length = 0;
+    if (waitATResponse(sendATCommand("AP"), data, &length)) {
+        if (toNumber(data, length) == _apiMode) { return true; }
+        MS_DBG(F("Changing the XBee to API mode"), _apiMode);
+        return setParameter("AP", _apiMode) &&
+            waitATResponse(sendATCommand("WR"));
+    }
+
+    // This is the only time the guard times are needed; the mode is saved
+    MS_DBG(F("XBee isn't answering API frames; switching it to API mode"),
+           _apiMode, F("in command mode..."));
+    delay(XBEE_API_GUARD_TIME_MS);
+    _stream->print(F("+++"));
+    if (!waitForOK(XBEE_API_GUARD_TIME_MS + XBEE_API_RESPONSE_TIMEOUT_MS)) {
+        MS_DBG(F("... XBee didn't enter command mode!"));
+        return false;
+    }
+    char command[4] = {'A', 'P', static_cast<char>('0' + _apiMode), '\0'};
+    bool success    = sendCommandModeAT(command);
+    success &= sendCommandModeAT("WR");
+    // Leaving command mode applies the change
+    success &= sendCommandModeAT("CN");
+    return success && isResponding(XBEE_API_RESPONSE_TIMEOUT_MS);
+}
+
+
+bool DigiXBeeAPI::isResponding(uint32_t timeout_ms) {
+    uint32_t start = millis();
+    do {
+        if (waitATResponse(sendATCommand("AP"))) { return true; }
+    } while (millis() - start < timeout_ms && TaskWatch::yield());
+    return false;
+}
+
+
+uint8_t DigiXBeeAPI::sendATBytes(const char* command, const uint8_t* parameter,
+                                 uint8_t length) {
+    PendingCommand* slot = &_pending[_nextSlot];
+    if (slot->frameId != 0) {
+        // Every slot is in use; make room by finishing the oldest command
+        MS_DBG(F("Too many AT commands waiting; dropping the response to"),
+               slot->frameId);
+        waitATResponse(slot->frameId);
+    }
+    _nextSlot = (_nextSlot + 1) % MS_XBEE_API_MAX_PENDING;
+
+    slot->frameId     = nextFrameId();
+    slot->status      = XBEE_API_STATUS_WAITING;
+    slot->length      = 0;
+    uint8_t header[4] = {XBEE_API_AT_COMMAND, slot->frameId,
+                         static_cast<uint8_t>(command[0]),
+                         static_cast<uint8_t>(command[1])};
+    writeFrame(header, sizeof(header), parameter, length);
+    return slot->frameId;
+}
+
+
+uint8_t DigiXBeeAPI::sendATCommand(const char* command) {
+    return sendATBytes(command, NULL, 0);
+}
+
+
+uint8_t DigiXBeeAPI::sendATCommand(const char* command, uint32_t value) {
+    uint8_t bytes[4];
+    uint8_t length = 0;
+    for (int8_t shift = 24; shift >= 0; shift -= 8) {
+        uint8_t b = value >> shift;
+        if (length > 0 || b != 0 || shift == 0) { bytes[length++] = b; }
+    }
+    return sendATBytes(command, bytes, length);
+}
+
+
+uint8_t DigiXBeeAPI::sendATString(const char* command, const char* text) {
+    return sendATBytes(command, reinterpret_cast<const uint8_t*>(text),
+                       strlen(text));
+}
+
+
+bool DigiXBeeAPI::waitATResponse(uint8_t frameId, uint8_t* data,
+                                 uint8_t* length, uint32_t timeout_ms) {
+    PendingCommand* slot = NULL;
+    for (uint8_t i = 0; i < MS_XBEE_API_MAX_PENDING; i++) {
+        if (_pending[i].frameId == frameId) { slot = &_pending[i]; }
+    }
+    if (frameId == 0 || slot == NULL) { return false; }
+
+    uint32_t start = millis();
+    while (slot->status == XBEE_API_STATUS_WAITING &&
+           millis() - start < timeout_ms) {
+        poll();
+    }
+
+    bool success = slot->status == XBEE_API_STATUS_OK;
+    if (slot->status == XBEE_API_STATUS_WAITING) {
+        MS_DBG(F("No response from the XBee to frame"), frameId);
+    } else if (!success) {
+        MS_DBG(F("XBee returned status"), slot->status, F("for frame"),
+               frameId);
+    }
+    if (data != NULL) { memcpy(data, slot->data, slot->length); }
+    if (length != NULL) { *length = slot->length; }
+    slot->frameId = 0;
+    return success;
+}
+
+
+bool DigiXBeeAPI::setParameter(const char* command, uint32_t value) {
+    return waitATResponse(sendATCommand(command, value));
+}
+
+
+bool DigiXBeeAPI::getParameter(const char* command, uint32_t& value) {
+    uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+    uint8_t length  = 0;
+    bool    success = waitATResponse(sendATCommand(command), data, &length);
+    if (success) { value = toNumber(data, length); }
+    return success;
+}
+
+
+bool DigiXBeeAPI::setParameters(const char* const commands[],
+                                const uint32_t values[], uint8_t count) {
+    bool    success = true;
+    uint8_t frameIds[MS_XBEE_API_MAX_PENDING];
+    uint8_t sent = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        frameIds[sent++] = sendATCommand(commands[i], values[i]);
+        if (sent == MS_XBEE_API_MAX_PENDING || i == count - 1) {
+            for (uint8_t j = 0; j < sent; j++) {
+                success &= waitATResponse(frameIds[j]);
+            }
+            sent = 0;
+        }
+    }
+    return success;
+}
+
+
+uint32_t DigiXBeeAPI::toNumber(const uint8_t* data, uint8_t length) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < length; i++) { value = (value << 8) | data[i]; }
+    return value;
+}
+
+
+bool DigiXBeeAPI::sendSocketData(const uint8_t* address, uint16_t port,
+                                 const uint8_t* data, uint16_t length,
+                                 bool closeSocket) {
+    // A source port of 0 lets the XBee pick one
+    uint8_t header[XBEE_API_TX_IPV4_HEADER] = {
+        XBEE_API_TX_IPV4,
+        nextFrameId(),
+        address[0],
+        address[1],
+        address[2],
+        address[3],
+        static_cast<uint8_t>(port >> 8),
+        static_cast<uint8_t>(port & 0xFF),
+        0,
+        0,
+        XBEE_API_PROTOCOL_TCP,
+        static_cast<uint8_t>(closeSocket ? XBEE_API_CLOSE_SOCKET : 0)};
+    _txFrameId = header[1];
+    _txStatus  = XBEE_API_STATUS_WAITING;
+    writeFrame(header, sizeof(header), data, length);
+
+    uint32_t start = millis();
+    while (_txStatus == XBEE_API_STATUS_WAITING &&
+           millis() - start < XBEE_API_SEND_TIMEOUT_MS && TaskWatch::yield()) {
+        poll();
+    }
+    if (_txStatus != XBEE_API_STATUS_OK) {
+        MS_DBG(F("XBee couldn't send socket data; TX status"),
+               String(_txStatus, HEX));
+    }
+    return _txStatus == XBEE_API_STATUS_OK;
+}
+
+
+uint16_t DigiXBeeAPI::socketAvailable(void) {
+    poll();
+    return _socketCount;
+}
+
+
+int DigiXBeeAPI::socketRead(bool remove) {
+    if (_socketCount == 0) { return -1; }
+    uint8_t c = _socketBuffer[_socketHead];
+    if (remove) {
+        _socketHead = (_socketHead + 1) % MS_XBEE_API_RX_BUFFER;
+        _socketCount--;
+    }
+    return c;
+}
+
+
+void DigiXBeeAPI::socketClear(void) {
+    _socketHead  = 0;
+    _socketCount = 0;
+}
+
+
+void DigiXBeeAPI::poll(void) {
+    while (_stream->available()) { readByte(_stream->read()); }
+}
+
+
+void DigiXBeeAPI::writeFrame(const uint8_t* header, uint8_t headerLength,
+                             const uint8_t* payload, uint16_t payloadLength) {
+    uint16_t frameLength = headerLength + payloadLength;
+    uint8_t  sum         = 0;
+    _stream->write(static_cast<uint8_t>(XBEE_API_START_DELIMITER));
+    writeEscaped(frameLength >> 8);
+    writeEscaped(frameLength & 0xFF);
+    for (uint8_t i = 0; i < headerLength; i++) {
+        writeEscaped(header[i]);
+        sum += header[i];
+    }
+    for (uint16_t i = 0; i < payloadLength; i++) {
+        writeEscaped(payload[i]);
+        sum += payload[i];
+        // Keep up with anything coming back while a long frame goes out
+        if ((i & 0x1F) == 0x1F) { poll(); }
+    }
+    writeEscaped(0xFF - sum);
+    poll();
+}
+
+
+void DigiXBeeAPI::writeEscaped(uint8_t c) {
+    if (_apiMode == 2 &&
+        (c == XBEE_API_START_DELIMITER || c == XBEE_API_ESCAPE ||
+         c == XBEE_API_XON || c == XBEE_API_XOFF)) {
+        _stream->write(static_cast<uint8_t>(XBEE_API_ESCAPE));
+        _stream->write(static_cast<uint8_t>(c ^ 0x20));
+    } else {
+        _stream->write(c);
+    }
+}
+
+
+void DigiXBeeAPI::readByte(uint8_t c) {
+    // In API mode 1 a start delimiter can also be a byte inside a frame
+    if (c == XBEE_API_START_DELIMITER &&
+        (_apiMode == 2 || _rxState == XBEE_API_RX_IDLE)) {
+        if (_rxState != XBEE_API_RX_IDLE) {
+            MS_DBG(F("Dropped a partial frame from the XBee"));
+        }
+        _rxState   = XBEE_API_RX_LENGTH_HI;
+        _rxEscaped = false;
+        return;
+    }
+    if (_rxState == XBEE_API_RX_IDLE) { return; }
+    if (_apiMode == 2) {
+        if (c == XBEE_API_ESCAPE) {
+            _rxEscaped = true;
+            return;
+        }
+        if (_rxEscaped) {
+            c ^= 0x20;
+            _rxEscaped = false;
+        }
+    }
+
+    switch (_rxState) {
+        case XBEE_API_RX_LENGTH_HI:
+            _rxLength = static_cast<uint16_t>(c) << 8;
+            _rxState  = XBEE_API_RX_LENGTH_LO;
+            break;
+        case XBEE_API_RX_LENGTH_LO:
+            _rxLength |= c;
+            _rxIndex = 0;
+            _rxSum   = 0;
+            _rxState = _rxLength > 0 ? XBEE_API_RX_DATA : XBEE_API_RX_IDLE;
+            break;
+        case XBEE_API_RX_DATA:
+            _rxSum += c;
+            if (_rxIndex < sizeof(_rxFrame)) { _rxFrame[_rxIndex] = c; }
+            // Socket data goes straight into the socket buffer, so frames of
+            // any length can be read.  The checksum comes too late to take
+            // the bytes back out, but the serial link rarely garbles them.
+            // Bytes that don't fit are dropped, as a full serial buffer would.
+            if (_rxFrame[0] == XBEE_API_RX_IPV4 &&
+                _rxIndex >= XBEE_API_RX_IPV4_HEADER &&
+                _socketCount < MS_XBEE_API_RX_BUFFER) {
+                _socketBuffer[(_socketHead + _socketCount) %
+                              MS_XBEE_API_RX_BUFFER] = c;
+                _socketCount++;
+            }
+            if (++_rxIndex == _rxLength) { _rxState = XBEE_API_RX_CHECKSUM; }
+            break;
+        case XBEE_API_RX_CHECKSUM:
+            if (static_cast<uint8_t>(_rxSum + c) == 0xFF) {
+                handleFrame();
+            } else {
+                MS_DBG(F("Bad checksum on a frame from the XBee"));
+            }
+            _rxState = XBEE_API_RX_IDLE;
+            break;
+    }
+}
+
+
+void DigiXBeeAPI::handleFrame(void) {
+    switch (_rxFrame[0]) {
+        case XBEE_API_AT_RESPONSE: {
+            if (_rxLength < XBEE_API_AT_RESPONSE_HEADER) { break; }
+            uint16_t length = _rxLength - XBEE_API_AT_RESPONSE_HEADER;
+            if (length > MS_XBEE_API_RESPONSE_SIZE) {
+                length = MS_XBEE_API_RESPONSE_SIZE;
+            }
+            for (uint8_t i = 0; i < MS_XBEE_API_MAX_PENDING; i++) {
+                PendingCommand* slot = &_pending[i];
+                if (slot->frameId == _rxFrame[1] &&
+                    slot->status == XBEE_API_STATUS_WAITING) {
+                    slot->status = _rxFrame[4];
+                    slot->length = length;
+                    memcpy(slot->data,
+                           _rxFrame + XBEE_API_AT_RESPONSE_HEADER, length);
+                    break;
+                }
+            }
+            break;
+        }
+        case XBEE_API_TX_STATUS:
+            if (_rxLength >= 3 && _rxFrame[1] == _txFrameId) {
+                _txStatus = _rxFrame[2];
+            }
+            break;
+        case XBEE_API_MODEM_STATUS:
+            MS_DBG(F("XBee modem status:"), String(_rxFrame[1], HEX));
+            break;
+        case XBEE_API_RX_IPV4:
+            MS_DBG(F("Received"), _rxLength - XBEE_API_RX_IPV4_HEADER,
+                   F("bytes from the socket"));
+            break;
+        default: break;
+    }
+}
+
+
+uint8_t DigiXBeeAPI::nextFrameId(void) {
+    uint8_t frameId = _nextFrameId;
+    _nextFrameId    = _nextFrameId == 255 ? 1 : _nextFrameId + 1;
+    return frameId;
+}
+
+
+bool DigiXBeeAPI::sendCommandModeAT(const char* command) {
+    _stream->print(F("AT"));
+    _stream->print(command);
+    _stream->print('\r');
+    return waitForOK(XBEE_API_RESPONSE_TIMEOUT_MS);
+}
+
+
+bool DigiXBeeAPI::waitForOK(uint32_t timeout_ms) {
+    const char ok[]    = "OK\r";
+    uint8_t    matched = 0;
+    uint32_t   start   = millis();
+    while (millis() - start < timeout_ms) {
+        if (!_stream->available()) { continue; }
+        char c = _stream->read();
+        if (c == ok[matched]) {
+            if (++matched == 3) { return true; }
+        } else {
+            matched = c == 'O' ? 1 : 0;
+        }
+    }
+    return false;
+}
+
+
+// Constructor
+DigiXBeeAPIClient::DigiXBeeAPIClient(DigiXBeeAPI& api) {
+    _api = &api;
+    memset(_remoteAddress, 0, sizeof(_remoteAddress));
+    _remotePort = 0;
+    _open       = false;
+    _txCount    = 0;
+}
+// Destructor
+DigiXBeeAPIClient::~DigiXBeeAPIClient() {}
+
+
+int DigiXBeeAPIClient::connect(IPAddress ip, uint16_t port) {
+    if (_open) { stop(); }
+    // The XBee opens the socket with the first data sent
+    for (uint8_t i = 0; i < 4; i++) { _remoteAddress[i] = ip[i]; }
+    _remotePort = port;
+    _open       = true;
+    _api->socketClear();
+    return 1;
+}
+
+
+int DigiXBeeAPIClient::connect(const char* host, uint16_t port) {
+    // Have the XBee look up the address
+    uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+    uint8_t length  = 0;
+    uint8_t frameId = _api->sendATString("LA", host);
+    if (!_api->waitATResponse(frameId, data, &length,
+                              XBEE_API_SEND_TIMEOUT_MS) ||
+        length != 4) {
+        MS_DBG(F("XBee couldn't look up"), host);
+        return 0;
+    }
+    return connect(IPAddress(data[0], data[1], data[2], data[3]), port);
+}
+
+
+size_t DigiXBeeAPIClient::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+
+size_t DigiXBeeAPIClient::write(const uint8_t* buf, size_t size) {
+    if (!_open) { return 0; }
+    size_t written = 0;
+    while (written < size) {
+        if (_txCount == 0 && size - written >= MS_XBEE_API_TX_BUFFER) {
+            // Long writes skip the buffer and go out in as few frames as
+            // possible
+            size_t chunk = size - written;
+            if (chunk > XBEE_API_MAX_PAYLOAD) { chunk = XBEE_API_MAX_PAYLOAD; }
+            if (!_api->sendSocketData(_remoteAddress, _remotePort,
+                                      buf + written, chunk)) {
+                _open = false;
+                return written;
+            }
+            written += chunk;
+        } else {
+            _txBuffer[_txCount++] = buf[written++];
+            if (_txCount == MS_XBEE_API_TX_BUFFER && !sendBuffer(false)) {
+                return written;
+            }
+        }
+    }
+    return written;
+}
+
+
+int DigiXBeeAPIClient::available(void) {
+    flush();
+    return _api->socketAvailable();
+}
+
+
+int DigiXBeeAPIClient::read(void) {
+    flush();
+    _api->poll();
+    return _api->socketRead();
+}
+
+
+int DigiXBeeAPIClient::read(uint8_t* buf, size_t size) {
+    flush();
+    _api->poll();
+    size_t count = 0;
+    int    c;
+    while (count < size && (c = _api->socketRead()) >= 0) {
+        buf[count++] = c;
+    }
+    return count;
+}
+
+
+int DigiXBeeAPIClient::peek(void) {
+    flush();
+    _api->poll();
+    return _api->socketRead(false);
+}
+
+
+void DigiXBeeAPIClient::flush(void) {
+    if (_open && _txCount > 0) { sendBuffer(false); }
+}
+
+
+void DigiXBeeAPIClient::stop(void) {
+    // Anything left is sent with the close, or an empty frame closes it
+    if (_open) { sendBuffer(true); }
+    _open    = false;
+    _txCount = 0;
+    _api->socketClear();
+}
+
+
+uint8_t DigiXBeeAPIClient::connected(void) {
+    return _open || _api->socketAvailable() > 0;
+}
+
+
+bool DigiXBeeAPIClient::sendBuffer(bool closeSocket) {
+    bool success = _api->sendSocketData(_remoteAddress, _remotePort, _txBuffer,
+                                        _txCount, closeSocket);
+    _txCount     = 0;
+    if (!success) { _open = false; }
+    return success;
+}
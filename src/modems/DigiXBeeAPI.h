@@ -0,0 +1,507 @@
+/**
+ * @file DigiXBeeAPI.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the DigiXBeeAPI and DigiXBeeAPIClient classes, which talk to
+ * a Digi XBee in API mode (AP=1 or AP=2).
+ *
+ * In transparent mode, every setting or query needs the XBee to be put into
+ * command mode with "+++" and taken out again.  The XBee only accepts the
+ * "+++" after a guard time of silence on both sides of it, so each trip costs
+ * a couple of seconds with the radio powered.  In API mode every AT command,
+ * every response, and all socket data travel in framed packets instead.
+ * There are no guard times, and several commands can be sent in one burst
+ * before collecting their responses.
+ *
+ * The frames used are:
+ * - 0x08 Local AT Command Request, answered by a 0x88 AT Command Response
+ * - 0x20 Transmit (TX) Request: IPv4, answered by a 0x89 TX Status
+ * - 0xB0 Receive (RX) Packet: IPv4
+ * - 0x8A Modem Status
+ */
+
+// Header Guards
+#ifndef SRC_MODEMS_DIGIXBEEAPI_H_
+#define SRC_MODEMS_DIGIXBEEAPI_H_
+
+// Debugging Statement
+// #define MS_DIGIXBEEAPI_DEBUG
+
+#ifdef MS_DIGIXBEEAPI_DEBUG
+#define MS_DEBUGGING_STD "DigiXBeeAPI"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "TaskWatch.h"
+#include <Client.h>
+
+/** @ingroup modem_digi */
+/**@{*/
+
+/**
+ * @brief The API mode to put the XBee in; 1 for unescaped frames or 2 for
+ * escaped frames.
+ *
+ * With escaped frames, a start delimiter can never show up inside a frame, so
+ * the reader can always find the start of the next frame after a lost byte.
+ *
+ * This can be changed by setting the build flag MS_XBEE_API_MODE when
+ * compiling.
+ */
+#ifndef MS_XBEE_API_MODE
+#define MS_XBEE_API_MODE 2
+#endif
+/**
+ * @brief The number of AT commands that can wait for a response at once.
+ *
+ * This can be changed by setting the build flag MS_XBEE_API_MAX_PENDING when
+ * compiling.
+ */
+#ifndef MS_XBEE_API_MAX_PENDING
+#define MS_XBEE_API_MAX_PENDING 8
+#endif
+/**
+ * @brief The most bytes kept from each AT command response.
+ *
+ * This can be changed by setting the build flag MS_XBEE_API_RESPONSE_SIZE when
+ * compiling.
+ */
+#ifndef MS_XBEE_API_RESPONSE_SIZE
+#define MS_XBEE_API_RESPONSE_SIZE 16
+#endif
+/**
+ * @brief The number of bytes received from the socket that can wait to be
+ * read.
+ *
+ * This can be changed by setting the build flag MS_XBEE_API_RX_BUFFER when
+ * compiling.
+ */
+#ifndef MS_XBEE_API_RX_BUFFER
+#define MS_XBEE_API_RX_BUFFER 64
+#endif
+/**
+ * @brief The number of bytes written to a DigiXBeeAPIClient that are gathered
+ * before they are sent in a frame.
+ *
+ * This can be changed by setting the build flag MS_XBEE_API_TX_BUFFER when
+ * compiling.
+ */
+#ifndef MS_XBEE_API_TX_BUFFER
+#define MS_XBEE_API_TX_BUFFER 64
+#endif
+/**
+ * @brief The most socket data sent in a single frame.
+ */
+#define XBEE_API_MAX_PAYLOAD 1500
+/**
+ * @brief The time to wait for the response to an AT command frame, in
+ * milliseconds.
+ */
+#define XBEE_API_RESPONSE_TIMEOUT_MS 1000L
+/**
+ * @brief The time to wait for the XBee to hand socket data to the network, in
+ * milliseconds.  The first frame to a server also opens the connection.
+ */
+#define XBEE_API_SEND_TIMEOUT_MS 30000L
+/**
+ * @brief The command mode guard time used when the XBee first has to be
+ * switched into API mode, in milliseconds.  This is the XBee default of 1s
+ * (GT=0x3E8) with some margin.
+ */
+#define XBEE_API_GUARD_TIME_MS 1100
+
+
+/**
+ * @brief The DigiXBeeAPI class builds and reads the API frames used to talk to
+ * a Digi XBee in API mode.
+ *
+ * Incoming frames are read whenever a command or socket call waits on the
+ * XBee, so neither the serial buffer nor the XBee's output can back up.
+ *
+ * @ingroup modem_digi
+ */
+class DigiXBeeAPI {
+ public:
+    /**
+     * @brief Construct a new Digi XBee API object
+     *
+     * @param modemStream The Arduino stream instance for serial communication.
+     * @param apiMode The API mode the XBee is set to; 1 or 2.  Optional with
+     * a default value of #MS_XBEE_API_MODE.
+     */
+    explicit DigiXBeeAPI(Stream* modemStream,
+                         uint8_t apiMode = MS_XBEE_API_MODE);
+    /**
+     * @brief Destroy the Digi XBee API object - no action taken
+     */
+    ~DigiXBeeAPI();
+
+    /**
+     * @brief Make sure the XBee is answering API frames.
+     *
+     * If it isn't, this switches it into API mode using command mode and saves
+     * the setting, so the guard times are only ever needed once.
+     *
+     * @return **bool** True if the XBee is answering API frames.
+     */
+    bool enableAPIMode(void);
+    /**
+     * @brief Check whether the XBee answers an AT command frame.
+     *
+     * @param timeout_ms The time to keep trying, in milliseconds
+     * @return **bool** True if the XBee answered.
+     */
+    bool isResponding(uint32_t timeout_ms);
+
+    /**
+     * @brief Send an AT command frame without waiting for its response.
+     *
+     * Any number of commands can be sent before the responses are collected
+     * with waitATResponse().  If #MS_XBEE_API_MAX_PENDING commands are already
+     * waiting, this first waits for the oldest of them and drops its
+     * response.
+     *
+     * @param command The two character AT command, without the "AT"
+     * @param parameter The parameter bytes
+     * @param length The number of parameter bytes; 0 to query the current
+     * setting or run the command.
+     * @return **uint8_t** The frame ID to collect the response with
+     */
+    uint8_t sendATBytes(const char* command, const uint8_t* parameter,
+                        uint8_t length);
+    /**
+     * @brief Send an AT command frame with no parameter, without waiting for
+     * its response.
+     *
+     * @param command The two character AT command, without the "AT"
+     * @return **uint8_t** The frame ID to collect the response with
+     */
+    uint8_t sendATCommand(const char* command);
+    /**
+     * @brief Send an AT command frame with a numeric parameter, without
+     * waiting for its response.
+     *
+     * The value is sent big-endian, in as few bytes as it fits in.
+     *
+     * @param command The two character AT command, without the "AT"
+     * @param value The parameter value
+     * @return **uint8_t** The frame ID to collect the response with
+     */
+    uint8_t sendATCommand(const char* command, uint32_t value);
+    /**
+     * @brief Send an AT command frame with a text parameter, without waiting
+     * for its response.
+     *
+     * @param command The two character AT command, without the "AT"
+     * @param text The parameter text
+     * @return **uint8_t** The frame ID to collect the response with
+     */
+    uint8_t sendATString(const char* command, const char* text);
+    /**
+     * @brief Wait for the response to an AT command frame.
+     *
+     * @param frameId The frame ID returned when the command was sent
+     * @param data A buffer of at least #MS_XBEE_API_RESPONSE_SIZE bytes for
+     * the response value; optional with a default value of NULL.
+     * @param length Filled with the number of bytes in the response value;
+     * optional with a default value of NULL.
+     * @param timeout_ms The time to wait, in milliseconds; optional with a
+     * default value of #XBEE_API_RESPONSE_TIMEOUT_MS.
+     * @return **bool** True if the XBee answered "OK".
+     */
+    bool waitATResponse(uint8_t frameId, uint8_t* data = NULL,
+                        uint8_t* length = NULL,
+                        uint32_t timeout_ms = XBEE_API_RESPONSE_TIMEOUT_MS);
+    /**
+     * @brief Set a numeric parameter and wait for the XBee to accept it.
+     *
+     * @param command The two character AT command, without the "AT"
+     * @param value The parameter value
+     * @return **bool** True if the XBee answered "OK".
+     */
+    bool setParameter(const char* command, uint32_t value);
+    /**
+     * @brief Query a numeric parameter.
+     *
+     * @param command The two character AT command, without the "AT"
+     * @param value Filled with the value returned by the XBee
+     * @return **bool** True if the XBee answered "OK".
+     */
+    bool getParameter(const char* command, uint32_t& value);
+    /**
+     * @brief Set several numeric parameters.
+     *
+     * The settings are sent in bursts of up to #MS_XBEE_API_MAX_PENDING frames
+     * before their responses are collected.
+     *
+     * @param commands The two character AT commands, without the "AT"
+     * @param values The parameter value for each command
+     * @param count The number of commands
+     * @return **bool** True if the XBee answered "OK" to every command.
+     */
+    bool setParameters(const char* const commands[], const uint32_t values[],
+                       uint8_t count);
+    /**
+     * @brief Convert a big-endian response value to a number.
+     *
+     * @param data The response bytes
+     * @param length The number of response bytes
+     * @return **uint32_t** The value
+     */
+    static uint32_t toNumber(const uint8_t* data, uint8_t length);
+
+    /**
+     * @brief Send socket data to a server in a TX Request: IPv4 frame and wait
+     * for the XBee to accept it.
+     *
+     * @param address The four bytes of the server's IPv4 address
+     * @param port The server's port
+     * @param data The bytes to send; may be NULL when closing the socket.
+     * @param length The number of bytes to send; at most
+     * #XBEE_API_MAX_PAYLOAD.
+     * @param closeSocket True to close the socket once the data is sent
+     * @return **bool** True if the XBee reported the data as sent.
+     */
+    bool sendSocketData(const uint8_t* address, uint16_t port,
+                        const uint8_t* data, uint16_t length,
+                        bool closeSocket = false);
+    /**
+     * @brief Get the number of socket bytes waiting to be read.
+     *
+     * @return **uint16_t** The number of bytes waiting
+     */
+    uint16_t socketAvailable(void);
+    /**
+     * @brief Read one socket byte.
+     *
+     * @param remove False to leave the byte to be read again; optional with a
+     * default value of true.
+     * @return **int** The byte, or -1 if there is none.
+     */
+    int socketRead(bool remove = true);
+    /**
+     * @brief Drop all socket bytes waiting to be read.
+     */
+    void socketClear(void);
+
+    /**
+     * @brief Read and handle every frame that has arrived.
+     */
+    void poll(void);
+
+ protected:
+    /**
+     * @brief Internal reference to the serial stream
+     */
+    Stream* _stream;
+    /**
+     * @brief The API mode of the XBee; escaping is used for mode 2
+     */
+    uint8_t _apiMode;
+    /**
+     * @brief The frame ID to use for the next frame; never 0, which would ask
+     * the XBee not to respond.
+     */
+    uint8_t _nextFrameId;
+
+    /**
+     * @brief An AT command waiting for its response
+     */
+    typedef struct {
+        /** @brief The frame ID; 0 if the slot is free */
+        uint8_t frameId;
+        /** @brief The command status, or 0xFF while waiting */
+        uint8_t status;
+        /** @brief The number of bytes in the value */
+        uint8_t length;
+        /** @brief The response value */
+        uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+    } PendingCommand;
+    /**
+     * @brief The AT commands waiting for responses
+     */
+    PendingCommand _pending[MS_XBEE_API_MAX_PENDING];
+    /**
+     * @brief The slot to use for the next command; slots are used in turn, so
+     * this is also the oldest.
+     */
+    uint8_t _nextSlot;
+
+    /**
+     * @brief The frame ID of the last socket data sent
+     */
+    uint8_t _txFrameId;
+    /**
+     * @brief The TX status of the last socket data sent, or 0xFF while
+     * waiting
+     */
+    uint8_t _txStatus;
+
+    /**
+     * @brief Socket bytes waiting to be read
+     */
+    uint8_t _socketBuffer[MS_XBEE_API_RX_BUFFER];
+    /**
+     * @brief The position of the oldest byte in #_socketBuffer
+     */
+    uint16_t _socketHead;
+    /**
+     * @brief The number of bytes in #_socketBuffer
+     */
+    uint16_t _socketCount;
+
+    /**
+     * @brief Where the reader is in the frame coming in
+     */
+    uint8_t _rxState;
+    /**
+     * @brief True if the next byte read was escaped
+     */
+    bool _rxEscaped;
+    /**
+     * @brief The length of the frame coming in
+     */
+    uint16_t _rxLength;
+    /**
+     * @brief The number of frame bytes read so far
+     */
+    uint16_t _rxIndex;
+    /**
+     * @brief The sum of the frame bytes read so far
+     */
+    uint8_t _rxSum;
+    /**
+     * @brief The start of the frame coming in; socket data is put straight
+     * into #_socketBuffer instead.
+     */
+    uint8_t _rxFrame[MS_XBEE_API_RESPONSE_SIZE + 5];
+
+    /**
+     * @brief Write a frame, escaping it if needed.
+     *
+     * @param header The frame type and the fields before the payload
+     * @param headerLength The number of header bytes
+     * @param payload The payload; may be NULL
+     * @param payloadLength The number of payload bytes
+     */
+    void writeFrame(const uint8_t* header, uint8_t headerLength,
+                    const uint8_t* payload, uint16_t payloadLength);
+    /**
+     * @brief Write one byte of a frame, escaping it if needed.
+     *
+     * @param c The byte
+     */
+    void writeEscaped(uint8_t c);
+    /**
+     * @brief Handle one byte read from the stream.
+     *
+     * @param c The byte
+     */
+    void readByte(uint8_t c);
+    /**
+     * @brief Handle a whole frame once its checksum has been checked.
+     */
+    void handleFrame(void);
+    /**
+     * @brief Get the next frame ID.
+     *
+     * @return **uint8_t** A frame ID between 1 and 255
+     */
+    uint8_t nextFrameId(void);
+    /**
+     * @brief Send one AT command in command mode and wait for "OK".
+     *
+     * @param command The command, without the "AT"
+     * @return **bool** True if the XBee answered "OK".
+     */
+    bool sendCommandModeAT(const char* command);
+    /**
+     * @brief Wait for the "OK" that ends a command mode response.
+     *
+     * @param timeout_ms The time to wait, in milliseconds
+     * @return **bool** True if the XBee answered "OK".
+     */
+    bool waitForOK(uint32_t timeout_ms);
+};
+
+
+/**
+ * @brief The DigiXBeeAPIClient class is an Arduino Client for a TCP socket
+ * opened by an XBee in API mode.
+ *
+ * The XBee opens the socket with the first data sent to the server, so
+ * connect() only remembers where to send.  Bytes written are gathered and sent
+ * in frames of up to #MS_XBEE_API_TX_BUFFER bytes; a flush(), or a call to
+ * read from the socket, sends whatever has been gathered.  Only one socket is
+ * open at a time.
+ *
+ * @ingroup modem_digi
+ */
+class DigiXBeeAPIClient : public Client {
+ public:
+    /**
+     * @brief Construct a new Digi XBee API Client object
+     *
+     * @param api The XBee's API frame transport
+     */
+    explicit DigiXBeeAPIClient(DigiXBeeAPI& api);
+    /**
+     * @brief Destroy the Digi XBee API Client object - no action taken
+     */
+    virtual ~DigiXBeeAPIClient();
+
+    int    connect(IPAddress ip, uint16_t port) override;
+    int    connect(const char* host, uint16_t port) override;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t size) override;
+    int    available(void) override;
+    int    read(void) override;
+    int    read(uint8_t* buf, size_t size) override;
+    int    peek(void) override;
+    void   flush(void) override;
+    void   stop(void) override;
+    uint8_t connected(void) override;
+    operator bool(void) override {
+        return connected();
+    }
+    using Print::write;
+
+ protected:
+    /**
+     * @brief Internal reference to the XBee's API frame transport
+     */
+    DigiXBeeAPI* _api;
+    /**
+     * @brief The four bytes of the server's IPv4 address
+     */
+    uint8_t _remoteAddress[4];
+    /**
+     * @brief The server's port
+     */
+    uint16_t _remotePort;
+    /**
+     * @brief True between connect() and stop(), unless sending failed
+     */
+    bool _open;
+    /**
+     * @brief Bytes written but not yet sent
+     */
+    uint8_t _txBuffer[MS_XBEE_API_TX_BUFFER];
+    /**
+     * @brief The number of bytes in #_txBuffer
+     */
+    uint16_t _txCount;
+
+    /**
+     * @brief Send the bytes in #_txBuffer.
+     *
+     * @param closeSocket True to close the socket once they are sent
+     * @return **bool** True if the bytes were sent.
+     */
+    bool sendBuffer(bool closeSocket);
+};
+/**@}*/
+#endif  // SRC_MODEMS_DIGIXBEEAPI_H_
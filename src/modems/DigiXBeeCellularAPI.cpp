@@ -0,0 +1,413 @@
+/**
+ * @file DigiXBeeCellularAPI.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the DigiXBeeCellularAPI class.
+ */
+
+// Included Dependencies
+#include "DigiXBeeCellularAPI.h"
+
+// Constructor/Destructor
+DigiXBeeCellularAPI::DigiXBeeCellularAPI(Stream* modemStream, int8_t powerPin,
+                                         int8_t statusPin, bool useCTSStatus,
+                                         int8_t      modemResetPin,
+                                         int8_t      modemSleepRqPin,
+                                         const char* apn)
+    : DigiXBee(powerPin, statusPin, useCTSStatus, modemResetPin,
+               modemSleepRqPin),
+      xbeeAPI(modemStream),
+      gsmClient(xbeeAPI) {
+    setCurrents(XBEE3_LTEM_ACTIVE_CURRENT_MA, XBEE3_LTEM_IDLE_CURRENT_MA,
+                XBEE3_LTEM_SLEEP_CURRENT_MA);
+    _apn = apn;
+}
+
+// Destructor
+DigiXBeeCellularAPI::~DigiXBeeCellularAPI() {}
+
+
+bool DigiXBeeCellularAPI::isModemAwake(void) {
+    if (_wakePulse_ms == 0 && _modemSleepRqPin >= 0) {
+        // The sleep request pin is held, so its level shows whether attempts
+        // were made to wake the modem before entering the setup function.
+        int8_t sleepRqBitNumber = log(digitalPinToBitMask(_modemSleepRqPin)) /
+            log(2);
+        bool currentRqPinState = bitRead(
+            *portInputRegister(digitalPinToPort(_modemSleepRqPin)),
+            sleepRqBitNumber);
+        MS_DBG(F("Current state of sleep request pin"), _modemSleepRqPin, '=',
+               currentRqPinState ? F("HIGH") : F("LOW"), F("meaning"),
+               getModemName(), F("should be"),
+               currentRqPinState == _wakeLevel ? F("on") : F("off"));
+        return currentRqPinState == _wakeLevel;
+    } else if (_statusPin >= 0) {
+        bool levelNow = digitalRead(_statusPin);
+        MS_DBG(getModemName(), F("status pin"), _statusPin, F("level = "),
+               levelNow ? F("HIGH") : F("LOW"), F("meaning"), getModemName(),
+               F("should be"), levelNow == _statusLevel ? F("on") : F("off"));
+        return levelNow == _statusLevel;
+    } else {
+        // With neither pin, see if the modem answers a frame
+        bool res = xbeeAPI.isResponding(500);
+        MS_DBG(F("Tested AT command frame and got"),
+               res ? F("a response") : F("no response"), F("meaning"),
+               getModemName(),
+               res ? F("must be awake") : F("is probably asleep"));
+        return res;
+    }
+}
+
+
+bool DigiXBeeCellularAPI::modemWake(void) {
+    // Power up
+    if (_millisPowerOn == 0) { modemPowerUp(); }
+
+    // Set-up pin modes.
+    // Because the modem calls wake BEFORE the first setup, we must set the pin
+    // modes in the wake function.
+    setModemPinModes();
+
+    MS_DBG(F("Wait"), _wakeDelayTime_ms - (millis() - _millisPowerOn),
+           F("ms longer for warm-up"));
+    while (millis() - _millisPowerOn < _wakeDelayTime_ms) {}
+
+    // Mark the wake time for the energy estimates.
+    if (_millisModemAwake == 0) { _millisModemAwake = millis(); }
+
+    if (isModemAwake()) {
+        MS_DBG(getModemName(),
+               F("was already on! Will not run wake function."));
+    } else {
+        MS_DBG(F("Running wake function for"), getModemName());
+        if (!modemWakeFxn()) {
+            MS_DBG(F("Wake function for"), getModemName(),
+                   F("did not run as expected!"));
+        }
+    }
+
+    uint8_t resets  = 0;
+    bool    success = false;
+    while (!success && resets < 2 && TaskWatch::yield()) {
+        // Check that the modem is answering frames
+        MS_START_DEBUG_TIMER;
+        MS_DBG(F("\nWaiting up to"), _max_atresponse_time_ms, F("ms for"),
+               getModemName(), F("to respond to AT command frames..."));
+        success = xbeeAPI.isResponding(_max_atresponse_time_ms + 500);
+        // Until it has been set up, the modem may still be in transparent
+        // mode
+        if (!success && !_hasBeenSetup) { success = xbeeAPI.enableAPIMode(); }
+        if (success) {
+            MS_DBG(F("... AT OK after"), MS_PRINT_DEBUG_TIMER,
+                   F("milliseconds!"));
+        } else {
+            // Hard reset if there's no response
+            MS_DBG(F("No response to AT command frames!"));
+            MS_DBG(F("Attempting a hard reset on the modem! "), resets + 1);
+            if (!modemHardReset()) {
+                // Exit if we can't hard reset
+                break;
+            } else {
+                resets++;
+            }
+        }
+    }
+
+    // If we run setup, take success value entirely from that
+    if (!_hasBeenSetup) { success = modemSetup(); }
+
+    if (success) {
+        modemLEDOn();
+        MS_DBG(getModemName(), F("should be awake and ready to go."));
+    } else {
+        MS_DBG(getModemName(), F("failed to wake!"));
+    }
+
+    return success;
+}
+
+
+// We turn on airplane mode before sleep; it's turned off again when
+// connecting to the internet
+bool DigiXBeeCellularAPI::modemSleepFxn(void) {
+    if (_modemSleepRqPin >= 0) {
+        MS_DBG(F("Turning on airplane mode..."));
+        xbeeAPI.setParameter("AM", 1);
+    }
+    return DigiXBee::modemSleepFxn();
+}
+
+
+bool DigiXBeeCellularAPI::extraModemSetup(void) {
+    MS_DBG(F("Making sure the XBee is in API mode..."));
+    if (!xbeeAPI.enableAPIMode()) {
+        MS_DBG(F("... setup failed!"));
+        return false;
+    }
+    _modemName = "Digi XBee Cellular";
+
+    MS_DBG(F("Setting I/O Pins, Sleep Options, and Other Options..."));
+    // These are the same settings used in transparent mode; see
+    // DigiXBeeCellularTransparent::extraModemSetup() for what each does.
+    static const char* const commands[] = {"D8", "D9", "D7", "D5", "P0",
+                                           "SM", "SO", "DO", "P1", "TM"};
+    static const uint32_t    values[]   = {1, 1, 1, 1, 1, 1, 0, 0, 0, 0x64};
+    bool success = xbeeAPI.setParameters(commands, values, 10);
+
+    MS_DBG(F("Setting the APN..."));
+    uint8_t apnFrame = xbeeAPI.sendATString("AN", _apn);
+    success &= xbeeAPI.waitATResponse(apnFrame);
+
+    // Write all changes to flash and apply them
+    MS_DBG(F("Applying changes..."));
+    uint8_t writeFrame = xbeeAPI.sendATCommand("WR");
+    uint8_t applyFrame = xbeeAPI.sendATCommand("AC");
+    success &= xbeeAPI.waitATResponse(writeFrame);
+    success &= xbeeAPI.waitATResponse(applyFrame);
+
+    // Force restart the modem to make sure all settings take
+    MS_DBG(F("Restarting XBee..."));
+    success &= xbeeAPI.waitATResponse(xbeeAPI.sendATCommand("FR"));
+    delay(XBEE_WAKE_DELAY_MS);
+    success &= xbeeAPI.isResponding(_max_atresponse_time_ms);
+
+    if (success) {
+        MS_DBG(F("... setup successful!"));
+    } else {
+        MS_DBG(F("... setup failed!"));
+    }
+    return success;
+}
+
+
+bool DigiXBeeCellularAPI::isInternetAvailable(void) {
+    // The association indication is 0 once connected to the internet
+    uint32_t association = 0xFF;
+    return xbeeAPI.getParameter("AI", association) && association == 0;
+}
+
+
+bool DigiXBeeCellularAPI::connectInternet(uint32_t maxConnectionTime) {
+    bool success = true;
+
+    // Power up, if necessary
+    bool wasPowered = true;
+    if (_millisPowerOn == 0) {
+        modemPowerUp();
+        wasPowered = false;
+    }
+
+    // Check if the modem was awake, wake it if not
+    bool wasAwake = isModemAwake();
+    if (!wasAwake) {
+        while (millis() - _millisPowerOn < _wakeDelayTime_ms) {}
+        MS_DBG(F("Waking up the modem to connect to the internet ..."));
+        success &= modemWake();
+    } else {
+        MS_DBG(F("Modem was already awake and should be ready."));
+    }
+
+    if (success) {
+        MS_START_DEBUG_TIMER
+        MS_DBG(F("Turning off airplane mode..."));
+        xbeeAPI.setParameter("AM", 0);
+        MS_DBG(F("\nWaiting up to"), maxConnectionTime / 1000,
+               F("seconds for cellular network registration..."));
+        uint32_t startMillis = millis();
+        success              = false;
+        while (millis() - startMillis < maxConnectionTime &&
+               TaskWatch::yield()) {
+            if (isInternetAvailable()) {
+                success = true;
+                break;
+            }
+            delay(250);
+        }
+        if (success) {
+            MS_DBG(F("... Connected after"), MS_PRINT_DEBUG_TIMER,
+                   F("milliseconds."));
+        } else {
+            MS_DBG(F("...GPRS connection failed."));
+        }
+    }
+    if (!wasPowered) {
+        MS_DBG(F("Modem was powered to connect to the internet!  "
+                 "Remember to turn it off when you're done."));
+    } else if (!wasAwake) {
+        MS_DBG(F("Modem was woken up to connect to the internet!   "
+                 "Remember to put it to sleep when you're done."));
+    }
+    return success;
+}
+
+
+void DigiXBeeCellularAPI::disconnectInternet(void) {
+    MS_START_DEBUG_TIMER;
+    gsmClient.stop();
+    xbeeAPI.setParameter("AM", 1);
+    MS_DBG(F("Disconnected from cellular network after"), MS_PRINT_DEBUG_TIMER,
+           F("milliseconds."));
+}
+
+
+uint32_t DigiXBeeCellularAPI::getNISTTime(void) {
+    /* bail if not connected to the internet */
+    if (!isInternetAvailable()) {
+        MS_DBG(F("No internet connection, cannot connect to NIST."));
+        return 0;
+    }
+
+    /* The XBee keeps the network time; reading it is a single frame */
+    uint32_t secFrom2000 = 0;
+    if (xbeeAPI.getParameter("DT", secFrom2000)) {
+        // Convert from seconds since Jan 1, 2000 to 1970
+        uint32_t unixTimeStamp = secFrom2000 + 946684800;
+        MS_DBG(F("Unix Timestamp returned by the XBee (UTC):"), unixTimeStamp);
+        // If before Jan 1, 2019 or after Jan 1, 2030, the XBee doesn't have
+        // the time yet
+        if (unixTimeStamp > 1546300800 && unixTimeStamp < 1893456000) {
+            return unixTimeStamp;
+        }
+    }
+
+    /* Try up to 12 times to get a timestamp from NIST */
+    for (uint8_t i = 0; i < 12; i++) {
+        // Must ensure that we do not ping the daylight more than once every 4
+        // seconds.  NIST clearly specifies here that this is a requirement for
+        // all software that accesses its servers:
+        // https://tf.nist.gov/tf-cgi/servers.cgi
+        while (millis() < _lastNISTrequest + 4000) {}
+
+        /* Make TCP connection */
+        MS_DBG(F("\nConnecting to NIST daytime Server"));
+
+        /* This is the IP address of time-e-wwv.nist.gov  */
+        /* XBee's address lookup falters on time.nist.gov */
+        IPAddress ip(132, 163, 97, 6);
+        gsmClient.connect(ip, 37);
+        /* The XBee only opens the connection once there's data to send */
+        gsmClient.println('!');
+        gsmClient.flush();
+
+        /* Wait up to 5 seconds for a response */
+        if (gsmClient.connected()) {
+            uint32_t start = millis();
+            while (gsmClient.available() < 4 && millis() - start < 5000L) {}
+
+            if (gsmClient.available() >= 4) {
+                MS_DBG(F("NIST responded after"), millis() - start, F("ms"));
+                byte response[4] = {0};
+                gsmClient.read(response, 4);
+                gsmClient.stop();
+                return parseNISTBytes(response);
+            } else {
+                MS_DBG(F("NIST Time server did not respond!"));
+                gsmClient.stop();
+            }
+        } else {
+            MS_DBG(F("Unable to open TCP to NIST!"));
+            gsmClient.stop();
+        }
+    }
+    return 0;
+}
+
+
+bool DigiXBeeCellularAPI::getModemSignalQuality(int16_t& rssi,
+                                                int16_t& percent) {
+    // The XBee returns the RSSI in -dBm
+    MS_DBG(F("Getting signal quality:"));
+    uint32_t signalQual = 0;
+    xbeeAPI.getParameter("DB", signalQual);
+    rssi = -static_cast<int16_t>(signalQual);
+    MS_DBG(F("Raw signal is already in units of RSSI:"), rssi);
+    percent = getPctFromRSSI(rssi);
+    MS_DBG(F("Signal percent calcuated from RSSI:"), percent);
+    return true;
+}
+
+
+bool DigiXBeeCellularAPI::getModemBatteryStats(uint8_t&  chargeState,
+                                               int8_t&   percent,
+                                               uint16_t& milliVolts) {
+    MS_DBG(F("This modem doesn't return battery information!"));
+    chargeState = 99;
+    percent     = -99;
+    milliVolts  = 9999;
+    return false;
+}
+
+
+float DigiXBeeCellularAPI::getModemChipTemperature(void) {
+    MS_DBG(F("Getting temperature:"));
+    uint32_t temp = 0;
+    if (!xbeeAPI.getParameter("TP", temp)) { return static_cast<float>(-9999); }
+    MS_DBG(F("Temperature:"), static_cast<int16_t>(temp));
+    return static_cast<int16_t>(temp);
+}
+
+
+bool DigiXBeeCellularAPI::updateModemMetadata(void) {
+    bool success = true;
+
+    // Unset whatever we had previously
+    loggerModem::_priorRSSI           = -9999;
+    loggerModem::_priorSignalPercent  = -9999;
+    loggerModem::_priorBatteryState   = -9999;
+    loggerModem::_priorBatteryPercent = -9999;
+    loggerModem::_priorBatteryVoltage = -9999;
+    loggerModem::_priorModemTemp      = -9999;
+
+    bool wantSignal = isMetadataRequested(MODEM_METADATA_SIGNAL);
+    bool wantTemp   = isMetadataRequested(MODEM_METADATA_TEMPERATURE);
+    if (!wantSignal && !wantTemp) { return success; }
+
+    // Ask for everything in one burst, then collect the answers
+    uint32_t startMillis = millis();
+    uint8_t  signalFrame = wantSignal ? xbeeAPI.sendATCommand("DB") : 0;
+    uint8_t  tempFrame   = wantTemp ? xbeeAPI.sendATCommand("TP") : 0;
+
+    if (wantSignal) {
+        // Try for up to 15 seconds to get a valid signal quality
+        // NOTE:  The XBee returns 0 both when there's no response from the
+        // cell chip and when there's really no signal.
+        int16_t signalQual = -9999;
+        uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+        uint8_t length = 0;
+        while (true) {
+            if (xbeeAPI.waitATResponse(signalFrame, data, &length)) {
+                signalQual = -static_cast<int16_t>(
+                    DigiXBeeAPI::toNumber(data, length));
+            }
+            MS_DBG(F("Raw signal quality:"), signalQual);
+            if ((signalQual != 0 && signalQual != -9999) ||
+                millis() - startMillis >= 15000L || !TaskWatch::yield()) {
+                break;
+            }
+            delay(250);
+            signalFrame = xbeeAPI.sendATCommand("DB");
+        }
+
+        loggerModem::_priorRSSI = signalQual;
+        MS_DBG(F("CURRENT RSSI:"), signalQual);
+        loggerModem::_priorSignalPercent = getPctFromRSSI(signalQual);
+        MS_DBG(F("CURRENT Percent signal strength:"),
+               getPctFromRSSI(signalQual));
+    }
+
+    if (wantTemp) {
+        uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+        uint8_t length = 0;
+        if (xbeeAPI.waitATResponse(tempFrame, data, &length)) {
+            loggerModem::_priorModemTemp = static_cast<int16_t>(
+                DigiXBeeAPI::toNumber(data, length));
+        }
+        MS_DBG(F("CURRENT Modem temperature:"), loggerModem::_priorModemTemp);
+    }
+
+    MS_DBG(F("Updating the modem metadata took"), millis() - startMillis,
+           F("ms"));
+
+    return success;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file DigiXBeeCellularAPI.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the DigiXBeeCellularAPI class for Digi Cellular XBee's
+ * operating in API mode.
+ */
+/* clang-format off */
+/**
+ * @defgroup modem_digi_cellular_api XBee Cellular in API Mode
+ *
+ * @ingroup modem_digi
+ *
+ * @tableofcontents
+ * @m_footernavigation
+ *
+ * @section modem_digi_cellular_api_notes Introduction
+ *
+ * Any of the Digi _cellular_ modems can also be implemented as a
+ * DigiXBeeCellularAPI object - a subclass of DigiXBee and loggerModem.
+ * Instead of passing data straight through like in transparent mode, the
+ * module is put into API mode, where every AT command, response, and piece of
+ * socket data travels in a framed packet.
+ *
+ * A DigiXBeeCellularTransparent object has to put the module into command
+ * mode for every setting and query, waiting out the module's guard time on
+ * each side of the "+++".
+ * In API mode there are no guard times, and the signal strength and
+ * temperature are asked for in one burst, so the module spends several
+ * seconds less awake each time data is sent.
+ * The network time is read from the module without opening a connection to
+ * NIST, when the module has it.
+ *
+ * The first time a module that is still in transparent mode is set up, it is
+ * switched into API mode with command mode and the change is saved.
+ * After that, command mode is never used again.
+ *
+ * This does not use TinyGSM.
+ * The DigiXBeeCellularAPI::gsmClient is a DigiXBeeAPIClient, which can be
+ * given to any publisher just like a TinyGSM client.
+ * Only one socket can be open at a time.
+ *
+ * @section modem_digi_cellular_api_docs Manufacturer Documentation
+ * The Digi product page for the various cellular modules is here:
+ * https://www.digi.com/products/embedded-systems/digi-xbee/cellular-modems
+ *
+ * @section modem_digi_cellular_api_ctor Modem Constructor
+ * {{ @ref DigiXBeeCellularAPI::DigiXBeeCellularAPI }}
+ */
+/* clang-format on */
+
+// Header Guards
+#ifndef SRC_MODEMS_DIGIXBEECELLULARAPI_H_
+#define SRC_MODEMS_DIGIXBEECELLULARAPI_H_
+
+// Debugging Statement
+// #define MS_DIGIXBEECELLULARAPI_DEBUG
+
+#ifdef MS_DIGIXBEECELLULARAPI_DEBUG
+#define MS_DEBUGGING_STD "DigiXBeeCellularAPI"
+#endif
+
+/** @ingroup modem_digi_cellular_api */
+/**@{*/
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "DigiXBee.h"
+#include "DigiXBeeAPI.h"
+
+/**
+ * @brief The loggerModem subclass for any of the Digi cellular XBee's and
+ * XBee3's in API mode.
+ */
+class DigiXBeeCellularAPI : public DigiXBee {
+ public:
+    /**
+     * @brief Construct a new Digi XBee Cellular API object
+     *
+     * The constuctor initializes all of the provided member variables,
+     * constructs a loggerModem parent class with the appropriate timing for the
+     * module, creates the API frame transport on the provided modemStream, and
+     * creates a client linked to it.
+     *
+     * @param modemStream The Arduino stream instance for serial communication.
+     * @param powerPin @copydoc loggerModem::_powerPin
+     * @param statusPin @copydoc loggerModem::_statusPin
+     * This can be either the pin named `ON/SLEEP_N/DIO9` or `CTS_N/DIO7` pin in
+     * Digi's hardware reference.
+     * @param useCTSStatus True to use the `CTS_N/DIO7` pin of the XBee as a
+     * status indicator rather than the true status (`ON/SLEEP_N/DIO9`) pin.
+     * This inverts the loggerModem::_statusLevel.
+     * @param modemResetPin @copydoc loggerModem::_modemResetPin
+     * This shold be the pin called `RESET_N` in Digi's hardware reference.
+     * @param modemSleepRqPin @copydoc loggerModem::_modemSleepRqPin
+     * This shold be the pin called `DTR_N/SLEEP_RQ/DIO8` in Digi's hardware
+     * reference.
+     * @param apn The Access Point Name (APN) for the SIM card.
+     *
+     * @see DigiXBee::DigiXBee
+     */
+    DigiXBeeCellularAPI(Stream* modemStream, int8_t powerPin, int8_t statusPin,
+                        bool useCTSStatus, int8_t modemResetPin,
+                        int8_t modemSleepRqPin, const char* apn);
+    /**
+     * @brief Destroy the Digi XBee Cellular API object - no action needed
+     */
+    ~DigiXBeeCellularAPI();
+
+    bool modemWake(void) override;
+
+    bool connectInternet(uint32_t maxConnectionTime = 50000L) override;
+    void disconnectInternet(void) override;
+
+    /**
+     * @copydoc loggerModem::getNISTTime()
+     *
+     * The network time kept by the XBee is used when it has it, and NIST is
+     * only asked when it doesn't.
+     */
+    uint32_t getNISTTime(void) override;
+
+    bool  getModemSignalQuality(int16_t& rssi, int16_t& percent) override;
+    bool  getModemBatteryStats(uint8_t& chargeState, int8_t& percent,
+                               uint16_t& milliVolts) override;
+    float getModemChipTemperature(void) override;
+
+    bool updateModemMetadata(void) override;
+
+    /**
+     * @brief Public reference to the XBee's API frame transport.
+     */
+    DigiXBeeAPI xbeeAPI;
+    /**
+     * @brief Public reference to the client.
+     */
+    DigiXBeeAPIClient gsmClient;
+
+ protected:
+    bool isInternetAvailable(void) override;
+    bool modemSleepFxn(void) override;
+    /**
+     * @copybrief loggerModem::extraModemSetup()
+     *
+     * For XBees in API mode, this makes sure the module is in API mode, enables
+     * pin sleep, sets the DIO pins to the expected functions, saves the APN,
+     * and reboots the modem to ensure all settings are applied.  The settings
+     * are sent in bursts rather than one at a time.
+     *
+     * @return **bool** True if the extra setup succeeded.
+     */
+    bool extraModemSetup(void) override;
+    bool isModemAwake(void) override;
+
+ private:
+    const char* _apn;
+};
+/**@}*/
+#endif  // SRC_MODEMS_DIGIXBEECELLULARAPI_H_
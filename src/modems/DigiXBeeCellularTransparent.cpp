@@ -26,6 +26,8 @@ DigiXBeeCellularTransparent::DigiXBeeCellularTransparent(
       gsmModem(*modemStream, modemResetPin),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(XBEE3_LTEM_ACTIVE_CURRENT_MA, XBEE3_LTEM_IDLE_CURRENT_MA,
+                XBEE3_LTEM_SLEEP_CURRENT_MA);
     _apn = apn;
     _user = user;
     _pwd = pwd;
@@ -301,44 +303,59 @@ bool DigiXBeeCellularTransparent::updateModemMetadata(void) {
     loggerModem::_priorSignalPercent  = -9999;
     loggerModem::_priorBatteryState   = -9999;
     loggerModem::_priorBatteryPercent = -9999;
-    loggerModem::_priorBatteryPercent = -9999;
+    loggerModem::_priorBatteryVoltage = -9999;
     loggerModem::_priorModemTemp      = -9999;
 
     // Initialize variable
     int16_t signalQual = -9999;
 
+    // Entering command mode takes over a second of guard time; don't bother
+    // if no variable will use anything
+    if (!isMetadataRequested(MODEM_METADATA_SIGNAL |
+                             MODEM_METADATA_TEMPERATURE)) {
+        return success;
+    }
+
     // Enter command mode only once
     MS_DBG(F("Entering Command Mode:"));
     gsmModem.commandMode();
 
-    // Try for up to 15 seconds to get a valid signal quality
-    // NOTE:  We can't actually distinguish between a bad modem response, no
-    // modem response, and a real response from the modem of no service/signal.
-    // The TinyGSM getSignalQuality function returns the same "no signal"
-    // value (99 CSQ or 0 RSSI) in all 3 cases.
+    // Only ask the modem for what some variable will use
     uint32_t startMillis = millis();
-    do {
-        MS_DBG(F("Getting signal quality:"));
-        signalQual = gsmModem.getSignalQuality();
-        MS_DBG(F("Raw signal quality:"), signalQual);
-        if (signalQual != 0 && signalQual != -9999) break;
-        delay(250);
-    } while ((signalQual == 0 || signalQual == -9999) &&
-             millis() - startMillis < 15000L && success);
-
-    // Convert signal quality to RSSI
-    loggerModem::_priorRSSI = signalQual;
-    MS_DBG(F("CURRENT RSSI:"), signalQual);
-    loggerModem::_priorSignalPercent = getPctFromRSSI(signalQual);
-    MS_DBG(F("CURRENT Percent signal strength:"), getPctFromRSSI(signalQual));
-
-    MS_DBG(F("Getting chip temperature:"));
-    loggerModem::_priorModemTemp = getModemChipTemperature();
-    MS_DBG(F("CURRENT Modem temperature:"), loggerModem::_priorModemTemp);
+    if (isMetadataRequested(MODEM_METADATA_SIGNAL)) {
+        // Try for up to 15 seconds to get a valid signal quality
+        // NOTE:  We can't actually distinguish between a bad modem response,
+        // no modem response, and a real response from the modem of no
+        // service/signal.  The TinyGSM getSignalQuality function returns the
+        // same "no signal" value (99 CSQ or 0 RSSI) in all 3 cases.
+        do {
+            MS_DBG(F("Getting signal quality:"));
+            signalQual = gsmModem.getSignalQuality();
+            MS_DBG(F("Raw signal quality:"), signalQual);
+            if (signalQual != 0 && signalQual != -9999) break;
+            delay(250);
+        } while ((signalQual == 0 || signalQual == -9999) &&
+                 millis() - startMillis < 15000L && success);
+
+        // Convert signal quality to RSSI
+        loggerModem::_priorRSSI = signalQual;
+        MS_DBG(F("CURRENT RSSI:"), signalQual);
+        loggerModem::_priorSignalPercent = getPctFromRSSI(signalQual);
+        MS_DBG(F("CURRENT Percent signal strength:"),
+               getPctFromRSSI(signalQual));
+    }
+
+    if (isMetadataRequested(MODEM_METADATA_TEMPERATURE)) {
+        MS_DBG(F("Getting chip temperature:"));
+        loggerModem::_priorModemTemp = getModemChipTemperature();
+        MS_DBG(F("CURRENT Modem temperature:"), loggerModem::_priorModemTemp);
+    }
 
     // Exit command modem
     MS_DBG(F("Leaving Command Mode:"));
     gsmModem.exitCommand();
+    MS_DBG(F("Updating the modem metadata took"), millis() - startMillis,
+           F("ms"));
 
     return success;
 }
@@ -25,6 +25,8 @@ DigiXBeeLTEBypass::DigiXBeeLTEBypass(Stream* modemStream, int8_t powerPin,
       gsmModem(*modemStream),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(XBEE3_LTEM_ACTIVE_CURRENT_MA, XBEE3_LTEM_IDLE_CURRENT_MA,
+                XBEE3_LTEM_SLEEP_CURRENT_MA);
     _apn = apn;
 }
 
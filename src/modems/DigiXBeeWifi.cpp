@@ -25,6 +25,8 @@ DigiXBeeWifi::DigiXBeeWifi(Stream* modemStream, int8_t powerPin,
       gsmModem(*modemStream, modemResetPin),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(XBEE_WIFI_ACTIVE_CURRENT_MA, XBEE_WIFI_IDLE_CURRENT_MA,
+                XBEE_WIFI_SLEEP_CURRENT_MA);
     _ssid = ssid;
     _pwd  = pwd;
 }
@@ -245,7 +247,7 @@ bool DigiXBeeWifi::updateModemMetadata(void) {
     loggerModem::_priorSignalPercent  = -9999;
     loggerModem::_priorBatteryState   = -9999;
     loggerModem::_priorBatteryPercent = -9999;
-    loggerModem::_priorBatteryPercent = -9999;
+    loggerModem::_priorBatteryVoltage = -9999;
     loggerModem::_priorModemTemp      = -9999;
 
     // Initialize variable
@@ -253,40 +255,54 @@ bool DigiXBeeWifi::updateModemMetadata(void) {
     int16_t  percent = -9999;
     uint16_t volt    = 9999;
 
-    // Try up to 5 times to get a signal quality - that is, ping NIST 5 times
-    // and see if the value updates
-    int8_t num_pings_remaining = 5;
-    do {
-        getModemSignalQuality(rssi, percent);
-        MS_DBG(F("Raw signal quality:"), rssi);
-        if (percent != 0 && percent != -9999) break;
-        num_pings_remaining--;
-    } while ((percent == 0 || percent == -9999) && num_pings_remaining);
-
-    // Convert signal quality to RSSI
-    loggerModem::_priorRSSI          = rssi;
-    loggerModem::_priorSignalPercent = percent;
-
-
-    // Enter command mode only once for temp and battery
-    MS_DBG(F("Entering Command Mode:"));
-    success &= gsmModem.commandMode();
+    // Only ask the modem for what some variable will use
+    uint32_t startMillis = millis();
+    if (isMetadataRequested(MODEM_METADATA_SIGNAL)) {
+        // Try up to 5 times to get a signal quality - that is, ping NIST 5
+        // times and see if the value updates
+        int8_t num_pings_remaining = 5;
+        do {
+            getModemSignalQuality(rssi, percent);
+            MS_DBG(F("Raw signal quality:"), rssi);
+            if (percent != 0 && percent != -9999) break;
+            num_pings_remaining--;
+        } while ((percent == 0 || percent == -9999) && num_pings_remaining);
+
+        // Convert signal quality to RSSI
+        loggerModem::_priorRSSI          = rssi;
+        loggerModem::_priorSignalPercent = percent;
+    }
 
-    MS_DBG(F("Getting input voltage:"));
-    volt = gsmModem.getBattVoltage();
-    MS_DBG(F("CURRENT Modem input battery voltage:"), volt);
-    if (volt != 9999)
-        loggerModem::_priorBatteryVoltage = static_cast<float>(volt);
-    else
-        loggerModem::_priorBatteryVoltage = static_cast<float>(-9999);
+    // Enter command mode only once for temp and battery, and only if either
+    // is wanted
+    if (isMetadataRequested(MODEM_METADATA_BATTERY |
+                            MODEM_METADATA_TEMPERATURE)) {
+        MS_DBG(F("Entering Command Mode:"));
+        success &= gsmModem.commandMode();
+
+        if (isMetadataRequested(MODEM_METADATA_BATTERY)) {
+            MS_DBG(F("Getting input voltage:"));
+            volt = gsmModem.getBattVoltage();
+            MS_DBG(F("CURRENT Modem input battery voltage:"), volt);
+            if (volt != 9999)
+                loggerModem::_priorBatteryVoltage = static_cast<float>(volt);
+            else
+                loggerModem::_priorBatteryVoltage = static_cast<float>(-9999);
+        }
 
-    MS_DBG(F("Getting chip temperature:"));
-    loggerModem::_priorModemTemp = getModemChipTemperature();
-    MS_DBG(F("CURRENT Modem temperature:"), loggerModem::_priorModemTemp);
+        if (isMetadataRequested(MODEM_METADATA_TEMPERATURE)) {
+            MS_DBG(F("Getting chip temperature:"));
+            loggerModem::_priorModemTemp = getModemChipTemperature();
+            MS_DBG(F("CURRENT Modem temperature:"),
+                   loggerModem::_priorModemTemp);
+        }
 
-    // Exit command modem
-    MS_DBG(F("Leaving Command Mode:"));
-    gsmModem.exitCommand();
+        // Exit command modem
+        MS_DBG(F("Leaving Command Mode:"));
+        gsmModem.exitCommand();
+    }
+    MS_DBG(F("Updating the modem metadata took"), millis() - startMillis,
+           F("ms"));
 
     return success;
 }
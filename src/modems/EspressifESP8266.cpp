@@ -29,6 +29,8 @@ EspressifESP8266::EspressifESP8266(Stream* modemStream, int8_t powerPin,
       gsmModem(*modemStream),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(ESP8266_ACTIVE_CURRENT_MA, ESP8266_IDLE_CURRENT_MA,
+                ESP8266_SLEEP_CURRENT_MA);
     _ssid = ssid;
     _pwd  = pwd;
 
@@ -115,6 +115,9 @@
                F("ms longer for warm-up"));                                    \
         while (millis() - _millisPowerOn < _wakeDelayTime_ms) {}               \
                                                                                \
+        /** Mark the wake time for the energy estimates. */                    \
+        if (_millisModemAwake == 0) { _millisModemAwake = millis(); }          \
+                                                                               \
         if (isModemAwake()) {                                                  \
             MS_DBG(getModemName(),                                             \
                    F("was already on! Will not run wake function."));          \
@@ -129,7 +132,7 @@
                                                                                \
         uint8_t resets  = 0;                                                   \
         bool    success = false;                                               \
-        while (!success && resets < 2) {                                       \
+        while (!success && resets < 2 && TaskWatch::yield()) {                 \
             /** Check that the modem is responding to AT commands. */          \
             MS_START_DEBUG_TIMER;                                              \
             MS_DBG(F("\nWaiting up to"), _max_atresponse_time_ms, F("ms for"), \
@@ -366,7 +369,10 @@
         MS_DBG(F("\nAttempting to connect to WiFi network..."));      \
         if (!(gsmModem.isNetworkConnected())) {                       \
             MS_DBG(F("Sending credentials..."));                      \
-            while (!gsmModem.networkConnect(_ssid, _pwd)) {}          \
+            while (!gsmModem.networkConnect(_ssid, _pwd)) {           \
+                /** Give up if the connection is overdue. */          \
+                if (!TaskWatch::yield()) { return false; }            \
+            }                                                         \
             MS_DBG(F("Waiting up to"), maxConnectionTime / 1000,      \
                    F("seconds for connection"));                      \
             if (!gsmModem.waitForNetwork(maxConnectionTime)) {        \
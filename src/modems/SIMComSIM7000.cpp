@@ -27,6 +27,8 @@ SIMComSIM7000::SIMComSIM7000(Stream* modemStream, int8_t powerPin,
       gsmModem(*modemStream),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(SIM7000_ACTIVE_CURRENT_MA, SIM7000_IDLE_CURRENT_MA,
+                SIM7000_SLEEP_CURRENT_MA);
     _apn = apn;
 }
 
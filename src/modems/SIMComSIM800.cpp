@@ -27,6 +27,8 @@ SIMComSIM800::SIMComSIM800(Stream* modemStream, int8_t powerPin,
       gsmModem(*modemStream),
 #endif
       gsmClient(gsmModem) {
+    setCurrents(SIM800_ACTIVE_CURRENT_MA, SIM800_IDLE_CURRENT_MA,
+                SIM800_SLEEP_CURRENT_MA);
     _apn = apn;
 }
 
@@ -163,7 +163,8 @@ int16_t DreamHostPublisher::publishData(Client* outClient) {
 
         // Wait 10 seconds for a response from the server
         uint32_t start = millis();
-        while ((millis() - start) < 10000L && outClient->available() < 12) {
+        while ((millis() - start) < 10000L && outClient->available() < 12 &&
+               TaskWatch::yield()) {
             delay(10);
         }
 
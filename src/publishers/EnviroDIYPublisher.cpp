@@ -82,6 +82,9 @@ uint16_t EnviroDIYPublisher::calculateJsonSize() {
     jsonLength += 36;          // sampling feature UUID
     jsonLength += 15;          // ","timestamp":"
     jsonLength += 25;          // markedISO8601Time
+#if defined MS_MILLISECOND_TIMESTAMPS
+    jsonLength += 4;  // .mmm
+#endif
     jsonLength += 2;           //  ",
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
         jsonLength += 1;   //  "
@@ -122,7 +125,7 @@ void EnviroDIYPublisher::printSensorDataJSON(Stream* stream) {
     stream->print(samplingFeatureTag);
     stream->print(_baseLogger->getSamplingFeatureUUID());
     stream->print(timestampTag);
-    stream->print(_baseLogger->formatDateTime_ISO8601(Logger::markedEpochTime));
+    stream->print(Logger::formatMarkedTime_ISO8601());
     stream->print(F("\","));
 
     for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
@@ -233,9 +236,7 @@ int16_t EnviroDIYPublisher::publishData(Client* outClient) {
 
         if (bufferFree() < 42) printTxBuffer(outClient);
         strcat(txBuffer, timestampTag);
-        _baseLogger->formatDateTime_ISO8601(Logger::markedEpochTime)
-            .toCharArray(tempBuffer, 37);
-        strcat(txBuffer, tempBuffer);
+        strcat(txBuffer, Logger::formatMarkedTime_ISO8601());
         txBuffer[strlen(txBuffer)] = '"';
         txBuffer[strlen(txBuffer)] = ',';
 
@@ -262,7 +263,8 @@ int16_t EnviroDIYPublisher::publishData(Client* outClient) {
 
         // Wait 10 seconds for a response from the server
         uint32_t start = millis();
-        while ((millis() - start) < 10000L && outClient->available() < 12) {
+        while ((millis() - start) < 10000L && outClient->available() < 12 &&
+               TaskWatch::yield()) {
             delay(10);
         }
 
@@ -51,11 +51,10 @@ class EnviroDIYPublisher : public dataPublisher {
      * logger.
      *
      * @param baseLogger The logger supplying the data to be published
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -72,11 +71,10 @@ class EnviroDIYPublisher : public dataPublisher {
      * @param inClient An Arduino client instance to use to print data to.
      * Allows the use of any type of client and multiple clients tied to a
      * single TinyGSM modem instance
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -94,11 +92,10 @@ class EnviroDIYPublisher : public dataPublisher {
      * Monitor My Watershed data portal.
      * @param samplingFeatureUUID The sampling feature UUID for the site on the
      * Monitor My Watershed data portal.
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      */
     EnviroDIYPublisher(Logger& baseLogger, const char* registrationToken,
                        const char* samplingFeatureUUID, uint8_t sendEveryX = 1,
@@ -114,11 +111,10 @@ class EnviroDIYPublisher : public dataPublisher {
      * Monitor My Watershed data portal.
      * @param samplingFeatureUUID The sampling feature UUID for the site on the
      * Monitor My Watershed data portal.
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      */
     EnviroDIYPublisher(Logger& baseLogger, Client* inClient,
                        const char* registrationToken,
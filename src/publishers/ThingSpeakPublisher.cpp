@@ -22,29 +22,37 @@ const int   ThingSpeakPublisher::mqttPort       = 1883;
 const char* ThingSpeakPublisher::mqttClientName = THING_SPEAK_CLIENT_NAME;
 const char* ThingSpeakPublisher::mqttUser       = THING_SPEAK_USER_NAME;
 
+// Constant portions of the bulk-update requests
+const char* ThingSpeakPublisher::bulkHost        = "api.thingspeak.com";
+const char* ThingSpeakPublisher::bulkEndpoint    = "/channels/";
+const char* ThingSpeakPublisher::bulkEndpointEnd = "/bulk_update.json";
+const char* ThingSpeakPublisher::contentLengthHeader = "\r\nContent-Length: ";
+const char* ThingSpeakPublisher::contentTypeHeader =
+    "\r\nContent-Type: application/json\r\n\r\n";
+const char* ThingSpeakPublisher::bulkKeyTag       = "{\"write_api_key\":\"";
+const char* ThingSpeakPublisher::bulkUpdatesTag   = "\",\"updates\":[";
+const char* ThingSpeakPublisher::bulkTimestampTag = "{\"created_at\":\"";
+
 
 // Constructors
 ThingSpeakPublisher::ThingSpeakPublisher() : dataPublisher() {
     // MS_DBG(F("ThingSpeakPublisher object created"));
-    _thingSpeakMQTTKey    = NULL;
-    _thingSpeakChannelID  = NULL;
-    _thingSpeakChannelKey = NULL;
+    _thingSpeakMQTTKey = NULL;
+    resetChannels();
 }
 ThingSpeakPublisher::ThingSpeakPublisher(Logger& baseLogger, uint8_t sendEveryX,
                                          uint8_t sendOffset)
     : dataPublisher(baseLogger, sendEveryX, sendOffset) {
     // MS_DBG(F("ThingSpeakPublisher object created"));
-    _thingSpeakMQTTKey    = NULL;
-    _thingSpeakChannelID  = NULL;
-    _thingSpeakChannelKey = NULL;
+    _thingSpeakMQTTKey = NULL;
+    resetChannels();
 }
 ThingSpeakPublisher::ThingSpeakPublisher(Logger& baseLogger, Client* inClient,
                                          uint8_t sendEveryX, uint8_t sendOffset)
     : dataPublisher(baseLogger, inClient, sendEveryX, sendOffset) {
     // MS_DBG(F("ThingSpeakPublisher object created"));
-    _thingSpeakMQTTKey    = NULL;
-    _thingSpeakChannelID  = NULL;
-    _thingSpeakChannelKey = NULL;
+    _thingSpeakMQTTKey = NULL;
+    resetChannels();
 }
 ThingSpeakPublisher::ThingSpeakPublisher(Logger&     baseLogger,
                                          const char* thingSpeakMQTTKey,
@@ -52,6 +60,7 @@ ThingSpeakPublisher::ThingSpeakPublisher(Logger&     baseLogger,
                                          const char* thingSpeakChannelKey,
                                          uint8_t sendEveryX, uint8_t sendOffset)
     : dataPublisher(baseLogger, sendEveryX, sendOffset) {
+    resetChannels();
     setMQTTKey(thingSpeakMQTTKey);
     setChannelID(thingSpeakChannelID);
     setChannelKey(thingSpeakChannelKey);
@@ -63,6 +72,7 @@ ThingSpeakPublisher::ThingSpeakPublisher(Logger& baseLogger, Client* inClient,
                                          const char* thingSpeakChannelKey,
                                          uint8_t sendEveryX, uint8_t sendOffset)
     : dataPublisher(baseLogger, inClient, sendEveryX, sendOffset) {
+    resetChannels();
     setMQTTKey(thingSpeakMQTTKey);
     setChannelID(thingSpeakChannelID);
     setChannelKey(thingSpeakChannelKey);
@@ -72,20 +82,36 @@ ThingSpeakPublisher::ThingSpeakPublisher(Logger& baseLogger, Client* inClient,
 ThingSpeakPublisher::~ThingSpeakPublisher() {}
 
 
+void ThingSpeakPublisher::resetChannels(void) {
+    for (uint8_t i = 0; i < MS_THINGSPEAK_MAX_CHANNELS; i++) {
+        _channelID[i]       = NULL;
+        _channelKey[i]      = NULL;
+        _channelLastSent[i] = 0;
+    }
+    _channelCount = 0;
+    _bulkUpdate   = false;
+    _bulkHost     = bulkHost;
+    _bulkPort     = 80;
+}
+
+
 void ThingSpeakPublisher::setMQTTKey(const char* thingSpeakMQTTKey) {
     _thingSpeakMQTTKey = thingSpeakMQTTKey;
     // MS_DBG(F("MQTT Key set!"));
 }
 
 
+// The first channel is the one set by the single-channel functions
 void ThingSpeakPublisher::setChannelID(const char* thingSpeakChannelID) {
-    _thingSpeakChannelID = thingSpeakChannelID;
+    _channelID[0] = thingSpeakChannelID;
+    if (_channelCount == 0) { _channelCount = 1; }
     // MS_DBG(F("Channel ID set!"));
 }
 
 
 void ThingSpeakPublisher::setChannelKey(const char* thingSpeakChannelKey) {
-    _thingSpeakChannelKey = thingSpeakChannelKey;
+    _channelKey[0] = thingSpeakChannelKey;
+    if (_channelCount == 0) { _channelCount = 1; }
     // MS_DBG(F("Channel Key set!"));
 }
 
@@ -99,6 +125,34 @@ void ThingSpeakPublisher::setThingSpeakParams(const char* MQTTKey,
 }
 
 
+// Adds a channel for the next 8 variables
+bool ThingSpeakPublisher::addChannel(const char* channelID,
+                                     const char* channelKey) {
+    if (_channelCount >= MS_THINGSPEAK_MAX_CHANNELS) {
+        PRINTOUT(F("No more than"), MS_THINGSPEAK_MAX_CHANNELS,
+                 F("ThingSpeak channels can be used!"));
+        return false;
+    }
+    _channelID[_channelCount]       = channelID;
+    _channelKey[_channelCount]      = channelKey;
+    _channelLastSent[_channelCount] = 0;
+    _channelCount++;
+    MS_DBG(F("ThingSpeak channel"), _channelCount, F("added"));
+    return true;
+}
+
+
+void ThingSpeakPublisher::setBulkUpdate(bool enable) {
+    _bulkUpdate = enable;
+}
+
+
+void ThingSpeakPublisher::setBulkServer(const char* host, uint16_t port) {
+    _bulkHost = host;
+    _bulkPort = port;
+}
+
+
 // A way to begin with everything already set
 void ThingSpeakPublisher::begin(Logger& baseLogger, Client* inClient,
                                 const char* thingSpeakMQTTKey,
@@ -120,49 +174,41 @@ void ThingSpeakPublisher::begin(Logger&     baseLogger,
 }
 
 
+// Each channel takes the next 8 variables
+uint8_t ThingSpeakPublisher::getFieldCount(uint8_t channel) {
+    uint8_t varCount = _baseLogger->getArrayVarCount();
+    if (channel * 8 >= varCount) { return 0; }
+    return min(varCount - channel * 8, 8);
+}
+
+
 // This sends the data to ThingSpeak
 // bool ThingSpeakPublisher::mqttThingSpeak(void)
 int16_t ThingSpeakPublisher::publishData(Client* outClient) {
+    // Bulk updates send the live values as a single update
+    if (_bulkUpdate) {
+        int16_t retVal = 0;
+        for (uint8_t c = 0; c < _channelCount; c++) {
+            if (getFieldCount(c) == 0) { break; }
+            retVal = publishBulkUpdate(outClient, c, 0, 0);
+        }
+        return retVal;
+    }
+
     bool retVal = false;
 
     // Make sure we don't have too many fields
     // A channel can have a max of 8 fields
-    if (_baseLogger->getArrayVarCount() > 8) {
+    if (_baseLogger->getArrayVarCount() > 8 * _channelCount) {
         MS_DBG(F("No more than 8 fields of data can be sent to a single "
                  "ThingSpeak channel!"));
-        MS_DBG(F("Only the first 8 fields worth of data will be sent."));
+        MS_DBG(F("Only the first"), 8 * _channelCount,
+               F("fields worth of data will be sent."));
     }
-    uint8_t numChannels = min(_baseLogger->getArrayVarCount(), 8);
-    MS_DBG(numChannels, F("fields will be sent to ThingSpeak"));
 
     // Create a buffer for the portions of the request and response
     char tempBuffer[26] = "";
 
-    char topicBuffer[42] = "channels/";
-    strcat(topicBuffer, _thingSpeakChannelID);
-    strcat(topicBuffer, "/publish/");
-    strcat(topicBuffer, _thingSpeakChannelKey);
-    MS_DBG(F("Topic ["), strlen(topicBuffer), F("]:"), String(topicBuffer));
-
-    emptyTxBuffer();
-
-    _baseLogger->formatDateTime_ISO8601(Logger::markedEpochTime)
-        .toCharArray(tempBuffer, 26);
-    strcat(txBuffer, "created_at=");
-    strcat(txBuffer, tempBuffer);
-    txBuffer[strlen(txBuffer)] = '&';
-
-    for (uint8_t i = 0; i < numChannels; i++) {
-        strcat(txBuffer, "field");
-        itoa(i + 1, tempBuffer, 10);  // BASE 10
-        strcat(txBuffer, tempBuffer);
-        txBuffer[strlen(txBuffer)] = '=';
-        _baseLogger->getValueStringAtI(i).toCharArray(tempBuffer, 26);
-        strcat(txBuffer, tempBuffer);
-        if (i + 1 != numChannels) { txBuffer[strlen(txBuffer)] = '&'; }
-    }
-    MS_DBG(F("Message ["), strlen(txBuffer), F("]:"), String(txBuffer));
-
     // Set the client connection parameters
     _mqttClient.setClient(*outClient);
     _mqttClient.setServer(mqttServer, mqttPort);
@@ -183,14 +229,48 @@ int16_t ThingSpeakPublisher::publishData(Client* outClient) {
     if (_mqttClient.connect(mqttClientName, mqttUser, _thingSpeakMQTTKey)) {
         MS_DBG(F("MQTT connected after"), MS_PRINT_DEBUG_TIMER, F("ms"));
 
-        if (_mqttClient.publish(topicBuffer, txBuffer)) {
-            PRINTOUT(F("ThingSpeak topic published!  Current state:"),
-                     parseMQTTState(_mqttClient.state()));
-            retVal = true;
-        } else {
-            PRINTOUT(F("MQTT publish failed with state:"),
-                     parseMQTTState(_mqttClient.state()));
-            retVal = false;
+        // Publish each channel's fields on the same connection
+        retVal = true;
+        for (uint8_t c = 0; c < _channelCount && retVal; c++) {
+            uint8_t numFields = getFieldCount(c);
+            if (numFields == 0) { break; }
+            MS_DBG(numFields, F("fields will be sent to ThingSpeak channel"),
+                   _channelID[c]);
+
+            char topicBuffer[42] = "channels/";
+            strcat(topicBuffer, _channelID[c]);
+            strcat(topicBuffer, "/publish/");
+            strcat(topicBuffer, _channelKey[c]);
+            MS_DBG(F("Topic ["), strlen(topicBuffer), F("]:"),
+                   String(topicBuffer));
+
+            emptyTxBuffer();
+
+            strcat(txBuffer, "created_at=");
+            strcat(txBuffer, Logger::formatMarkedTime_ISO8601());
+            txBuffer[strlen(txBuffer)] = '&';
+
+            for (uint8_t i = 0; i < numFields; i++) {
+                strcat(txBuffer, "field");
+                itoa(i + 1, tempBuffer, 10);  // BASE 10
+                strcat(txBuffer, tempBuffer);
+                txBuffer[strlen(txBuffer)] = '=';
+                _baseLogger->getValueStringAtI(c * 8 + i)
+                    .toCharArray(tempBuffer, 26);
+                strcat(txBuffer, tempBuffer);
+                if (i + 1 != numFields) { txBuffer[strlen(txBuffer)] = '&'; }
+            }
+            MS_DBG(F("Message ["), strlen(txBuffer), F("]:"),
+                   String(txBuffer));
+
+            if (_mqttClient.publish(topicBuffer, txBuffer)) {
+                PRINTOUT(F("ThingSpeak topic published!  Current state:"),
+                         parseMQTTState(_mqttClient.state()));
+            } else {
+                PRINTOUT(F("MQTT publish failed with state:"),
+                         parseMQTTState(_mqttClient.state()));
+                retVal = false;
+            }
         }
     } else {
         PRINTOUT(F("MQTT connection failed with state:"),
@@ -206,3 +286,193 @@ int16_t ThingSpeakPublisher::publishData(Client* outClient) {
     MS_DBG(F("Disconnected after"), MS_PRINT_DEBUG_TIMER, F("ms"));
     return retVal;
 }
+
+
+// This sends every record kept since each channel's last accepted update in
+// one bulk update per channel
+int16_t ThingSpeakPublisher::publishCachedData(void) {
+    if (!_bulkUpdate) { return dataPublisher::publishCachedData(); }
+    if (_inClient == NULL) {
+        PRINTOUT(F("ERROR! No web client assigned to publish data!"));
+        return 0;
+    }
+
+    uint32_t oldest = _baseLogger->getOldestCachedRecord();
+    uint32_t newest = _baseLogger->getNewestCachedRecord();
+    // If the logger can't keep records, all that can be sent is the live data
+    if (newest == 0) { return publishData(_inClient); }
+
+    int16_t  retVal     = 0;
+    uint32_t lowestSent = newest;
+    for (uint8_t c = 0; c < _channelCount; c++) {
+        if (getFieldCount(c) == 0) { break; }
+        // A record number past the newest means the cache was started over
+        if (_channelLastSent[c] > newest) { _channelLastSent[c] = 0; }
+        uint32_t first = oldest;
+        if (first <= _channelLastSent[c]) { first = _channelLastSent[c] + 1; }
+        if (first <= newest) {
+            MS_DBG(F("Sending records"), first, F("to"), newest,
+                   F("to ThingSpeak channel"), _channelID[c]);
+            int16_t responseCode = publishBulkUpdate(_inClient, c, first,
+                                                     newest);
+            if (wasPublished(responseCode)) {
+                _channelLastSent[c] = newest;
+                if (retVal == 0) { retVal = responseCode; }
+            } else {
+                retVal = responseCode;
+            }
+        }
+        if (_channelLastSent[c] < lowestSent) {
+            lowestSent = _channelLastSent[c];
+        }
+        // Stop if this publisher has used up its time
+        if (!TaskWatch::yield()) { break; }
+    }
+    _lastSentRecord = lowestSent;
+    return retVal;
+}
+
+
+// Every channel starts again from the oldest record kept
+void ThingSpeakPublisher::resetSentRecords(void) {
+    dataPublisher::resetSentRecords();
+    for (uint8_t c = 0; c < MS_THINGSPEAK_MAX_CHANNELS; c++) {
+        _channelLastSent[c] = 0;
+    }
+}
+
+
+// The MQTT publish returns true, and ThingSpeak accepts bulk updates with 202
+bool ThingSpeakPublisher::wasPublished(int16_t result) {
+    return _bulkUpdate ? result == 202 : result != 0;
+}
+
+
+// The same function both counts the body for the content length and prints it
+uint32_t ThingSpeakPublisher::printBulkBody(Client* outClient, uint8_t channel,
+                                            uint32_t first, uint32_t last) {
+    char     tempBuffer[26] = "";
+    uint32_t bodySize       = 0;
+    uint8_t  numFields      = getFieldCount(channel);
+    bool     firstUpdate    = true;
+
+    appendTxBuffer(outClient, bulkKeyTag, bodySize);
+    appendTxBuffer(outClient, _channelKey[channel], bodySize);
+    appendTxBuffer(outClient, bulkUpdatesTag, bodySize);
+
+    for (uint32_t n = first; n <= last; n++) {
+        // Record 0 is the live data, which needs no replay
+        if (n != 0 && !_baseLogger->replayCachedRecord(n)) { continue; }
+        if (!firstUpdate) { appendTxBuffer(outClient, ",", bodySize); }
+        firstUpdate = false;
+
+        appendTxBuffer(outClient, bulkTimestampTag, bodySize);
+        appendTxBuffer(outClient, Logger::formatMarkedTime_ISO8601(), bodySize);
+        appendTxBuffer(outClient, "\"", bodySize);
+        for (uint8_t i = 0; i < numFields; i++) {
+            strcpy(tempBuffer, ",\"field");
+            itoa(i + 1, tempBuffer + strlen(tempBuffer), 10);  // BASE 10
+            strcat(tempBuffer, "\":");
+            appendTxBuffer(outClient, tempBuffer, bodySize);
+            _baseLogger->getValueStringAtI(channel * 8 + i)
+                .toCharArray(tempBuffer, 26);
+            appendTxBuffer(outClient, tempBuffer, bodySize);
+        }
+        appendTxBuffer(outClient, "}", bodySize);
+        if (n == 0) { break; }
+    }
+    _baseLogger->endReplay();
+
+    appendTxBuffer(outClient, "]}", bodySize);
+    return bodySize;
+}
+
+
+// This posts records to a channel's bulk-update JSON API
+// The return is the http status code of the response.
+int16_t ThingSpeakPublisher::publishBulkUpdate(Client* outClient,
+                                               uint8_t channel, uint32_t first,
+                                               uint32_t last) {
+    // Create a buffer for the portions of the request and response
+    char     tempBuffer[26] = "";
+    uint16_t did_respond    = 0;
+
+    uint32_t bodySize = printBulkBody(NULL, channel, first, last);
+    MS_DBG(F("Outgoing JSON size:"), bodySize);
+
+    // Open a TCP/IP connection to the bulk-update server
+    MS_DBG(F("Connecting client"));
+    MS_START_DEBUG_TIMER;
+    if (outClient->connect(_bulkHost, _bulkPort)) {
+        MS_DBG(F("Client connected after"), MS_PRINT_DEBUG_TIMER, F("ms\n"));
+
+        // copy the initial post header into the tx buffer
+        emptyTxBuffer();
+        strcpy(txBuffer, postHeader);
+        strcat(txBuffer, bulkEndpoint);
+        strcat(txBuffer, _channelID[channel]);
+        strcat(txBuffer, bulkEndpointEnd);
+        strcat(txBuffer, HTTPtag);
+
+        // add the rest of the HTTP POST headers to the outgoing buffer
+        // before adding each line/chunk to the outgoing buffer, we make sure
+        // there is space for that line, sending out buffer if not
+        if (bufferFree() < static_cast<int>(strlen(_bulkHost) + 10)) {
+            printTxBuffer(outClient);
+        }
+        strcat(txBuffer, hostHeader);
+        strcat(txBuffer, _bulkHost);
+
+        if (bufferFree() < 30) printTxBuffer(outClient);
+        strcat(txBuffer, contentLengthHeader);
+        ultoa(bodySize, tempBuffer, 10);  // BASE 10
+        strcat(txBuffer, tempBuffer);
+
+        if (bufferFree() < 42) printTxBuffer(outClient);
+        strcat(txBuffer, contentTypeHeader);
+
+        // add the JSON body, sending the buffer out as it fills
+        printBulkBody(outClient, channel, first, last);
+
+        // Send out the finished request (or the last unsent section of it)
+        printTxBuffer(outClient, true);
+
+        // Wait 10 seconds for a response from the server
+        uint32_t waitStart = millis();
+        while ((millis() - waitStart) < 10000L && outClient->available() < 12 &&
+               TaskWatch::yield()) {
+            delay(10);
+        }
+
+        // Read only the first 12 characters of the response
+        // We're only reading as far as the http code, anything beyond that
+        // we don't care about.
+        did_respond = outClient->readBytes(tempBuffer, 12);
+
+        // Close the TCP/IP connection
+        MS_DBG(F("Stopping client"));
+        MS_RESET_DEBUG_TIMER;
+        outClient->stop();
+        MS_DBG(F("Client stopped after"), MS_PRINT_DEBUG_TIMER, F("ms"));
+    } else {
+        PRINTOUT(F("\n -- Unable to Establish Connection to ThingSpeak --"));
+    }
+
+    // Process the HTTP response
+    int16_t responseCode = 0;
+    if (did_respond > 0) {
+        char responseCode_char[4];
+        for (uint8_t i = 0; i < 3; i++) {
+            responseCode_char[i] = tempBuffer[i + 9];
+        }
+        responseCode_char[3] = '\0';
+        responseCode         = atoi(responseCode_char);
+    } else {
+        responseCode = 504;
+    }
+
+    PRINTOUT(F("-- Response Code --"));
+    PRINTOUT(responseCode);
+
+    return responseCode;
+}
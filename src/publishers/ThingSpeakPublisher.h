@@ -33,6 +33,17 @@
  */
 #define THING_SPEAK_CLIENT_NAME "MS"
 
+/**
+ * @brief The most ThingSpeak channels one publisher can fill; each channel
+ * takes the next 8 variables.
+ *
+ * This can be changed by setting the build flag MS_THINGSPEAK_MAX_CHANNELS
+ * when compiling.
+ */
+#ifndef MS_THINGSPEAK_MAX_CHANNELS
+#define MS_THINGSPEAK_MAX_CHANNELS 4
+#endif
+
 // Included Dependencies
 #include "ModSensorDebugger.h"
 #undef MS_DEBUGGING_STD
@@ -58,6 +69,17 @@
  * be "Field3".  Any text names you have given to your fields in ThingSpeak are
  * also irrelevant.
  *
+ * A channel holds at most 8 fields.  To send more than 8 variables, add more
+ * channels with addChannel(); the ninth to sixteenth variables go to the
+ * second channel as Field1 to Field8, and so on.  Variables beyond the last
+ * channel are not sent.
+ *
+ * By default, each record is published over MQTT.  With setBulkUpdate(), all
+ * of the records kept by the logger since the last send are instead posted
+ * to each channel's bulk-update JSON API in a single request.  How many records
+ * the logger keeps is set by #MS_PUBLISH_CACHE_RECORDS and
+ * #MS_PUBLISH_CACHE_VALUES.
+ *
  * @ingroup the_publishers
  */
 class ThingSpeakPublisher : public dataPublisher {
@@ -76,11 +98,10 @@ class ThingSpeakPublisher : public dataPublisher {
      * logger.
      *
      * @param baseLogger The logger supplying the data to be published
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -97,11 +118,10 @@ class ThingSpeakPublisher : public dataPublisher {
      * @param inClient An Arduino client instance to use to print data to.
      * Allows the use of any type of client and multiple clients tied to a
      * single TinyGSM modem instance
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -118,10 +138,10 @@ class ThingSpeakPublisher : public dataPublisher {
      * @param thingSpeakMQTTKey Your MQTT API Key from Account > MyProfile.
      * @param thingSpeakChannelID The numeric channel id for your channel
      * @param thingSpeakChannelKey The write API key for your channel
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      */
     ThingSpeakPublisher(Logger& baseLogger, const char* thingSpeakMQTTKey,
                         const char* thingSpeakChannelID,
@@ -137,11 +157,10 @@ class ThingSpeakPublisher : public dataPublisher {
      * @param thingSpeakMQTTKey Your MQTT API Key from Account > MyProfile.
      * @param thingSpeakChannelID The numeric channel id for your channel
      * @param thingSpeakChannelKey The write API key for your channel
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      */
     ThingSpeakPublisher(Logger& baseLogger, Client* inClient,
                         const char* thingSpeakMQTTKey,
@@ -155,7 +174,7 @@ class ThingSpeakPublisher : public dataPublisher {
 
     // Returns the data destination
     String getEndpoint(void) override {
-        return String(mqttServer);
+        return String(_bulkUpdate ? _bulkHost : mqttServer);
     }
 
     /**
@@ -189,6 +208,36 @@ class ThingSpeakPublisher : public dataPublisher {
     void setThingSpeakParams(const char* MQTTKey, const char* channelID,
                              const char* channelKey);
 
+    /**
+     * @brief Add another channel for the next 8 variables.
+     *
+     * The channel set with setChannelID() and setChannelKey() gets the first
+     * 8 variables, and each channel added gets the next 8.
+     *
+     * @param channelID The numeric channel id for the channel
+     * @param channelKey The write API key for the channel
+     * @return **bool** True if the channel was added; false if there are
+     * already #MS_THINGSPEAK_MAX_CHANNELS channels.
+     */
+    bool addChannel(const char* channelID, const char* channelKey);
+
+    /**
+     * @brief Choose between publishing each record over MQTT and posting all
+     * of the waiting records to the bulk-update JSON API.
+     *
+     * @param enable True to use the bulk-update API; optional with a default
+     * value of true.
+     */
+    void setBulkUpdate(bool enable = true);
+    /**
+     * @brief Set the server the bulk updates are posted to, such as a local
+     * stand-in server for testing.
+     *
+     * @param host The host name or IP address of the server
+     * @param port The server's HTTP port; optional with a default value of 80.
+     */
+    void setBulkServer(const char* host, uint16_t port = 80);
+
     // A way to begin with everything already set
     /**
      * @copydoc dataPublisher::begin(Logger& baseLogger, Client* inClient)
@@ -212,6 +261,22 @@ class ThingSpeakPublisher : public dataPublisher {
     // This sends the data to ThingSpeak
     // bool mqttThingSpeak(void);
     int16_t publishData(Client* outClient) override;
+    /**
+     * @copydoc dataPublisher::publishCachedData()
+     *
+     * With bulk updates, every waiting record goes to each channel in a single
+     * request.
+     *
+     * @return **int16_t** The http response code of the last request to fail,
+     * or of the last request if none failed.
+     */
+    int16_t publishCachedData(void) override;
+    /**
+     * @copydoc dataPublisher::resetSentRecords()
+     *
+     * Every channel starts over.
+     */
+    void resetSentRecords(void) override;
 
  protected:
     /**
@@ -226,12 +291,78 @@ class ThingSpeakPublisher : public dataPublisher {
     static const char* mqttUser;        ///< The MQTT user name
                                         /**@}*/
 
+    /**
+     * @anchor ts_bulk_vars
+     * @name Portions of the bulk-update POST request
+     *
+     * @{
+     */
+    static const char* bulkHost;             ///< The default host name
+    static const char* bulkEndpoint;         ///< The start of the endpoint
+    static const char* bulkEndpointEnd;      ///< The end of the endpoint
+    static const char* contentLengthHeader;  ///< The content length header text
+    static const char* contentTypeHeader;    ///< The content type header text
+    static const char* bulkKeyTag;           ///< The JSON write key tag
+    static const char* bulkUpdatesTag;       ///< The JSON updates array tag
+    static const char* bulkTimestampTag;     ///< The JSON update timestamp tag
+    /**@}*/
+
+    /**
+     * @copybrief dataPublisher::wasPublished()
+     *
+     * @param result The result returned by publishData()
+     * @return **bool** True if the MQTT topics were published, or, with bulk
+     * updates, for a 202 http response code.
+     */
+    bool wasPublished(int16_t result) override;
+
+    /**
+     * @brief Get the number of fields sent to a channel.
+     *
+     * @param channel The channel, starting from 0
+     * @return **uint8_t** The number of variables sent to the channel; at most
+     * 8.
+     */
+    uint8_t getFieldCount(uint8_t channel);
+    /**
+     * @brief Post records to one channel's bulk-update JSON API.
+     *
+     * @param outClient An Arduino client instance to use to print data to.
+     * @param channel The channel, starting from 0
+     * @param first The first record to send; 0 to send the live values.
+     * @param last The last record to send
+     * @return **int16_t** The http response code
+     */
+    int16_t publishBulkUpdate(Client* outClient, uint8_t channel,
+                              uint32_t first, uint32_t last);
+    /**
+     * @brief Print the JSON body of a bulk update, or only work out its size.
+     *
+     * @param outClient The client to print to; NULL to only count the
+     * characters.
+     * @param channel The channel, starting from 0
+     * @param first The first record to send; 0 to send the live values.
+     * @param last The last record to send
+     * @return **uint32_t** The number of characters in the body
+     */
+    uint32_t printBulkBody(Client* outClient, uint8_t channel, uint32_t first,
+                           uint32_t last);
+
  private:
     // Keys for ThingSpeak
     const char*  _thingSpeakMQTTKey;
-    const char*  _thingSpeakChannelID;
-    const char*  _thingSpeakChannelKey;
+    const char*  _channelID[MS_THINGSPEAK_MAX_CHANNELS];
+    const char*  _channelKey[MS_THINGSPEAK_MAX_CHANNELS];
+    uint8_t      _channelCount;
     PubSubClient _mqttClient;
+    // The last record each channel accepted in a bulk update
+    uint32_t _channelLastSent[MS_THINGSPEAK_MAX_CHANNELS];
+    // Where and whether to send bulk updates
+    bool        _bulkUpdate;
+    const char* _bulkHost;
+    uint16_t    _bulkPort;
+    // Sets every channel and bulk update setting to its default
+    void resetChannels(void);
 };
 
 #endif  // SRC_PUBLISHERS_THINGSPEAKPUBLISHER_H_
@@ -36,23 +36,28 @@ const char* UbidotsPublisher::payload = "{";
 UbidotsPublisher::UbidotsPublisher() : dataPublisher() {
     // MS_DBG(F("dataPublisher object created"));
     _authentificationToken = NULL;
+    _batchMode             = false;
 }
 UbidotsPublisher::UbidotsPublisher(Logger& baseLogger, uint8_t sendEveryX,
                                    uint8_t sendOffset)
     : dataPublisher(baseLogger, sendEveryX, sendOffset) {
     // MS_DBG(F("dataPublisher object created"));
     _authentificationToken = NULL;
+    _batchMode             = false;
 }
 UbidotsPublisher::UbidotsPublisher(Logger& baseLogger, Client* inClient,
                                    uint8_t sendEveryX, uint8_t sendOffset)
     : dataPublisher(baseLogger, inClient, sendEveryX, sendOffset) {
     // MS_DBG(F("dataPublisher object created"));
+    _authentificationToken = NULL;
+    _batchMode             = false;
 }
 UbidotsPublisher::UbidotsPublisher(Logger&     baseLogger,
                                    const char* authentificationToken,
                                    const char* deviceID, uint8_t sendEveryX,
                                    uint8_t sendOffset)
     : dataPublisher(baseLogger, sendEveryX, sendOffset) {
+    _batchMode = false;
     setToken(authentificationToken);
     _baseLogger->setSamplingFeatureUUID(deviceID);
     MS_DBG(F("dataPublisher object created"));
@@ -62,6 +67,7 @@ UbidotsPublisher::UbidotsPublisher(Logger& baseLogger, Client* inClient,
                                    const char* deviceID, uint8_t sendEveryX,
                                    uint8_t sendOffset)
     : dataPublisher(baseLogger, inClient, sendEveryX, sendOffset) {
+    _batchMode = false;
     setToken(authentificationToken);
     _baseLogger->setSamplingFeatureUUID(deviceID);
     MS_DBG(F("dataPublisher object created"));
@@ -76,6 +82,11 @@ void UbidotsPublisher::setToken(const char* authentificationToken) {
 }
 
 
+void UbidotsPublisher::setBatchMode(bool enable) {
+    _batchMode = enable;
+}
+
+
 // Calculates how long the JSON will be
 uint16_t UbidotsPublisher::calculateJsonSize() {
     uint16_t jsonLength = 1;  // {
@@ -112,8 +123,11 @@ void UbidotsPublisher::printSensorDataJSON(Stream* stream) {
         stream->print(_baseLogger->getValueStringAtI(i));
         stream->print(",'timestamp':");
         stream->print(Logger::markedEpochTimeUTC);
-        stream->print(
-            F("000}"));  // Convert microseconds to milliseconds for ubidots
+        // Ubidots timestamps are in milliseconds
+        char millisStr[4];
+        snprintf(millisStr, sizeof(millisStr), "%03u", Logger::markedMillis);
+        stream->print(millisStr);
+        stream->print('}');
         if (i + 1 != _baseLogger->getArrayVarCount()) { stream->print(','); }
     }
 
@@ -231,7 +245,10 @@ int16_t UbidotsPublisher::publishData(Client* outClient) {
             txBuffer[strlen(txBuffer)] = ':';
             ltoa((Logger::markedEpochTimeUTC), tempBuffer, 10);  // BASE 10
             strcat(txBuffer, tempBuffer);
-            strcat(txBuffer, "000");
+            // Ubidots timestamps are in milliseconds
+            snprintf(tempBuffer, sizeof(tempBuffer), "%03u",
+                     Logger::markedMillis);
+            strcat(txBuffer, tempBuffer);
             if (i + 1 != _baseLogger->getArrayVarCount()) {
                 txBuffer[strlen(txBuffer)] = '}';
                 txBuffer[strlen(txBuffer)] = ',';
@@ -246,7 +263,8 @@ int16_t UbidotsPublisher::publishData(Client* outClient) {
 
         // Wait 10 seconds for a response from the server
         uint32_t start = millis();
-        while ((millis() - start) < 10000L && outClient->available() < 12) {
+        while ((millis() - start) < 10000L && outClient->available() < 12 &&
+               TaskWatch::yield()) {
             delay(10);
         }
 
@@ -281,3 +299,164 @@ int16_t UbidotsPublisher::publishData(Client* outClient) {
 
     return responseCode;
 }
+
+
+// This posts every record kept since the last send in one request
+int16_t UbidotsPublisher::publishCachedData(void) {
+    if (!_batchMode) { return dataPublisher::publishCachedData(); }
+    if (_inClient == NULL) {
+        PRINTOUT(F("ERROR! No web client assigned to publish data!"));
+        return 0;
+    }
+
+    uint32_t newest = _baseLogger->getNewestCachedRecord();
+    // If the logger can't keep records, all that can be sent is the live data
+    if (newest == 0) { return publishData(_inClient); }
+
+    // A record number past the newest means the cache was started over
+    if (_lastSentRecord > newest) { _lastSentRecord = 0; }
+    uint32_t first = _baseLogger->getOldestCachedRecord();
+    if (first <= _lastSentRecord) { first = _lastSentRecord + 1; }
+    if (first > newest) { return 0; }
+
+    MS_DBG(F("Sending records"), first, F("to"), newest, F("to Ubidots"));
+    int16_t responseCode = publishBatch(_inClient, first, newest);
+    // Only move on if Ubidots took the batch, so it's resent otherwise
+    if (wasPublished(responseCode)) { _lastSentRecord = newest; }
+    return responseCode;
+}
+
+
+// The same function both counts the JSON for the content length and prints it
+uint32_t UbidotsPublisher::printBatchJSON(Stream* stream, uint32_t first,
+                                          uint32_t last) {
+    char     tempBuffer[37] = "";
+    uint32_t jsonSize       = 0;
+
+    appendTxBuffer(stream, payload, jsonSize);
+    for (uint8_t i = 0; i < _baseLogger->getArrayVarCount(); i++) {
+        appendTxBuffer(stream, "\"", jsonSize);
+        _baseLogger->getVarUUIDAtI(i).toCharArray(tempBuffer, 37);
+        appendTxBuffer(stream, tempBuffer, jsonSize);
+        appendTxBuffer(stream, "\":[", jsonSize);
+
+        bool firstValue = true;
+        for (uint32_t n = first; n <= last; n++) {
+            if (!_baseLogger->replayCachedRecord(n)) { continue; }
+            appendTxBuffer(stream, firstValue ? "{\"value\":" : ",{\"value\":",
+                           jsonSize);
+            firstValue = false;
+            _baseLogger->getValueStringAtI(i).toCharArray(tempBuffer, 37);
+            appendTxBuffer(stream, tempBuffer, jsonSize);
+            appendTxBuffer(stream, ",\"timestamp\":", jsonSize);
+            ltoa((Logger::markedEpochTimeUTC), tempBuffer, 10);  // BASE 10
+            appendTxBuffer(stream, tempBuffer, jsonSize);
+            // Ubidots timestamps are in milliseconds
+            snprintf(tempBuffer, sizeof(tempBuffer), "%03u",
+                     Logger::markedMillis);
+            appendTxBuffer(stream, tempBuffer, jsonSize);
+            appendTxBuffer(stream, "}", jsonSize);
+        }
+
+        if (i + 1 != _baseLogger->getArrayVarCount()) {
+            appendTxBuffer(stream, "],", jsonSize);
+        } else {
+            appendTxBuffer(stream, "]", jsonSize);
+        }
+    }
+    _baseLogger->endReplay();
+    appendTxBuffer(stream, "}", jsonSize);
+
+    return jsonSize;
+}
+
+
+// This posts a batch of kept records to Ubidots
+// The return is the http status code of the response.
+int16_t UbidotsPublisher::publishBatch(Client* outClient, uint32_t first,
+                                       uint32_t last) {
+    // Create a buffer for the portions of the request and response
+    char     tempBuffer[37] = "";
+    uint16_t did_respond    = 0;
+
+    uint32_t jsonSize = printBatchJSON(NULL, first, last);
+    MS_DBG(F("Outgoing JSON size:"), jsonSize);
+
+    // Open a TCP/IP connection to Ubidots
+    MS_DBG(F("Connecting client"));
+    MS_START_DEBUG_TIMER;
+    if (outClient->connect(ubidotsHost, ubidotsPort)) {
+        MS_DBG(F("Client connected after"), MS_PRINT_DEBUG_TIMER, F("ms\n"));
+
+        // copy the initial post header into the tx buffer
+        emptyTxBuffer();
+        strcpy(txBuffer, postHeader);
+        strcat(txBuffer, postEndpoint);
+        strcat(txBuffer, _baseLogger->getSamplingFeatureUUID());
+        txBuffer[strlen(txBuffer)] = '/';
+        strcat(txBuffer, HTTPtag);
+
+        // add the rest of the HTTP POST headers to the outgoing buffer
+        // before adding each line/chunk to the outgoing buffer, we make sure
+        // there is space for that line, sending out buffer if not
+        if (bufferFree() < 28) printTxBuffer(outClient);
+        strcat(txBuffer, hostHeader);
+        strcat(txBuffer, ubidotsHost);
+
+        if (bufferFree() < 47) printTxBuffer(outClient);
+        strcat(txBuffer, tokenHeader);
+        strcat(txBuffer, _authentificationToken);
+
+        if (bufferFree() < 30) printTxBuffer(outClient);
+        strcat(txBuffer, contentLengthHeader);
+        ultoa(jsonSize, tempBuffer, 10);  // BASE 10
+        strcat(txBuffer, tempBuffer);
+
+        if (bufferFree() < 42) printTxBuffer(outClient);
+        strcat(txBuffer, contentTypeHeader);
+
+        // add the JSON, sending the buffer out as it fills
+        printBatchJSON(outClient, first, last);
+
+        // Send out the finished request (or the last unsent section of it)
+        printTxBuffer(outClient, true);
+
+        // Wait 10 seconds for a response from the server
+        uint32_t waitStart = millis();
+        while ((millis() - waitStart) < 10000L && outClient->available() < 12 &&
+               TaskWatch::yield()) {
+            delay(10);
+        }
+
+        // Read only the first 12 characters of the response
+        // We're only reading as far as the http code, anything beyond that
+        // we don't care about.
+        did_respond = outClient->readBytes(tempBuffer, 12);
+
+        // Close the TCP/IP connection
+        MS_DBG(F("Stopping client"));
+        MS_RESET_DEBUG_TIMER;
+        outClient->stop();
+        MS_DBG(F("Client stopped after"), MS_PRINT_DEBUG_TIMER, F("ms"));
+    } else {
+        PRINTOUT(F("\n -- Unable to Establish Connection to Ubiots --"));
+    }
+
+    // Process the HTTP response
+    int16_t responseCode = 0;
+    if (did_respond > 0) {
+        char responseCode_char[4];
+        for (uint8_t i = 0; i < 3; i++) {
+            responseCode_char[i] = tempBuffer[i + 9];
+        }
+        responseCode_char[3] = '\0';
+        responseCode         = atoi(responseCode_char);
+    } else {
+        responseCode = 504;
+    }
+
+    PRINTOUT(F("-- Response Code --"));
+    PRINTOUT(responseCode);
+
+    return responseCode;
+}
@@ -33,6 +33,10 @@
  * @brief The UbidotsPublisher subclass of dataPublisher for publishing data
  * to the Ubidots data portal at https://ubidots.com
  *
+ * By default, each record the logger kept since the last send is posted in
+ * its own request.  With setBatchMode(), all of them are posted in one
+ * request instead, with an array of values and timestamps for each variable.
+ *
  * @ingroup the_publishers
  */
 class UbidotsPublisher : public dataPublisher {
@@ -50,11 +54,10 @@ class UbidotsPublisher : public dataPublisher {
      * logger.
      *
      * @param baseLogger The logger supplying the data to be published
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -71,11 +74,10 @@ class UbidotsPublisher : public dataPublisher {
      * @param inClient An Arduino client instance to use to print data to.
      * Allows the use of any type of client and multiple clients tied to a
      * single TinyGSM modem instance
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      *
      * @note It is possible (though very unlikey) that using this constructor
      * could cause errors if the compiler attempts to initialize the publisher
@@ -95,11 +97,10 @@ class UbidotsPublisher : public dataPublisher {
      * specific device's setup panel).
      * @param deviceID The device API Label from Ubidots, derived from the
      * user-specified device name.
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      */
     UbidotsPublisher(Logger& baseLogger, const char* authentificationToken,
                      const char* deviceID, uint8_t sendEveryX = 1,
@@ -117,11 +118,10 @@ class UbidotsPublisher : public dataPublisher {
      * specific device's setup panel).
      * @param deviceID The device API Label from Ubidots, derived from the
      * user-specified device name.
-     * @param sendEveryX Currently unimplemented, intended for future use to
-     * enable caching and bulk publishing
-     * @param sendOffset Currently unimplemented, intended for future use to
-     * enable publishing data at a time slightly delayed from when it is
-     * collected
+     * @param sendEveryX Send the data every X logging intervals, with all of
+     * the records kept since the last send; optional with a default value of 1
+     * @param sendOffset Which interval, from 0 to sendEveryX - 1, to send on,
+     * so endpoints can take turns; optional with a default value of 0
      */
     UbidotsPublisher(Logger& baseLogger, Client* inClient,
                      const char* authentificationToken, const char* deviceID,
@@ -147,6 +147,15 @@ class UbidotsPublisher : public dataPublisher {
      */
     void setToken(const char* authentificationToken);
 
+    /**
+     * @brief Choose between posting each kept record in its own request and
+     * posting all of them in one request.
+     *
+     * @param enable True to post all of the kept records in one request;
+     * optional with a default value of true.
+     */
+    void setBatchMode(bool enable = true);
+
     /**
      * @brief Calculates how long the outgoing JSON will be
      *
@@ -217,6 +226,12 @@ class UbidotsPublisher : public dataPublisher {
      * @return **int16_t** The http status code of the response.
      */
     int16_t publishData(Client* outClient) override;
+    /**
+     * @copydoc dataPublisher::publishCachedData()
+     *
+     * In batch mode, every waiting record is posted in a single request.
+     */
+    int16_t publishCachedData(void) override;
 
  protected:
     /**
@@ -244,9 +259,35 @@ class UbidotsPublisher : public dataPublisher {
     static const char* payload;  ///< The JSON initial characters
     /**@}*/
 
+    /**
+     * @brief Print the JSON for a batch of kept records, or only work out its
+     * size.
+     *
+     * Each variable gets an array with a value and timestamp from each
+     * record.
+     *
+     * @param stream The Arduino stream to write out the JSON to; NULL to only
+     * count the characters.
+     * @param first The first record to include
+     * @param last The last record to include
+     * @return **uint32_t** The number of characters in the JSON object.
+     */
+    uint32_t printBatchJSON(Stream* stream, uint32_t first, uint32_t last);
+    /**
+     * @brief Post a batch of kept records to Ubidots in one request.
+     *
+     * @param outClient An Arduino client instance to use to print data to.
+     * @param first The first record to post
+     * @param last The last record to post
+     * @return **int16_t** The http status code of the response.
+     */
+    int16_t publishBatch(Client* outClient, uint32_t first, uint32_t last);
+
  private:
     // Tokens for Ubidots
     const char* _authentificationToken;
+    // Whether to post all kept records in one request
+    bool _batchMode;
 };
 
 #endif  // SRC_PUBLISHERS_UBIDOTSPUBLISHER_H_
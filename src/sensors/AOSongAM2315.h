@@ -231,6 +231,10 @@ class AOSongAM2315 : public Sensor {
      * @brief An internal reference to the hardware Wire instance.
      */
     TwoWire* _i2c;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<AM2315_NUM_VARIABLES> _results;
 };
 
 
@@ -258,8 +262,8 @@ class AOSongAM2315_Humidity : public Variable {
         const char* varCode = AM2315_HUMIDITY_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)AM2315_HUMIDITY_VAR_NUM,
                    (uint8_t)AM2315_HUMIDITY_RESOLUTION,
-                   AM2315_HUMIDITY_VAR_NAME, AM2315_HUMIDITY_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(AM2315_HUMIDITY_VAR_NAME), F(AM2315_HUMIDITY_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new AOSongAM2315_Humidity object.
      *
@@ -268,7 +272,7 @@ class AOSongAM2315_Humidity : public Variable {
     AOSongAM2315_Humidity()
         : Variable((const uint8_t)AM2315_HUMIDITY_VAR_NUM,
                    (uint8_t)AM2315_HUMIDITY_RESOLUTION,
-                   AM2315_HUMIDITY_VAR_NAME, AM2315_HUMIDITY_UNIT_NAME,
+                   F(AM2315_HUMIDITY_VAR_NAME), F(AM2315_HUMIDITY_UNIT_NAME),
                    AM2315_HUMIDITY_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AOSongAM2315_Humidity object - no action needed.
@@ -299,8 +303,8 @@ class AOSongAM2315_Temp : public Variable {
     explicit AOSongAM2315_Temp(AOSongAM2315* parentSense, const char* uuid = "",
                                const char* varCode = AM2315_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)AM2315_TEMP_VAR_NUM,
-                   (uint8_t)AM2315_TEMP_RESOLUTION, AM2315_TEMP_VAR_NAME,
-                   AM2315_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)AM2315_TEMP_RESOLUTION, F(AM2315_TEMP_VAR_NAME),
+                   F(AM2315_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AOSongAM2315_Temp object.
      *
@@ -308,8 +312,8 @@ class AOSongAM2315_Temp : public Variable {
      */
     AOSongAM2315_Temp()
         : Variable((const uint8_t)AM2315_TEMP_VAR_NUM,
-                   (uint8_t)AM2315_TEMP_RESOLUTION, AM2315_TEMP_VAR_NAME,
-                   AM2315_TEMP_UNIT_NAME, AM2315_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)AM2315_TEMP_RESOLUTION, F(AM2315_TEMP_VAR_NAME),
+                   F(AM2315_TEMP_UNIT_NAME), AM2315_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AOSongAM2315_Temp object - no action needed.
      */
@@ -17,6 +17,7 @@ AOSongDHT::AOSongDHT(int8_t powerPin, int8_t dataPin, DHTtype type,
              DHT_STABILIZATION_TIME_MS, DHT_MEASUREMENT_TIME_MS, powerPin,
              dataPin, measurementsToAverage),
       dht_internal(dataPin, type) {
+    setResultArrays(_results);
     _dhtType = type;
 }
 // Destructor - does nothing.
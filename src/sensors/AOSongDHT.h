@@ -246,6 +246,10 @@ class AOSongDHT : public Sensor {
  private:
     DHT     dht_internal;
     DHTtype _dhtType;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<DHT_NUM_VARIABLES> _results;
 };
 
 
@@ -271,8 +275,8 @@ class AOSongDHT_Humidity : public Variable {
     explicit AOSongDHT_Humidity(AOSongDHT* parentSense, const char* uuid = "",
                                 const char* varCode = DHT_HUMIDITY_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DHT_HUMIDITY_VAR_NUM,
-                   (uint8_t)DHT_HUMIDITY_RESOLUTION, DHT_HUMIDITY_VAR_NAME,
-                   DHT_HUMIDITY_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DHT_HUMIDITY_RESOLUTION, F(DHT_HUMIDITY_VAR_NAME),
+                   F(DHT_HUMIDITY_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AOSongDHT_Humidity object.
      *
@@ -280,8 +284,8 @@ class AOSongDHT_Humidity : public Variable {
      */
     AOSongDHT_Humidity()
         : Variable((const uint8_t)DHT_HUMIDITY_VAR_NUM,
-                   (uint8_t)DHT_HUMIDITY_RESOLUTION, DHT_HUMIDITY_VAR_NAME,
-                   DHT_HUMIDITY_UNIT_NAME, DHT_HUMIDITY_DEFAULT_CODE) {}
+                   (uint8_t)DHT_HUMIDITY_RESOLUTION, F(DHT_HUMIDITY_VAR_NAME),
+                   F(DHT_HUMIDITY_UNIT_NAME), DHT_HUMIDITY_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AOSongDHT_Humidity object - no action needed.
      */
@@ -312,8 +316,8 @@ class AOSongDHT_Temp : public Variable {
     explicit AOSongDHT_Temp(AOSongDHT* parentSense, const char* uuid = "",
                             const char* varCode = DHT_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DHT_TEMP_VAR_NUM,
-                   (uint8_t)DHT_TEMP_RESOLUTION, DHT_TEMP_VAR_NAME,
-                   DHT_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DHT_TEMP_RESOLUTION, F(DHT_TEMP_VAR_NAME),
+                   F(DHT_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AOSongDHT_Temp object.
      *
@@ -321,8 +325,8 @@ class AOSongDHT_Temp : public Variable {
      */
     AOSongDHT_Temp()
         : Variable((const uint8_t)DHT_TEMP_VAR_NUM,
-                   (uint8_t)DHT_TEMP_RESOLUTION, DHT_TEMP_VAR_NAME,
-                   DHT_TEMP_UNIT_NAME, DHT_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)DHT_TEMP_RESOLUTION, F(DHT_TEMP_VAR_NAME),
+                   F(DHT_TEMP_UNIT_NAME), DHT_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AOSongDHT_Temp object - no action needed.
      */
@@ -353,8 +357,8 @@ class AOSongDHT_HI : public Variable {
     explicit AOSongDHT_HI(AOSongDHT* parentSense, const char* uuid = "",
                           const char* varCode = DHT_HI_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DHT_HI_VAR_NUM,
-                   (uint8_t)DHT_HI_RESOLUTION, DHT_HI_VAR_NAME,
-                   DHT_HI_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DHT_HI_RESOLUTION, F(DHT_HI_VAR_NAME),
+                   F(DHT_HI_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AOSongDHT_HI object.
      *
@@ -362,7 +366,8 @@ class AOSongDHT_HI : public Variable {
      */
     AOSongDHT_HI()
         : Variable((const uint8_t)DHT_HI_VAR_NUM, (uint8_t)DHT_HI_RESOLUTION,
-                   DHT_HI_VAR_NAME, DHT_HI_UNIT_NAME, DHT_HI_DEFAULT_CODE) {}
+                   F(DHT_HI_VAR_NAME), F(DHT_HI_UNIT_NAME),
+                   DHT_HI_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AOSongDHT_HI object - no action needed.
      */
@@ -20,10 +20,14 @@ AnalogElecConductivity::AnalogElecConductivity(int8_t powerPin, int8_t dataPin,
              ANALOGELECCONDUCTIVITY_STABILIZATION_TIME_MS,
              ANALOGELECCONDUCTIVITY_MEASUREMENT_TIME_MS, powerPin, dataPin,
              measurementsToAverage) {
+    setResultArrays(_results);
     _EcPowerPin     = powerPin;
     _EcAdcPin       = dataPin;
     _Rseries_ohms   = Rseries_ohms;
     _sensorEC_Konst = sensorEC_Konst;
+#if defined MS_USE_FIXED_POINT
+    updateFixedScale();
+#endif
 }
 // Destructor
 AnalogElecConductivity::~AnalogElecConductivity() {}
@@ -35,6 +39,16 @@ String AnalogElecConductivity::getSensorLocation(void) {
 }
 
 
+#if defined MS_USE_FIXED_POINT
+void AnalogElecConductivity::updateFixedScale(void) {
+    // The scale is multiplied by at most (ANALOG_EC_ADC_RANGE - 1), so
+    // analogEcScaleToFixed() refuses any that are too large for that to fit
+    _ecScaleFixed = analogEcScaleToFixed(
+        1000000 / (_Rseries_ohms * _sensorEC_Konst), ANALOG_EC_ADC_RANGE);
+}
+#endif
+
+
 float AnalogElecConductivity::readEC() {
     return readEC(_EcAdcPin);
 }
@@ -68,6 +82,21 @@ float AnalogElecConductivity::readEC(uint8_t analogPinNum) {
         sensorEC_adc = 1;
     }
 
+#if defined MS_USE_FIXED_POINT
+    if (_ecScaleFixed > 0) {
+        // Substituting the resistance calculation below into the EC
+        // calculation gives:
+        //   EC = (1000000 / (Rseries * K)) * (ADC_RANGE - adc) / adc
+        // The first term is constant, so this is one integer multiply and one
+        // integer divide.
+        uint32_t EC_fixed = analogEcFromCounts(
+            sensorEC_adc, ANALOG_EC_ADC_RANGE, _ecScaleFixed);
+        EC_uScm = EC_fixed * (1.0f / 256);
+        MS_DEEP_DBG("cond=", EC_uScm);
+        return EC_uScm;
+    }
+#endif
+
     // Estimate Resistance of Liquid
 
     // see the header for an explanation of this calculation
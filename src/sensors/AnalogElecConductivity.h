@@ -357,6 +357,9 @@ class AnalogElecConductivity : public Sensor {
      */
     void setEC_k(float sourceResistance_ohms) {
         _Rseries_ohms = sourceResistance_ohms;
+#if defined MS_USE_FIXED_POINT
+        updateFixedScale();
+#endif
     }
 
     /**
@@ -386,6 +389,22 @@ class AnalogElecConductivity : public Sensor {
 
     /// @brief the cell constant for the circuit
     float _sensorEC_Konst = SENSOREC_KONST_DEF;
+
+#if defined MS_USE_FIXED_POINT
+    /// @brief 1000000 / (#_Rseries_ohms * #_sensorEC_Konst) as an unsigned
+    /// integer with 8 fractional bits; 0 if it is too large for the
+    /// integer calculation.
+    uint32_t _ecScaleFixed;
+    /**
+     * @brief Recalculate #_ecScaleFixed after the series resistance or cell
+     * constant changes.
+     */
+    void updateFixedScale(void);
+#endif
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ANALOGELECCONDUCTIVITY_NUM_VARIABLES> _results;
 };
 
 /**
@@ -413,8 +432,8 @@ class AnalogElecConductivity_EC : public Variable {
         : Variable(parentSense,
                    (const uint8_t)ANALOGELECCONDUCTIVITY_EC_VAR_NUM,
                    (uint8_t)ANALOGELECCONDUCTIVITY_EC_RESOLUTION,
-                   ANALOGELECCONDUCTIVITY_EC_VAR_NAME,
-                   ANALOGELECCONDUCTIVITY_EC_UNIT_NAME, varCode, uuid) {}
+                   F(ANALOGELECCONDUCTIVITY_EC_VAR_NAME),
+                   F(ANALOGELECCONDUCTIVITY_EC_UNIT_NAME), varCode, uuid) {}
 
     /**
      * @brief Construct a new AnalogElecConductivity_EC object.
@@ -425,8 +444,8 @@ class AnalogElecConductivity_EC : public Variable {
     AnalogElecConductivity_EC()
         : Variable((const uint8_t)ANALOGELECCONDUCTIVITY_EC_VAR_NUM,
                    (uint8_t)ANALOGELECCONDUCTIVITY_EC_RESOLUTION,
-                   ANALOGELECCONDUCTIVITY_EC_VAR_NAME,
-                   ANALOGELECCONDUCTIVITY_EC_UNIT_NAME,
+                   F(ANALOGELECCONDUCTIVITY_EC_VAR_NAME),
+                   F(ANALOGELECCONDUCTIVITY_EC_UNIT_NAME),
                    ANALOGELECCONDUCTIVITY_EC_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AnalogElecConductivity_EC object - no action needed.
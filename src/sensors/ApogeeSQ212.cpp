@@ -21,6 +21,7 @@ ApogeeSQ212::ApogeeSQ212(int8_t powerPin, uint8_t adsChannel,
     : Sensor("ApogeeSQ212", SQ212_NUM_VARIABLES, SQ212_WARM_UP_TIME_MS,
              SQ212_STABILIZATION_TIME_MS, SQ212_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
+    setResultArrays(_results);
     _adsChannel = adsChannel;
     _i2cAddress = i2cAddress;
 }
@@ -45,6 +46,7 @@ bool ApogeeSQ212::addSingleMeasurementResult(void) {
     // Variables to store the results in
     float adcVoltage  = -9999;
     float calibResult = -9999;
+    bool  success     = false;
 
     // Check a measurement was *successfully* started (status bit 6 set)
     // Only go on to get a result if it was
@@ -76,6 +78,37 @@ bool ApogeeSQ212::addSingleMeasurementResult(void) {
         // Begin ADC
         ads.begin();
 
+#if defined MS_USE_FIXED_POINT
+        // Read Analog to Digital Converter (ADC)
+        // Taking this reading includes the 8ms conversion delay.
+        // We get the raw counts and do the bit-to-volts conversion ourselves
+        // in fixed point
+        fixed_q16_t adcVoltageFixed =
+            adsGainOneCountsToFixedVolts(ads.readADC_SingleEnded(_adsChannel));
+        MS_DBG(F("  ads.readADC_SingleEnded("), _adsChannel, F("): "),
+               fixedToFloat(adcVoltageFixed), F("V"));
+
+        if (adcVoltageFixed < floatToFixed(3.6) &&
+            adcVoltageFixed > floatToFixed(-0.3)) {
+            // Skip results out of range
+            success = true;
+            verifyAndAddFixedResult(SQ212_VOLTAGE_VAR_NUM, adcVoltageFixed);
+            // Apogee SQ-212 Calibration Factor = 1.0 μmol m-2 s-1 per mV;
+            // The calibration factor is a constant, so this check and the
+            // conversion of the factor are done by the compiler
+            if (fitsInFixed(3.6 * 1000 * SQ212_CALIBRATION_FACTOR)) {
+                fixed_q16_t calibResultFixed = fixedMul(
+                    adcVoltageFixed,
+                    floatToFixed(1000 * SQ212_CALIBRATION_FACTOR));
+                MS_DBG(F("  calibResult:"), fixedToFloat(calibResultFixed));
+                verifyAndAddFixedResult(SQ212_PAR_VAR_NUM, calibResultFixed);
+            } else {
+                calibResult = 1000 * fixedToFloat(adcVoltageFixed) *
+                    SQ212_CALIBRATION_FACTOR;
+                MS_DBG(F("  calibResult:"), calibResult);
+            }
+        }
+#else
         // Read Analog to Digital Converter (ADC)
         // Taking this reading includes the 8ms conversion delay.
         // We're allowing the ADS1115 library to do the bit-to-volts conversion
@@ -87,6 +120,7 @@ bool ApogeeSQ212::addSingleMeasurementResult(void) {
 
         if (adcVoltage < 3.6 && adcVoltage > -0.3) {
             // Skip results out of range
+            success = true;
             // Apogee SQ-212 Calibration Factor = 1.0 μmol m-2 s-1 per mV;
             calibResult = 1000 * adcVoltage * SQ212_CALIBRATION_FACTOR;
             MS_DBG(F("  calibResult:"), calibResult);
@@ -94,10 +128,13 @@ bool ApogeeSQ212::addSingleMeasurementResult(void) {
             // set invalid voltages back to -9999
             adcVoltage = -9999;
         }
+#endif
     } else {
         MS_DBG(getSensorNameAndLocation(), F("is not currently measuring!"));
     }
 
+    // With fixed point, the good results have already been added and these are
+    // -9999 unless the calibration had to be done as a float
     verifyAndAddMeasurementResult(SQ212_PAR_VAR_NUM, calibResult);
     verifyAndAddMeasurementResult(SQ212_VOLTAGE_VAR_NUM, adcVoltage);
 
@@ -106,9 +143,5 @@ bool ApogeeSQ212::addSingleMeasurementResult(void) {
     // Unset the status bits for a measurement request (bits 5 & 6)
     _sensorStatus &= 0b10011111;
 
-    if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-        return true;
-    } else {
-        return false;
-    }
+    return success;
 }
@@ -262,6 +262,10 @@ class ApogeeSQ212 : public Sensor {
  private:
     uint8_t _adsChannel;
     uint8_t _i2cAddress;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<SQ212_NUM_VARIABLES> _results;
 };
 
 
@@ -289,8 +293,8 @@ class ApogeeSQ212_PAR : public Variable {
     explicit ApogeeSQ212_PAR(ApogeeSQ212* parentSense, const char* uuid = "",
                              const char* varCode = SQ212_PAR_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)SQ212_PAR_VAR_NUM,
-                   (uint8_t)SQ212_PAR_RESOLUTION, SQ212_PAR_VAR_NAME,
-                   SQ212_PAR_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)SQ212_PAR_RESOLUTION, F(SQ212_PAR_VAR_NAME),
+                   F(SQ212_PAR_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ApogeeSQ212_PAR object.
      *
@@ -298,8 +302,8 @@ class ApogeeSQ212_PAR : public Variable {
      */
     ApogeeSQ212_PAR()
         : Variable((const uint8_t)SQ212_PAR_VAR_NUM,
-                   (uint8_t)SQ212_PAR_RESOLUTION, SQ212_PAR_VAR_NAME,
-                   SQ212_PAR_UNIT_NAME, SQ212_PAR_DEFAULT_CODE) {}
+                   (uint8_t)SQ212_PAR_RESOLUTION, F(SQ212_PAR_VAR_NAME),
+                   F(SQ212_PAR_UNIT_NAME), SQ212_PAR_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ApogeeSQ212_PAR object - no action needed.
      */
@@ -332,8 +336,8 @@ class ApogeeSQ212_Voltage : public Variable {
         ApogeeSQ212* parentSense, const char* uuid = "",
         const char* varCode = SQ212_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)SQ212_VOLTAGE_VAR_NUM,
-                   (uint8_t)SQ212_VOLTAGE_RESOLUTION, SQ212_VOLTAGE_VAR_NAME,
-                   SQ212_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)SQ212_VOLTAGE_RESOLUTION, F(SQ212_VOLTAGE_VAR_NAME),
+                   F(SQ212_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ApogeeSQ212_Voltage object.
      *
@@ -341,8 +345,8 @@ class ApogeeSQ212_Voltage : public Variable {
      */
     ApogeeSQ212_Voltage()
         : Variable((const uint8_t)SQ212_VOLTAGE_VAR_NUM,
-                   (uint8_t)SQ212_VOLTAGE_RESOLUTION, SQ212_VOLTAGE_VAR_NAME,
-                   SQ212_VOLTAGE_UNIT_NAME, SQ212_VOLTAGE_DEFAULT_CODE) {}
+                   (uint8_t)SQ212_VOLTAGE_RESOLUTION, F(SQ212_VOLTAGE_VAR_NAME),
+                   F(SQ212_VOLTAGE_UNIT_NAME), SQ212_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ApogeeSQ212_Voltage object - no action needed.
      */
@@ -243,3 +243,16 @@ bool AtlasParent::waitForProcessing(uint32_t timeout) {
     }
     return processed;
 }
+
+
+// Checks that the circuit acknowledges its address, without sending a command
+bool AtlasParent::isResponding(void) {
+    _i2c->beginTransmission(_i2cAddressHex);
+    // NOTE: The return of 0 from endTransmission indicates success
+    bool responding = !_i2c->endTransmission();
+    if (!responding) {
+        MS_DBG(getSensorNameAndLocation(), F("did not respond at address"),
+               _i2cAddressHex);
+    }
+    return responding;
+}
@@ -339,6 +339,15 @@ class AtlasParent : public Sensor {
      * within the wait period.
      */
     bool waitForProcessing(uint32_t timeout = 1000L);
+    /**
+     * @brief Check that the EZO circuit acknowledges its I2C address.
+     *
+     * This sends nothing but the address, so it doesn't change any setting.
+     * The circuit must be powered and warmed up.
+     *
+     * @return **bool** True if the circuit acknowledged.
+     */
+    bool isResponding(void);
 };
 
 #endif  // SRC_SENSORS_ATLASPARENT_H_
@@ -19,7 +19,9 @@ AtlasScientificCO2::AtlasScientificCO2(SoftwareWire* theI2C, int8_t powerPin,
     : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificCO2", ATLAS_CO2_NUM_VARIABLES,
                   ATLAS_CO2_WARM_UP_TIME_MS, ATLAS_CO2_STABILIZATION_TIME_MS,
-                  ATLAS_CO2_MEASUREMENT_TIME_MS) {}
+                  ATLAS_CO2_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 AtlasScientificCO2::AtlasScientificCO2(int8_t powerPin, int8_t dataPin,
                                        int8_t clockPin, uint8_t i2cAddressHex,
                                        uint8_t measurementsToAverage)
@@ -27,7 +29,9 @@ AtlasScientificCO2::AtlasScientificCO2(int8_t powerPin, int8_t dataPin,
                   measurementsToAverage, "AtlasScientificCO2",
                   ATLAS_CO2_NUM_VARIABLES, ATLAS_CO2_WARM_UP_TIME_MS,
                   ATLAS_CO2_STABILIZATION_TIME_MS,
-                  ATLAS_CO2_MEASUREMENT_TIME_MS) {}
+                  ATLAS_CO2_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 #else
 AtlasScientificCO2::AtlasScientificCO2(TwoWire* theI2C, int8_t powerPin,
                                        uint8_t i2cAddressHex,
@@ -35,13 +39,17 @@ AtlasScientificCO2::AtlasScientificCO2(TwoWire* theI2C, int8_t powerPin,
     : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificCO2", ATLAS_CO2_NUM_VARIABLES,
                   ATLAS_CO2_WARM_UP_TIME_MS, ATLAS_CO2_STABILIZATION_TIME_MS,
-                  ATLAS_CO2_MEASUREMENT_TIME_MS) {}
+                  ATLAS_CO2_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 AtlasScientificCO2::AtlasScientificCO2(int8_t powerPin, uint8_t i2cAddressHex,
                                        uint8_t measurementsToAverage)
     : AtlasParent(powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificCO2", ATLAS_CO2_NUM_VARIABLES,
                   ATLAS_CO2_WARM_UP_TIME_MS, ATLAS_CO2_STABILIZATION_TIME_MS,
-                  ATLAS_CO2_MEASUREMENT_TIME_MS) {}
+                  ATLAS_CO2_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 #endif
 // Destructor
 AtlasScientificCO2::~AtlasScientificCO2() {}
@@ -58,19 +66,34 @@ bool AtlasScientificCO2::setup() {
     if (!wasOn) { powerUp(); }
     waitForWarmUp();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(),
-           F("to report temperature with CO2"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,t,1", 5);  // Enable temperature
-    success &= !_i2c->endTransmission();
-    // NOTE: The return of 0 from endTransmission indicates success
-    success &= waitForProcessing();
+    // Make sure the sensor is there, even if its outputs don't need setting
+    success &= isResponding();
+
+    // The sensor keeps its output settings through a power cycle, so there's
+    // no need to send them again if they were sent at an earlier boot
+    uint8_t outputsSet = 0;
+    if (readBootCache(&outputsSet, 1) && outputsSet) {
+        MS_DBG(F("Outputs of"), getSensorNameAndLocation(),
+               F("were set at an earlier boot"));
+    } else if (success) {
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report temperature with CO2"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,t,1",
+                               5);  // Enable temperature
+        success &= !_i2c->endTransmission();
+        // NOTE: The return of 0 from endTransmission indicates success
+        success &= waitForProcessing();
+    }
 
     if (!success) {
         // Set the status error bit (bit 7)
         _sensorStatus |= 0b10000000;
         // UN-set the set-up bit (bit 0) since setup failed!
         _sensorStatus &= 0b11111110;
+    } else if (!outputsSet) {
+        outputsSet = 1;
+        writeBootCache(&outputsSet, 1);
     }
 
     // Turn the power back off it it had been turned on
@@ -285,6 +285,12 @@ class AtlasScientificCO2 : public AtlasParent {
      * @return **bool** True if the setup was successful.
      */
     bool setup(void) override;
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ATLAS_CO2_NUM_VARIABLES> _results;
 };
 
 /* clang-format off */
@@ -312,8 +318,8 @@ class AtlasScientificCO2_CO2 : public Variable {
         AtlasScientificCO2* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_CO2_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_CO2_VAR_NUM,
-                   (uint8_t)ATLAS_CO2_RESOLUTION, ATLAS_CO2_VAR_NAME,
-                   ATLAS_CO2_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_CO2_RESOLUTION, F(ATLAS_CO2_VAR_NAME),
+                   F(ATLAS_CO2_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificCO2_CO2 object.
      *
@@ -322,8 +328,8 @@ class AtlasScientificCO2_CO2 : public Variable {
      */
     AtlasScientificCO2_CO2()
         : Variable((const uint8_t)ATLAS_CO2_VAR_NUM,
-                   (uint8_t)ATLAS_CO2_RESOLUTION, ATLAS_CO2_VAR_NAME,
-                   ATLAS_CO2_UNIT_NAME, ATLAS_CO2_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_CO2_RESOLUTION, F(ATLAS_CO2_VAR_NAME),
+                   F(ATLAS_CO2_UNIT_NAME), ATLAS_CO2_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificCO2_CO2 object - no action needed.
      */
@@ -355,8 +361,8 @@ class AtlasScientificCO2_Temp : public Variable {
         AtlasScientificCO2* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_CO2TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_CO2TEMP_VAR_NUM,
-                   (uint8_t)ATLAS_CO2TEMP_RESOLUTION, ATLAS_CO2TEMP_VAR_NAME,
-                   ATLAS_CO2TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_CO2TEMP_RESOLUTION, F(ATLAS_CO2TEMP_VAR_NAME),
+                   F(ATLAS_CO2TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificCO2_Temp object.
      *
@@ -365,8 +371,8 @@ class AtlasScientificCO2_Temp : public Variable {
      */
     AtlasScientificCO2_Temp()
         : Variable((const uint8_t)ATLAS_CO2TEMP_VAR_NUM,
-                   (uint8_t)ATLAS_CO2TEMP_RESOLUTION, ATLAS_CO2TEMP_VAR_NAME,
-                   ATLAS_CO2TEMP_UNIT_NAME, ATLAS_CO2TEMP_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_CO2TEMP_RESOLUTION, F(ATLAS_CO2TEMP_VAR_NAME),
+                   F(ATLAS_CO2TEMP_UNIT_NAME), ATLAS_CO2TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificCO2_Temp object - no action needed.
      */
@@ -19,14 +19,18 @@ AtlasScientificDO::AtlasScientificDO(SoftwareWire* theI2C, int8_t powerPin,
     : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificDO", ATLAS_DO_NUM_VARIABLES,
                   ATLAS_DO_WARM_UP_TIME_MS, ATLAS_DO_STABILIZATION_TIME_MS,
-                  ATLAS_DO_MEASUREMENT_TIME_MS) {}
+                  ATLAS_DO_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 AtlasScientificDO::AtlasScientificDO(int8_t powerPin, int8_t dataPin,
                                      int8_t clockPin, uint8_t i2cAddressHex,
                                      uint8_t measurementsToAverage)
     : AtlasParent(
           powerPin, dataPin, clockPin, i2cAddressHex, measurementsToAverage,
           "AtlasScientificDO", ATLAS_DO_NUM_VARIABLES, ATLAS_DO_WARM_UP_TIME_MS,
-          ATLAS_DO_STABILIZATION_TIME_MS, ATLAS_DO_MEASUREMENT_TIME_MS) {}
+          ATLAS_DO_STABILIZATION_TIME_MS, ATLAS_DO_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 #else
 AtlasScientificDO::AtlasScientificDO(TwoWire* theI2C, int8_t powerPin,
                                      uint8_t i2cAddressHex,
@@ -34,13 +38,17 @@ AtlasScientificDO::AtlasScientificDO(TwoWire* theI2C, int8_t powerPin,
     : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificDO", ATLAS_DO_NUM_VARIABLES,
                   ATLAS_DO_WARM_UP_TIME_MS, ATLAS_DO_STABILIZATION_TIME_MS,
-                  ATLAS_DO_MEASUREMENT_TIME_MS) {}
+                  ATLAS_DO_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 AtlasScientificDO::AtlasScientificDO(int8_t powerPin, uint8_t i2cAddressHex,
                                      uint8_t measurementsToAverage)
     : AtlasParent(powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificDO", ATLAS_DO_NUM_VARIABLES,
                   ATLAS_DO_WARM_UP_TIME_MS, ATLAS_DO_STABILIZATION_TIME_MS,
-                  ATLAS_DO_MEASUREMENT_TIME_MS) {}
+                  ATLAS_DO_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 #endif
 // Destructor
 AtlasScientificDO::~AtlasScientificDO() {}
@@ -57,27 +65,41 @@ bool AtlasScientificDO::setup() {
     if (!wasOn) { powerUp(); }
     waitForWarmUp();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(),
-           F("to report O2 concentration"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,mg,1",
-                           6);  // Enable concentration in mg/L
-    success &= !_i2c->endTransmission();
-    success &= waitForProcessing();
+    // Make sure the sensor is there, even if its outputs don't need setting
+    success &= isResponding();
+
+    // The sensor keeps its output settings through a power cycle, so there's
+    // no need to send them again if they were sent at an earlier boot
+    uint8_t outputsSet = 0;
+    if (readBootCache(&outputsSet, 1) && outputsSet) {
+        MS_DBG(F("Outputs of"), getSensorNameAndLocation(),
+               F("were set at an earlier boot"));
+    } else if (success) {
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report O2 concentration"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,mg,1",
+                               6);  // Enable concentration in mg/L
+        success &= !_i2c->endTransmission();
+        success &= waitForProcessing();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(),
-           F("to report O2 % saturation"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,%,1",
-                           5);  // Enable percent saturation
-    success &= !_i2c->endTransmission();
-    success &= waitForProcessing();
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report O2 % saturation"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,%,1",
+                               5);  // Enable percent saturation
+        success &= !_i2c->endTransmission();
+        success &= waitForProcessing();
+    }
 
     if (!success) {
         // Set the status error bit (bit 7)
         _sensorStatus |= 0b10000000;
         // UN-set the set-up bit (bit 0) since setup failed!
         _sensorStatus &= 0b11111110;
+    } else if (!outputsSet) {
+        outputsSet = 1;
+        writeBootCache(&outputsSet, 1);
     }
 
     // Turn the power back off it it had been turned on
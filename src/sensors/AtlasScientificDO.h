@@ -295,6 +295,12 @@ class AtlasScientificDO : public AtlasParent {
      * @return **bool** True if the setup was successful.
      */
     bool setup(void) override;
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ATLAS_DO_NUM_VARIABLES> _results;
 };
 
 /* clang-format off */
@@ -322,8 +328,8 @@ class AtlasScientificDO_DOmgL : public Variable {
         AtlasScientificDO* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_DOMGL_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_DOMGL_VAR_NUM,
-                   (uint8_t)ATLAS_DOMGL_RESOLUTION, ATLAS_DOMGL_VAR_NAME,
-                   ATLAS_DOMGL_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_DOMGL_RESOLUTION, F(ATLAS_DOMGL_VAR_NAME),
+                   F(ATLAS_DOMGL_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificDO_DOmgL object.
      *
@@ -332,8 +338,8 @@ class AtlasScientificDO_DOmgL : public Variable {
      */
     AtlasScientificDO_DOmgL()
         : Variable((const uint8_t)ATLAS_DOMGL_VAR_NUM,
-                   (uint8_t)ATLAS_DOMGL_RESOLUTION, ATLAS_DOMGL_VAR_NAME,
-                   ATLAS_DOMGL_UNIT_NAME, ATLAS_DOMGL_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_DOMGL_RESOLUTION, F(ATLAS_DOMGL_VAR_NAME),
+                   F(ATLAS_DOMGL_UNIT_NAME), ATLAS_DOMGL_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificDO_DOmgL object - no action needed.
      */
@@ -365,8 +371,8 @@ class AtlasScientificDO_DOpct : public Variable {
         AtlasScientificDO* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_DOPCT_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_DOPCT_VAR_NUM,
-                   (uint8_t)ATLAS_DOPCT_RESOLUTION, ATLAS_DOPCT_VAR_NAME,
-                   ATLAS_DOPCT_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_DOPCT_RESOLUTION, F(ATLAS_DOPCT_VAR_NAME),
+                   F(ATLAS_DOPCT_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificDO_DOpct object.
      *
@@ -375,8 +381,8 @@ class AtlasScientificDO_DOpct : public Variable {
      */
     AtlasScientificDO_DOpct()
         : Variable((const uint8_t)ATLAS_DOPCT_VAR_NUM,
-                   (uint8_t)ATLAS_DOPCT_RESOLUTION, ATLAS_DOPCT_VAR_NAME,
-                   ATLAS_DOPCT_UNIT_NAME, ATLAS_DOPCT_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_DOPCT_RESOLUTION, F(ATLAS_DOPCT_VAR_NAME),
+                   F(ATLAS_DOPCT_UNIT_NAME), ATLAS_DOPCT_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificDO_DOpct object - no action needed.
      */
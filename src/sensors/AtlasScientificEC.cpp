@@ -19,7 +19,9 @@ AtlasScientificEC::AtlasScientificEC(SoftwareWire* theI2C, int8_t powerPin,
     : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificEC", ATLAS_COND_NUM_VARIABLES,
                   ATLAS_COND_WARM_UP_TIME_MS, ATLAS_COND_STABILIZATION_TIME_MS,
-                  ATLAS_COND_MEASUREMENT_TIME_MS) {}
+                  ATLAS_COND_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 AtlasScientificEC::AtlasScientificEC(int8_t powerPin, int8_t dataPin,
                                      int8_t clockPin, uint8_t i2cAddressHex,
                                      uint8_t measurementsToAverage)
@@ -27,7 +29,9 @@ AtlasScientificEC::AtlasScientificEC(int8_t powerPin, int8_t dataPin,
                   measurementsToAverage, "AtlasScientificEC",
                   ATLAS_COND_NUM_VARIABLES, ATLAS_COND_WARM_UP_TIME_MS,
                   ATLAS_COND_STABILIZATION_TIME_MS,
-                  ATLAS_COND_MEASUREMENT_TIME_MS) {}
+                  ATLAS_COND_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 #else
 AtlasScientificEC::AtlasScientificEC(TwoWire* theI2C, int8_t powerPin,
                                      uint8_t i2cAddressHex,
@@ -35,13 +39,17 @@ AtlasScientificEC::AtlasScientificEC(TwoWire* theI2C, int8_t powerPin,
     : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificEC", ATLAS_COND_NUM_VARIABLES,
                   ATLAS_COND_WARM_UP_TIME_MS, ATLAS_COND_STABILIZATION_TIME_MS,
-                  ATLAS_COND_MEASUREMENT_TIME_MS) {}
+                  ATLAS_COND_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 AtlasScientificEC::AtlasScientificEC(int8_t powerPin, uint8_t i2cAddressHex,
                                      uint8_t measurementsToAverage)
     : AtlasParent(powerPin, i2cAddressHex, measurementsToAverage,
                   "AtlasScientificEC", ATLAS_COND_NUM_VARIABLES,
                   ATLAS_COND_WARM_UP_TIME_MS, ATLAS_COND_STABILIZATION_TIME_MS,
-                  ATLAS_COND_MEASUREMENT_TIME_MS) {}
+                  ATLAS_COND_MEASUREMENT_TIME_MS) {
+    setResultArrays(_results);
+}
 #endif
 // Destructor
 AtlasScientificEC::~AtlasScientificEC() {}
@@ -58,40 +66,56 @@ bool AtlasScientificEC::setup() {
     if (!wasOn) { powerUp(); }
     waitForWarmUp();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(),
-           F("to report conductivity"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,EC,1", 6);  // Enable conductivity
-    success &= !_i2c->endTransmission();
-    success &= waitForProcessing();
+    // Make sure the sensor is there, even if its outputs don't need setting
+    success &= isResponding();
+
+    // The sensor keeps its output settings through a power cycle, so there's
+    // no need to send them again if they were sent at an earlier boot
+    uint8_t outputsSet = 0;
+    if (readBootCache(&outputsSet, 1) && outputsSet) {
+        MS_DBG(F("Outputs of"), getSensorNameAndLocation(),
+               F("were set at an earlier boot"));
+    } else if (success) {
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report conductivity"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,EC,1",
+                               6);  // Enable conductivity
+        success &= !_i2c->endTransmission();
+        success &= waitForProcessing();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(),
-           F("to report total dissolved solids"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,TDS,1",
-                           7);  // Enable total dissolved solids
-    success &= !_i2c->endTransmission();
-    success &= waitForProcessing();
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report total dissolved solids"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,TDS,1",
+                               7);  // Enable total dissolved solids
+        success &= !_i2c->endTransmission();
+        success &= waitForProcessing();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(), F("to report salinity"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,S,1", 5);  // Enable salinity
-    success &= !_i2c->endTransmission();
-    success &= waitForProcessing();
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report salinity"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,S,1", 5);  // Enable salinity
+        success &= !_i2c->endTransmission();
+        success &= waitForProcessing();
 
-    MS_DBG(F("Asking"), getSensorNameAndLocation(),
-           F("to report specific gravity"));
-    _i2c->beginTransmission(_i2cAddressHex);
-    success &= _i2c->write((const uint8_t*)"O,SG,1",
-                           6);  // Enable specific gravity
-    success &= !_i2c->endTransmission();
-    success &= waitForProcessing();
+        MS_DBG(F("Asking"), getSensorNameAndLocation(),
+               F("to report specific gravity"));
+        _i2c->beginTransmission(_i2cAddressHex);
+        success &= _i2c->write((const uint8_t*)"O,SG,1",
+                               6);  // Enable specific gravity
+        success &= !_i2c->endTransmission();
+        success &= waitForProcessing();
+    }
 
     if (!success) {
         // Set the status error bit (bit 7)
         _sensorStatus |= 0b10000000;
         // UN-set the set-up bit (bit 0) since setup failed!
         _sensorStatus &= 0b11111110;
+    } else if (!outputsSet) {
+        outputsSet = 1;
+        writeBootCache(&outputsSet, 1);
     }
 
     // Turn the power back off it it had been turned on
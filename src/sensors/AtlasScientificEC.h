@@ -353,6 +353,12 @@ class AtlasScientificEC : public AtlasParent {
      * @return **bool** True if the setup was successful.
      */
     bool setup(void) override;
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ATLAS_COND_NUM_VARIABLES> _results;
 };
 
 /* clang-format off */
@@ -380,8 +386,8 @@ class AtlasScientificEC_Cond : public Variable {
         AtlasScientificEC* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_COND_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_COND_VAR_NUM,
-                   (uint8_t)ATLAS_COND_RESOLUTION, ATLAS_COND_VAR_NAME,
-                   ATLAS_COND_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_COND_RESOLUTION, F(ATLAS_COND_VAR_NAME),
+                   F(ATLAS_COND_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificEC_Cond object.
      *
@@ -390,8 +396,8 @@ class AtlasScientificEC_Cond : public Variable {
      */
     AtlasScientificEC_Cond()
         : Variable((const uint8_t)ATLAS_COND_VAR_NUM,
-                   (uint8_t)ATLAS_COND_RESOLUTION, ATLAS_COND_VAR_NAME,
-                   ATLAS_COND_UNIT_NAME, ATLAS_COND_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_COND_RESOLUTION, F(ATLAS_COND_VAR_NAME),
+                   F(ATLAS_COND_UNIT_NAME), ATLAS_COND_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificEC_Cond object - no action needed.
      */
@@ -423,8 +429,8 @@ class AtlasScientificEC_TDS : public Variable {
                                    const char*        uuid = "",
                                    const char* varCode = ATLAS_TDS_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_TDS_VAR_NUM,
-                   (uint8_t)ATLAS_TDS_RESOLUTION, ATLAS_TDS_VAR_NAME,
-                   ATLAS_TDS_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_TDS_RESOLUTION, F(ATLAS_TDS_VAR_NAME),
+                   F(ATLAS_TDS_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificEC_TDS object.
      *
@@ -433,8 +439,8 @@ class AtlasScientificEC_TDS : public Variable {
      */
     AtlasScientificEC_TDS()
         : Variable((const uint8_t)ATLAS_TDS_VAR_NUM,
-                   (uint8_t)ATLAS_TDS_RESOLUTION, ATLAS_TDS_VAR_NAME,
-                   ATLAS_TDS_UNIT_NAME, ATLAS_TDS_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_TDS_RESOLUTION, F(ATLAS_TDS_VAR_NAME),
+                   F(ATLAS_TDS_UNIT_NAME), ATLAS_TDS_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificEC_TDS object - no action needed.
      */
@@ -466,8 +472,9 @@ class AtlasScientificEC_Salinity : public Variable {
         AtlasScientificEC* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_SALINITY_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_SALINITY_VAR_NUM,
-                   (uint8_t)ATLAS_SALINITY_RESOLUTION, ATLAS_SALINITY_VAR_NAME,
-                   ATLAS_SALINITY_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_SALINITY_RESOLUTION,
+                   F(ATLAS_SALINITY_VAR_NAME), F(ATLAS_SALINITY_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificEC_Salinity object.
      *
@@ -476,8 +483,9 @@ class AtlasScientificEC_Salinity : public Variable {
      */
     AtlasScientificEC_Salinity()
         : Variable((const uint8_t)ATLAS_SALINITY_VAR_NUM,
-                   (uint8_t)ATLAS_SALINITY_RESOLUTION, ATLAS_SALINITY_VAR_NAME,
-                   ATLAS_SALINITY_UNIT_NAME, ATLAS_SALINITY_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_SALINITY_RESOLUTION,
+                   F(ATLAS_SALINITY_VAR_NAME), F(ATLAS_SALINITY_UNIT_NAME),
+                   ATLAS_SALINITY_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificEC_Salinity() object - no action
      * needed.
@@ -510,8 +518,8 @@ class AtlasScientificEC_SpecificGravity : public Variable {
         AtlasScientificEC* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_SG_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_SG_VAR_NUM,
-                   (uint8_t)ATLAS_SG_RESOLUTION, ATLAS_SG_VAR_NAME,
-                   ATLAS_SG_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_SG_RESOLUTION, F(ATLAS_SG_VAR_NAME),
+                   F(ATLAS_SG_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificEC_SpecificGravity object.
      *
@@ -520,8 +528,8 @@ class AtlasScientificEC_SpecificGravity : public Variable {
      */
     AtlasScientificEC_SpecificGravity()
         : Variable((const uint8_t)ATLAS_SG_VAR_NUM,
-                   (uint8_t)ATLAS_SG_RESOLUTION, ATLAS_SG_VAR_NAME,
-                   ATLAS_SG_UNIT_NAME, ATLAS_SG_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_SG_RESOLUTION, F(ATLAS_SG_VAR_NAME),
+                   F(ATLAS_SG_UNIT_NAME), ATLAS_SG_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificEC_SpecificGravity() object - no action
      * needed.
@@ -155,7 +155,9 @@ class AtlasScientificORP : public AtlasParent {
                       "AtlasScientificORP", ATLAS_ORP_NUM_VARIABLES,
                       ATLAS_ORP_WARM_UP_TIME_MS,
                       ATLAS_ORP_STABILIZATION_TIME_MS,
-                      ATLAS_ORP_MEASUREMENT_TIME_MS) {}
+                      ATLAS_ORP_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Construct a new Atlas Scientific ORP object, also creating a
      * [SoftwareWire](https://github.com/Testato/SoftwareWire) I2C instance for
@@ -193,7 +195,9 @@ class AtlasScientificORP : public AtlasParent {
                       measurementsToAverage, "AtlasScientificORP",
                       ATLAS_ORP_NUM_VARIABLES, ATLAS_ORP_WARM_UP_TIME_MS,
                       ATLAS_ORP_STABILIZATION_TIME_MS,
-                      ATLAS_ORP_MEASUREMENT_TIME_MS) {}
+                      ATLAS_ORP_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
 #endif
 #if !defined(MS_ATLAS_SOFTWAREWIRE) | defined DOXYGEN
     /**
@@ -226,7 +230,9 @@ class AtlasScientificORP : public AtlasParent {
                       "AtlasScientificORP", ATLAS_ORP_NUM_VARIABLES,
                       ATLAS_ORP_WARM_UP_TIME_MS,
                       ATLAS_ORP_STABILIZATION_TIME_MS,
-                      ATLAS_ORP_MEASUREMENT_TIME_MS) {}
+                      ATLAS_ORP_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Construct a new Atlas Scientific ORP object using the primary
      * hardware I2C instance.
@@ -258,6 +264,12 @@ class AtlasScientificORP : public AtlasParent {
      * @brief Destroy the Atlas Scientific ORP object
      */
     ~AtlasScientificORP() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ATLAS_ORP_NUM_VARIABLES> _results;
 };
 
 
@@ -286,8 +298,8 @@ class AtlasScientificORP_Potential : public Variable {
         AtlasScientificORP* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_ORP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_ORP_VAR_NUM,
-                   (uint8_t)ATLAS_ORP_RESOLUTION, ATLAS_ORP_VAR_NAME,
-                   ATLAS_ORP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_ORP_RESOLUTION, F(ATLAS_ORP_VAR_NAME),
+                   F(ATLAS_ORP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificORP_Potential object.
      *
@@ -296,8 +308,8 @@ class AtlasScientificORP_Potential : public Variable {
      */
     AtlasScientificORP_Potential()
         : Variable((const uint8_t)ATLAS_ORP_VAR_NUM,
-                   (uint8_t)ATLAS_ORP_RESOLUTION, ATLAS_ORP_VAR_NAME,
-                   ATLAS_ORP_UNIT_NAME, ATLAS_ORP_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_ORP_RESOLUTION, F(ATLAS_ORP_VAR_NAME),
+                   F(ATLAS_ORP_UNIT_NAME), ATLAS_ORP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificORP_Potential() object - no action
      * needed.
@@ -165,7 +165,9 @@ class AtlasScientificRTD : public AtlasParent {
                       "AtlasScientificRTD", ATLAS_RTD_NUM_VARIABLES,
                       ATLAS_RTD_WARM_UP_TIME_MS,
                       ATLAS_RTD_STABILIZATION_TIME_MS,
-                      ATLAS_RTD_MEASUREMENT_TIME_MS) {}
+                      ATLAS_RTD_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Construct a new Atlas Scientific RTD object, also creating a
      * [SoftwareWire](https://github.com/Testato/SoftwareWire) I2C instance for
@@ -203,7 +205,9 @@ class AtlasScientificRTD : public AtlasParent {
                       measurementsToAverage, "AtlasScientificRTD",
                       ATLAS_RTD_NUM_VARIABLES, ATLAS_RTD_WARM_UP_TIME_MS,
                       ATLAS_RTD_STABILIZATION_TIME_MS,
-                      ATLAS_RTD_MEASUREMENT_TIME_MS) {}
+                      ATLAS_RTD_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
 #endif
 #if !defined(MS_ATLAS_SOFTWAREWIRE) | defined DOXYGEN
     /**
@@ -236,7 +240,9 @@ class AtlasScientificRTD : public AtlasParent {
                       "AtlasScientificRTD", ATLAS_RTD_NUM_VARIABLES,
                       ATLAS_RTD_WARM_UP_TIME_MS,
                       ATLAS_RTD_STABILIZATION_TIME_MS,
-                      ATLAS_RTD_MEASUREMENT_TIME_MS) {}
+                      ATLAS_RTD_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Construct a new Atlas Scientific RTD object using the primary
      * hardware I2C instance.
@@ -268,6 +274,12 @@ class AtlasScientificRTD : public AtlasParent {
      * @brief Destroy the Atlas Scientific RTD object
      */
     ~AtlasScientificRTD() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ATLAS_RTD_NUM_VARIABLES> _results;
 };
 
 /* clang-format off */
@@ -295,8 +307,8 @@ class AtlasScientificRTD_Temp : public Variable {
         AtlasScientificRTD* parentSense, const char* uuid = "",
         const char* varCode = ATLAS_RTD_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_RTD_VAR_NUM,
-                   (uint8_t)ATLAS_RTD_RESOLUTION, ATLAS_RTD_VAR_NAME,
-                   ATLAS_RTD_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_RTD_RESOLUTION, F(ATLAS_RTD_VAR_NAME),
+                   F(ATLAS_RTD_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificRTD_Temp object.
      *
@@ -305,8 +317,8 @@ class AtlasScientificRTD_Temp : public Variable {
      */
     AtlasScientificRTD_Temp()
         : Variable((const uint8_t)ATLAS_RTD_VAR_NUM,
-                   (uint8_t)ATLAS_RTD_RESOLUTION, ATLAS_RTD_VAR_NAME,
-                   ATLAS_RTD_UNIT_NAME, ATLAS_RTD_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_RTD_RESOLUTION, F(ATLAS_RTD_VAR_NAME),
+                   F(ATLAS_RTD_UNIT_NAME), ATLAS_RTD_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificRTD_Temp object - no action needed.
      */
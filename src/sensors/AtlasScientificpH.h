@@ -158,7 +158,9 @@ class AtlasScientificpH : public AtlasParent {
         : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                       "AtlasScientificpH", ATLAS_PH_NUM_VARIABLES,
                       ATLAS_PH_WARM_UP_TIME_MS, ATLAS_PH_STABILIZATION_TIME_MS,
-                      ATLAS_PH_MEASUREMENT_TIME_MS) {}
+                      ATLAS_PH_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Construct a new Atlas Scientific pH object, also creating a
      * [SoftwareWire](https://github.com/Testato/SoftwareWire) I2C instance for
@@ -196,7 +198,9 @@ class AtlasScientificpH : public AtlasParent {
                       measurementsToAverage, "AtlasScientificpH",
                       ATLAS_PH_NUM_VARIABLES, ATLAS_PH_WARM_UP_TIME_MS,
                       ATLAS_PH_STABILIZATION_TIME_MS,
-                      ATLAS_PH_MEASUREMENT_TIME_MS) {}
+                      ATLAS_PH_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
 #endif
 #if !defined(MS_ATLAS_SOFTWAREWIRE) | defined DOXYGEN
     /**
@@ -228,7 +232,9 @@ class AtlasScientificpH : public AtlasParent {
         : AtlasParent(theI2C, powerPin, i2cAddressHex, measurementsToAverage,
                       "AtlasScientificpH", ATLAS_PH_NUM_VARIABLES,
                       ATLAS_PH_WARM_UP_TIME_MS, ATLAS_PH_STABILIZATION_TIME_MS,
-                      ATLAS_PH_MEASUREMENT_TIME_MS) {}
+                      ATLAS_PH_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Construct a new Atlas Scientific pH object using the primary
      * hardware I2C instance.
@@ -259,6 +265,12 @@ class AtlasScientificpH : public AtlasParent {
      * @brief Destroy the Atlas Scientific pH object
      */
     ~AtlasScientificpH() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ATLAS_PH_NUM_VARIABLES> _results;
 };
 
 
@@ -289,8 +301,8 @@ class AtlasScientificpH_pH : public Variable {
                                   const char*        uuid = "",
                                   const char* varCode = ATLAS_PH_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ATLAS_PH_VAR_NUM,
-                   (uint8_t)ATLAS_PH_RESOLUTION, ATLAS_PH_VAR_NAME,
-                   ATLAS_PH_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ATLAS_PH_RESOLUTION, F(ATLAS_PH_VAR_NAME),
+                   F(ATLAS_PH_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new AtlasScientificpH_pH object.
      *
@@ -299,8 +311,8 @@ class AtlasScientificpH_pH : public Variable {
      */
     AtlasScientificpH_pH()
         : Variable((const uint8_t)ATLAS_PH_VAR_NUM,
-                   (uint8_t)ATLAS_PH_RESOLUTION, ATLAS_PH_VAR_NAME,
-                   ATLAS_PH_UNIT_NAME, ATLAS_PH_DEFAULT_CODE) {}
+                   (uint8_t)ATLAS_PH_RESOLUTION, F(ATLAS_PH_VAR_NAME),
+                   F(ATLAS_PH_UNIT_NAME), ATLAS_PH_DEFAULT_CODE) {}
     /**
      * @brief Destroy the AtlasScientificpH_pH object - no action needed.
      */
@@ -9,6 +9,16 @@
 
 #include "BoschBME280.h"
 
+// The registers used for forced measurements, from section 5.3 of the datasheet
+#define BME280_REG_CALIB_00 0x88   // First of 26 calibration registers
+#define BME280_REG_CALIB_26 0xE1   // First of 7 humidity calibration registers
+#define BME280_REG_CTRL_HUM 0xF2   // Humidity oversampling
+#define BME280_REG_STATUS 0xF3     // Bit 3 is set while measuring
+#define BME280_REG_CTRL_MEAS 0xF4  // Temperature/pressure oversampling, mode
+#define BME280_REG_CONFIG 0xF5     // Standby time and IIR filter
+#define BME280_REG_DATA 0xF7       // First of 8 data registers
+#define BME280_MODE_FORCED 0x01
+
 
 // The constructors
 BoschBME280::BoschBME280(TwoWire* theI2C, int8_t powerPin,
@@ -16,16 +26,26 @@ BoschBME280::BoschBME280(TwoWire* theI2C, int8_t powerPin,
     : Sensor("BoschBME280", BME280_NUM_VARIABLES, BME280_WARM_UP_TIME_MS,
              BME280_STABILIZATION_TIME_MS, BME280_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
+    setCurrents(BME280_ACTIVE_CURRENT_MA, BME280_IDLE_CURRENT_MA,
+                BME280_SLEEP_CURRENT_MA);
     _i2c           = theI2C;
+    _calibrated    = false;
+    setOversampling();
 }
 BoschBME280::BoschBME280(int8_t powerPin, uint8_t i2cAddressHex,
                          uint8_t measurementsToAverage)
     : Sensor("BoschBME280", BME280_NUM_VARIABLES, BME280_WARM_UP_TIME_MS,
              BME280_STABILIZATION_TIME_MS, BME280_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
+    setCurrents(BME280_ACTIVE_CURRENT_MA, BME280_IDLE_CURRENT_MA,
+                BME280_SLEEP_CURRENT_MA);
     _i2c           = &Wire;
+    _calibrated    = false;
+    setOversampling();
 }
 // Destructor
 BoschBME280::~BoschBME280() {}
@@ -42,6 +62,10 @@ bool BoschBME280::setup(void) {
     bool retVal =
         Sensor::setup();  // this will set pin modes and the setup status bit
 
+    // The variables have all registered by now, so the measurement time can
+    // account for the channels that will be skipped
+    setOversampling();
+
     // This sensor needs power for setup!
     // The bme280's begin() reads required calibration data from the sensor.
     bool wasOn = checkPowerOn();
@@ -56,6 +80,8 @@ bool BoschBME280::setup(void) {
         success = bme_internal.begin(_i2cAddressHex, _i2c);
         ntries++;
     }
+    // Keep our own copy of the calibration for the burst reads
+    if (success) { success = readCalibration(); }
     if (!success) {
         // Set the status error bit (bit 7)
         _sensorStatus |= 0b10000000;
@@ -76,39 +102,78 @@ bool BoschBME280::wake(void) {
     // and status bits.  If it returns false, there's no reason to go on.
     if (!Sensor::wake()) return false;
 
-    // Restart always needed after power-up to set sampling modes
-    // As of Adafruit library version 1.0.7, this function includes all of the
-    // various delays to allow the chip to wake up, get calibrations, get
-    // coefficients, and set sampling modes.
-    // This will also restart "Wire"
-    // Currently this is using the settings that Adafruit considered to be
-    // 'default'
-    //  - sensor mode = normal (sensor measures, sleeps for the "standby time"
-    //  and then automatically remeasures
-    //  - temperature oversampling = 16x
-    //  - pressure oversampling = 16x
-    //  - humidity oversampling = 16x
-    //  - built-in IIR filter = off
-    //  - sleep time between measurements = 0.5ms
-    // TODO(SRGDamia1):  Figure out why this is necessary; setSampling should be
-    // enough and this adds a bunch of small delays...
-    bme_internal.begin(_i2cAddressHex, _i2c);
-
-    // When the Adafruit library is updated to remove the built-in delay after
-    // forcing a sample, it would be better to operate in forced mode.
-    bme_internal.setSampling(
-        Adafruit_BME280::MODE_NORMAL,  // sensor mode
-        // bme_internal.setSampling(Adafruit_BME280::MODE_FORCED,  // sensor
-        // mode
-        Adafruit_BME280::SAMPLING_X16,      // temperature oversampling
-        Adafruit_BME280::SAMPLING_X16,      //  pressure oversampling
-        Adafruit_BME280::SAMPLING_X16,      //  humidity oversampling
-        Adafruit_BME280::FILTER_OFF,        // built-in IIR filter
-        Adafruit_BME280::STANDBY_MS_1000);  // sleep time between measurements
-                                            // (N/A in forced mode)
-    delay(100);  // Need this delay after changing sampling mode
+    // The BME280 powers up in sleep mode with its calibration already loaded,
+    // so all that's needed is to set the oversampling for forced measurements.
+    // There's no need to restart the Adafruit library or to wait for the
+    // sensor to start measuring, as there is in normal mode.
+    // The humidity setting only takes effect after ctrl_meas is written.
+    setOversampling();
+    bool success = true;
+    if (!_calibrated) { success &= readCalibration(); }
+    success &= writeRegister(BME280_REG_CTRL_HUM, _humidOversampling);
+    success &= writeRegister(BME280_REG_CONFIG, 0);  // IIR filter off
+    success &= writeRegister(BME280_REG_CTRL_MEAS,
+                             (_oversampling << 5) | (_pressOversampling << 2));
 
-    return true;
+    if (!success) {
+        MS_DBG(getSensorNameAndLocation(), F("was NOT activated!"));
+        // Make sure the activation time is zero and the wake success bit (bit
+        // 4) is unset
+        _millisSensorActivated = 0;
+        _sensorStatus &= 0b11101111;
+    }
+    return success;
+}
+
+
+bool BoschBME280::startSingleMeasurement(void) {
+    // Sensor::startSingleMeasurement() checks that if it's awake/active and
+    // sets the timestamp and status bits.  If it returns false, there's no
+    // reason to go on.
+    if (!Sensor::startSingleMeasurement()) return false;
+
+    // Writing forced mode starts one conversion, after which the sensor goes
+    // back to sleep by itself
+    bool success = writeRegister(BME280_REG_CTRL_MEAS,
+                                 (_oversampling << 5) |
+                                     (_pressOversampling << 2) |
+                                     BME280_MODE_FORCED);
+
+    if (success) {
+        // Update the time that a measurement was requested
+        _millisMeasurementRequested = millis();
+    } else {
+        // Otherwise, make sure that the measurement start time and success bit
+        // (bit 6) are unset
+        MS_DBG(getSensorNameAndLocation(),
+               F("did not successfully start a measurement."));
+        _millisMeasurementRequested = 0;
+        _sensorStatus &= 0b10111111;
+    }
+
+    return success;
+}
+
+
+bool BoschBME280::isMeasurementComplete(bool debug) {
+    // Without a started measurement, the base class knows what to do
+    if (!bitRead(_sensorStatus, 6)) {
+        return Sensor::isMeasurementComplete(debug);
+    }
+    // Give the sensor a moment to raise the measuring bit
+    if (millis() - _millisMeasurementRequested < 2) { return false; }
+
+    uint8_t status;
+    if (readRegisters(BME280_REG_STATUS, &status, 1) &&
+        !bitRead(status, 3)) {
+        if (debug) {
+            MS_DBG(getSensorNameAndLocation(), F("finished measuring after"),
+                   millis() - _millisMeasurementRequested, F("ms"));
+        }
+        return true;
+    }
+    // Never wait longer than the datasheet maximum
+    return Sensor::isMeasurementComplete(debug);
 }
 
 
@@ -126,15 +191,88 @@ bool BoschBME280::addSingleMeasurementResult(void) {
     if (bitRead(_sensorStatus, 6)) {
         MS_DBG(getSensorNameAndLocation(), F("is reporting:"));
 
-        // Read values
-        temp = bme_internal.readTemperature();
-        if (isnan(temp)) temp = -9999;
-        humid = bme_internal.readHumidity();
-        if (isnan(humid)) humid = -9999;
-        press = bme_internal.readPressure();
-        if (isnan(press)) press = -9999;
-        alt = bme_internal.readAltitude(SEALEVELPRESSURE_HPA);
-        if (isnan(alt)) alt = -9999;
+        // Read the pressure, temperature, and humidity registers all at once,
+        // leaving off the humidity if it wasn't measured
+        uint8_t data[8] = {0};
+        uint8_t nData   = _humidOversampling ? 8 : 6;
+        if (readRegisters(BME280_REG_DATA, data, nData)) {
+            int32_t adc_P = ((uint32_t)data[0] << 12) |
+                ((uint32_t)data[1] << 4) | (data[2] >> 4);
+            int32_t adc_T = ((uint32_t)data[3] << 12) |
+                ((uint32_t)data[4] << 4) | (data[5] >> 4);
+            int32_t adc_H = ((uint32_t)data[6] << 8) | data[7];
+
+            // Compensate the raw values with the integer formulas from
+            // section 4.2.3 of the datasheet.  The temperature must come first
+            // because it's needed for the other two.
+            int32_t var1 = ((((adc_T >> 3) - ((int32_t)_digT1 << 1))) *
+                            ((int32_t)_digT2)) >>
+                11;
+            int32_t var2 = (((((adc_T >> 4) - ((int32_t)_digT1)) *
+                              ((adc_T >> 4) - ((int32_t)_digT1))) >>
+                             12) *
+                            ((int32_t)_digT3)) >>
+                14;
+            int32_t t_fine = var1 + var2;
+            temp           = ((t_fine * 5 + 128) >> 8) / 100.0f;
+
+            // The 64-bit pressure math is slow on an AVR; skip it unless
+            // something uses the pressure
+            if (_pressOversampling) {
+                int64_t pvar1 = ((int64_t)t_fine) - 128000;
+                int64_t pvar2 = pvar1 * pvar1 * (int64_t)_digP6;
+                pvar2         = pvar2 + ((pvar1 * (int64_t)_digP5) << 17);
+                pvar2         = pvar2 + (((int64_t)_digP4) << 35);
+                pvar1         = ((pvar1 * pvar1 * (int64_t)_digP3) >> 8) +
+                    ((pvar1 * (int64_t)_digP2) << 12);
+                pvar1 = (((((int64_t)1) << 47) + pvar1)) *
+                        ((int64_t)_digP1) >>
+                    33;
+                if (pvar1 != 0) {
+                    int64_t p = 1048576 - adc_P;
+                    p = (((p << 31) - pvar2) * 3125) / pvar1;
+                    pvar1 = (((int64_t)_digP9) * (p >> 13) * (p >> 13)) >>
+                        25;
+                    pvar2 = (((int64_t)_digP8) * p) >> 19;
+                    p = ((p + pvar1 + pvar2) >> 8) + (((int64_t)_digP7) << 4);
+                    press = p / 256.0f;
+                }
+            }
+
+            if (_humidOversampling) {
+                int32_t h = t_fine - ((int32_t)76800);
+                h = (((((adc_H << 14) - (((int32_t)_digH4) << 20) -
+                        (((int32_t)_digH5) * h)) +
+                       ((int32_t)16384)) >>
+                      15) *
+                     (((((((h * ((int32_t)_digH6)) >> 10) *
+                          (((h * ((int32_t)_digH3)) >> 11) +
+                           ((int32_t)32768))) >>
+                         10) +
+                        ((int32_t)2097152)) *
+                           ((int32_t)_digH2) +
+                       8192) >>
+                      14));
+                h = (h - (((((h >> 15) * (h >> 15)) >> 7) *
+                           ((int32_t)_digH1)) >>
+                          4));
+                h     = (h < 0 ? 0 : h);
+                h     = (h > 419430400 ? 419430400 : h);
+                humid = (h >> 12) / 1024.0f;
+            }
+
+            // A skipped or unfinished conversion reads back as 0x80000
+            if (adc_T == 0x80000) { temp = -9999; }
+            if (adc_P == 0x80000) { press = -9999; }
+            if (adc_H == 0x8000) { humid = -9999; }
+
+            // Only work out the altitude if anything will use it
+            if (isResultRequested(BME280_ALTITUDE_VAR_NUM) && press != -9999) {
+                alt = 44330.0f *
+                    (1.0f - pow((press / 100.0f) / SEALEVELPRESSURE_HPA,
+                                0.1903f));
+            }
+        }
 
         // Assume that if all three are 0, really a failed response
         // May also return a very negative temp when receiving a bad response
@@ -168,3 +306,85 @@ bool BoschBME280::addSingleMeasurementResult(void) {
 
     return success;
 }
+
+
+// Pick the oversampling so that, with averaging, each result is made from
+// about the same number of samples
+void BoschBME280::setOversampling(void) {
+    uint8_t samples = BME280_OVERSAMPLING_TARGET / _measurementsToAverage;
+    _oversampling   = 1;
+    while (_oversampling < 5 && (1 << _oversampling) <= samples) {
+        _oversampling++;
+    }
+    // Skip the channels no variable uses; the altitude needs the pressure
+    bool needPress = isResultRequested(BME280_PRESSURE_VAR_NUM) ||
+        isResultRequested(BME280_ALTITUDE_VAR_NUM);
+    bool needHumid     = isResultRequested(BME280_HUMIDITY_VAR_NUM);
+    _pressOversampling = needPress ? _oversampling : 0;
+    _humidOversampling = needHumid ? _oversampling : 0;
+
+    // Maximum measurement time from section 9.1 of the datasheet, in us
+    uint32_t oversample = 1 << (_oversampling - 1);
+    uint32_t channel_us = 2300 * oversample;
+    uint32_t maxTime_us = 1250 + channel_us;
+    if (needPress) { maxTime_us += channel_us + 575; }
+    if (needHumid) { maxTime_us += channel_us + 575; }
+    _measurementTime_ms = (maxTime_us + 999) / 1000;
+    MS_DBG(F("Skipping unused channels saves"),
+           (1250 + 3 * channel_us + 2 * 575 + 999) / 1000 -
+               _measurementTime_ms,
+           F("ms per measurement of"), getSensorNameAndLocation());
+}
+
+
+// Read the trimming parameters, as laid out in table 16 of the datasheet
+bool BoschBME280::readCalibration(void) {
+    uint8_t c[26];
+    uint8_t h[7];
+    if (!readRegisters(BME280_REG_CALIB_00, c, 26) ||
+        !readRegisters(BME280_REG_CALIB_26, h, 7)) {
+        MS_DBG(F("Could not read the calibration from"),
+               getSensorNameAndLocation());
+        return false;
+    }
+    _digT1 = (uint16_t)(c[1] << 8) | c[0];
+    _digT2 = (int16_t)((c[3] << 8) | c[2]);
+    _digT3 = (int16_t)((c[5] << 8) | c[4]);
+    _digP1 = (uint16_t)(c[7] << 8) | c[6];
+    _digP2 = (int16_t)((c[9] << 8) | c[8]);
+    _digP3 = (int16_t)((c[11] << 8) | c[10]);
+    _digP4 = (int16_t)((c[13] << 8) | c[12]);
+    _digP5 = (int16_t)((c[15] << 8) | c[14]);
+    _digP6 = (int16_t)((c[17] << 8) | c[16]);
+    _digP7 = (int16_t)((c[19] << 8) | c[18]);
+    _digP8 = (int16_t)((c[21] << 8) | c[20]);
+    _digP9 = (int16_t)((c[23] << 8) | c[22]);
+    _digH1 = c[25];
+    _digH2 = (int16_t)((h[1] << 8) | h[0]);
+    _digH3 = h[2];
+    _digH4 = (int16_t)(((int8_t)h[3] << 4) | (h[4] & 0x0F));
+    _digH5 = (int16_t)(((int8_t)h[5] << 4) | (h[4] >> 4));
+    _digH6 = (int8_t)h[6];
+
+    _calibrated = true;
+    return true;
+}
+
+
+bool BoschBME280::writeRegister(uint8_t reg, uint8_t value) {
+    _i2c->beginTransmission(_i2cAddressHex);
+    _i2c->write(reg);
+    _i2c->write(value);
+    // NOTE: The return of 0 from endTransmission indicates success
+    return _i2c->endTransmission() == 0;
+}
+
+
+bool BoschBME280::readRegisters(uint8_t reg, uint8_t* buffer, uint8_t length) {
+    _i2c->beginTransmission(_i2cAddressHex);
+    _i2c->write(reg);
+    if (_i2c->endTransmission() != 0) { return false; }
+    if (_i2c->requestFrom(_i2cAddressHex, length) != length) { return false; }
+    for (uint8_t i = 0; i < length; i++) { buffer[i] = _i2c->read(); }
+    return true;
+}
@@ -49,7 +49,14 @@
  * between measurements.
  *
  * The [Adafruit BME280 library](https://github.com/adafruit/Adafruit_BME280_Library)
- * is used internally for communication with the BME280.
+ * is used internally to find and reset the BME280 during setup.  Measurements
+ * are taken directly in the sensor's "forced" mode: each reading triggers a
+ * single conversion, after which the sensor goes straight back to sleep.  The
+ * oversampling of each conversion is chosen so that the oversampling times the
+ * number of measurements to average is about #BME280_OVERSAMPLING_TARGET.
+ * The status register is polled for the end of the conversion and the
+ * results are read in a single I2C transaction.  The altitude is only
+ * calculated if a BoschBME280_Altitude variable is attached.
  *
  * @warning The I2C addresses used by the BME280 are the same as those of the
  * MS5803!  If you are also using one of those sensors, make sure that the
@@ -117,15 +124,39 @@
  */
 #define BME280_STABILIZATION_TIME_MS 4000
 /**
- * @brief Sensor::_measurementTime_ms; BME280 takes 1100ms to complete a
- * measurement.
+ * @brief Sensor::_measurementTime_ms; BME280 takes at most 113ms to complete a
+ * forced measurement.
  *
- * 1.0 s according to datasheet, but slightly better stdev when 1.1 s
- * For details on BME280 stabilization time updates, include testing sketch and
- * link to data in Google Sheet, see:
- * https://github.com/EnviroDIY/ModularSensors/commit/27e3cb531162ed6971a41f3c38f5920d356089e9
+ * This is the maximum from section 9.1 of the datasheet with 16x oversampling
+ * on every channel.  With less oversampling the measurement time is shortened
+ * to match when the sensor is woken, and the status register is polled so the
+ * result is read as soon as it's ready.
  */
-#define BME280_MEASUREMENT_TIME_MS 1100
+#define BME280_MEASUREMENT_TIME_MS 113
+/**
+ * @brief The total number of samples to aim for across all of the
+ * measurements that are averaged.
+ *
+ * Each measurement is oversampled by the largest of 1, 2, 4, 8, or 16 that
+ * is no more than this divided by the number of measurements to average.
+ */
+#define BME280_OVERSAMPLING_TARGET 16
+/**@}*/
+
+/**
+ * @anchor sensor_bme280_current
+ * @name Sensor Current
+ * The typical supply currents for a Bosch BME280 from the datasheet, used for
+ * the [energy estimates](@ref sensor_energy)
+ */
+/**@{*/
+/// @brief Sensor::_activeCurrent_mA; the BME280 draws up to 0.714 mA while
+/// measuring pressure.
+#define BME280_ACTIVE_CURRENT_MA 0.714
+/// @brief Sensor::_idleCurrent_mA; the BME280 draws 0.2 µA in standby.
+#define BME280_IDLE_CURRENT_MA 0.0002
+/// @brief Sensor::_sleepCurrent_mA; the BME280 draws 0.1 µA in sleep mode.
+#define BME280_SLEEP_CURRENT_MA 0.0001
 /**@}*/
 
 /**
@@ -314,7 +345,22 @@ class BoschBME280 : public Sensor {
      */
     String getSensorLocation(void) override;
 
-    // bool startSingleMeasurement(void) override;  // for forced mode
+    /**
+     * @brief Tell the sensor to take a single forced measurement.
+     *
+     * @return **bool** True if the measurement was started.
+     */
+    bool startSingleMeasurement(void) override;
+    /**
+     * @brief Check whether the forced measurement is finished.
+     *
+     * This polls the measuring bit of the status register.  If the register
+     * can't be read, it falls back to waiting the measurement time.
+     *
+     * @param debug True to output the result to the debugging Serial
+     * @return **bool** True if the measurement is finished.
+     */
+    bool isMeasurementComplete(bool debug = false) override;
     /**
      * @copydoc Sensor::addSingleMeasurementResult()
      */
@@ -333,6 +379,86 @@ class BoschBME280 : public Sensor {
      * @brief An internal reference to the hardware Wire instance.
      */
     TwoWire* _i2c;
+    /**
+     * @brief The oversampling register code used for every channel; 1 for 1x
+     * through 5 for 16x.
+     */
+    uint8_t _oversampling;
+    /**
+     * @brief The oversampling register code for the pressure channel; 0 if no
+     * variable uses the pressure or altitude, so it is skipped.
+     */
+    uint8_t _pressOversampling;
+    /**
+     * @brief The oversampling register code for the humidity channel; 0 if no
+     * variable uses the humidity, so it is skipped.
+     */
+    uint8_t _humidOversampling;
+    /**
+     * @brief True once the calibration coefficients have been read.
+     */
+    bool _calibrated;
+    /**
+     * @name Calibration Coefficients
+     * The trimming parameters from the sensor's memory, named as in section
+     * 4.2.2 of the datasheet
+     */
+    /**@{*/
+    uint16_t _digT1;
+    int16_t  _digT2;
+    int16_t  _digT3;
+    uint16_t _digP1;
+    int16_t  _digP2;
+    int16_t  _digP3;
+    int16_t  _digP4;
+    int16_t  _digP5;
+    int16_t  _digP6;
+    int16_t  _digP7;
+    int16_t  _digP8;
+    int16_t  _digP9;
+    uint8_t  _digH1;
+    int16_t  _digH2;
+    uint8_t  _digH3;
+    int16_t  _digH4;
+    int16_t  _digH5;
+    int8_t   _digH6;
+    /**@}*/
+
+    /**
+     * @brief Pick the oversampling for the number of measurements to average
+     * and set the measurement time to match.
+     *
+     * The pressure and humidity channels are skipped entirely when no
+     * variable uses them, which shortens each conversion.
+     */
+    void setOversampling(void);
+    /**
+     * @brief Read the calibration coefficients from the sensor.
+     *
+     * @return **bool** True if the coefficients were read.
+     */
+    bool readCalibration(void);
+    /**
+     * @brief Write a single register of the sensor.
+     *
+     * @param reg The register address
+     * @param value The value to write
+     * @return **bool** True if the sensor acknowledged the write.
+     */
+    bool writeRegister(uint8_t reg, uint8_t value);
+    /**
+     * @brief Read a run of registers from the sensor in one transaction.
+     *
+     * @param reg The address of the first register
+     * @param buffer The array to read into
+     * @param length The number of registers to read
+     * @return **bool** True if all of the registers were read.
+     */
+    bool readRegisters(uint8_t reg, uint8_t* buffer, uint8_t length);
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<BME280_NUM_VARIABLES> _results;
 };
 
 
@@ -360,8 +486,8 @@ class BoschBME280_Temp : public Variable {
     explicit BoschBME280_Temp(BoschBME280* parentSense, const char* uuid = "",
                               const char* varCode = BME280_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)BME280_TEMP_VAR_NUM,
-                   (uint8_t)BME280_TEMP_RESOLUTION, BME280_TEMP_VAR_NAME,
-                   BME280_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)BME280_TEMP_RESOLUTION, F(BME280_TEMP_VAR_NAME),
+                   F(BME280_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new BoschBME280_Temp object.
      *
@@ -369,8 +495,8 @@ class BoschBME280_Temp : public Variable {
      */
     BoschBME280_Temp()
         : Variable((const uint8_t)BME280_TEMP_VAR_NUM,
-                   (uint8_t)BME280_TEMP_RESOLUTION, BME280_TEMP_VAR_NAME,
-                   BME280_TEMP_UNIT_NAME, BME280_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)BME280_TEMP_RESOLUTION, F(BME280_TEMP_VAR_NAME),
+                   F(BME280_TEMP_UNIT_NAME), BME280_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the BoschBME280_Temp object - no action needed.
      */
@@ -404,8 +530,8 @@ class BoschBME280_Humidity : public Variable {
         const char* varCode = BME280_HUMIDITY_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)BME280_HUMIDITY_VAR_NUM,
                    (uint8_t)BME280_HUMIDITY_RESOLUTION,
-                   BME280_HUMIDITY_VAR_NAME, BME280_HUMIDITY_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(BME280_HUMIDITY_VAR_NAME), F(BME280_HUMIDITY_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new BoschBME280_Humidity object.
      *
@@ -414,7 +540,7 @@ class BoschBME280_Humidity : public Variable {
     BoschBME280_Humidity()
         : Variable((const uint8_t)BME280_HUMIDITY_VAR_NUM,
                    (uint8_t)BME280_HUMIDITY_RESOLUTION,
-                   BME280_HUMIDITY_VAR_NAME, BME280_HUMIDITY_UNIT_NAME,
+                   F(BME280_HUMIDITY_VAR_NAME), F(BME280_HUMIDITY_UNIT_NAME),
                    BME280_HUMIDITY_DEFAULT_CODE) {}
     /**
      * @brief Destroy the BoschBME280_Humidity object - no action needed.
@@ -449,8 +575,8 @@ class BoschBME280_Pressure : public Variable {
         const char* varCode = BME280_PRESSURE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)BME280_PRESSURE_VAR_NUM,
                    (uint8_t)BME280_PRESSURE_RESOLUTION,
-                   BME280_PRESSURE_VAR_NAME, BME280_PRESSURE_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(BME280_PRESSURE_VAR_NAME), F(BME280_PRESSURE_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new BoschBME280_Pressure object.
      *
@@ -459,7 +585,7 @@ class BoschBME280_Pressure : public Variable {
     BoschBME280_Pressure()
         : Variable((const uint8_t)BME280_PRESSURE_VAR_NUM,
                    (uint8_t)BME280_PRESSURE_RESOLUTION,
-                   BME280_PRESSURE_VAR_NAME, BME280_PRESSURE_UNIT_NAME,
+                   F(BME280_PRESSURE_VAR_NAME), F(BME280_PRESSURE_UNIT_NAME),
                    BME280_PRESSURE_DEFAULT_CODE) {}
 };
 
@@ -490,8 +616,8 @@ class BoschBME280_Altitude : public Variable {
         const char* varCode = BME280_ALTITUDE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)BME280_ALTITUDE_VAR_NUM,
                    (uint8_t)BME280_ALTITUDE_RESOLUTION,
-                   BME280_ALTITUDE_VAR_NAME, BME280_ALTITUDE_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(BME280_ALTITUDE_VAR_NAME), F(BME280_ALTITUDE_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new BoschBME280_Altitude object.
      *
@@ -500,7 +626,7 @@ class BoschBME280_Altitude : public Variable {
     BoschBME280_Altitude()
         : Variable((const uint8_t)BME280_ALTITUDE_VAR_NUM,
                    (uint8_t)BME280_ALTITUDE_RESOLUTION,
-                   BME280_ALTITUDE_VAR_NAME, BME280_ALTITUDE_UNIT_NAME,
+                   F(BME280_ALTITUDE_VAR_NAME), F(BME280_ALTITUDE_UNIT_NAME),
                    BME280_ALTITUDE_DEFAULT_CODE) {}
 };
 /**@}*/
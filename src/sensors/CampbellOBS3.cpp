@@ -19,11 +19,22 @@ CampbellOBS3::CampbellOBS3(int8_t powerPin, uint8_t adsChannel,
     : Sensor("CampbellOBS3", OBS3_NUM_VARIABLES, OBS3_WARM_UP_TIME_MS,
              OBS3_STABILIZATION_TIME_MS, OBS3_MEASUREMENT_TIME_MS, powerPin, -1,
              measurementsToAverage) {
+    setResultArrays(_results);
     _adsChannel = adsChannel;
     _x2_coeff_A = x2_coeff_A;
     _x1_coeff_B = x1_coeff_B;
     _x0_coeff_C = x0_coeff_C;
     _i2cAddress = i2cAddress;
+#if defined MS_USE_FIXED_POINT
+    // The calibration can only be done in fixed point if the largest possible
+    // result (at 3.6V) fits
+    _fixedCalibration = fitsInFixed(fabs(_x2_coeff_A) * 3.6 * 3.6 +
+                                    fabs(_x1_coeff_B) * 3.6 +
+                                    fabs(_x0_coeff_C));
+    _x2_coeff_A_fixed = _fixedCalibration ? floatToFixed(_x2_coeff_A) : 0;
+    _x1_coeff_B_fixed = _fixedCalibration ? floatToFixed(_x1_coeff_B) : 0;
+    _x0_coeff_C_fixed = _fixedCalibration ? floatToFixed(_x0_coeff_C) : 0;
+#endif
 }
 // Destructor
 CampbellOBS3::~CampbellOBS3() {}
@@ -46,6 +57,7 @@ bool CampbellOBS3::addSingleMeasurementResult(void) {
     // Variables to store the results in
     float adcVoltage  = -9999;
     float calibResult = -9999;
+    bool  success     = false;
 
     // Check a measurement was *successfully* started (status bit 6 set)
     // Only go on to get a result if it was
@@ -81,6 +93,38 @@ bool CampbellOBS3::addSingleMeasurementResult(void) {
         MS_DBG(F("  Input calibration Curve:"), _x2_coeff_A, F("x^2 +"),
                _x1_coeff_B, F("x +"), _x0_coeff_C);
 
+#if defined MS_USE_FIXED_POINT
+        // Read Analog to Digital Converter (ADC)
+        // Taking this reading includes the 8ms conversion delay.
+        // We get the raw counts and do the bit-to-volts conversion ourselves
+        // in fixed point
+        fixed_q16_t adcVoltageFixed =
+            adsGainOneCountsToFixedVolts(ads.readADC_SingleEnded(_adsChannel));
+        MS_DBG(F("  ads.readADC_SingleEnded("), _adsChannel, F("): "),
+               fixedToFloat(adcVoltageFixed), F("V"));
+
+        if (adcVoltageFixed < floatToFixed(3.6) &&
+            adcVoltageFixed > floatToFixed(-0.3)) {
+            // Skip results out of range
+            success = true;
+            verifyAndAddFixedResult(OBS3_VOLTAGE_VAR_NUM, adcVoltageFixed);
+            // Apply the unique calibration curve for the given sensor
+            if (_fixedCalibration) {
+                fixed_q16_t calibResultFixed =
+                    fixedMul(_x2_coeff_A_fixed,
+                             fixedMul(adcVoltageFixed, adcVoltageFixed)) +
+                    fixedMul(_x1_coeff_B_fixed, adcVoltageFixed) +
+                    _x0_coeff_C_fixed;
+                MS_DBG(F("  calibResult:"), fixedToFloat(calibResultFixed));
+                verifyAndAddFixedResult(OBS3_TURB_VAR_NUM, calibResultFixed);
+            } else {
+                float adcVoltageFloat = fixedToFloat(adcVoltageFixed);
+                calibResult           = (_x2_coeff_A * sq(adcVoltageFloat)) +
+                    (_x1_coeff_B * adcVoltageFloat) + _x0_coeff_C;
+                MS_DBG(F("  calibResult:"), calibResult);
+            }
+        }
+#else
         // Read Analog to Digital Converter (ADC)
         // Taking this reading includes the 8ms conversion delay.
         // We're allowing the ADS1115 library to do the bit-to-volts conversion
@@ -92,6 +136,7 @@ bool CampbellOBS3::addSingleMeasurementResult(void) {
 
         if (adcVoltage < 3.6 && adcVoltage > -0.3) {
             // Skip results out of range
+            success = true;
             // Apply the unique calibration curve for the given sensor
             calibResult = (_x2_coeff_A * sq(adcVoltage)) +
                 (_x1_coeff_B * adcVoltage) + _x0_coeff_C;
@@ -99,10 +144,13 @@ bool CampbellOBS3::addSingleMeasurementResult(void) {
         } else {  // set invalid voltages back to -9999
             adcVoltage = -9999;
         }
+#endif
     } else {
         MS_DBG(getSensorNameAndLocation(), F("is not currently measuring!"));
     }
 
+    // With fixed point, the good results have already been added and these are
+    // -9999 unless the calibration had to be done as a float
     verifyAndAddMeasurementResult(OBS3_TURB_VAR_NUM, calibResult);
     verifyAndAddMeasurementResult(OBS3_VOLTAGE_VAR_NUM, adcVoltage);
 
@@ -111,9 +159,5 @@ bool CampbellOBS3::addSingleMeasurementResult(void) {
     // Unset the status bits for a measurement request (bits 5 & 6)
     _sensorStatus &= 0b10011111;
 
-    if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-        return true;
-    } else {
-        return false;
-    }
+    return success;
 }
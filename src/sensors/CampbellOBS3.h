@@ -269,6 +269,16 @@ class CampbellOBS3 : public Sensor {
     uint8_t _adsChannel;
     float   _x2_coeff_A, _x1_coeff_B, _x0_coeff_C;
     uint8_t _i2cAddress;
+#if defined MS_USE_FIXED_POINT
+    /// @brief The calibration coefficients as Q16.16 numbers
+    fixed_q16_t _x2_coeff_A_fixed, _x1_coeff_B_fixed, _x0_coeff_C_fixed;
+    /// @brief True if the calibrated result always fits in a Q16.16 number
+    bool _fixedCalibration;
+#endif
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<OBS3_NUM_VARIABLES> _results;
 };
 
 
@@ -300,8 +310,8 @@ class CampbellOBS3_Turbidity : public Variable {
         CampbellOBS3* parentSense, const char* uuid = "",
         const char* varCode = OBS3_TURB_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)OBS3_TURB_VAR_NUM,
-                   (uint8_t)OBS3_RESOLUTION, OBS3_TURB_VAR_NAME,
-                   OBS3_TURB_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)OBS3_RESOLUTION, F(OBS3_TURB_VAR_NAME),
+                   F(OBS3_TURB_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new CampbellOBS3_Turbidity object.
      *
@@ -309,7 +319,7 @@ class CampbellOBS3_Turbidity : public Variable {
      */
     CampbellOBS3_Turbidity()
         : Variable((const uint8_t)OBS3_TURB_VAR_NUM, (uint8_t)OBS3_RESOLUTION,
-                   OBS3_TURB_VAR_NAME, OBS3_TURB_UNIT_NAME,
+                   F(OBS3_TURB_VAR_NAME), F(OBS3_TURB_UNIT_NAME),
                    OBS3_TURB_DEFAULT_CODE) {}
     ~CampbellOBS3_Turbidity() {}
 };
@@ -342,8 +352,8 @@ class CampbellOBS3_Voltage : public Variable {
         CampbellOBS3* parentSense, const char* uuid = "",
         const char* varCode = OBS3_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)OBS3_VOLTAGE_VAR_NUM,
-                   (uint8_t)OBS3_VOLTAGE_RESOLUTION, OBS3_VOLTAGE_VAR_NAME,
-                   OBS3_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)OBS3_VOLTAGE_RESOLUTION, F(OBS3_VOLTAGE_VAR_NAME),
+                   F(OBS3_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new CampbellOBS3_Voltage object.
      *
@@ -351,8 +361,8 @@ class CampbellOBS3_Voltage : public Variable {
      */
     CampbellOBS3_Voltage()
         : Variable((const uint8_t)OBS3_VOLTAGE_VAR_NUM,
-                   (uint8_t)OBS3_VOLTAGE_RESOLUTION, OBS3_VOLTAGE_VAR_NAME,
-                   OBS3_VOLTAGE_UNIT_NAME, OBS3_VOLTAGE_DEFAULT_CODE) {}
+                   (uint8_t)OBS3_VOLTAGE_RESOLUTION, F(OBS3_VOLTAGE_VAR_NAME),
+                   F(OBS3_VOLTAGE_UNIT_NAME), OBS3_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the CampbellOBS3_Voltage object - no action needed.
      */
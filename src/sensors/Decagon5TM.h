@@ -236,7 +236,9 @@ class Decagon5TM : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "Decagon5TM", TM_NUM_VARIABLES, TM_WARM_UP_TIME_MS,
-                       TM_STABILIZATION_TIME_MS, TM_MEASUREMENT_TIME_MS) {}
+                       TM_STABILIZATION_TIME_MS, TM_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc Decagon5TM::Decagon5TM
      */
@@ -244,7 +246,9 @@ class Decagon5TM : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "Decagon5TM", TM_NUM_VARIABLES, TM_WARM_UP_TIME_MS,
-                       TM_STABILIZATION_TIME_MS, TM_MEASUREMENT_TIME_MS) {}
+                       TM_STABILIZATION_TIME_MS, TM_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc Decagon5TM::Decagon5TM
      */
@@ -252,7 +256,9 @@ class Decagon5TM : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "Decagon5TM", TM_NUM_VARIABLES, TM_WARM_UP_TIME_MS,
-                       TM_STABILIZATION_TIME_MS, TM_MEASUREMENT_TIME_MS) {}
+                       TM_STABILIZATION_TIME_MS, TM_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Decagon 5TM object
      */
@@ -262,6 +268,12 @@ class Decagon5TM : public SDI12Sensors {
      * @copydoc Sensor::addSingleMeasurementResult()
      */
     bool addSingleMeasurementResult(void) override;
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<TM_NUM_VARIABLES> _results;
 };
 
 
@@ -289,8 +301,8 @@ class Decagon5TM_Ea : public Variable {
     explicit Decagon5TM_Ea(Decagon5TM* parentSense, const char* uuid = "",
                            const char* varCode = TM_EA_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TM_EA_VAR_NUM,
-                   (uint8_t)TM_EA_RESOLUTION, TM_EA_VAR_NAME, TM_EA_UNIT_NAME,
-                   varCode, uuid) {}
+                   (uint8_t)TM_EA_RESOLUTION, F(TM_EA_VAR_NAME),
+                   F(TM_EA_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new Decagon5TM_Ea object.
      *
@@ -298,7 +310,7 @@ class Decagon5TM_Ea : public Variable {
      */
     Decagon5TM_Ea()
         : Variable((const uint8_t)TM_EA_VAR_NUM, (uint8_t)TM_EA_RESOLUTION,
-                   TM_EA_VAR_NAME, TM_EA_UNIT_NAME, TM_EA_DEFAULT_CODE) {}
+                   F(TM_EA_VAR_NAME), F(TM_EA_UNIT_NAME), TM_EA_DEFAULT_CODE) {}
     /**
      * @brief Destroy the Decagon5TM_Ea object - no action needed.
      */
@@ -329,8 +341,8 @@ class Decagon5TM_Temp : public Variable {
     explicit Decagon5TM_Temp(Decagon5TM* parentSense, const char* uuid = "",
                              const char* varCode = TM_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TM_TEMP_VAR_NUM,
-                   (uint8_t)TM_TEMP_RESOLUTION, TM_TEMP_VAR_NAME,
-                   TM_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)TM_TEMP_RESOLUTION, F(TM_TEMP_VAR_NAME),
+                   F(TM_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new Decagon5TM_Temp object.
      *
@@ -338,7 +350,8 @@ class Decagon5TM_Temp : public Variable {
      */
     Decagon5TM_Temp()
         : Variable((const uint8_t)TM_TEMP_VAR_NUM, (uint8_t)TM_TEMP_RESOLUTION,
-                   TM_TEMP_VAR_NAME, TM_TEMP_UNIT_NAME, TM_TEMP_DEFAULT_CODE) {}
+                   F(TM_TEMP_VAR_NAME), F(TM_TEMP_UNIT_NAME),
+                   TM_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the Decagon5TM_Temp object - no action needed.
      */
@@ -369,8 +382,8 @@ class Decagon5TM_VWC : public Variable {
     explicit Decagon5TM_VWC(Decagon5TM* parentSense, const char* uuid = "",
                             const char* varCode = TM_VWC_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TM_VWC_VAR_NUM,
-                   (uint8_t)TM_VWC_RESOLUTION, TM_VWC_VAR_NAME,
-                   TM_VWC_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)TM_VWC_RESOLUTION, F(TM_VWC_VAR_NAME),
+                   F(TM_VWC_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new Decagon5TM_VWC object.
      *
@@ -378,7 +391,8 @@ class Decagon5TM_VWC : public Variable {
      */
     Decagon5TM_VWC()
         : Variable((const uint8_t)TM_VWC_VAR_NUM, (uint8_t)TM_VWC_RESOLUTION,
-                   TM_VWC_VAR_NAME, TM_VWC_UNIT_NAME, TM_VWC_DEFAULT_CODE) {}
+                   F(TM_VWC_VAR_NAME), F(TM_VWC_UNIT_NAME),
+                   TM_VWC_DEFAULT_CODE) {}
     /**
      * @brief Destroy the Decagon5TM_VWC object - no action needed.
      */
@@ -214,7 +214,9 @@ class DecagonCTD : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "DecagonCTD", CTD_NUM_VARIABLES, CTD_WARM_UP_TIME_MS,
-                       CTD_STABILIZATION_TIME_MS, CTD_MEASUREMENT_TIME_MS) {}
+                       CTD_STABILIZATION_TIME_MS, CTD_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc DecagonCTD::DecagonCTD
      */
@@ -222,7 +224,9 @@ class DecagonCTD : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "DecagonCTD", CTD_NUM_VARIABLES, CTD_WARM_UP_TIME_MS,
-                       CTD_STABILIZATION_TIME_MS, CTD_MEASUREMENT_TIME_MS) {}
+                       CTD_STABILIZATION_TIME_MS, CTD_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc DecagonCTD::DecagonCTD
      */
@@ -230,12 +234,20 @@ class DecagonCTD : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "DecagonCTD", CTD_NUM_VARIABLES, CTD_WARM_UP_TIME_MS,
-                       CTD_STABILIZATION_TIME_MS, CTD_MEASUREMENT_TIME_MS) {}
+                       CTD_STABILIZATION_TIME_MS, CTD_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
 
     /**
      * @brief Destroy the Decagon CTD object
      */
     ~DecagonCTD() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<CTD_NUM_VARIABLES> _results;
 };
 
 
@@ -262,8 +274,8 @@ class DecagonCTD_Cond : public Variable {
     explicit DecagonCTD_Cond(DecagonCTD* parentSense, const char* uuid = "",
                              const char* varCode = CTD_COND_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)CTD_COND_VAR_NUM,
-                   (uint8_t)CTD_COND_RESOLUTION, CTD_COND_VAR_NAME,
-                   CTD_COND_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)CTD_COND_RESOLUTION, F(CTD_COND_VAR_NAME),
+                   F(CTD_COND_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new DecagonCTD_Cond object.
      *
@@ -271,8 +283,8 @@ class DecagonCTD_Cond : public Variable {
      */
     DecagonCTD_Cond()
         : Variable((const uint8_t)CTD_COND_VAR_NUM,
-                   (uint8_t)CTD_COND_RESOLUTION, CTD_COND_VAR_NAME,
-                   CTD_COND_UNIT_NAME, CTD_COND_DEFAULT_CODE) {}
+                   (uint8_t)CTD_COND_RESOLUTION, F(CTD_COND_VAR_NAME),
+                   F(CTD_COND_UNIT_NAME), CTD_COND_DEFAULT_CODE) {}
     /**
      * @brief Destroy the DecagonCTD_Cond object - no action needed.
      */
@@ -303,8 +315,8 @@ class DecagonCTD_Temp : public Variable {
     explicit DecagonCTD_Temp(DecagonCTD* parentSense, const char* uuid = "",
                              const char* varCode = CTD_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)CTD_TEMP_VAR_NUM,
-                   (uint8_t)CTD_TEMP_RESOLUTION, CTD_TEMP_VAR_NAME,
-                   CTD_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)CTD_TEMP_RESOLUTION, F(CTD_TEMP_VAR_NAME),
+                   F(CTD_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new DecagonCTD_Temp object.
      *
@@ -312,8 +324,8 @@ class DecagonCTD_Temp : public Variable {
      */
     DecagonCTD_Temp()
         : Variable((const uint8_t)CTD_TEMP_VAR_NUM,
-                   (uint8_t)CTD_TEMP_RESOLUTION, CTD_TEMP_VAR_NAME,
-                   CTD_TEMP_UNIT_NAME, CTD_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)CTD_TEMP_RESOLUTION, F(CTD_TEMP_VAR_NAME),
+                   F(CTD_TEMP_UNIT_NAME), CTD_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the DecagonCTD_Temp object - no action needed.
      */
@@ -344,8 +356,8 @@ class DecagonCTD_Depth : public Variable {
     explicit DecagonCTD_Depth(DecagonCTD* parentSense, const char* uuid = "",
                               const char* varCode = CTD_DEPTH_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)CTD_DEPTH_VAR_NUM,
-                   (uint8_t)CTD_DEPTH_RESOLUTION, CTD_DEPTH_VAR_NAME,
-                   CTD_DEPTH_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)CTD_DEPTH_RESOLUTION, F(CTD_DEPTH_VAR_NAME),
+                   F(CTD_DEPTH_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new DecagonCTD_Depth object.
      *
@@ -353,8 +365,8 @@ class DecagonCTD_Depth : public Variable {
      */
     DecagonCTD_Depth()
         : Variable((const uint8_t)CTD_DEPTH_VAR_NUM,
-                   (uint8_t)CTD_DEPTH_RESOLUTION, CTD_DEPTH_VAR_NAME,
-                   CTD_DEPTH_UNIT_NAME, CTD_DEPTH_DEFAULT_CODE) {}
+                   (uint8_t)CTD_DEPTH_RESOLUTION, F(CTD_DEPTH_VAR_NAME),
+                   F(CTD_DEPTH_UNIT_NAME), CTD_DEPTH_DEFAULT_CODE) {}
     /**
      * @brief Destroy the DecagonCTD_Depth object - no action needed.
      */
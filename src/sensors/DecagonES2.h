@@ -183,7 +183,9 @@ class DecagonES2 : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "DecagonES2", ES2_NUM_VARIABLES, ES2_WARM_UP_TIME_MS,
-                       ES2_STABILIZATION_TIME_MS, ES2_MEASUREMENT_TIME_MS) {}
+                       ES2_STABILIZATION_TIME_MS, ES2_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc DecagonES2::DecagonES2
      */
@@ -191,7 +193,9 @@ class DecagonES2 : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "DecagonES2", ES2_NUM_VARIABLES, ES2_WARM_UP_TIME_MS,
-                       ES2_STABILIZATION_TIME_MS, ES2_MEASUREMENT_TIME_MS) {}
+                       ES2_STABILIZATION_TIME_MS, ES2_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc DecagonES2::DecagonES2
      */
@@ -199,11 +203,19 @@ class DecagonES2 : public SDI12Sensors {
                uint8_t measurementsToAverage = 1)
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "DecagonES2", ES2_NUM_VARIABLES, ES2_WARM_UP_TIME_MS,
-                       ES2_STABILIZATION_TIME_MS, ES2_MEASUREMENT_TIME_MS) {}
+                       ES2_STABILIZATION_TIME_MS, ES2_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Decagon ES2 object
      */
     ~DecagonES2() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ES2_NUM_VARIABLES> _results;
 };
 
 
@@ -230,8 +242,8 @@ class DecagonES2_Cond : public Variable {
     explicit DecagonES2_Cond(DecagonES2* parentSense, const char* uuid = "",
                              const char* varCode = ES2_COND_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ES2_COND_VAR_NUM,
-                   (uint8_t)ES2_COND_RESOLUTION, ES2_COND_VAR_NAME,
-                   ES2_COND_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ES2_COND_RESOLUTION, F(ES2_COND_VAR_NAME),
+                   F(ES2_COND_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new DecagonES2_Cond object.
      *
@@ -239,8 +251,8 @@ class DecagonES2_Cond : public Variable {
      */
     DecagonES2_Cond()
         : Variable((const uint8_t)ES2_COND_VAR_NUM,
-                   (uint8_t)ES2_COND_RESOLUTION, ES2_COND_VAR_NAME,
-                   ES2_COND_UNIT_NAME, ES2_COND_DEFAULT_CODE) {}
+                   (uint8_t)ES2_COND_RESOLUTION, F(ES2_COND_VAR_NAME),
+                   F(ES2_COND_UNIT_NAME), ES2_COND_DEFAULT_CODE) {}
     /**
      * @brief Destroy the DecagonES2_Cond object - no action needed.
      */
@@ -270,8 +282,8 @@ class DecagonES2_Temp : public Variable {
     explicit DecagonES2_Temp(DecagonES2* parentSense, const char* uuid = "",
                              const char* varCode = ES2_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)ES2_TEMP_VAR_NUM,
-                   (uint8_t)ES2_TEMP_RESOLUTION, ES2_TEMP_VAR_NAME,
-                   ES2_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ES2_TEMP_RESOLUTION, F(ES2_TEMP_VAR_NAME),
+                   F(ES2_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new DecagonES2_Temp object.
      *
@@ -279,8 +291,8 @@ class DecagonES2_Temp : public Variable {
      */
     DecagonES2_Temp()
         : Variable((const uint8_t)ES2_TEMP_VAR_NUM,
-                   (uint8_t)ES2_TEMP_RESOLUTION, ES2_TEMP_VAR_NAME,
-                   ES2_TEMP_UNIT_NAME, ES2_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)ES2_TEMP_RESOLUTION, F(ES2_TEMP_VAR_NAME),
+                   F(ES2_TEMP_UNIT_NAME), ES2_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the DecagonES2_Temp object - no action needed.
      */
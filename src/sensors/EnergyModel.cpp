@@ -0,0 +1,123 @@
+/**
+ * @file EnergyModel.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Implements the EnergyModel class.
+ */
+
+#include "EnergyModel.h"
+
+
+// Need the logger to model and, optionally, the battery capacity
+EnergyModel::EnergyModel(Logger* logger, float batteryCapacity_mAh,
+                         uint8_t measurementsToAverage)
+    : Sensor("EnergyModel", ENERGY_NUM_VARIABLES, ENERGY_WARM_UP_TIME_MS,
+             ENERGY_STABILIZATION_TIME_MS, ENERGY_MEASUREMENT_TIME_MS, -1, -1,
+             measurementsToAverage),
+      _logger(logger),
+      _batteryCapacity_mAh(batteryCapacity_mAh),
+      _lastEpoch(0),
+      _lastAwakeTime_ms(0),
+      _lastBoardCharge(0),
+      _lastSensorCharge(0),
+      _lastModemCharge(0),
+      _lastAwakeCharge(-9999),
+      _lastAwakeTime_s(0) {
+    setResultArrays(_results);
+}
+// Destructor
+EnergyModel::~EnergyModel() {}
+
+
+String EnergyModel::getSensorLocation(void) {
+    return F("Logger");
+}
+
+
+bool EnergyModel::addSingleMeasurementResult(void) {
+    // Get the running totals
+    uint32_t nowEpoch     = Logger::getNowEpoch();
+    uint32_t awakeTime_ms = _logger->getAwakeTime();
+    float    boardCharge  = _logger->getBoardChargeUsed();
+    float    sensorCharge = _logger->getSensorChargeUsed();
+    float    modemCharge  = _logger->getModemChargeUsed();
+
+    float cycleCharge = -9999;
+    float dailyCharge = -9999;
+    float boardUsed   = -9999;
+    float sensorsUsed = -9999;
+    float modemUsed   = -9999;
+    float sleepUsed   = -9999;
+    float batteryLife = -9999;
+
+    // The clock only has one second resolution, so a second reading in the
+    // same cycle has nothing to report
+    if (_lastEpoch != 0 && nowEpoch > _lastEpoch) {
+        uint32_t elapsed_s = nowEpoch - _lastEpoch;
+        float    awake_s   = (awakeTime_ms - _lastAwakeTime_ms) / 1000.0f;
+        float    asleep_s  = elapsed_s - awake_s;
+        if (asleep_s < 0) { asleep_s = 0; }
+
+        boardUsed   = boardCharge - _lastBoardCharge;
+        sensorsUsed = sensorCharge - _lastSensorCharge;
+        modemUsed   = modemCharge - _lastModemCharge;
+        sleepUsed   = _logger->getBaselineCurrent() * asleep_s / 3600.0f;
+        cycleCharge = boardUsed + sensorsUsed + modemUsed + sleepUsed;
+
+        // Scale to a day from the time that actually passed, which may not be
+        // exactly the logging interval
+        dailyCharge = cycleCharge * 86400.0f / elapsed_s;
+        if (_batteryCapacity_mAh > 0) {
+            batteryLife = energyBatteryLifeDays(_batteryCapacity_mAh,
+                                                dailyCharge);
+        }
+
+        // Save the awake part for projecting other intervals
+        _lastAwakeCharge = boardUsed + sensorsUsed + modemUsed;
+        _lastAwakeTime_s = awake_s;
+
+        MS_DBG(F("In the last"), elapsed_s, F("s, awake for"), awake_s,
+               F("s, the logger used"), String(cycleCharge, 4), F("mAh"));
+    }
+
+    // Save the totals for the next reading
+    _lastEpoch        = nowEpoch;
+    _lastAwakeTime_ms = awakeTime_ms;
+    _lastBoardCharge  = boardCharge;
+    _lastSensorCharge = sensorCharge;
+    _lastModemCharge  = modemCharge;
+
+    verifyAndAddMeasurementResult(ENERGY_CYCLE_VAR_NUM, cycleCharge);
+    verifyAndAddMeasurementResult(ENERGY_DAILY_VAR_NUM, dailyCharge);
+    verifyAndAddMeasurementResult(ENERGY_BOARD_VAR_NUM, boardUsed);
+    verifyAndAddMeasurementResult(ENERGY_SENSOR_VAR_NUM, sensorsUsed);
+    verifyAndAddMeasurementResult(ENERGY_MODEM_VAR_NUM, modemUsed);
+    verifyAndAddMeasurementResult(ENERGY_SLEEP_VAR_NUM, sleepUsed);
+    verifyAndAddMeasurementResult(ENERGY_LIFE_VAR_NUM, batteryLife);
+
+    // Unset the time stamp for the beginning of this measurement
+    _millisMeasurementRequested = 0;
+    // Unset the status bits for a measurement request (bits 5 & 6)
+    _sensorStatus &= 0b10011111;
+
+    // Return true when finished
+    return true;
+}
+
+
+// This repeats the last cycle's awake charge at a new interval
+float EnergyModel::projectBatteryLife(uint16_t loggingIntervalMinutes) {
+    if (_batteryCapacity_mAh <= 0 || _lastAwakeCharge == -9999 ||
+        _lastAwakeTime_s <= 0) {
+        return -9999;
+    }
+    // Treat the awake charge as an average awake current over the awake time
+    float awakeCurrent_mA = _lastAwakeCharge * 3600.0f / _lastAwakeTime_s;
+    float perCycle = energyChargePerCycle(awakeCurrent_mA, _lastAwakeTime_s,
+                                          _logger->getBaselineCurrent(),
+                                          loggingIntervalMinutes);
+    return energyBatteryLifeDays(
+        _batteryCapacity_mAh,
+        energyChargePerDay(perCycle, loggingIntervalMinutes));
+}
@@ -0,0 +1,538 @@
+/**
+ * @file EnergyModel.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Contains the EnergyModel sensor subclass and the variable subclasses
+ * EnergyModel_CycleCharge, EnergyModel_DailyCharge,
+ * EnergyModel_BoardCharge, EnergyModel_SensorCharge,
+ * EnergyModel_ModemCharge, EnergyModel_SleepCharge, and
+ * EnergyModel_BatteryLife.
+ *
+ * These are used to estimate the charge the logger draws from its battery
+ * using the currents set for the logger board, each sensor, and the modem.
+ */
+/* clang-format off */
+/**
+ * @defgroup sensor_energy Logger Energy Model
+ * Classes for estimating the charge used by a logger and each of its parts.
+ *
+ * @ingroup the_sensors
+ *
+ * @tableofcontents
+ * @m_footernavigation
+ *
+ * @section sensor_energy_intro Introduction
+ *
+ * The energy model is not a physical sensor.  It adds up the time each part of
+ * the logger spends in each power state and multiplies those times by the
+ * currents given for that part.
+ *
+ * - The logger board draws its awake current from each wake until it goes back
+ * to sleep, as measured by the processor clock.  Set it with
+ * Logger::setCurrents().
+ * - Each sensor draws its active current from when it is woken until it is put
+ * to sleep and its idle current while it is powered but not awake, from the
+ * same time stamps used to time the sensor updates.  Set these with
+ * Sensor::setCurrents().
+ * - The modem draws its active current from when it is woken until it is put
+ * to sleep and its idle current while it is powered but asleep.  Set these
+ * with loggerModem::setCurrents().
+ * - Between cycles, the board sleep current and the sleep current of every
+ * sensor and modem that is not powered down is drawn for the time between
+ * readings of the real time clock, less the time the processor was awake.
+ *
+ * Every reading reports the charge used since the previous reading, so with
+ * the default of one measurement per cycle each result is the charge used in
+ * the last full logging cycle.  The first reading after start-up has nothing
+ * to compare to and reports -9999.
+ *
+ * The accuracy is only as good as the currents given.  They should be measured
+ * or taken from the datasheets for the actual parts and supply voltage.
+ *
+ * The arithmetic for the projections is in EnergyProjection.h, which can also
+ * be compiled on a computer to simulate a configuration before deploying it.
+ *
+ * @section sensor_energy_ctor Sensor Constructor
+ * {{ @ref EnergyModel::EnergyModel }}
+ */
+/* clang-format on */
+
+// Header Guards
+#ifndef SRC_SENSORS_ENERGYMODEL_H_
+#define SRC_SENSORS_ENERGYMODEL_H_
+
+// Debugging Statement
+// #define MS_ENERGYMODEL_DEBUG
+
+#ifdef MS_ENERGYMODEL_DEBUG
+#define MS_DEBUGGING_STD "EnergyModel"
+#endif
+
+// Included Dependencies
+#include "ModSensorDebugger.h"
+#undef MS_DEBUGGING_STD
+#include "VariableBase.h"
+#include "SensorBase.h"
+#include "LoggerBase.h"
+#include "EnergyProjection.h"
+
+// Sensor Specific Defines
+/** @ingroup sensor_energy */
+/**@{*/
+
+/// @brief Sensor::_numReturnedValues; the energy model can report 7 values.
+#define ENERGY_NUM_VARIABLES 7
+
+/**
+ * @anchor sensor_energy_timing
+ * @name Sensor Timing
+ * The energy model is calculated, so it takes no time.
+ */
+/**@{*/
+/// @brief Sensor::_warmUpTime_ms; the energy model does not need to warm up.
+#define ENERGY_WARM_UP_TIME_MS 0
+/// @brief Sensor::_stabilizationTime_ms; the energy model is stable as soon as
+/// it is awake.
+#define ENERGY_STABILIZATION_TIME_MS 0
+/// @brief Sensor::_measurementTime_ms; the energy model is calculated at once.
+#define ENERGY_MEASUREMENT_TIME_MS 0
+/**@}*/
+
+/**
+ * @anchor sensor_energy_charge
+ * @name Charge
+ * The charge variables from the energy model, all in mAh
+ */
+/**@{*/
+/// @brief Decimals places in string representation; charge should have 4.
+#define ENERGY_CHARGE_RESOLUTION 4
+/// @brief Variable unit name; "milliampereHour" (mAh)
+#define ENERGY_CHARGE_UNIT_NAME "milliampereHour"
+/// @brief Sensor variable number; the total charge used in the last cycle is
+/// stored in sensorValues[0].
+#define ENERGY_CYCLE_VAR_NUM 0
+/// @brief Variable name; "chargeUsedPerCycle"
+#define ENERGY_CYCLE_VAR_NAME "chargeUsedPerCycle"
+/// @brief Default variable short code; "CycleCharge"
+#define ENERGY_CYCLE_DEFAULT_CODE "CycleCharge"
+/// @brief Sensor variable number; the projected charge used per day is stored
+/// in sensorValues[1].
+#define ENERGY_DAILY_VAR_NUM 1
+/// @brief Variable name; "chargeUsedPerDay"
+#define ENERGY_DAILY_VAR_NAME "chargeUsedPerDay"
+/// @brief Default variable short code; "DailyCharge"
+#define ENERGY_DAILY_DEFAULT_CODE "DailyCharge"
+/// @brief Sensor variable number; the charge used by the logger board while
+/// awake is stored in sensorValues[2].
+#define ENERGY_BOARD_VAR_NUM 2
+/// @brief Variable name; "chargeUsedByBoard"
+#define ENERGY_BOARD_VAR_NAME "chargeUsedByBoard"
+/// @brief Default variable short code; "BoardCharge"
+#define ENERGY_BOARD_DEFAULT_CODE "BoardCharge"
+/// @brief Sensor variable number; the charge used by all sensors while on is
+/// stored in sensorValues[3].
+#define ENERGY_SENSOR_VAR_NUM 3
+/// @brief Variable name; "chargeUsedBySensors"
+#define ENERGY_SENSOR_VAR_NAME "chargeUsedBySensors"
+/// @brief Default variable short code; "SensorCharge"
+#define ENERGY_SENSOR_DEFAULT_CODE "SensorCharge"
+/// @brief Sensor variable number; the charge used by the modem while powered
+/// is stored in sensorValues[4].
+#define ENERGY_MODEM_VAR_NUM 4
+/// @brief Variable name; "chargeUsedByModem"
+#define ENERGY_MODEM_VAR_NAME "chargeUsedByModem"
+/// @brief Default variable short code; "ModemCharge"
+#define ENERGY_MODEM_DEFAULT_CODE "ModemCharge"
+/// @brief Sensor variable number; the charge used while asleep is stored in
+/// sensorValues[5].
+#define ENERGY_SLEEP_VAR_NUM 5
+/// @brief Variable name; "chargeUsedAsleep"
+#define ENERGY_SLEEP_VAR_NAME "chargeUsedAsleep"
+/// @brief Default variable short code; "SleepCharge"
+#define ENERGY_SLEEP_DEFAULT_CODE "SleepCharge"
+/**@}*/
+
+/**
+ * @anchor sensor_energy_life
+ * @name Battery Life
+ * The projected battery life from the energy model
+ *   - Only reported if a battery capacity is given in the constructor
+ *
+ * {{ @ref EnergyModel_BatteryLife::EnergyModel_BatteryLife }}
+ */
+/**@{*/
+/// @brief Decimals places in string representation; battery life should have
+/// 1.
+#define ENERGY_LIFE_RESOLUTION 1
+/// @brief Sensor variable number; battery life is stored in sensorValues[6].
+#define ENERGY_LIFE_VAR_NUM 6
+/// @brief Variable name; "batteryLife"
+#define ENERGY_LIFE_VAR_NAME "batteryLife"
+/// @brief Variable unit name; "day"
+#define ENERGY_LIFE_UNIT_NAME "day"
+/// @brief Default variable short code; "BatteryLife"
+#define ENERGY_LIFE_DEFAULT_CODE "BatteryLife"
+/**@}*/
+
+
+/**
+ * @brief The Sensor sub-class for the [logger energy model](@ref sensor_energy)
+ *
+ * @ingroup sensor_energy
+ */
+class EnergyModel : public Sensor {
+ public:
+    /**
+     * @brief Construct a new EnergyModel object.
+     *
+     * @param logger The logger to model; its board currents should be set with
+     * Logger::setCurrents().
+     * @param batteryCapacity_mAh The usable capacity of the battery in mAh;
+     * optional.  If not given, no battery life is projected.
+     * @param measurementsToAverage The number of measurements to take and
+     * average before giving a "final" result from the sensor; optional with a
+     * default value of 1.  Only the first measurement in each cycle has a
+     * result, so there is no reason to change this.
+     */
+    explicit EnergyModel(Logger* logger, float batteryCapacity_mAh = -1,
+                         uint8_t measurementsToAverage = 1);
+    /**
+     * @brief Destroy the EnergyModel object
+     */
+    ~EnergyModel();
+
+    /**
+     * @copydoc Sensor::getSensorLocation()
+     */
+    String getSensorLocation(void) override;
+
+    /**
+     * @copydoc Sensor::addSingleMeasurementResult()
+     */
+    bool addSingleMeasurementResult(void) override;
+
+    /**
+     * @brief Project the battery life if the last cycle were repeated at a
+     * different logging interval.
+     *
+     * The charge used while awake is assumed to be the same as in the last
+     * cycle; only the time asleep changes.
+     *
+     * @param loggingIntervalMinutes The logging interval to project for
+     * @return **float** The projected battery life in days; -9999 if there is
+     * no battery capacity or no cycle has been measured yet.
+     */
+    float projectBatteryLife(uint16_t loggingIntervalMinutes);
+
+ private:
+    Logger*  _logger;
+    float    _batteryCapacity_mAh;
+    uint32_t _lastEpoch;
+    uint32_t _lastAwakeTime_ms;
+    float    _lastBoardCharge;
+    float    _lastSensorCharge;
+    float    _lastModemCharge;
+    float    _lastAwakeCharge;
+    float    _lastAwakeTime_s;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<ENERGY_NUM_VARIABLES> _results;
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [total charge used in the last cycle](@ref sensor_energy_charge) from an
+ * [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_CycleCharge : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_CycleCharge object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "CycleCharge".
+     */
+    explicit EnergyModel_CycleCharge(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_CYCLE_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_CYCLE_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_CYCLE_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_CycleCharge object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_CycleCharge()
+        : Variable((const uint8_t)ENERGY_CYCLE_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_CYCLE_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), ENERGY_CYCLE_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_CycleCharge object - no action needed.
+     */
+    ~EnergyModel_CycleCharge() {}
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [projected charge used per day](@ref sensor_energy_charge) from an
+ * [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_DailyCharge : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_DailyCharge object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "DailyCharge".
+     */
+    explicit EnergyModel_DailyCharge(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_DAILY_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_DAILY_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_DAILY_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_DailyCharge object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_DailyCharge()
+        : Variable((const uint8_t)ENERGY_DAILY_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_DAILY_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), ENERGY_DAILY_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_DailyCharge object - no action needed.
+     */
+    ~EnergyModel_DailyCharge() {}
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [charge used by the logger board while awake](@ref sensor_energy_charge)
+ * from an [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_BoardCharge : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_BoardCharge object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "BoardCharge".
+     */
+    explicit EnergyModel_BoardCharge(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_BOARD_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_BOARD_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_BOARD_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_BoardCharge object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_BoardCharge()
+        : Variable((const uint8_t)ENERGY_BOARD_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_BOARD_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), ENERGY_BOARD_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_BoardCharge object - no action needed.
+     */
+    ~EnergyModel_BoardCharge() {}
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [charge used by all of the sensors while on](@ref sensor_energy_charge)
+ * from an [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_SensorCharge : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_SensorCharge object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "SensorCharge".
+     */
+    explicit EnergyModel_SensorCharge(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_SENSOR_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_SENSOR_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_SENSOR_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_SensorCharge object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_SensorCharge()
+        : Variable((const uint8_t)ENERGY_SENSOR_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_SENSOR_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), ENERGY_SENSOR_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_SensorCharge object - no action needed.
+     */
+    ~EnergyModel_SensorCharge() {}
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [charge used by the modem while powered](@ref sensor_energy_charge) from an
+ * [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_ModemCharge : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_ModemCharge object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "ModemCharge".
+     */
+    explicit EnergyModel_ModemCharge(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_MODEM_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_MODEM_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_MODEM_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_ModemCharge object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_ModemCharge()
+        : Variable((const uint8_t)ENERGY_MODEM_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_MODEM_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), ENERGY_MODEM_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_ModemCharge object - no action needed.
+     */
+    ~EnergyModel_ModemCharge() {}
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [charge used while asleep](@ref sensor_energy_charge) from an
+ * [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_SleepCharge : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_SleepCharge object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "SleepCharge".
+     */
+    explicit EnergyModel_SleepCharge(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_SLEEP_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_SLEEP_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_SLEEP_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_SleepCharge object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_SleepCharge()
+        : Variable((const uint8_t)ENERGY_SLEEP_VAR_NUM,
+                   (uint8_t)ENERGY_CHARGE_RESOLUTION, F(ENERGY_SLEEP_VAR_NAME),
+                   F(ENERGY_CHARGE_UNIT_NAME), ENERGY_SLEEP_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_SleepCharge object - no action needed.
+     */
+    ~EnergyModel_SleepCharge() {}
+};
+
+
+/* clang-format off */
+/**
+ * @brief The Variable sub-class used for the
+ * [projected battery life](@ref sensor_energy_life) from an
+ * [EnergyModel](@ref sensor_energy).
+ *
+ * @ingroup sensor_energy
+ */
+/* clang-format on */
+class EnergyModel_BatteryLife : public Variable {
+ public:
+    /**
+     * @brief Construct a new EnergyModel_BatteryLife object.
+     *
+     * @param parentSense The parent EnergyModel providing the result values.
+     * @param uuid A universally unique identifier (UUID or GUID) for the
+     * variable; optional with the default value of an empty string.
+     * @param varCode A short code to help identify the variable in files;
+     * optional with a default value of "BatteryLife".
+     */
+    explicit EnergyModel_BatteryLife(
+        EnergyModel* parentSense, const char* uuid = "",
+        const char* varCode = ENERGY_LIFE_DEFAULT_CODE)
+        : Variable(parentSense, (const uint8_t)ENERGY_LIFE_VAR_NUM,
+                   (uint8_t)ENERGY_LIFE_RESOLUTION, F(ENERGY_LIFE_VAR_NAME),
+                   F(ENERGY_LIFE_UNIT_NAME), varCode, uuid) {}
+    /**
+     * @brief Construct a new EnergyModel_BatteryLife object.
+     *
+     * @note This must be tied with a parent EnergyModel before it can be used.
+     */
+    EnergyModel_BatteryLife()
+        : Variable((const uint8_t)ENERGY_LIFE_VAR_NUM,
+                   (uint8_t)ENERGY_LIFE_RESOLUTION, F(ENERGY_LIFE_VAR_NAME),
+                   F(ENERGY_LIFE_UNIT_NAME), ENERGY_LIFE_DEFAULT_CODE) {}
+    /**
+     * @brief Destroy the EnergyModel_BatteryLife object - no action needed.
+     */
+    ~EnergyModel_BatteryLife() {}
+};
+/**@}*/
+#endif  // SRC_SENSORS_ENERGYMODEL_H_
@@ -23,9 +23,16 @@ ExternalVoltage::ExternalVoltage(int8_t powerPin, uint8_t adsChannel,
              EXT_VOLTAGE_WARM_UP_TIME_MS, EXT_VOLTAGE_STABILIZATION_TIME_MS,
              EXT_VOLTAGE_MEASUREMENT_TIME_MS, powerPin, -1,
              measurementsToAverage) {
+    setResultArrays(_results);
     _adsChannel = adsChannel;
     _gain       = gain;
     _i2cAddress = i2cAddress;
+#if defined MS_USE_FIXED_POINT
+    // The gain can only be applied in fixed point if the largest possible
+    // result (at 3.6V) fits
+    _fixedCalibration = fitsInFixed(fabs(_gain) * 3.6);
+    _gainFixed        = _fixedCalibration ? floatToFixed(_gain) : 0;
+#endif
 }
 // Destructor
 ExternalVoltage::~ExternalVoltage() {}
@@ -48,6 +55,7 @@ bool ExternalVoltage::addSingleMeasurementResult(void) {
     // Variables to store the results in
     float adcVoltage  = -9999;
     float calibResult = -9999;
+    bool  success     = false;
 
     // Check a measurement was *successfully* started (status bit 6 set)
     // Only go on to get a result if it was
@@ -77,6 +85,32 @@ bool ExternalVoltage::addSingleMeasurementResult(void) {
         // Begin ADC
         ads.begin();
 
+#if defined MS_USE_FIXED_POINT
+        // Read Analog to Digital Converter (ADC)
+        // Taking this reading includes the 8ms conversion delay.
+        // We get the raw counts and do the bit-to-volts conversion ourselves
+        // in fixed point
+        fixed_q16_t adcVoltageFixed =
+            adsGainOneCountsToFixedVolts(ads.readADC_SingleEnded(_adsChannel));
+        MS_DBG(F("  ads.readADC_SingleEnded("), _adsChannel, F("): "),
+               fixedToFloat(adcVoltageFixed), F("V"));
+
+        if (adcVoltageFixed < floatToFixed(3.6) &&
+            adcVoltageFixed > floatToFixed(-0.3)) {
+            // Skip results out of range
+            success = true;
+            // Apply the gain calculation, with a defualt gain of 10 V/V Gain
+            if (_fixedCalibration) {
+                fixed_q16_t calibResultFixed = fixedMul(adcVoltageFixed,
+                                                        _gainFixed);
+                MS_DBG(F("  calibResult:"), fixedToFloat(calibResultFixed));
+                verifyAndAddFixedResult(EXT_VOLTAGE_VAR_NUM, calibResultFixed);
+            } else {
+                calibResult = fixedToFloat(adcVoltageFixed) * _gain;
+                MS_DBG(F("  calibResult:"), calibResult);
+            }
+        }
+#else
         // Read Analog to Digital Converter (ADC)
         // Taking this reading includes the 8ms conversion delay.
         // We're allowing the ADS1115 library to do the bit-to-volts conversion
@@ -88,16 +122,20 @@ bool ExternalVoltage::addSingleMeasurementResult(void) {
 
         if (adcVoltage < 3.6 && adcVoltage > -0.3) {
             // Skip results out of range
+            success = true;
             // Apply the gain calculation, with a defualt gain of 10 V/V Gain
             calibResult = adcVoltage * _gain;
             MS_DBG(F("  calibResult:"), calibResult);
         } else {  // set invalid voltages back to -9999
             adcVoltage = -9999;
         }
+#endif
     } else {
         MS_DBG(getSensorNameAndLocation(), F("is not currently measuring!"));
     }
 
+    // With fixed point, a good result has already been added and this is
+    // -9999 unless the gain had to be applied as a float
     verifyAndAddMeasurementResult(EXT_VOLTAGE_VAR_NUM, calibResult);
 
     // Unset the time stamp for the beginning of this measurement
@@ -105,9 +143,5 @@ bool ExternalVoltage::addSingleMeasurementResult(void) {
     // Unset the status bits for a measurement request (bits 5 & 6)
     _sensorStatus &= 0b10011111;
 
-    if (adcVoltage < 3.6 && adcVoltage > -0.3) {
-        return true;
-    } else {
-        return false;
-    }
+    return success;
 }
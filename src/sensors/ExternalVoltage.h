@@ -287,6 +287,17 @@ class ExternalVoltage : public Sensor {
     uint8_t _adsChannel;
     float   _gain;
     uint8_t _i2cAddress;
+#if defined MS_USE_FIXED_POINT
+    /// @brief The gain as a Q16.16 number
+    fixed_q16_t _gainFixed;
+    /// @brief True if the result with the gain applied always fits in a
+    /// Q16.16 number
+    bool _fixedCalibration;
+#endif
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<EXT_VOLTAGE_NUM_VARIABLES> _results;
 };
 
 
@@ -316,8 +327,8 @@ class ExternalVoltage_Volt : public Variable {
         ExternalVoltage* parentSense, const char* uuid = "",
         const char* varCode = EXT_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)EXT_VOLTAGE_VAR_NUM,
-                   (uint8_t)EXT_VOLTAGE_RESOLUTION, EXT_VOLTAGE_VAR_NAME,
-                   EXT_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)EXT_VOLTAGE_RESOLUTION, F(EXT_VOLTAGE_VAR_NAME),
+                   F(EXT_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ExternalVoltage_Volt object.
      *
@@ -326,8 +337,8 @@ class ExternalVoltage_Volt : public Variable {
      */
     ExternalVoltage_Volt()
         : Variable((const uint8_t)EXT_VOLTAGE_VAR_NUM,
-                   (uint8_t)EXT_VOLTAGE_RESOLUTION, EXT_VOLTAGE_VAR_NAME,
-                   EXT_VOLTAGE_UNIT_NAME, EXT_VOLTAGE_DEFAULT_CODE) {}
+                   (uint8_t)EXT_VOLTAGE_RESOLUTION, F(EXT_VOLTAGE_VAR_NAME),
+                   F(EXT_VOLTAGE_UNIT_NAME), EXT_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ExternalVoltage_Volt object - no action needed.
      */
@@ -235,6 +235,10 @@ class MPL115A2 : public Sensor {
      * @brief An internal reference to the hardware Wire instance.
      */
     TwoWire* _i2c;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<MPL115A2_NUM_VARIABLES> _results;
 };
 
 
@@ -261,8 +265,8 @@ class MPL115A2_Temp : public Variable {
     explicit MPL115A2_Temp(MPL115A2* parentSense, const char* uuid = "",
                            const char* varCode = MPL115A2_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)MPL115A2_TEMP_VAR_NUM,
-                   (uint8_t)MPL115A2_TEMP_RESOLUTION, MPL115A2_TEMP_VAR_NAME,
-                   MPL115A2_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)MPL115A2_TEMP_RESOLUTION, F(MPL115A2_TEMP_VAR_NAME),
+                   F(MPL115A2_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MPL115A2_Temp object.
      *
@@ -270,8 +274,8 @@ class MPL115A2_Temp : public Variable {
      */
     MPL115A2_Temp()
         : Variable((const uint8_t)MPL115A2_TEMP_VAR_NUM,
-                   (uint8_t)MPL115A2_TEMP_RESOLUTION, MPL115A2_TEMP_VAR_NAME,
-                   MPL115A2_TEMP_UNIT_NAME, MPL115A2_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)MPL115A2_TEMP_RESOLUTION, F(MPL115A2_TEMP_VAR_NAME),
+                   F(MPL115A2_TEMP_UNIT_NAME), MPL115A2_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MPL115A2_Temp object - no action needed.
      */
@@ -304,8 +308,8 @@ class MPL115A2_Pressure : public Variable {
         const char* varCode = MPL115A2_PRESSURE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)MPL115A2_PRESSURE_VAR_NUM,
                    (uint8_t)MPL115A2_PRESSURE_RESOLUTION,
-                   MPL115A2_PRESSURE_VAR_NAME, MPL115A2_PRESSURE_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(MPL115A2_PRESSURE_VAR_NAME),
+                   F(MPL115A2_PRESSURE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MPL115A2_Pressure object.
      *
@@ -314,7 +318,8 @@ class MPL115A2_Pressure : public Variable {
     MPL115A2_Pressure()
         : Variable((const uint8_t)MPL115A2_PRESSURE_VAR_NUM,
                    (uint8_t)MPL115A2_PRESSURE_RESOLUTION,
-                   MPL115A2_PRESSURE_VAR_NAME, MPL115A2_PRESSURE_UNIT_NAME,
+                   F(MPL115A2_PRESSURE_VAR_NAME),
+                   F(MPL115A2_PRESSURE_UNIT_NAME),
                    MPL115A2_PRESSURE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MPL115A2_Pressure object - no action needed.
@@ -374,7 +374,9 @@ class InSituRDO : public SDI12Sensors {
                        "InSitu RDO PRO-X", INSITU_RDO_NUM_VARIABLES,
                        INSITU_RDO_WARM_UP_TIME_MS,
                        INSITU_RDO_STABILIZATION_TIME_MS,
-                       INSITU_RDO_MEASUREMENT_TIME_MS) {}
+                       INSITU_RDO_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc InSituRDO::InSituRDO
      */
@@ -384,7 +386,9 @@ class InSituRDO : public SDI12Sensors {
                        "InSitu RDO PRO-X", INSITU_RDO_NUM_VARIABLES,
                        INSITU_RDO_WARM_UP_TIME_MS,
                        INSITU_RDO_STABILIZATION_TIME_MS,
-                       INSITU_RDO_MEASUREMENT_TIME_MS) {}
+                       INSITU_RDO_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc InSituRDO::InSituRDO
      */
@@ -394,11 +398,19 @@ class InSituRDO : public SDI12Sensors {
                        "InSitu RDO PRO-X", INSITU_RDO_NUM_VARIABLES,
                        INSITU_RDO_WARM_UP_TIME_MS,
                        INSITU_RDO_STABILIZATION_TIME_MS,
-                       INSITU_RDO_MEASUREMENT_TIME_MS) {}
+                       INSITU_RDO_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the InSitu RDO object
      */
     ~InSituRDO() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<INSITU_RDO_NUM_VARIABLES> _results;
 };
 
 
@@ -428,7 +440,7 @@ class InSituRDO_DOmgL : public Variable {
         const char* varCode = INSITU_RDO_DOMGL_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INSITU_RDO_DOMGL_VAR_NUM,
                    (uint8_t)INSITU_RDO_DOMGL_RESOLUTION,
-                   INSITU_RDO_DOMGL_VAR_NAME, INSITU_RDO_DOMGL_UNIT_NAME,
+                   F(INSITU_RDO_DOMGL_VAR_NAME), F(INSITU_RDO_DOMGL_UNIT_NAME),
                    varCode, uuid) {}
     /**
      * @brief Construct a new InSituRDO_DOmgL object.
@@ -439,7 +451,7 @@ class InSituRDO_DOmgL : public Variable {
     InSituRDO_DOmgL()
         : Variable((const uint8_t)INSITU_RDO_DOMGL_VAR_NUM,
                    (uint8_t)INSITU_RDO_DOMGL_RESOLUTION,
-                   INSITU_RDO_DOMGL_VAR_NAME, INSITU_RDO_DOMGL_UNIT_NAME,
+                   F(INSITU_RDO_DOMGL_VAR_NAME), F(INSITU_RDO_DOMGL_UNIT_NAME),
                    INSITU_RDO_DOMGL_DEFAULT_CODE) {}
     /**
      * @brief Destroy the InSituRDO_DOmgL object - no action needed.
@@ -474,7 +486,7 @@ class InSituRDO_DOpct : public Variable {
         const char* varCode = INSITU_RDO_DOPCT_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INSITU_RDO_DOPCT_VAR_NUM,
                    (uint8_t)INSITU_RDO_DOPCT_RESOLUTION,
-                   INSITU_RDO_DOPCT_VAR_NAME, INSITU_RDO_DOPCT_UNIT_NAME,
+                   F(INSITU_RDO_DOPCT_VAR_NAME), F(INSITU_RDO_DOPCT_UNIT_NAME),
                    varCode, uuid) {}
     /**
      * @brief Construct a new InSituRDO_DOpct object.
@@ -485,7 +497,7 @@ class InSituRDO_DOpct : public Variable {
     InSituRDO_DOpct()
         : Variable((const uint8_t)INSITU_RDO_DOPCT_VAR_NUM,
                    (uint8_t)INSITU_RDO_DOPCT_RESOLUTION,
-                   INSITU_RDO_DOPCT_VAR_NAME, INSITU_RDO_DOPCT_UNIT_NAME,
+                   F(INSITU_RDO_DOPCT_VAR_NAME), F(INSITU_RDO_DOPCT_UNIT_NAME),
                    INSITU_RDO_DOPCT_DEFAULT_CODE) {}
     /**
      * @brief Destroy the InSituRDO_DOpct object - no action needed.
@@ -519,8 +531,8 @@ class InSituRDO_Temp : public Variable {
                             const char* varCode = INSITU_RDO_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INSITU_RDO_TEMP_VAR_NUM,
                    (uint8_t)INSITU_RDO_TEMP_RESOLUTION,
-                   INSITU_RDO_TEMP_VAR_NAME, INSITU_RDO_TEMP_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(INSITU_RDO_TEMP_VAR_NAME), F(INSITU_RDO_TEMP_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new InSituRDO_Temp object.
      *
@@ -530,7 +542,7 @@ class InSituRDO_Temp : public Variable {
     InSituRDO_Temp()
         : Variable((const uint8_t)INSITU_RDO_TEMP_VAR_NUM,
                    (uint8_t)INSITU_RDO_TEMP_RESOLUTION,
-                   INSITU_RDO_TEMP_VAR_NAME, INSITU_RDO_TEMP_UNIT_NAME,
+                   F(INSITU_RDO_TEMP_VAR_NAME), F(INSITU_RDO_TEMP_UNIT_NAME),
                    INSITU_RDO_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the InSituRDO_Temp object - no action needed.
@@ -565,8 +577,8 @@ class InSituRDO_Pressure : public Variable {
         const char* varCode = INSITU_RDO_PRESSURE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INSITU_RDO_PRESSURE_VAR_NUM,
                    (uint8_t)INSITU_RDO_PRESSURE_RESOLUTION,
-                   INSITU_RDO_PRESSURE_VAR_NAME, INSITU_RDO_PRESSURE_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(INSITU_RDO_PRESSURE_VAR_NAME),
+                   F(INSITU_RDO_PRESSURE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new InSituRDO_Pressure object.
      *
@@ -576,7 +588,8 @@ class InSituRDO_Pressure : public Variable {
     InSituRDO_Pressure()
         : Variable((const uint8_t)INSITU_RDO_PRESSURE_VAR_NUM,
                    (uint8_t)INSITU_RDO_PRESSURE_RESOLUTION,
-                   INSITU_RDO_PRESSURE_VAR_NAME, INSITU_RDO_PRESSURE_UNIT_NAME,
+                   F(INSITU_RDO_PRESSURE_VAR_NAME),
+                   F(INSITU_RDO_PRESSURE_UNIT_NAME),
                    INSITU_RDO_PRESSURE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the InSituRDO_Pressure object - no action needed.
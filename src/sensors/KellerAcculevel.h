@@ -164,7 +164,9 @@ class KellerAcculevel : public KellerParent {
               modbusAddress, stream, powerPin, powerPin2, enablePin,
               measurementsToAverage, Acculevel_kellerModel, "KellerAcculevel",
               KELLER_NUM_VARIABLES, ACCULEVEL_WARM_UP_TIME_MS,
-              ACCULEVEL_STABILIZATION_TIME_MS, ACCULEVEL_MEASUREMENT_TIME_MS) {}
+              ACCULEVEL_STABILIZATION_TIME_MS, ACCULEVEL_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc KellerAcculevel::KellerAcculevel
      */
@@ -175,9 +177,17 @@ class KellerAcculevel : public KellerParent {
               modbusAddress, stream, powerPin, powerPin2, enablePin,
               measurementsToAverage, Acculevel_kellerModel, "KellerAcculevel",
               KELLER_NUM_VARIABLES, ACCULEVEL_WARM_UP_TIME_MS,
-              ACCULEVEL_STABILIZATION_TIME_MS, ACCULEVEL_MEASUREMENT_TIME_MS) {}
+              ACCULEVEL_STABILIZATION_TIME_MS, ACCULEVEL_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     // Destructor
     ~KellerAcculevel() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<KELLER_NUM_VARIABLES> _results;
 };
 
 
@@ -207,8 +217,8 @@ class KellerAcculevel_Pressure : public Variable {
         const char* varCode = ACCULEVEL_PRESSURE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)KELLER_PRESSURE_VAR_NUM,
                    (uint8_t)ACCULEVEL_PRESSURE_RESOLUTION,
-                   KELLER_PRESSURE_VAR_NAME, KELLER_PRESSURE_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(KELLER_PRESSURE_VAR_NAME), F(KELLER_PRESSURE_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new KellerAcculevel_Pressure object.
      *
@@ -218,7 +228,7 @@ class KellerAcculevel_Pressure : public Variable {
     KellerAcculevel_Pressure()
         : Variable((const uint8_t)KELLER_PRESSURE_VAR_NUM,
                    (uint8_t)ACCULEVEL_PRESSURE_RESOLUTION,
-                   KELLER_PRESSURE_VAR_NAME, KELLER_PRESSURE_UNIT_NAME,
+                   F(KELLER_PRESSURE_VAR_NAME), F(KELLER_PRESSURE_UNIT_NAME),
                    ACCULEVEL_PRESSURE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the KellerAcculevel_Pressure object - no action needed.
@@ -252,8 +262,8 @@ class KellerAcculevel_Temp : public Variable {
         KellerAcculevel* parentSense, const char* uuid = "",
         const char* varCode = ACCULEVEL_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)KELLER_TEMP_VAR_NUM,
-                   (uint8_t)ACCULEVEL_TEMP_RESOLUTION, KELLER_TEMP_VAR_NAME,
-                   KELLER_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ACCULEVEL_TEMP_RESOLUTION, F(KELLER_TEMP_VAR_NAME),
+                   F(KELLER_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new KellerAcculevel_Temp object.
      *
@@ -262,8 +272,8 @@ class KellerAcculevel_Temp : public Variable {
      */
     KellerAcculevel_Temp()
         : Variable((const uint8_t)KELLER_TEMP_VAR_NUM,
-                   (uint8_t)ACCULEVEL_TEMP_RESOLUTION, KELLER_TEMP_VAR_NAME,
-                   KELLER_TEMP_UNIT_NAME, ACCULEVEL_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)ACCULEVEL_TEMP_RESOLUTION, F(KELLER_TEMP_VAR_NAME),
+                   F(KELLER_TEMP_UNIT_NAME), ACCULEVEL_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the KellerAcculevel_Temp object - no action needed.
      */
@@ -296,8 +306,9 @@ class KellerAcculevel_Height : public Variable {
         KellerAcculevel* parentSense, const char* uuid = "",
         const char* varCode = ACCULEVEL_HEIGHT_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)KELLER_HEIGHT_VAR_NUM,
-                   (uint8_t)ACCULEVEL_HEIGHT_RESOLUTION, KELLER_HEIGHT_VAR_NAME,
-                   KELLER_HEIGHT_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)ACCULEVEL_HEIGHT_RESOLUTION,
+                   F(KELLER_HEIGHT_VAR_NAME), F(KELLER_HEIGHT_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new KellerAcculevel_Height object.
      *
@@ -306,8 +317,9 @@ class KellerAcculevel_Height : public Variable {
      */
     KellerAcculevel_Height()
         : Variable((const uint8_t)KELLER_HEIGHT_VAR_NUM,
-                   (uint8_t)ACCULEVEL_HEIGHT_RESOLUTION, KELLER_HEIGHT_VAR_NAME,
-                   KELLER_HEIGHT_UNIT_NAME, ACCULEVEL_HEIGHT_DEFAULT_CODE) {}
+                   (uint8_t)ACCULEVEL_HEIGHT_RESOLUTION,
+                   F(KELLER_HEIGHT_VAR_NAME), F(KELLER_HEIGHT_UNIT_NAME),
+                   ACCULEVEL_HEIGHT_DEFAULT_CODE) {}
     /**
      * @brief Destroy the KellerAcculevel_Height object - no action needed.
      */
@@ -156,7 +156,9 @@ class KellerNanolevel : public KellerParent {
               modbusAddress, stream, powerPin, powerPin2, enablePin,
               measurementsToAverage, Nanolevel_kellerModel, "KellerNanolevel",
               KELLER_NUM_VARIABLES, NANOLEVEL_WARM_UP_TIME_MS,
-              NANOLEVEL_STABILIZATION_TIME_MS, NANOLEVEL_MEASUREMENT_TIME_MS) {}
+              NANOLEVEL_STABILIZATION_TIME_MS, NANOLEVEL_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc KellerNanolevel::KellerNanolevel
      */
@@ -167,9 +169,17 @@ class KellerNanolevel : public KellerParent {
               modbusAddress, stream, powerPin, powerPin2, enablePin,
               measurementsToAverage, Nanolevel_kellerModel, "KellerNanolevel",
               KELLER_NUM_VARIABLES, NANOLEVEL_WARM_UP_TIME_MS,
-              NANOLEVEL_STABILIZATION_TIME_MS, NANOLEVEL_MEASUREMENT_TIME_MS) {}
+              NANOLEVEL_STABILIZATION_TIME_MS, NANOLEVEL_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     // Destructor
     ~KellerNanolevel() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<KELLER_NUM_VARIABLES> _results;
 };
 
 
@@ -199,8 +209,8 @@ class KellerNanolevel_Pressure : public Variable {
         const char* varCode = NANOLEVEL_PRESSURE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)KELLER_PRESSURE_VAR_NUM,
                    (uint8_t)NANOLEVEL_PRESSURE_RESOLUTION,
-                   KELLER_PRESSURE_VAR_NAME, KELLER_PRESSURE_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(KELLER_PRESSURE_VAR_NAME), F(KELLER_PRESSURE_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new KellerNanolevel_Pressure object.
      *
@@ -210,7 +220,7 @@ class KellerNanolevel_Pressure : public Variable {
     KellerNanolevel_Pressure()
         : Variable((const uint8_t)KELLER_PRESSURE_VAR_NUM,
                    (uint8_t)NANOLEVEL_PRESSURE_RESOLUTION,
-                   KELLER_PRESSURE_VAR_NAME, KELLER_PRESSURE_UNIT_NAME,
+                   F(KELLER_PRESSURE_VAR_NAME), F(KELLER_PRESSURE_UNIT_NAME),
                    NANOLEVEL_PRESSURE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the KellerNanolevel_Pressure object - no action needed.
@@ -244,8 +254,8 @@ class KellerNanolevel_Temp : public Variable {
         KellerNanolevel* parentSense, const char* uuid = "",
         const char* varCode = NANOLEVEL_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)KELLER_TEMP_VAR_NUM,
-                   (uint8_t)NANOLEVEL_TEMP_RESOLUTION, KELLER_TEMP_VAR_NAME,
-                   KELLER_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)NANOLEVEL_TEMP_RESOLUTION, F(KELLER_TEMP_VAR_NAME),
+                   F(KELLER_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new KellerNanolevel_Temp object.
      *
@@ -254,8 +264,8 @@ class KellerNanolevel_Temp : public Variable {
      */
     KellerNanolevel_Temp()
         : Variable((const uint8_t)KELLER_TEMP_VAR_NUM,
-                   (uint8_t)NANOLEVEL_TEMP_RESOLUTION, KELLER_TEMP_VAR_NAME,
-                   KELLER_TEMP_UNIT_NAME, NANOLEVEL_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)NANOLEVEL_TEMP_RESOLUTION, F(KELLER_TEMP_VAR_NAME),
+                   F(KELLER_TEMP_UNIT_NAME), NANOLEVEL_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the KellerNanolevel_Temp object - no action needed.
      */
@@ -288,8 +298,9 @@ class KellerNanolevel_Height : public Variable {
         KellerNanolevel* parentSense, const char* uuid = "",
         const char* varCode = NANOLEVEL_HEIGHT_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)KELLER_HEIGHT_VAR_NUM,
-                   (uint8_t)NANOLEVEL_HEIGHT_RESOLUTION, KELLER_HEIGHT_VAR_NAME,
-                   KELLER_HEIGHT_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)NANOLEVEL_HEIGHT_RESOLUTION,
+                   F(KELLER_HEIGHT_VAR_NAME), F(KELLER_HEIGHT_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new KellerNanolevel_Height object.
      *
@@ -298,8 +309,9 @@ class KellerNanolevel_Height : public Variable {
      */
     KellerNanolevel_Height()
         : Variable((const uint8_t)KELLER_HEIGHT_VAR_NUM,
-                   (uint8_t)NANOLEVEL_HEIGHT_RESOLUTION, KELLER_HEIGHT_VAR_NAME,
-                   KELLER_HEIGHT_UNIT_NAME, NANOLEVEL_HEIGHT_DEFAULT_CODE) {}
+                   (uint8_t)NANOLEVEL_HEIGHT_RESOLUTION,
+                   F(KELLER_HEIGHT_VAR_NAME), F(KELLER_HEIGHT_UNIT_NAME),
+                   NANOLEVEL_HEIGHT_DEFAULT_CODE) {}
     /**
      * @brief Destroy the KellerNanolevel_Height object - no action needed.
      */
@@ -22,7 +22,9 @@ KellerParent::KellerParent(byte modbusAddress, Stream* stream, int8_t powerPin,
     : Sensor(sensName, numVariables, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, -1, measurementsToAverage),
       _ksensor(), _model(model), _modbusAddress(modbusAddress), _stream(stream),
-      _RS485EnablePin(enablePin), _powerPin2(powerPin2) {}
+      _RS485EnablePin(enablePin), _powerPin2(powerPin2) {
+    setInrushClass(SENSOR_INRUSH_MEDIUM);
+}
 KellerParent::KellerParent(byte modbusAddress, Stream& stream, int8_t powerPin,
                            int8_t powerPin2, int8_t enablePin,
                            uint8_t measurementsToAverage, kellerModel model,
@@ -33,7 +35,9 @@ KellerParent::KellerParent(byte modbusAddress, Stream& stream, int8_t powerPin,
     : Sensor(sensName, numVariables, warmUpTime_ms, stabilizationTime_ms,
              measurementTime_ms, powerPin, -1, measurementsToAverage),
       _ksensor(), _model(model), _modbusAddress(modbusAddress),
-      _stream(&stream), _RS485EnablePin(enablePin), _powerPin2(powerPin2) {}
+      _stream(&stream), _RS485EnablePin(enablePin), _powerPin2(powerPin2) {
+    setInrushClass(SENSOR_INRUSH_MEDIUM);
+}
 // Destructor
 KellerParent::~KellerParent() {}
 
@@ -134,11 +138,12 @@ bool KellerParent::addSingleMeasurementResult(void) {
         MS_DBG(getSensorNameAndLocation(), F("is reporting:"));
 
         // Get Values
-        success     = _ksensor.getValues(waterPressureBar, waterTempertureC);
-        waterDepthM = _ksensor.calcWaterDepthM(
-            waterPressureBar,
-            waterTempertureC);  // float calcWaterDepthM(float waterPressureBar,
-                                // float waterTempertureC)
+        success = _ksensor.getValues(waterPressureBar, waterTempertureC);
+        // Only work out the depth if anything will use it
+        if (isResultRequested(KELLER_HEIGHT_VAR_NUM)) {
+            waterDepthM = _ksensor.calcWaterDepthM(waterPressureBar,
+                                                   waterTempertureC);
+        }
 
         // Fix not-a-number values
         if (!success || isnan(waterPressureBar)) waterPressureBar = -9999;
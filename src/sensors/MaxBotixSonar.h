@@ -240,6 +240,10 @@ class MaxBotixSonar : public Sensor {
  private:
     int8_t  _triggerPin;
     Stream* _stream;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<HRXL_NUM_VARIABLES> _results;
 };
 
 
@@ -268,8 +272,8 @@ class MaxBotixSonar_Range : public Variable {
                                  const char*    uuid    = "",
                                  const char*    varCode = HRXL_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)HRXL_VAR_NUM,
-                   (uint8_t)HRXL_RESOLUTION, HRXL_VAR_NAME, HRXL_UNIT_NAME,
-                   varCode, uuid) {}
+                   (uint8_t)HRXL_RESOLUTION, F(HRXL_VAR_NAME),
+                   F(HRXL_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MaxBotixSonar_Range object.
      *
@@ -278,7 +282,7 @@ class MaxBotixSonar_Range : public Variable {
      */
     MaxBotixSonar_Range()
         : Variable((const uint8_t)HRXL_VAR_NUM, (uint8_t)HRXL_RESOLUTION,
-                   HRXL_VAR_NAME, HRXL_UNIT_NAME, HRXL_DEFAULT_CODE) {}
+                   F(HRXL_VAR_NAME), F(HRXL_UNIT_NAME), HRXL_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MaxBotixSonar_Range object - no action needed.
      */
@@ -18,6 +18,9 @@ MaximDS18::MaximDS18(DeviceAddress OneWireAddress, int8_t powerPin,
              DS18_STABILIZATION_TIME_MS, DS18_MEASUREMENT_TIME_MS, powerPin,
              dataPin, measurementsToAverage),
       _internalOneWire(dataPin), _internalDallasTemp(&_internalOneWire) {
+    setResultArrays(_results);
+    setCurrents(DS18_ACTIVE_CURRENT_MA, DS18_IDLE_CURRENT_MA,
+                DS18_SLEEP_CURRENT_MA);
     for (uint8_t i = 0; i < 8; i++) _OneWireAddress[i] = OneWireAddress[i];
     // _OneWireAddress = OneWireAddress;
     _addressKnown = true;
@@ -31,6 +34,9 @@ MaximDS18::MaximDS18(int8_t powerPin, int8_t dataPin,
              DS18_STABILIZATION_TIME_MS, DS18_MEASUREMENT_TIME_MS, powerPin,
              dataPin, measurementsToAverage),
       _internalOneWire(dataPin), _internalDallasTemp(&_internalOneWire) {
+    setResultArrays(_results);
+    setCurrents(DS18_ACTIVE_CURRENT_MA, DS18_IDLE_CURRENT_MA,
+                DS18_SLEEP_CURRENT_MA);
     _addressKnown = false;
 }
 // Destructor
@@ -60,6 +66,12 @@ String MaximDS18::getSensorLocation(void) {
 }
 
 
+// The address isn't known before setup, so key the boot cache on the pin
+uint16_t MaximDS18::getBootCacheKey(void) {
+    return 0xD500 | (uint8_t)_dataPin;
+}
+
+
 // The function to set up connection to a sensor.
 // By default, sets pin modes and returns ready
 bool MaximDS18::setup(void) {
@@ -83,6 +95,12 @@ bool MaximDS18::setup(void) {
             address;  // create a variable to put the found address into
         ntries          = 0;
         bool gotAddress = false;
+        // Try the address found at the last boot before searching the bus
+        if (readBootCache(address, 8) &&
+            _internalDallasTemp.isConnected(address)) {
+            MS_DBG(F("Using the address found at the last boot"));
+            gotAddress = true;
+        }
         // Try 5 times to get an address
         while (!gotAddress && ntries < 5) {
             gotAddress = _internalOneWire.search(address);
@@ -92,6 +110,7 @@ bool MaximDS18::setup(void) {
             MS_DBG(F("Sensor found at"), makeAddressString(address));
             for (uint8_t i = 0; i < 8; i++) _OneWireAddress[i] = address[i];
             _addressKnown = true;  // Now we know the address
+            writeBootCache(address, 8);
         } else {
             MS_DBG(F("Unable to find address for DS18 on pin"), _dataPin);
             retVal = false;
@@ -119,6 +119,22 @@
 #define DS18_MEASUREMENT_TIME_MS 750
 /**@}*/
 
+/**
+ * @anchor sensor_ds18_current
+ * @name Sensor Current
+ * The maximum supply currents for a Maxim DS18B20 from the datasheet, used for
+ * the [energy estimates](@ref sensor_energy)
+ */
+/**@{*/
+/// @brief Sensor::_activeCurrent_mA; the DS18B20 draws up to 1.5 mA during a
+/// temperature conversion.
+#define DS18_ACTIVE_CURRENT_MA 1.5
+/// @brief Sensor::_idleCurrent_mA; the DS18B20 draws up to 1 µA in standby.
+#define DS18_IDLE_CURRENT_MA 0.001
+/// @brief Sensor::_sleepCurrent_mA; the DS18B20 draws up to 1 µA in standby.
+#define DS18_SLEEP_CURRENT_MA 0.001
+/**@}*/
+
 /**
  * @anchor sensor_ds18_temp
  * @name Temperature
@@ -227,6 +243,15 @@ class MaximDS18 : public Sensor {
      * @copydoc Sensor::getSensorLocation()
      */
     String getSensorLocation(void) override;
+    /**
+     * @brief Get the key this sensor's record is kept under in the boot cache.
+     *
+     * The location of a DS18 includes its address, which may only be found
+     * during setup, so the key is made from the data pin alone.
+     *
+     * @return **uint16_t** The boot cache key
+     */
+    uint16_t getBootCacheKey(void) override;
 
     /**
      * @brief Tell the sensor to start a single measurement, if needed.
@@ -256,6 +281,10 @@ class MaximDS18 : public Sensor {
     DallasTemperature _internalDallasTemp;
     // Turns the address into a printable string
     String makeAddressString(DeviceAddress OneWireAddress);
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<DS18_NUM_VARIABLES> _results;
 };
 
 
@@ -282,8 +311,8 @@ class MaximDS18_Temp : public Variable {
     explicit MaximDS18_Temp(MaximDS18* parentSense, const char* uuid = "",
                             const char* varCode = DS18_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DS18_TEMP_VAR_NUM,
-                   (uint8_t)DS18_TEMP_RESOLUTION, DS18_TEMP_VAR_NAME,
-                   DS18_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DS18_TEMP_RESOLUTION, F(DS18_TEMP_VAR_NAME),
+                   F(DS18_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MaximDS18_Temp object.
      *
@@ -291,8 +320,8 @@ class MaximDS18_Temp : public Variable {
      */
     MaximDS18_Temp()
         : Variable((const uint8_t)DS18_TEMP_VAR_NUM,
-                   (uint8_t)DS18_TEMP_RESOLUTION, DS18_TEMP_VAR_NAME,
-                   DS18_TEMP_UNIT_NAME, DS18_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)DS18_TEMP_RESOLUTION, F(DS18_TEMP_VAR_NAME),
+                   F(DS18_TEMP_UNIT_NAME), DS18_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MaximDS18_Temp object - no action needed.
      */
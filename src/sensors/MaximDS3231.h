@@ -186,6 +186,12 @@ class MaximDS3231 : public Sensor {
      * @copydoc Sensor::addSingleMeasurementResult()
      */
     bool addSingleMeasurementResult(void) override;
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<DS3231_NUM_VARIABLES> _results;
 };
 
 
@@ -212,8 +218,8 @@ class MaximDS3231_Temp : public Variable {
     explicit MaximDS3231_Temp(MaximDS3231* parentSense, const char* uuid = "",
                               const char* varCode = DS3231_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DS3231_TEMP_VAR_NUM,
-                   (uint8_t)DS3231_TEMP_RESOLUTION, DS3231_TEMP_VAR_NAME,
-                   DS3231_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DS3231_TEMP_RESOLUTION, F(DS3231_TEMP_VAR_NAME),
+                   F(DS3231_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MaximDS3231_Temp object.
      *
@@ -221,8 +227,8 @@ class MaximDS3231_Temp : public Variable {
      */
     MaximDS3231_Temp()
         : Variable((const uint8_t)DS3231_TEMP_VAR_NUM,
-                   (uint8_t)DS3231_TEMP_RESOLUTION, DS3231_TEMP_VAR_NAME,
-                   DS3231_TEMP_UNIT_NAME, DS3231_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)DS3231_TEMP_RESOLUTION, F(DS3231_TEMP_VAR_NAME),
+                   F(DS3231_TEMP_UNIT_NAME), DS3231_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MaximDS3231_Temp object - no action needed.
      */
@@ -18,6 +18,7 @@ MeaSpecMS5803::MeaSpecMS5803(int8_t powerPin, uint8_t i2cAddressHex,
     : Sensor("MeaSpecMS5803", MS5803_NUM_VARIABLES, MS5803_WARM_UP_TIME_MS,
              MS5803_STABILIZATION_TIME_MS, MS5803_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
     _maxPressure   = maxPressure;
 }
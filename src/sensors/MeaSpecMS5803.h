@@ -257,6 +257,10 @@ class MeaSpecMS5803 : public Sensor {
      * @brief Maximum pressure supported by the MS5803.
      */
     int16_t _maxPressure;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<MS5803_NUM_VARIABLES> _results;
 };
 
 
@@ -285,8 +289,8 @@ class MeaSpecMS5803_Temp : public Variable {
                                 const char*    uuid = "",
                                 const char* varCode = MS5803_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)MS5803_TEMP_VAR_NUM,
-                   (uint8_t)MS5803_TEMP_RESOLUTION, MS5803_TEMP_VAR_NAME,
-                   MS5803_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)MS5803_TEMP_RESOLUTION, F(MS5803_TEMP_VAR_NAME),
+                   F(MS5803_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MeaSpecMS5803_Temp object.
      *
@@ -295,8 +299,8 @@ class MeaSpecMS5803_Temp : public Variable {
      */
     MeaSpecMS5803_Temp()
         : Variable((const uint8_t)MS5803_TEMP_VAR_NUM,
-                   (uint8_t)MS5803_TEMP_RESOLUTION, MS5803_TEMP_VAR_NAME,
-                   MS5803_TEMP_UNIT_NAME, MS5803_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)MS5803_TEMP_RESOLUTION, F(MS5803_TEMP_VAR_NAME),
+                   F(MS5803_TEMP_UNIT_NAME), MS5803_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MeaSpecMS5803_Temp object - no action needed.
      */
@@ -331,8 +335,8 @@ class MeaSpecMS5803_Pressure : public Variable {
         const char* varCode = MS5803_PRESSURE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)MS5803_PRESSURE_VAR_NUM,
                    (uint8_t)MS5803_PRESSURE_RESOLUTION,
-                   MS5803_PRESSURE_VAR_NAME, MS5803_PRESSURE_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(MS5803_PRESSURE_VAR_NAME), F(MS5803_PRESSURE_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new MeaSpecMS5803_Pressure object.
      *
@@ -342,7 +346,7 @@ class MeaSpecMS5803_Pressure : public Variable {
     MeaSpecMS5803_Pressure()
         : Variable((const uint8_t)MS5803_PRESSURE_VAR_NUM,
                    (uint8_t)MS5803_PRESSURE_RESOLUTION,
-                   MS5803_PRESSURE_VAR_NAME, MS5803_PRESSURE_UNIT_NAME,
+                   F(MS5803_PRESSURE_VAR_NAME), F(MS5803_PRESSURE_UNIT_NAME),
                    MS5803_PRESSURE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MeaSpecMS5803_Pressure object - no action needed.
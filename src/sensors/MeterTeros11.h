@@ -247,7 +247,9 @@ class MeterTeros11 : public SDI12Sensors {
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "MeterTeros11", TEROS11_NUM_VARIABLES,
                        TEROS11_WARM_UP_TIME_MS, TEROS11_STABILIZATION_TIME_MS,
-                       TEROS11_MEASUREMENT_TIME_MS) {}
+                       TEROS11_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc MeterTeros11::MeterTeros11
      */
@@ -256,7 +258,9 @@ class MeterTeros11 : public SDI12Sensors {
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "MeterTeros11", TEROS11_NUM_VARIABLES,
                        TEROS11_WARM_UP_TIME_MS, TEROS11_STABILIZATION_TIME_MS,
-                       TEROS11_MEASUREMENT_TIME_MS) {}
+                       TEROS11_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc MeterTeros11::MeterTeros11
      */
@@ -265,7 +269,9 @@ class MeterTeros11 : public SDI12Sensors {
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "MeterTeros11", TEROS11_NUM_VARIABLES,
                        TEROS11_WARM_UP_TIME_MS, TEROS11_STABILIZATION_TIME_MS,
-                       TEROS11_MEASUREMENT_TIME_MS) {}
+                       TEROS11_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Meter Teros 11 object
      */
@@ -275,6 +281,12 @@ class MeterTeros11 : public SDI12Sensors {
      * @copydoc Sensor::addSingleMeasurementResult()
      */
     bool addSingleMeasurementResult(void) override;
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<TEROS11_NUM_VARIABLES> _results;
 };
 
 
@@ -303,8 +315,8 @@ class MeterTeros11_Ea : public Variable {
     explicit MeterTeros11_Ea(MeterTeros11* parentSense, const char* uuid = "",
                              const char* varCode = TEROS11_EA_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TEROS11_EA_VAR_NUM,
-                   (uint8_t)TEROS11_EA_RESOLUTION, TEROS11_EA_VAR_NAME,
-                   TEROS11_EA_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)TEROS11_EA_RESOLUTION, F(TEROS11_EA_VAR_NAME),
+                   F(TEROS11_EA_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MeterTeros11_Ea object.
      *
@@ -312,8 +324,8 @@ class MeterTeros11_Ea : public Variable {
      */
     MeterTeros11_Ea()
         : Variable((const uint8_t)TEROS11_EA_VAR_NUM,
-                   (uint8_t)TEROS11_EA_RESOLUTION, TEROS11_EA_VAR_NAME,
-                   TEROS11_EA_UNIT_NAME, TEROS11_EA_DEFAULT_CODE) {}
+                   (uint8_t)TEROS11_EA_RESOLUTION, F(TEROS11_EA_VAR_NAME),
+                   F(TEROS11_EA_UNIT_NAME), TEROS11_EA_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MeterTeros11_Ea object - no action needed.
      */
@@ -345,8 +357,8 @@ class MeterTeros11_Temp : public Variable {
     explicit MeterTeros11_Temp(MeterTeros11* parentSense, const char* uuid = "",
                                const char* varCode = TEROS11_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TEROS11_TEMP_VAR_NUM,
-                   (uint8_t)TEROS11_TEMP_RESOLUTION, TEROS11_TEMP_VAR_NAME,
-                   TEROS11_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)TEROS11_TEMP_RESOLUTION, F(TEROS11_TEMP_VAR_NAME),
+                   F(TEROS11_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MeterTeros11_Temp object.
      *
@@ -354,8 +366,8 @@ class MeterTeros11_Temp : public Variable {
      */
     MeterTeros11_Temp()
         : Variable((const uint8_t)TEROS11_TEMP_VAR_NUM,
-                   (uint8_t)TEROS11_TEMP_RESOLUTION, TEROS11_TEMP_VAR_NAME,
-                   TEROS11_TEMP_UNIT_NAME, TEROS11_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)TEROS11_TEMP_RESOLUTION, F(TEROS11_TEMP_VAR_NAME),
+                   F(TEROS11_TEMP_UNIT_NAME), TEROS11_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MeterTeros11_Temp object - no action needed.
      */
@@ -387,8 +399,8 @@ class MeterTeros11_VWC : public Variable {
     explicit MeterTeros11_VWC(MeterTeros11* parentSense, const char* uuid = "",
                               const char* varCode = TEROS11_VWC_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TEROS11_VWC_VAR_NUM,
-                   (uint8_t)TEROS11_VWC_RESOLUTION, TEROS11_VWC_VAR_NAME,
-                   TEROS11_VWC_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)TEROS11_VWC_RESOLUTION, F(TEROS11_VWC_VAR_NAME),
+                   F(TEROS11_VWC_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new MeterTeros11_VWC object.
      *
@@ -396,8 +408,8 @@ class MeterTeros11_VWC : public Variable {
      */
     MeterTeros11_VWC()
         : Variable((const uint8_t)TEROS11_VWC_VAR_NUM,
-                   (uint8_t)TEROS11_VWC_RESOLUTION, TEROS11_VWC_VAR_NAME,
-                   TEROS11_VWC_UNIT_NAME, TEROS11_VWC_DEFAULT_CODE) {}
+                   (uint8_t)TEROS11_VWC_RESOLUTION, F(TEROS11_VWC_VAR_NAME),
+                   F(TEROS11_VWC_UNIT_NAME), TEROS11_VWC_DEFAULT_CODE) {}
     /**
      * @brief Destroy the MeterTeros11_VWC object - no action needed.
      */
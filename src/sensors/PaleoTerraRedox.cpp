@@ -23,6 +23,7 @@ PaleoTerraRedox::PaleoTerraRedox(SoftwareWire* theI2C, int8_t powerPin,
     : Sensor("PaleoTerraRedox", PTR_NUM_VARIABLES, PTR_WARM_UP_TIME_MS,
              PTR_STABILIZATION_TIME_MS, PTR_MEASUREMENT_TIME_MS, powerPin, -1,
              measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = theI2C;
     createdSoftwareWire = false;
@@ -33,6 +34,7 @@ PaleoTerraRedox::PaleoTerraRedox(int8_t powerPin, int8_t dataPin,
     : Sensor("PaleoTerraRedox", PTR_NUM_VARIABLES, PTR_WARM_UP_TIME_MS,
              PTR_STABILIZATION_TIME_MS, PTR_MEASUREMENT_TIME_MS, powerPin,
              dataPin, measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex      = i2cAddressHex;
     _i2c                = new SoftwareWire(dataPin, clockPin);
     createdSoftwareWire = true;
@@ -44,6 +46,7 @@ PaleoTerraRedox::PaleoTerraRedox(TwoWire* theI2C, int8_t powerPin,
     : Sensor("PaleoTerraRedox", PTR_NUM_VARIABLES, PTR_WARM_UP_TIME_MS,
              PTR_STABILIZATION_TIME_MS, PTR_MEASUREMENT_TIME_MS, powerPin, -1,
              measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
     _i2c           = theI2C;
 }
@@ -52,6 +55,7 @@ PaleoTerraRedox::PaleoTerraRedox(int8_t powerPin, uint8_t i2cAddressHex,
     : Sensor("PaleoTerraRedox", PTR_NUM_VARIABLES, PTR_WARM_UP_TIME_MS,
              PTR_STABILIZATION_TIME_MS, PTR_MEASUREMENT_TIME_MS, powerPin,
              measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
     _i2c           = &Wire;
 }
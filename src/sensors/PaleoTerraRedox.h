@@ -273,6 +273,10 @@ class PaleoTerraRedox : public Sensor {
      */
     TwoWire* _i2c;  // Hardware Wire
 #endif
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<PTR_NUM_VARIABLES> _results;
 };
 
 
@@ -299,8 +303,8 @@ class PaleoTerraRedox_Volt : public Variable {
         Sensor* parentSense, const char* uuid = "",
         const char* varCode = PTR_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)PTR_VOLTAGE_VAR_NUM,
-                   (uint8_t)PTR_VOLTAGE_RESOLUTION, PTR_VOLTAGE_VAR_NAME,
-                   PTR_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)PTR_VOLTAGE_RESOLUTION, F(PTR_VOLTAGE_VAR_NAME),
+                   F(PTR_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new PaleoTerraRedox_Volt object.
      *
@@ -309,8 +313,8 @@ class PaleoTerraRedox_Volt : public Variable {
      */
     PaleoTerraRedox_Volt()
         : Variable((const uint8_t)PTR_VOLTAGE_VAR_NUM,
-                   (uint8_t)PTR_VOLTAGE_RESOLUTION, PTR_VOLTAGE_VAR_NAME,
-                   PTR_VOLTAGE_UNIT_NAME, PTR_VOLTAGE_DEFAULT_CODE) {}
+                   (uint8_t)PTR_VOLTAGE_RESOLUTION, F(PTR_VOLTAGE_VAR_NAME),
+                   F(PTR_VOLTAGE_UNIT_NAME), PTR_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the PaleoTerraRedox_Volt object - no action needed.
      */
@@ -97,6 +97,7 @@ ProcessorStats::ProcessorStats(const char* version)
     : Sensor(BOARD, PROCESSOR_NUM_VARIABLES, PROCESSOR_WARM_UP_TIME_MS,
              PROCESSOR_STABILIZATION_TIME_MS, PROCESSOR_MEASUREMENT_TIME_MS, -1,
              -1, 1) {
+    setResultArrays(_results);
     _version = version;
     sampNum  = 0;
 
@@ -116,6 +117,40 @@ ProcessorStats::ProcessorStats(const char* version)
 #else
     _batteryPin         = -1;
 #endif
+
+    // Work out the battery voltage per ADC count once, so the measurement is a
+    // single multiplication
+    _batteryMultiplier = 0;
+#if defined(ARDUINO_AVR_ENVIRODIY_MAYFLY)
+    if (strcmp(_version, "v0.3") == 0 || strcmp(_version, "v0.4") == 0) {
+        _batteryMultiplier = (3.3 / 1023.) * 1.47;
+    }
+    if (strcmp(_version, "v0.5") == 0 || strcmp(_version, "v0.5b") == 0) {
+        _batteryMultiplier = (3.3 / 1023.) * 4.7;
+    }
+
+#elif defined(ARDUINO_AVR_FEATHER32U4) || defined(ARDUINO_SAMD_FEATHER_M0) || \
+    defined(ARDUINO_SAMD_FEATHER_M0_EXPRESS)
+    // we divided by 2, so multiply back, then multiply by 3.3V, our reference
+    // voltage, and convert to voltage
+    _batteryMultiplier = 2 * 3.3 / 1024;
+
+#elif defined(ARDUINO_SODAQ_ONE) || defined(ARDUINO_SODAQ_ONE_BETA)
+    if (strcmp(_version, "v0.1") == 0) {
+        _batteryMultiplier = (3.3 / 1023.) * 2;
+    }
+    if (strcmp(_version, "v0.2") == 0) {
+        _batteryMultiplier = (3.3 / 1023.) * 1.47;
+    }
+
+#elif defined(ARDUINO_AVR_SODAQ_NDOGO) || defined(ARDUINO_SODAQ_AUTONOMO) || \
+    defined(ARDUINO_AVR_SODAQ_MBILI)
+    _batteryMultiplier = (3.3 / 1023.) * 1.47;
+#endif
+
+#if defined MS_USE_FIXED_POINT
+    _batteryMultiplierFixed = floatToFixed(_batteryMultiplier);
+#endif
 }
 // Destructor
 ProcessorStats::~ProcessorStats() {}
@@ -136,73 +171,52 @@ int16_t FreeRam() {
 #endif
 
 
-bool ProcessorStats::addSingleMeasurementResult(void) {
-    // Get the battery voltage
-    MS_DBG(F("Getting battery voltage"));
-
-    float sensorValue_battery = -9999;
-
-#if defined(ARDUINO_AVR_ENVIRODIY_MAYFLY)
-    if (strcmp(_version, "v0.3") == 0 || strcmp(_version, "v0.4") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 1.47 * rawBattery;
-    }
-    if (strcmp(_version, "v0.5") == 0 || strcmp(_version, "v0.5b") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 4.7 * rawBattery;
+float ProcessorStats::getInstantValue(uint8_t resultNumber) {
+    if (resultNumber != PROCESSOR_BATTERY_VAR_NUM || _batteryMultiplier <= 0) {
+        return -9999;
     }
+    return _batteryMultiplier * analogRead(_batteryPin);
+}
 
-#elif defined(ARDUINO_AVR_FEATHER32U4) || defined(ARDUINO_SAMD_FEATHER_M0) || \
-    defined(ARDUINO_SAMD_FEATHER_M0_EXPRESS)
-    float measuredvbat = analogRead(_batteryPin);
-    measuredvbat *= 2;     // we divided by 2, so multiply back
-    measuredvbat *= 3.3;   // Multiply by 3.3V, our reference voltage
-    measuredvbat /= 1024;  // convert to voltage
-    sensorValue_battery       = measuredvbat;
-
-#elif defined(ARDUINO_SODAQ_ONE) || defined(ARDUINO_SODAQ_ONE_BETA)
-    if (strcmp(_version, "v0.1") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 2 * rawBattery;
-    }
-    if (strcmp(_version, "v0.2") == 0) {
-        // Get the battery voltage
-        float rawBattery    = analogRead(_batteryPin);
-        sensorValue_battery = (3.3 / 1023.) * 1.47 * rawBattery;
-    }
 
-#elif defined(ARDUINO_AVR_SODAQ_NDOGO) || defined(ARDUINO_SODAQ_AUTONOMO) || \
-    defined(ARDUINO_AVR_SODAQ_MBILI)
+bool ProcessorStats::addSingleMeasurementResult(void) {
     // Get the battery voltage
-    float rawBattery    = analogRead(_batteryPin);
-    sensorValue_battery = (3.3 / 1023.) * 1.47 * rawBattery;
+    MS_DBG(F("Getting battery voltage"));
 
+    // Skip the analog read if nothing will use the battery voltage
+    if (_batteryMultiplier > 0 &&
+        isResultRequested(PROCESSOR_BATTERY_VAR_NUM)) {
+        // Get the battery voltage
+        uint16_t rawBattery = analogRead(_batteryPin);
+#if defined MS_USE_FIXED_POINT
+        // The raw reading is an integer, so this is one integer multiply
+        verifyAndAddFixedResult(
+            PROCESSOR_BATTERY_VAR_NUM,
+            analogCountsToFixed(rawBattery, _batteryMultiplierFixed));
 #else
-    sensorValue_battery = -9999;
-
+        verifyAndAddMeasurementResult(PROCESSOR_BATTERY_VAR_NUM,
+                                      _batteryMultiplier * rawBattery);
 #endif
-
-    verifyAndAddMeasurementResult(PROCESSOR_BATTERY_VAR_NUM,
-                                  sensorValue_battery);
+    } else {
+        verifyAndAddMeasurementResult(PROCESSOR_BATTERY_VAR_NUM,
+                                      (float)-9999);
+    }
 
     // Used only for debugging - can be removed
-    MS_DBG(F("Getting Free RAM"));
+    float sensorValue_freeRam = -9999;
+    if (isResultRequested(PROCESSOR_RAM_VAR_NUM)) {
+        MS_DBG(F("Getting Free RAM"));
 
 #if defined __AVR__ || defined ARDUINO_ARCH_AVR
-    extern int16_t __heap_start, *__brkval;
-    int16_t        v;
-    float          sensorValue_freeRam = (int)&v -
-        (__brkval == 0 ? (int)&__heap_start : (int)__brkval);
+        extern int16_t __heap_start, *__brkval;
+        int16_t        v;
+        sensorValue_freeRam = (int)&v -
+            (__brkval == 0 ? (int)&__heap_start : (int)__brkval);
 
 #elif defined(ARDUINO_ARCH_SAMD)
-    float sensorValue_freeRam = FreeRam();
-
-#else
-    float sensorValue_freeRam = -9999;
+        sensorValue_freeRam = FreeRam();
 #endif
+    }
 
     verifyAndAddMeasurementResult(PROCESSOR_RAM_VAR_NUM, sensorValue_freeRam);
 
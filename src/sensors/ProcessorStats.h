@@ -230,10 +230,33 @@ class ProcessorStats : public Sensor {
      */
     bool addSingleMeasurementResult(void) override;
 
+    /**
+     * @copydoc Sensor::getInstantValue()
+     *
+     * Only the battery voltage can be read this way; it is a single analog
+     * read, so the sample number isn't advanced.
+     */
+    float getInstantValue(uint8_t resultNumber) override;
+
  private:
     const char* _version;
     int8_t      _batteryPin;
     int16_t     sampNum;
+    /**
+     * @brief The battery voltage for each count of the processor's ADC,
+     * including the board's voltage divider; 0 if unknown.
+     */
+    float _batteryMultiplier;
+#if defined MS_USE_FIXED_POINT
+    /**
+     * @brief #_batteryMultiplier as a Q16.16 number
+     */
+    fixed_q16_t _batteryMultiplierFixed;
+#endif
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<PROCESSOR_NUM_VARIABLES> _results;
 };
 
 
@@ -261,8 +284,8 @@ class ProcessorStats_Battery : public Variable {
         const char* varCode = PROCESSOR_BATTERY_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)PROCESSOR_BATTERY_VAR_NUM,
                    (uint8_t)PROCESSOR_BATTERY_RESOLUTION,
-                   PROCESSOR_BATTERY_VAR_NAME, PROCESSOR_BATTERY_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(PROCESSOR_BATTERY_VAR_NAME),
+                   F(PROCESSOR_BATTERY_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ProcessorStats_Battery object.
      *
@@ -272,7 +295,8 @@ class ProcessorStats_Battery : public Variable {
     ProcessorStats_Battery()
         : Variable((const uint8_t)PROCESSOR_BATTERY_VAR_NUM,
                    (uint8_t)PROCESSOR_BATTERY_RESOLUTION,
-                   PROCESSOR_BATTERY_VAR_NAME, PROCESSOR_BATTERY_UNIT_NAME,
+                   F(PROCESSOR_BATTERY_VAR_NAME),
+                   F(PROCESSOR_BATTERY_UNIT_NAME),
                    PROCESSOR_BATTERY_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ProcessorStats_Battery object - no action needed.
@@ -311,8 +335,8 @@ class ProcessorStats_FreeRam : public Variable {
         ProcessorStats* parentSense, const char* uuid = "",
         const char* varCode = PROCESSOR_RAM_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)PROCESSOR_RAM_VAR_NUM,
-                   (uint8_t)PROCESSOR_RAM_RESOLUTION, PROCESSOR_RAM_VAR_NAME,
-                   PROCESSOR_RAM_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)PROCESSOR_RAM_RESOLUTION, F(PROCESSOR_RAM_VAR_NAME),
+                   F(PROCESSOR_RAM_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ProcessorStats_FreeRam object.
      *
@@ -321,8 +345,8 @@ class ProcessorStats_FreeRam : public Variable {
      */
     ProcessorStats_FreeRam()
         : Variable((const uint8_t)PROCESSOR_RAM_VAR_NUM,
-                   (uint8_t)PROCESSOR_RAM_RESOLUTION, PROCESSOR_RAM_VAR_NAME,
-                   PROCESSOR_RAM_UNIT_NAME, PROCESSOR_RAM_DEFAULT_CODE) {}
+                   (uint8_t)PROCESSOR_RAM_RESOLUTION, F(PROCESSOR_RAM_VAR_NAME),
+                   F(PROCESSOR_RAM_UNIT_NAME), PROCESSOR_RAM_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ProcessorStats_FreeRam object - no action needed.
      */
@@ -359,8 +383,8 @@ class ProcessorStats_SampleNumber : public Variable {
         const char* varCode = PROCESSOR_SAMPNUM_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)PROCESSOR_SAMPNUM_VAR_NUM,
                    (uint8_t)PROCESSOR_SAMPNUM_RESOLUTION,
-                   PROCESSOR_SAMPNUM_VAR_NAME, PROCESSOR_SAMPNUM_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(PROCESSOR_SAMPNUM_VAR_NAME),
+                   F(PROCESSOR_SAMPNUM_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ProcessorStats_SampleNumber object.
      *
@@ -370,7 +394,8 @@ class ProcessorStats_SampleNumber : public Variable {
     ProcessorStats_SampleNumber()
         : Variable((const uint8_t)PROCESSOR_SAMPNUM_VAR_NUM,
                    (uint8_t)PROCESSOR_SAMPNUM_RESOLUTION,
-                   PROCESSOR_SAMPNUM_VAR_NAME, PROCESSOR_SAMPNUM_UNIT_NAME,
+                   F(PROCESSOR_SAMPNUM_VAR_NAME),
+                   F(PROCESSOR_SAMPNUM_UNIT_NAME),
                    PROCESSOR_SAMPNUM_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ProcessorStats_SampleNumber() object - no action
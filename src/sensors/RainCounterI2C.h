@@ -301,6 +301,10 @@ class RainCounterI2C : public Sensor {
      */
     TwoWire* _i2c;  // Hardware Wire
 #endif
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<BUCKET_NUM_VARIABLES> _results;
 };
 
 
@@ -328,8 +332,8 @@ class RainCounterI2C_Tips : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode = BUCKET_TIPS_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)BUCKET_TIPS_VAR_NUM,
-                   (uint8_t)BUCKET_TIPS_RESOLUTION, BUCKET_TIPS_VAR_NAME,
-                   BUCKET_TIPS_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)BUCKET_TIPS_RESOLUTION, F(BUCKET_TIPS_VAR_NAME),
+                   F(BUCKET_TIPS_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new RainCounterI2C_Tips object.
      *
@@ -338,8 +342,8 @@ class RainCounterI2C_Tips : public Variable {
      */
     RainCounterI2C_Tips()
         : Variable((const uint8_t)BUCKET_TIPS_VAR_NUM,
-                   (uint8_t)BUCKET_TIPS_RESOLUTION, BUCKET_TIPS_VAR_NAME,
-                   BUCKET_TIPS_UNIT_NAME, BUCKET_TIPS_DEFAULT_CODE) {}
+                   (uint8_t)BUCKET_TIPS_RESOLUTION, F(BUCKET_TIPS_VAR_NAME),
+                   F(BUCKET_TIPS_UNIT_NAME), BUCKET_TIPS_DEFAULT_CODE) {}
     /**
      * @brief Destroy the RainCounterI2C_Tips object - no action needed.
      */
@@ -370,8 +374,8 @@ class RainCounterI2C_Depth : public Variable {
         RainCounterI2C* parentSense, const char* uuid = "",
         const char* varCode = BUCKET_RAIN_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)BUCKET_RAIN_VAR_NUM,
-                   (uint8_t)BUCKET_RAIN_RESOLUTION, BUCKET_RAIN_VAR_NAME,
-                   BUCKET_RAIN_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)BUCKET_RAIN_RESOLUTION, F(BUCKET_RAIN_VAR_NAME),
+                   F(BUCKET_RAIN_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new RainCounterI2C_Depth object.
      *
@@ -380,8 +384,8 @@ class RainCounterI2C_Depth : public Variable {
      */
     RainCounterI2C_Depth()
         : Variable((const uint8_t)BUCKET_RAIN_VAR_NUM,
-                   (uint8_t)BUCKET_RAIN_RESOLUTION, BUCKET_RAIN_VAR_NAME,
-                   BUCKET_RAIN_UNIT_NAME, BUCKET_RAIN_DEFAULT_CODE) {}
+                   (uint8_t)BUCKET_RAIN_RESOLUTION, F(BUCKET_RAIN_VAR_NAME),
+                   F(BUCKET_RAIN_UNIT_NAME), BUCKET_RAIN_DEFAULT_CODE) {}
     /**
      * @brief Destroy the RainCounterI2C_Depth object - no action needed.
      */
@@ -167,23 +167,37 @@ bool SDI12Sensors::getSensorInfo(void) {
     // Check that the sensor is there and responding
     if (!requestSensorAcknowledgement()) return false;
 
-    MS_DBG(F("  Getting sensor info"));
-    String myCommand = "";
-    myCommand += static_cast<char>(_SDI12address);
-    myCommand += "I!";  // sends 'info' command [address][I][!]
-    _SDI12Internal.sendCommand(myCommand);
-    MS_DBG(F("    >>>"), myCommand);
-    delay(30);
-
-    // wait for acknowlegement with format:
-    // [address][SDI12 version supported (2 char)][vendor (8 char)][model (6
-    // char)][version (3 char)][serial number (<14 char)]<CR><LF>
-    String sdiResponse = _SDI12Internal.readStringUntil('\n');
-    sdiResponse.trim();
-    MS_DBG(F("    <<<"), sdiResponse);
+    // Use the info the sensor gave at the last boot, if there is any
+    char   savedInfo[SDI12_INFO_CACHE_BYTES + 1] = {0};
+    String sdiResponse;
+    if (readBootCache(savedInfo, SDI12_INFO_CACHE_BYTES)) {
+        MS_DBG(F("  Using the sensor info saved at the last boot"));
+        sdiResponse = savedInfo;
+    } else {
+        MS_DBG(F("  Getting sensor info"));
+        String myCommand = "";
+        myCommand += static_cast<char>(_SDI12address);
+        myCommand += "I!";  // sends 'info' command [address][I][!]
+        _SDI12Internal.sendCommand(myCommand);
+        MS_DBG(F("    >>>"), myCommand);
+        delay(30);
 
-    // Empty the buffer again
-    _SDI12Internal.clearBuffer();
+        // wait for acknowlegement with format:
+        // [address][SDI12 version supported (2 char)][vendor (8 char)]
+        // [model (6 char)][version (3 char)][serial number (<14 char)]<CR><LF>
+        sdiResponse = _SDI12Internal.readStringUntil('\n');
+        sdiResponse.trim();
+        MS_DBG(F("    <<<"), sdiResponse);
+
+        // Empty the buffer again
+        _SDI12Internal.clearBuffer();
+
+        // Save the info for the next boot
+        if (sdiResponse.length() > 1) {
+            sdiResponse.toCharArray(savedInfo, SDI12_INFO_CACHE_BYTES + 1);
+            writeBootCache(savedInfo, SDI12_INFO_CACHE_BYTES);
+        }
+    }
 
     // De-activate the SDI-12 Object
     // Use end() instead of just forceHold to un-set the timers
@@ -86,6 +86,16 @@
 // SDI12_EXTERNAL_PCINT Unfortunately, that is not compatible with the Arduino
 // IDE
 
+/**
+ * @brief The longest response to the SDI-12 'info' command, which is saved
+ * to the boot cache.
+ *
+ * The response is the address, the SDI-12 version (2 characters), the vendor
+ * (8), the model (6), the sensor version (3), and up to 13 characters of
+ * serial number or other information.
+ */
+#define SDI12_INFO_CACHE_BYTES 33
+
 /**
  * @brief The main class for SDI-12 Sensors
  */
@@ -233,6 +243,10 @@ class SDI12Sensors : public Sensor {
      * @brief Send the SDI-12 'info' command [address][I][!] to a sensor and
      * parse the result into the vendor, model, version, and serial number.
      *
+     * The sensor must still acknowledge its address, but if the boot cache
+     * holds its info from an earlier boot, that is used instead of asking
+     * again.
+     *
      * @return **bool** True if all expected information fields returned by the
      * sensor.
      */
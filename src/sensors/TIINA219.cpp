@@ -16,6 +16,7 @@ TIINA219::TIINA219(TwoWire* theI2C, int8_t powerPin, uint8_t i2cAddressHex,
     : Sensor("TIINA219", INA219_NUM_VARIABLES, INA219_WARM_UP_TIME_MS,
              INA219_STABILIZATION_TIME_MS, INA219_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
     _i2c           = theI2C;
 }
@@ -24,6 +25,7 @@ TIINA219::TIINA219(int8_t powerPin, uint8_t i2cAddressHex,
     : Sensor("TIINA219", INA219_NUM_VARIABLES, INA219_WARM_UP_TIME_MS,
              INA219_STABILIZATION_TIME_MS, INA219_MEASUREMENT_TIME_MS, powerPin,
              -1, measurementsToAverage) {
+    setResultArrays(_results);
     _i2cAddressHex = i2cAddressHex;
     _i2c           = &Wire;
 }
@@ -291,6 +291,10 @@ class TIINA219 : public Sensor {
      * @brief An internal reference to the hardware Wire instance.
      */
     TwoWire* _i2c;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<INA219_NUM_VARIABLES> _results;
 };
 
 
@@ -318,8 +322,8 @@ class TIINA219_Current : public Variable {
         const char* varCode = INA219_CURRENT_MA_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INA219_CURRENT_MA_VAR_NUM,
                    (uint8_t)INA219_CURRENT_MA_RESOLUTION,
-                   INA219_CURRENT_MA_VAR_NAME, INA219_CURRENT_MA_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(INA219_CURRENT_MA_VAR_NAME),
+                   F(INA219_CURRENT_MA_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new TIINA219_Current object.
      *
@@ -328,7 +332,8 @@ class TIINA219_Current : public Variable {
     TIINA219_Current()
         : Variable((const uint8_t)INA219_CURRENT_MA_VAR_NUM,
                    (uint8_t)INA219_CURRENT_MA_RESOLUTION,
-                   INA219_CURRENT_MA_VAR_NAME, INA219_CURRENT_MA_UNIT_NAME,
+                   F(INA219_CURRENT_MA_VAR_NAME),
+                   F(INA219_CURRENT_MA_UNIT_NAME),
                    INA219_CURRENT_MA_DEFAULT_CODE) {}
     /**
      * @brief Destroy the TIINA219_Current object - no action needed.
@@ -361,8 +366,8 @@ class TIINA219_Volt : public Variable {
         const char* varCode = INA219_BUS_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INA219_BUS_VOLTAGE_VAR_NUM,
                    (uint8_t)INA219_BUS_VOLTAGE_RESOLUTION,
-                   INA219_BUS_VOLTAGE_VAR_NAME, INA219_BUS_VOLTAGE_UNIT_NAME,
-                   varCode, uuid) {}
+                   F(INA219_BUS_VOLTAGE_VAR_NAME),
+                   F(INA219_BUS_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new TIINA219_Volt object.
      *
@@ -371,7 +376,8 @@ class TIINA219_Volt : public Variable {
     TIINA219_Volt()
         : Variable((const uint8_t)INA219_BUS_VOLTAGE_VAR_NUM,
                    (uint8_t)INA219_BUS_VOLTAGE_RESOLUTION,
-                   INA219_BUS_VOLTAGE_VAR_NAME, INA219_BUS_VOLTAGE_UNIT_NAME,
+                   F(INA219_BUS_VOLTAGE_VAR_NAME),
+                   F(INA219_BUS_VOLTAGE_UNIT_NAME),
                    INA219_BUS_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the TIINA219_Volt object - no action needed.
@@ -404,8 +410,8 @@ class TIINA219_Power : public Variable {
                             const char* varCode = INA219_POWER_MW_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)INA219_POWER_MW_VAR_NUM,
                    (uint8_t)INA219_POWER_MW_RESOLUTION,
-                   INA219_POWER_MW_VAR_NAME, INA219_POWER_MW_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(INA219_POWER_MW_VAR_NAME), F(INA219_POWER_MW_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new TIINA219_Power object.
      *
@@ -414,7 +420,7 @@ class TIINA219_Power : public Variable {
     TIINA219_Power()
         : Variable((const uint8_t)INA219_POWER_MW_VAR_NUM,
                    (uint8_t)INA219_POWER_MW_RESOLUTION,
-                   INA219_POWER_MW_VAR_NAME, INA219_POWER_MW_UNIT_NAME,
+                   F(INA219_POWER_MW_VAR_NAME), F(INA219_POWER_MW_UNIT_NAME),
                    INA219_POWER_MW_DEFAULT_CODE) {}
     /**
      * @brief Destroy the TIINA219_Power object - no action needed.
@@ -214,6 +214,10 @@ class TallyCounterI2C : public Sensor {
      * @brief The I2C address of the Tally counter.
      */
     uint8_t _i2cAddressHex;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<TALLY_NUM_VARIABLES> _results;
 };
 
 /* clang-format off */
@@ -242,8 +246,8 @@ class TallyCounterI2C_Events : public Variable {
         TallyCounterI2C* parentSense, const char* uuid = "",
         const char* varCode = TALLY_EVENTS_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)TALLY_EVENTS_VAR_NUM,
-                   (uint8_t)TALLY_EVENTS_RESOLUTION, TALLY_EVENTS_VAR_NAME,
-                   TALLY_EVENTS_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)TALLY_EVENTS_RESOLUTION, F(TALLY_EVENTS_VAR_NAME),
+                   F(TALLY_EVENTS_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new TallyCounterI2C_Events object.
      *
@@ -252,8 +256,8 @@ class TallyCounterI2C_Events : public Variable {
      */
     TallyCounterI2C_Events()
         : Variable((const uint8_t)TALLY_EVENTS_VAR_NUM,
-                   (uint8_t)TALLY_EVENTS_RESOLUTION, TALLY_EVENTS_VAR_NAME,
-                   TALLY_EVENTS_UNIT_NAME, TALLY_EVENTS_DEFAULT_CODE) {}
+                   (uint8_t)TALLY_EVENTS_RESOLUTION, F(TALLY_EVENTS_VAR_NAME),
+                   F(TALLY_EVENTS_UNIT_NAME), TALLY_EVENTS_DEFAULT_CODE) {}
     /**
      * @brief Destroy the BoschBME280_Temp object - no action needed.
      */
@@ -19,6 +19,7 @@ TurnerCyclops::TurnerCyclops(int8_t powerPin, uint8_t adsChannel,
     : Sensor("TurnerCyclops", CYCLOPS_NUM_VARIABLES, CYCLOPS_WARM_UP_TIME_MS,
              CYCLOPS_STABILIZATION_TIME_MS, CYCLOPS_MEASUREMENT_TIME_MS,
              powerPin, -1, measurementsToAverage) {
+    setResultArrays(_results);
     _adsChannel = adsChannel;
     _conc_std   = conc_std;
     _volt_std   = volt_std;
@@ -328,6 +328,10 @@ class TurnerCyclops : public Sensor {
     uint8_t _adsChannel;
     float   _conc_std, _volt_std, _volt_blank;
     uint8_t _i2cAddress;
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<CYCLOPS_NUM_VARIABLES> _results;
 };
 
 
@@ -361,8 +365,8 @@ class TurnerCyclops_Voltage : public Variable {
         const char* varCode = CYCLOPS_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)CYCLOPS_VOLTAGE_VAR_NUM,
                    (uint8_t)CYCLOPS_VOLTAGE_RESOLUTION,
-                   CYCLOPS_VOLTAGE_VAR_NAME, CYCLOPS_VOLTAGE_UNIT_NAME, varCode,
-                   uuid) {}
+                   F(CYCLOPS_VOLTAGE_VAR_NAME), F(CYCLOPS_VOLTAGE_UNIT_NAME),
+                   varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Voltage object.
      *
@@ -372,7 +376,7 @@ class TurnerCyclops_Voltage : public Variable {
     TurnerCyclops_Voltage()
         : Variable((const uint8_t)CYCLOPS_VOLTAGE_VAR_NUM,
                    (uint8_t)CYCLOPS_VOLTAGE_RESOLUTION,
-                   CYCLOPS_VOLTAGE_VAR_NAME, CYCLOPS_VOLTAGE_UNIT_NAME,
+                   F(CYCLOPS_VOLTAGE_VAR_NAME), F(CYCLOPS_VOLTAGE_UNIT_NAME),
                    CYCLOPS_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the TurnerCyclops_Voltage object - no action needed.
@@ -419,8 +423,8 @@ class TurnerCyclops_Chlorophyll : public Variable {
         TurnerCyclops* parentSense, const char* uuid = "",
         const char* varCode = "CyclopsChlorophyll")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "chlorophyllFluorescence",
-                   "microgramPerLiter", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("chlorophyllFluorescence"),
+                   F("microgramPerLiter"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Chlorophyll object.
      *
@@ -429,7 +433,7 @@ class TurnerCyclops_Chlorophyll : public Variable {
      */
     TurnerCyclops_Chlorophyll()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "chlorophyllFluorescence", "microgramPerLiter",
+                   F("chlorophyllFluorescence"), F("microgramPerLiter"),
                    "CyclopsChlorophyll") {}
     ~TurnerCyclops_Chlorophyll() {}
 };
@@ -472,8 +476,8 @@ class TurnerCyclops_Rhodamine : public Variable {
                                      const char*    uuid = "",
                                      const char* varCode = "CyclopsRhodamine")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "RhodamineFluorescence",
-                   "partPerBillion", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("RhodamineFluorescence"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Rhodamine object.
      *
@@ -482,7 +486,7 @@ class TurnerCyclops_Rhodamine : public Variable {
      */
     TurnerCyclops_Rhodamine()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "RhodamineFluorescence", "partPerBillion",
+                   F("RhodamineFluorescence"), F("partPerBillion"),
                    "CyclopsRhodamine") {}
     ~TurnerCyclops_Rhodamine() {}
 };
@@ -525,8 +529,8 @@ class TurnerCyclops_Fluorescein : public Variable {
         TurnerCyclops* parentSense, const char* uuid = "",
         const char* varCode = "CyclopsFluorescein")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "fluorescein", "partPerBillion",
-                   varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("fluorescein"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Fluorescein object.
      *
@@ -535,7 +539,8 @@ class TurnerCyclops_Fluorescein : public Variable {
      */
     TurnerCyclops_Fluorescein()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "fluorescein", "partPerBillion", "CyclopsFluorescein") {}
+                   F("fluorescein"), F("partPerBillion"),
+                   "CyclopsFluorescein") {}
     ~TurnerCyclops_Fluorescein() {}
 };
 
@@ -579,8 +584,8 @@ class TurnerCyclops_Phycocyanin : public Variable {
         const char* varCode = "CyclopsPhycocyanin")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
                    (uint8_t)CYCLOPS_RESOLUTION,
-                   "blue_GreenAlgae_Cyanobacteria_Phycocyanin",
-                   "partPerBillion", varCode, uuid) {}
+                   F("blue_GreenAlgae_Cyanobacteria_Phycocyanin"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Phycocyanin object.
      *
@@ -589,8 +594,8 @@ class TurnerCyclops_Phycocyanin : public Variable {
      */
     TurnerCyclops_Phycocyanin()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "blue_GreenAlgae_Cyanobacteria_Phycocyanin",
-                   "partPerBillion", "CyclopsPhycocyanin") {}
+                   F("blue_GreenAlgae_Cyanobacteria_Phycocyanin"),
+                   F("partPerBillion"), "CyclopsPhycocyanin") {}
     ~TurnerCyclops_Phycocyanin() {}
 };
 
@@ -633,8 +638,8 @@ class TurnerCyclops_Phycoerythrin : public Variable {
         TurnerCyclops* parentSense, const char* uuid = "",
         const char* varCode = "CyclopsPhycoerythrin")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "phycoerythrin",
-                   "partPerBillion", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("phycoerythrin"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Phycoerythrin object.
      *
@@ -643,7 +648,8 @@ class TurnerCyclops_Phycoerythrin : public Variable {
      */
     TurnerCyclops_Phycoerythrin()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "phycoerythrin", "partPerBillion", "CyclopsPhycoerythrin") {}
+                   F("phycoerythrin"), F("partPerBillion"),
+                   "CyclopsPhycoerythrin") {}
     ~TurnerCyclops_Phycoerythrin() {}
 };
 
@@ -690,7 +696,7 @@ class TurnerCyclops_CDOM : public Variable {
                                 const char*    varCode = "CyclopsCDOM")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
                    (uint8_t)CYCLOPS_RESOLUTION,
-                   "fluorescenceDissolvedOrganicMatter", "partPerBillion",
+                   F("fluorescenceDissolvedOrganicMatter"), F("partPerBillion"),
                    varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_CDOM object.
@@ -700,7 +706,7 @@ class TurnerCyclops_CDOM : public Variable {
      */
     TurnerCyclops_CDOM()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "fluorescenceDissolvedOrganicMatter", "partPerBillion",
+                   F("fluorescenceDissolvedOrganicMatter"), F("partPerBillion"),
                    "CyclopsCDOM") {}
     ~TurnerCyclops_CDOM() {}
 };
@@ -745,8 +751,8 @@ class TurnerCyclops_CrudeOil : public Variable {
                                     const char*    uuid    = "",
                                     const char*    varCode = "CyclopsCrudeOil")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "petroleumHydrocarbonTotal",
-                   "partPerBillion", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("petroleumHydrocarbonTotal"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_CrudeOil object.
      *
@@ -755,7 +761,7 @@ class TurnerCyclops_CrudeOil : public Variable {
      */
     TurnerCyclops_CrudeOil()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "petroleumHydrocarbonTotal", "partPerBillion",
+                   F("petroleumHydrocarbonTotal"), F("partPerBillion"),
                    "CyclopsCrudeOil") {}
     ~TurnerCyclops_CrudeOil() {}
 };
@@ -801,8 +807,8 @@ class TurnerCyclops_Brighteners : public Variable {
         TurnerCyclops* parentSense, const char* uuid = "",
         const char* varCode = "CyclopsOpticalBrighteners")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "opticalBrighteners",
-                   "partPerBillion", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("opticalBrighteners"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Brighteners object.
      *
@@ -811,7 +817,7 @@ class TurnerCyclops_Brighteners : public Variable {
      */
     TurnerCyclops_Brighteners()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "opticalBrighteners", "partPerBillion",
+                   F("opticalBrighteners"), F("partPerBillion"),
                    "CyclopsOpticalBrighteners") {}
     ~TurnerCyclops_Brighteners() {}
 };
@@ -854,8 +860,8 @@ class TurnerCyclops_Turbidity : public Variable {
                                      const char*    uuid = "",
                                      const char* varCode = "CyclopsTurbidity")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "Turbidity",
-                   "nephelometricTurbidityUnit", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("Turbidity"),
+                   F("nephelometricTurbidityUnit"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Turbidity object.
      *
@@ -864,7 +870,7 @@ class TurnerCyclops_Turbidity : public Variable {
      */
     TurnerCyclops_Turbidity()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "Turbidity", "nephelometricTurbidityUnit",
+                   F("Turbidity"), F("nephelometricTurbidityUnit"),
                    "CyclopsTurbidity") {}
     ~TurnerCyclops_Turbidity() {}
 };
@@ -908,7 +914,7 @@ class TurnerCyclops_PTSA : public Variable {
                                 const char*    uuid    = "",
                                 const char*    varCode = "CyclopsPTSA")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "ptsa", "partPerBillion",
+                   (uint8_t)CYCLOPS_RESOLUTION, F("ptsa"), F("partPerBillion"),
                    varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_PTSA object.
@@ -918,7 +924,7 @@ class TurnerCyclops_PTSA : public Variable {
      */
     TurnerCyclops_PTSA()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "ptsa", "partPerBillion", "CyclopsPTSA") {}
+                   F("ptsa"), F("partPerBillion"), "CyclopsPTSA") {}
     ~TurnerCyclops_PTSA() {}
 };
 
@@ -961,7 +967,7 @@ class TurnerCyclops_BTEX : public Variable {
                                 const char*    uuid    = "",
                                 const char*    varCode = "CyclopsBTEX")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "btex", "partPerMillion",
+                   (uint8_t)CYCLOPS_RESOLUTION, F("btex"), F("partPerMillion"),
                    varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_BTEX object.
@@ -971,7 +977,7 @@ class TurnerCyclops_BTEX : public Variable {
      */
     TurnerCyclops_BTEX()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "btex", "partPerMillion", "CyclopsBTEX") {}
+                   F("btex"), F("partPerMillion"), "CyclopsBTEX") {}
     ~TurnerCyclops_BTEX() {}
 };
 
@@ -1013,8 +1019,8 @@ class TurnerCyclops_Tryptophan : public Variable {
                                       const char*    uuid = "",
                                       const char* varCode = "CyclopsTryptophan")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "tryptophan", "partPerBillion",
-                   varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("tryptophan"),
+                   F("partPerBillion"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_Tryptophan object.
      *
@@ -1023,7 +1029,7 @@ class TurnerCyclops_Tryptophan : public Variable {
      */
     TurnerCyclops_Tryptophan()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "tryptophan", "partPerBillion", "CyclopsTryptophan") {}
+                   F("tryptophan"), F("partPerBillion"), "CyclopsTryptophan") {}
     ~TurnerCyclops_Tryptophan() {}
 };
 
@@ -1066,8 +1072,8 @@ class TurnerCyclops_RedChlorophyll : public Variable {
         TurnerCyclops* parentSense, const char* uuid = "",
         const char* varCode = "CyclopsRedChlorophyll")
         : Variable(parentSense, (const uint8_t)CYCLOPS_VAR_NUM,
-                   (uint8_t)CYCLOPS_RESOLUTION, "chlorophyllFluorescence",
-                   "microgramPerLiter", varCode, uuid) {}
+                   (uint8_t)CYCLOPS_RESOLUTION, F("chlorophyllFluorescence"),
+                   F("microgramPerLiter"), varCode, uuid) {}
     /**
      * @brief Construct a new TurnerCyclops_RedChlorophyll object.
      *
@@ -1076,7 +1082,7 @@ class TurnerCyclops_RedChlorophyll : public Variable {
      */
     TurnerCyclops_RedChlorophyll()
         : Variable((const uint8_t)CYCLOPS_VAR_NUM, (uint8_t)CYCLOPS_RESOLUTION,
-                   "chlorophyllFluorescence", "microgramPerLiter",
+                   F("chlorophyllFluorescence"), F("microgramPerLiter"),
                    "CyclopsRedChlorophyll") {}
     ~TurnerCyclops_RedChlorophyll() {}
 };
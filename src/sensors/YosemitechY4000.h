@@ -347,7 +347,9 @@ class YosemitechY4000 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y4000,
                            "YosemitechY4000", Y4000_NUM_VARIABLES,
                            Y4000_WARM_UP_TIME_MS, Y4000_STABILIZATION_TIME_MS,
-                           Y4000_MEASUREMENT_TIME_MS) {}
+                           Y4000_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY4000::YosemitechY4000
      */
@@ -358,11 +360,19 @@ class YosemitechY4000 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y4000,
                            "YosemitechY4000", Y4000_NUM_VARIABLES,
                            Y4000_WARM_UP_TIME_MS, Y4000_STABILIZATION_TIME_MS,
-                           Y4000_MEASUREMENT_TIME_MS) {}
+                           Y4000_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y4000 object
      */
     ~YosemitechY4000() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y4000_NUM_VARIABLES> _results;
 };
 
 
@@ -391,8 +401,8 @@ class YosemitechY4000_DOmgL : public Variable {
         YosemitechY4000* parentSense, const char* uuid = "",
         const char* varCode = Y4000_DOMGL_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_DOMGL_VAR_NUM,
-                   (uint8_t)Y4000_DOMGL_RESOLUTION, Y4000_DOMGL_VAR_NAME,
-                   Y4000_DOMGL_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_DOMGL_RESOLUTION, F(Y4000_DOMGL_VAR_NAME),
+                   F(Y4000_DOMGL_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_DOmgL object.
      *
@@ -401,8 +411,8 @@ class YosemitechY4000_DOmgL : public Variable {
      */
     YosemitechY4000_DOmgL()
         : Variable((const uint8_t)Y4000_DOMGL_VAR_NUM,
-                   (uint8_t)Y4000_DOMGL_RESOLUTION, Y4000_DOMGL_VAR_NAME,
-                   Y4000_DOMGL_UNIT_NAME, Y4000_DOMGL_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_DOMGL_RESOLUTION, F(Y4000_DOMGL_VAR_NAME),
+                   F(Y4000_DOMGL_UNIT_NAME), Y4000_DOMGL_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_DOmgL object - no action needed.
      */
@@ -434,8 +444,8 @@ class YosemitechY4000_Turbidity : public Variable {
         YosemitechY4000* parentSense, const char* uuid = "",
         const char* varCode = Y4000_TURB_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_TURB_VAR_NUM,
-                   (uint8_t)Y4000_TURB_RESOLUTION, Y4000_TURB_VAR_NAME,
-                   Y4000_TURB_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_TURB_RESOLUTION, F(Y4000_TURB_VAR_NAME),
+                   F(Y4000_TURB_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_Turbidity object.
      *
@@ -444,8 +454,8 @@ class YosemitechY4000_Turbidity : public Variable {
      */
     YosemitechY4000_Turbidity()
         : Variable((const uint8_t)Y4000_TURB_VAR_NUM,
-                   (uint8_t)Y4000_TURB_RESOLUTION, Y4000_TURB_VAR_NAME,
-                   Y4000_TURB_UNIT_NAME, Y4000_TURB_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_TURB_RESOLUTION, F(Y4000_TURB_VAR_NAME),
+                   F(Y4000_TURB_UNIT_NAME), Y4000_TURB_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_Turbidity object - no action needed.
      */
@@ -477,8 +487,8 @@ class YosemitechY4000_Cond : public Variable {
                                   const char*      uuid = "",
                                   const char* varCode = Y4000_COND_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_COND_VAR_NUM,
-                   (uint8_t)Y4000_COND_RESOLUTION, Y4000_COND_VAR_NAME,
-                   Y4000_COND_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_COND_RESOLUTION, F(Y4000_COND_VAR_NAME),
+                   F(Y4000_COND_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_Cond object.
      *
@@ -487,8 +497,8 @@ class YosemitechY4000_Cond : public Variable {
      */
     YosemitechY4000_Cond()
         : Variable((const uint8_t)Y4000_COND_VAR_NUM,
-                   (uint8_t)Y4000_COND_RESOLUTION, Y4000_COND_VAR_NAME,
-                   Y4000_COND_UNIT_NAME, Y4000_COND_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_COND_RESOLUTION, F(Y4000_COND_VAR_NAME),
+                   F(Y4000_COND_UNIT_NAME), Y4000_COND_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_Cond object - no action needed.
      */
@@ -520,8 +530,8 @@ class YosemitechY4000_pH : public Variable {
                                 const char*      uuid = "",
                                 const char* varCode   = Y4000_PH_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_PH_VAR_NUM,
-                   (uint8_t)Y4000_PH_RESOLUTION, Y4000_PH_VAR_NAME,
-                   Y4000_PH_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_PH_RESOLUTION, F(Y4000_PH_VAR_NAME),
+                   F(Y4000_PH_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_pH object.
      *
@@ -530,8 +540,8 @@ class YosemitechY4000_pH : public Variable {
      */
     YosemitechY4000_pH()
         : Variable((const uint8_t)Y4000_PH_VAR_NUM,
-                   (uint8_t)Y4000_PH_RESOLUTION, Y4000_PH_VAR_NAME,
-                   Y4000_PH_UNIT_NAME, Y4000_PH_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_PH_RESOLUTION, F(Y4000_PH_VAR_NAME),
+                   F(Y4000_PH_UNIT_NAME), Y4000_PH_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_pH object - no action needed.
      */
@@ -563,8 +573,8 @@ class YosemitechY4000_Temp : public Variable {
                                   const char*      uuid = "",
                                   const char* varCode = Y4000_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_TEMP_VAR_NUM,
-                   (uint8_t)Y4000_TEMP_RESOLUTION, Y4000_TEMP_VAR_NAME,
-                   Y4000_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_TEMP_RESOLUTION, F(Y4000_TEMP_VAR_NAME),
+                   F(Y4000_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_Temp object.
      *
@@ -573,8 +583,8 @@ class YosemitechY4000_Temp : public Variable {
      */
     YosemitechY4000_Temp()
         : Variable((const uint8_t)Y4000_TEMP_VAR_NUM,
-                   (uint8_t)Y4000_TEMP_RESOLUTION, Y4000_TEMP_VAR_NAME,
-                   Y4000_TEMP_UNIT_NAME, Y4000_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_TEMP_RESOLUTION, F(Y4000_TEMP_VAR_NAME),
+                   F(Y4000_TEMP_UNIT_NAME), Y4000_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_Temp object - no action needed.
      */
@@ -606,8 +616,8 @@ class YosemitechY4000_ORP : public Variable {
                                  const char*      uuid = "",
                                  const char* varCode   = Y4000_ORP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_ORP_VAR_NUM,
-                   (uint8_t)Y4000_ORP_RESOLUTION, Y4000_ORP_VAR_NAME,
-                   Y4000_ORP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_ORP_RESOLUTION, F(Y4000_ORP_VAR_NAME),
+                   F(Y4000_ORP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_ORP object.
      *
@@ -616,8 +626,8 @@ class YosemitechY4000_ORP : public Variable {
      */
     YosemitechY4000_ORP()
         : Variable((const uint8_t)Y4000_ORP_VAR_NUM,
-                   (uint8_t)Y4000_ORP_RESOLUTION, Y4000_ORP_VAR_NAME,
-                   Y4000_ORP_UNIT_NAME, Y4000_ORP_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_ORP_RESOLUTION, F(Y4000_ORP_VAR_NAME),
+                   F(Y4000_ORP_UNIT_NAME), Y4000_ORP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_ORP object - no action needed.
      */
@@ -649,8 +659,8 @@ class YosemitechY4000_Chlorophyll : public Variable {
         YosemitechY4000* parentSense, const char* uuid = "",
         const char* varCode = Y4000_CHLORO_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_CHLORO_VAR_NUM,
-                   (uint8_t)Y4000_CHLORO_RESOLUTION, Y4000_CHLORO_VAR_NAME,
-                   Y4000_CHLORO_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_CHLORO_RESOLUTION, F(Y4000_CHLORO_VAR_NAME),
+                   F(Y4000_CHLORO_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_Chlorophyll object.
      *
@@ -659,8 +669,8 @@ class YosemitechY4000_Chlorophyll : public Variable {
      */
     YosemitechY4000_Chlorophyll()
         : Variable((const uint8_t)Y4000_CHLORO_VAR_NUM,
-                   (uint8_t)Y4000_CHLORO_RESOLUTION, Y4000_CHLORO_VAR_NAME,
-                   Y4000_CHLORO_UNIT_NAME, Y4000_CHLORO_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_CHLORO_RESOLUTION, F(Y4000_CHLORO_VAR_NAME),
+                   F(Y4000_CHLORO_UNIT_NAME), Y4000_CHLORO_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_Chlorophyll() object - no action
      * needed.
@@ -693,8 +703,8 @@ class YosemitechY4000_BGA : public Variable {
                                  const char*      uuid = "",
                                  const char* varCode   = Y4000_BGA_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y4000_BGA_VAR_NUM,
-                   (uint8_t)Y4000_BGA_RESOLUTION, Y4000_BGA_VAR_NAME,
-                   Y4000_BGA_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y4000_BGA_RESOLUTION, F(Y4000_BGA_VAR_NAME),
+                   F(Y4000_BGA_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY4000_BGA object.
      *
@@ -703,8 +713,8 @@ class YosemitechY4000_BGA : public Variable {
      */
     YosemitechY4000_BGA()
         : Variable((const uint8_t)Y4000_BGA_VAR_NUM,
-                   (uint8_t)Y4000_BGA_RESOLUTION, Y4000_BGA_VAR_NAME,
-                   Y4000_BGA_UNIT_NAME, Y4000_BGA_DEFAULT_CODE) {}
+                   (uint8_t)Y4000_BGA_RESOLUTION, F(Y4000_BGA_VAR_NAME),
+                   F(Y4000_BGA_UNIT_NAME), Y4000_BGA_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY4000_BGA object - no action needed.
      */
@@ -202,7 +202,9 @@ class YosemitechY504 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y504,
                            "YosemitechY504", Y504_NUM_VARIABLES,
                            Y504_WARM_UP_TIME_MS, Y504_STABILIZATION_TIME_MS,
-                           Y504_MEASUREMENT_TIME_MS) {}
+                           Y504_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY504::YosemitechY504
      */
@@ -213,11 +215,19 @@ class YosemitechY504 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y504,
                            "YosemitechY504", Y504_NUM_VARIABLES,
                            Y504_WARM_UP_TIME_MS, Y504_STABILIZATION_TIME_MS,
-                           Y504_MEASUREMENT_TIME_MS) {}
+                           Y504_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y504 object
      */
     ~YosemitechY504() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y504_NUM_VARIABLES> _results;
 };
 
 
@@ -246,8 +256,8 @@ class YosemitechY504_DOpct : public Variable {
                                   const char*     uuid = "",
                                   const char* varCode = Y504_DOPCT_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y504_DOPCT_VAR_NUM,
-                   (uint8_t)Y504_DOPCT_RESOLUTION, Y504_DOPCT_VAR_NAME,
-                   Y504_DOPCT_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y504_DOPCT_RESOLUTION, F(Y504_DOPCT_VAR_NAME),
+                   F(Y504_DOPCT_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY504_DOpct object.
      *
@@ -256,8 +266,8 @@ class YosemitechY504_DOpct : public Variable {
      */
     YosemitechY504_DOpct()
         : Variable((const uint8_t)Y504_DOPCT_VAR_NUM,
-                   (uint8_t)Y504_DOPCT_RESOLUTION, Y504_DOPCT_VAR_NAME,
-                   Y504_DOPCT_UNIT_NAME, Y504_DOPCT_DEFAULT_CODE) {}
+                   (uint8_t)Y504_DOPCT_RESOLUTION, F(Y504_DOPCT_VAR_NAME),
+                   F(Y504_DOPCT_UNIT_NAME), Y504_DOPCT_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY504_DOpct object - no action needed.
      */
@@ -290,8 +300,8 @@ class YosemitechY504_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y504_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y504_TEMP_VAR_NUM,
-                   (uint8_t)Y504_TEMP_RESOLUTION, Y504_TEMP_VAR_NAME,
-                   Y504_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y504_TEMP_RESOLUTION, F(Y504_TEMP_VAR_NAME),
+                   F(Y504_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY504_Temp object.
      *
@@ -300,8 +310,8 @@ class YosemitechY504_Temp : public Variable {
      */
     YosemitechY504_Temp()
         : Variable((const uint8_t)Y504_TEMP_VAR_NUM,
-                   (uint8_t)Y504_TEMP_RESOLUTION, Y504_TEMP_VAR_NAME,
-                   Y504_TEMP_UNIT_NAME, Y504_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y504_TEMP_RESOLUTION, F(Y504_TEMP_VAR_NAME),
+                   F(Y504_TEMP_UNIT_NAME), Y504_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY504_Temp object - no action needed.
      */
@@ -334,8 +344,8 @@ class YosemitechY504_DOmgL : public Variable {
                                   const char*     uuid = "",
                                   const char* varCode = Y504_DOMGL_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y504_DOMGL_VAR_NUM,
-                   (uint8_t)Y504_DOMGL_RESOLUTION, Y504_DOMGL_VAR_NAME,
-                   Y504_DOMGL_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y504_DOMGL_RESOLUTION, F(Y504_DOMGL_VAR_NAME),
+                   F(Y504_DOMGL_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY504_DOmgL object.
      *
@@ -344,8 +354,8 @@ class YosemitechY504_DOmgL : public Variable {
      */
     YosemitechY504_DOmgL()
         : Variable((const uint8_t)Y504_DOMGL_VAR_NUM,
-                   (uint8_t)Y504_DOMGL_RESOLUTION, Y504_DOMGL_VAR_NAME,
-                   Y504_DOMGL_UNIT_NAME, Y504_DOMGL_DEFAULT_CODE) {}
+                   (uint8_t)Y504_DOMGL_RESOLUTION, F(Y504_DOMGL_VAR_NAME),
+                   F(Y504_DOMGL_UNIT_NAME), Y504_DOMGL_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY504_DOmgL object - no action needed.
      */
@@ -169,7 +169,9 @@ class YosemitechY510 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y510,
                            "YosemitechY510", Y510_NUM_VARIABLES,
                            Y510_WARM_UP_TIME_MS, Y510_STABILIZATION_TIME_MS,
-                           Y510_MEASUREMENT_TIME_MS) {}
+                           Y510_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY510::YosemitechY510
      */
@@ -180,11 +182,19 @@ class YosemitechY510 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y510,
                            "YosemitechY510", Y510_NUM_VARIABLES,
                            Y510_WARM_UP_TIME_MS, Y510_STABILIZATION_TIME_MS,
-                           Y510_MEASUREMENT_TIME_MS) {}
+                           Y510_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y510 object
      */
     ~YosemitechY510() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y510_NUM_VARIABLES> _results;
 };
 
 
@@ -213,8 +223,8 @@ class YosemitechY510_Turbidity : public Variable {
         YosemitechY510* parentSense, const char* uuid = "",
         const char* varCode = Y510_TURB_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y510_TURB_VAR_NUM,
-                   (uint8_t)Y510_TURB_RESOLUTION, Y510_TURB_VAR_NAME,
-                   Y510_TURB_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y510_TURB_RESOLUTION, F(Y510_TURB_VAR_NAME),
+                   F(Y510_TURB_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY510_Turbidity object.
      *
@@ -223,8 +233,8 @@ class YosemitechY510_Turbidity : public Variable {
      */
     YosemitechY510_Turbidity()
         : Variable((const uint8_t)Y510_TURB_VAR_NUM,
-                   (uint8_t)Y510_TURB_RESOLUTION, Y510_TURB_VAR_NAME,
-                   Y510_TURB_UNIT_NAME, Y510_TURB_DEFAULT_CODE) {}
+                   (uint8_t)Y510_TURB_RESOLUTION, F(Y510_TURB_VAR_NAME),
+                   F(Y510_TURB_UNIT_NAME), Y510_TURB_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY510_Turbidity object - no action needed.
      */
@@ -257,8 +267,8 @@ class YosemitechY510_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y510_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y510_TEMP_VAR_NUM,
-                   (uint8_t)Y510_TEMP_RESOLUTION, Y510_TEMP_VAR_NAME,
-                   Y510_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y510_TEMP_RESOLUTION, F(Y510_TEMP_VAR_NAME),
+                   F(Y510_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY510_Temp object.
      *
@@ -267,8 +277,8 @@ class YosemitechY510_Temp : public Variable {
      */
     YosemitechY510_Temp()
         : Variable((const uint8_t)Y510_TEMP_VAR_NUM,
-                   (uint8_t)Y510_TEMP_RESOLUTION, Y510_TEMP_VAR_NAME,
-                   Y510_TEMP_UNIT_NAME, Y510_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y510_TEMP_RESOLUTION, F(Y510_TEMP_VAR_NAME),
+                   F(Y510_TEMP_UNIT_NAME), Y510_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY510_Temp object - no action needed.
      */
@@ -183,7 +183,9 @@ class YosemitechY511 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y511,
                            "YosemitechY511", Y511_NUM_VARIABLES,
                            Y511_WARM_UP_TIME_MS, Y511_STABILIZATION_TIME_MS,
-                           Y511_MEASUREMENT_TIME_MS) {}
+                           Y511_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY511::YosemitechY511
      */
@@ -194,11 +196,19 @@ class YosemitechY511 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y511,
                            "YosemitechY511", Y511_NUM_VARIABLES,
                            Y511_WARM_UP_TIME_MS, Y511_STABILIZATION_TIME_MS,
-                           Y511_MEASUREMENT_TIME_MS) {}
+                           Y511_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y511 object
      */
     ~YosemitechY511() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y511_NUM_VARIABLES> _results;
 };
 
 
@@ -227,8 +237,8 @@ class YosemitechY511_Turbidity : public Variable {
         YosemitechY511* parentSense, const char* uuid = "",
         const char* varCode = Y511_TURB_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y511_TURB_VAR_NUM,
-                   (uint8_t)Y511_TURB_RESOLUTION, Y511_TURB_VAR_NAME,
-                   Y511_TURB_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y511_TURB_RESOLUTION, F(Y511_TURB_VAR_NAME),
+                   F(Y511_TURB_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY511_Turbidity object.
      *
@@ -237,8 +247,8 @@ class YosemitechY511_Turbidity : public Variable {
      */
     YosemitechY511_Turbidity()
         : Variable((const uint8_t)Y511_TURB_VAR_NUM,
-                   (uint8_t)Y511_TURB_RESOLUTION, Y511_TURB_VAR_NAME,
-                   Y511_TURB_UNIT_NAME, Y511_TURB_DEFAULT_CODE) {}
+                   (uint8_t)Y511_TURB_RESOLUTION, F(Y511_TURB_VAR_NAME),
+                   F(Y511_TURB_UNIT_NAME), Y511_TURB_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY511_Turbidity object - no action needed.
      */
@@ -271,8 +281,8 @@ class YosemitechY511_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y511_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y511_TEMP_VAR_NUM,
-                   (uint8_t)Y511_TEMP_RESOLUTION, Y511_TEMP_VAR_NAME,
-                   Y511_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y511_TEMP_RESOLUTION, F(Y511_TEMP_VAR_NAME),
+                   F(Y511_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY511_Temp object.
      *
@@ -281,8 +291,8 @@ class YosemitechY511_Temp : public Variable {
      */
     YosemitechY511_Temp()
         : Variable((const uint8_t)Y511_TEMP_VAR_NUM,
-                   (uint8_t)Y511_TEMP_RESOLUTION, Y511_TEMP_VAR_NAME,
-                   Y511_TEMP_UNIT_NAME, Y511_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y511_TEMP_RESOLUTION, F(Y511_TEMP_VAR_NAME),
+                   F(Y511_TEMP_UNIT_NAME), Y511_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY511_Temp object - no action needed.
      */
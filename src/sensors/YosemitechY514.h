@@ -172,7 +172,9 @@ class YosemitechY514 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y514,
                            "YosemitechY514", Y514_NUM_VARIABLES,
                            Y514_WARM_UP_TIME_MS, Y514_STABILIZATION_TIME_MS,
-                           Y514_MEASUREMENT_TIME_MS) {}
+                           Y514_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY514::YosemitechY514
      */
@@ -183,11 +185,19 @@ class YosemitechY514 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y514,
                            "YosemitechY514", Y514_NUM_VARIABLES,
                            Y514_WARM_UP_TIME_MS, Y514_STABILIZATION_TIME_MS,
-                           Y514_MEASUREMENT_TIME_MS) {}
+                           Y514_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y514 object
      */
     ~YosemitechY514() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y514_NUM_VARIABLES> _results;
 };
 
 
@@ -216,8 +226,8 @@ class YosemitechY514_Chlorophyll : public Variable {
         YosemitechY514* parentSense, const char* uuid = "",
         const char* varCode = Y514_CHLORO_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y514_CHLORO_VAR_NUM,
-                   (uint8_t)Y514_CHLORO_RESOLUTION, Y514_CHLORO_VAR_NAME,
-                   Y514_CHLORO_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y514_CHLORO_RESOLUTION, F(Y514_CHLORO_VAR_NAME),
+                   F(Y514_CHLORO_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY514_Chlorophyll object.
      *
@@ -226,8 +236,8 @@ class YosemitechY514_Chlorophyll : public Variable {
      */
     YosemitechY514_Chlorophyll()
         : Variable((const uint8_t)Y514_CHLORO_VAR_NUM,
-                   (uint8_t)Y514_CHLORO_RESOLUTION, Y514_CHLORO_VAR_NAME,
-                   Y514_CHLORO_UNIT_NAME, Y514_CHLORO_DEFAULT_CODE) {}
+                   (uint8_t)Y514_CHLORO_RESOLUTION, F(Y514_CHLORO_VAR_NAME),
+                   F(Y514_CHLORO_UNIT_NAME), Y514_CHLORO_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY514_Chlorophyll() object - no action
      * needed.
@@ -261,8 +271,8 @@ class YosemitechY514_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y514_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y514_TEMP_VAR_NUM,
-                   (uint8_t)Y514_TEMP_RESOLUTION, Y514_TEMP_VAR_NAME,
-                   Y514_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y514_TEMP_RESOLUTION, F(Y514_TEMP_VAR_NAME),
+                   F(Y514_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY514_Temp object.
      *
@@ -271,8 +281,8 @@ class YosemitechY514_Temp : public Variable {
      */
     YosemitechY514_Temp()
         : Variable((const uint8_t)Y514_TEMP_VAR_NUM,
-                   (uint8_t)Y514_TEMP_RESOLUTION, Y514_TEMP_VAR_NAME,
-                   Y514_TEMP_UNIT_NAME, Y514_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y514_TEMP_RESOLUTION, F(Y514_TEMP_VAR_NAME),
+                   F(Y514_TEMP_UNIT_NAME), Y514_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY514_Temp object - no action needed.
      */
@@ -170,7 +170,9 @@ class YosemitechY520 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y520,
                            "YosemitechY520", Y520_NUM_VARIABLES,
                            Y520_WARM_UP_TIME_MS, Y520_STABILIZATION_TIME_MS,
-                           Y520_MEASUREMENT_TIME_MS) {}
+                           Y520_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY520::YosemitechY520
      */
@@ -181,11 +183,19 @@ class YosemitechY520 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y520,
                            "YosemitechY520", Y520_NUM_VARIABLES,
                            Y520_WARM_UP_TIME_MS, Y520_STABILIZATION_TIME_MS,
-                           Y520_MEASUREMENT_TIME_MS) {}
+                           Y520_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y520 object
      */
     ~YosemitechY520() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y520_NUM_VARIABLES> _results;
 };
 
 
@@ -214,8 +224,8 @@ class YosemitechY520_Cond : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y520_COND_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y520_COND_VAR_NUM,
-                   (uint8_t)Y520_COND_RESOLUTION, Y520_COND_VAR_NAME,
-                   Y520_COND_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y520_COND_RESOLUTION, F(Y520_COND_VAR_NAME),
+                   F(Y520_COND_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY520_Cond object.
      *
@@ -224,8 +234,8 @@ class YosemitechY520_Cond : public Variable {
      */
     YosemitechY520_Cond()
         : Variable((const uint8_t)Y520_COND_VAR_NUM,
-                   (uint8_t)Y520_COND_RESOLUTION, Y520_COND_VAR_NAME,
-                   Y520_COND_UNIT_NAME, Y520_COND_DEFAULT_CODE) {}
+                   (uint8_t)Y520_COND_RESOLUTION, F(Y520_COND_VAR_NAME),
+                   F(Y520_COND_UNIT_NAME), Y520_COND_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY520_Cond object - no action needed.
      */
@@ -258,8 +268,8 @@ class YosemitechY520_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y520_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y520_TEMP_VAR_NUM,
-                   (uint8_t)Y520_TEMP_RESOLUTION, Y520_TEMP_VAR_NAME,
-                   Y520_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y520_TEMP_RESOLUTION, F(Y520_TEMP_VAR_NAME),
+                   F(Y520_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY520_Temp object.
      *
@@ -268,8 +278,8 @@ class YosemitechY520_Temp : public Variable {
      */
     YosemitechY520_Temp()
         : Variable((const uint8_t)Y520_TEMP_VAR_NUM,
-                   (uint8_t)Y520_TEMP_RESOLUTION, Y520_TEMP_VAR_NAME,
-                   Y520_TEMP_UNIT_NAME, Y520_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y520_TEMP_RESOLUTION, F(Y520_TEMP_VAR_NAME),
+                   F(Y520_TEMP_UNIT_NAME), Y520_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY520_Temp object - no action needed.
      */
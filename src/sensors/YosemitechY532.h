@@ -194,7 +194,9 @@ class YosemitechY532 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y532,
                            "YosemitechY532", Y532_NUM_VARIABLES,
                            Y532_WARM_UP_TIME_MS, Y532_STABILIZATION_TIME_MS,
-                           Y532_MEASUREMENT_TIME_MS) {}
+                           Y532_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY532::YosemitechY532
      */
@@ -205,11 +207,19 @@ class YosemitechY532 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y532,
                            "YosemitechY532", Y532_NUM_VARIABLES,
                            Y532_WARM_UP_TIME_MS, Y532_STABILIZATION_TIME_MS,
-                           Y532_MEASUREMENT_TIME_MS) {}
+                           Y532_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y532 object
      */
     ~YosemitechY532() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y532_NUM_VARIABLES> _results;
 };
 
 
@@ -238,8 +248,8 @@ class YosemitechY532_pH : public Variable {
                                const char*     uuid    = "",
                                const char*     varCode = Y532_PH_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y532_PH_VAR_NUM,
-                   (uint8_t)Y532_PH_RESOLUTION, Y532_PH_VAR_NAME,
-                   Y532_PH_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y532_PH_RESOLUTION, F(Y532_PH_VAR_NAME),
+                   F(Y532_PH_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY532_pH object.
      *
@@ -248,7 +258,8 @@ class YosemitechY532_pH : public Variable {
      */
     YosemitechY532_pH()
         : Variable((const uint8_t)Y532_PH_VAR_NUM, (uint8_t)Y532_PH_RESOLUTION,
-                   Y532_PH_VAR_NAME, Y532_PH_UNIT_NAME, Y532_PH_DEFAULT_CODE) {}
+                   F(Y532_PH_VAR_NAME), F(Y532_PH_UNIT_NAME),
+                   Y532_PH_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY532_pH object - no action needed.
      */
@@ -281,8 +292,8 @@ class YosemitechY532_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y532_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y532_TEMP_VAR_NUM,
-                   (uint8_t)Y532_TEMP_RESOLUTION, Y532_TEMP_VAR_NAME,
-                   Y532_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y532_TEMP_RESOLUTION, F(Y532_TEMP_VAR_NAME),
+                   F(Y532_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY532_Temp object.
      *
@@ -291,8 +302,8 @@ class YosemitechY532_Temp : public Variable {
      */
     YosemitechY532_Temp()
         : Variable((const uint8_t)Y532_TEMP_VAR_NUM,
-                   (uint8_t)Y532_TEMP_RESOLUTION, Y532_TEMP_VAR_NAME,
-                   Y532_TEMP_UNIT_NAME, Y532_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y532_TEMP_RESOLUTION, F(Y532_TEMP_VAR_NAME),
+                   F(Y532_TEMP_UNIT_NAME), Y532_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY532_Temp object - no action needed.
      */
@@ -325,8 +336,8 @@ class YosemitechY532_Voltage : public Variable {
         YosemitechY532* parentSense, const char* uuid = "",
         const char* varCode = Y532_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y532_VOLTAGE_VAR_NUM,
-                   (uint8_t)Y532_VOLTAGE_RESOLUTION, Y532_VOLTAGE_VAR_NAME,
-                   Y532_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y532_VOLTAGE_RESOLUTION, F(Y532_VOLTAGE_VAR_NAME),
+                   F(Y532_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY532_Voltage object.
      *
@@ -335,8 +346,8 @@ class YosemitechY532_Voltage : public Variable {
      */
     YosemitechY532_Voltage()
         : Variable((const uint8_t)Y532_VOLTAGE_VAR_NUM,
-                   (uint8_t)Y532_VOLTAGE_RESOLUTION, Y532_VOLTAGE_VAR_NAME,
-                   Y532_VOLTAGE_UNIT_NAME, Y532_VOLTAGE_DEFAULT_CODE) {}
+                   (uint8_t)Y532_VOLTAGE_RESOLUTION, F(Y532_VOLTAGE_VAR_NAME),
+                   F(Y532_VOLTAGE_UNIT_NAME), Y532_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY532_Voltage object - no action needed.
      */
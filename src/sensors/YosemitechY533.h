@@ -196,7 +196,9 @@ class YosemitechY533 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y533,
                            "YosemitechY533", Y533_NUM_VARIABLES,
                            Y533_WARM_UP_TIME_MS, Y533_STABILIZATION_TIME_MS,
-                           Y533_MEASUREMENT_TIME_MS) {}
+                           Y533_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY533::YosemitechY533
      */
@@ -207,11 +209,19 @@ class YosemitechY533 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y533,
                            "YosemitechY533", Y533_NUM_VARIABLES,
                            Y533_WARM_UP_TIME_MS, Y533_STABILIZATION_TIME_MS,
-                           Y533_MEASUREMENT_TIME_MS) {}
+                           Y533_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y533 object
      */
     ~YosemitechY533() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y533_NUM_VARIABLES> _results;
 };
 
 
@@ -240,8 +250,8 @@ class YosemitechY533_pH : public Variable {
                                const char*     uuid    = "",
                                const char*     varCode = Y533_PH_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y533_PH_VAR_NUM,
-                   (uint8_t)Y533_PH_RESOLUTION, Y533_PH_VAR_NAME,
-                   Y533_PH_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y533_PH_RESOLUTION, F(Y533_PH_VAR_NAME),
+                   F(Y533_PH_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY533_pH object.
      *
@@ -250,7 +260,8 @@ class YosemitechY533_pH : public Variable {
      */
     YosemitechY533_pH()
         : Variable((const uint8_t)Y533_PH_VAR_NUM, (uint8_t)Y533_PH_RESOLUTION,
-                   Y533_PH_VAR_NAME, Y533_PH_UNIT_NAME, Y533_PH_DEFAULT_CODE) {}
+                   F(Y533_PH_VAR_NAME), F(Y533_PH_UNIT_NAME),
+                   Y533_PH_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY533_pH object - no action needed.
      */
@@ -283,8 +294,8 @@ class YosemitechY533_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y533_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y533_TEMP_VAR_NUM,
-                   (uint8_t)Y533_TEMP_RESOLUTION, Y533_TEMP_VAR_NAME,
-                   Y533_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y533_TEMP_RESOLUTION, F(Y533_TEMP_VAR_NAME),
+                   F(Y533_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY533_Temp object.
      *
@@ -293,8 +304,8 @@ class YosemitechY533_Temp : public Variable {
      */
     YosemitechY533_Temp()
         : Variable((const uint8_t)Y533_TEMP_VAR_NUM,
-                   (uint8_t)Y533_TEMP_RESOLUTION, Y533_TEMP_VAR_NAME,
-                   Y533_TEMP_UNIT_NAME, Y533_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y533_TEMP_RESOLUTION, F(Y533_TEMP_VAR_NAME),
+                   F(Y533_TEMP_UNIT_NAME), Y533_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY533_Temp object - no action needed.
      */
@@ -327,8 +338,8 @@ class YosemitechY533_Voltage : public Variable {
         YosemitechY533* parentSense, const char* uuid = "",
         const char* varCode = Y533_VOLTAGE_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y533_VOLTAGE_VAR_NUM,
-                   (uint8_t)Y533_VOLTAGE_RESOLUTION, Y533_VOLTAGE_VAR_NAME,
-                   Y533_VOLTAGE_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y533_VOLTAGE_RESOLUTION, F(Y533_VOLTAGE_VAR_NAME),
+                   F(Y533_VOLTAGE_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY533_Voltage object.
      *
@@ -337,8 +348,8 @@ class YosemitechY533_Voltage : public Variable {
      */
     YosemitechY533_Voltage()
         : Variable((const uint8_t)Y533_VOLTAGE_VAR_NUM,
-                   (uint8_t)Y533_VOLTAGE_RESOLUTION, Y533_VOLTAGE_VAR_NAME,
-                   Y533_VOLTAGE_UNIT_NAME, Y533_VOLTAGE_DEFAULT_CODE) {}
+                   (uint8_t)Y533_VOLTAGE_RESOLUTION, F(Y533_VOLTAGE_VAR_NAME),
+                   F(Y533_VOLTAGE_UNIT_NAME), Y533_VOLTAGE_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY533_Voltage object - no action needed.
      */
@@ -56,8 +56,8 @@
 /** @ingroup sensor_y550 */
 /**@{*/
 
-/// @brief Sensor::_numReturnedValues; the Y550 can report 2 values.
-#define Y550_NUM_VARIABLES 2
+/// @brief Sensor::_numReturnedValues; the Y550 can report 3 values.
+#define Y550_NUM_VARIABLES 3
 
 /**
  * @anchor sensor_y550_timing
@@ -198,7 +198,9 @@ class YosemitechY550 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y550,
                            "YosemitechY550", Y550_NUM_VARIABLES,
                            Y550_WARM_UP_TIME_MS, Y550_STABILIZATION_TIME_MS,
-                           Y550_MEASUREMENT_TIME_MS) {}
+                           Y550_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc YosemitechY550::YosemitechY550
      */
@@ -209,11 +211,19 @@ class YosemitechY550 : public YosemitechParent {
                            enablePin, measurementsToAverage, Y550,
                            "YosemitechY550", Y550_NUM_VARIABLES,
                            Y550_WARM_UP_TIME_MS, Y550_STABILIZATION_TIME_MS,
-                           Y550_MEASUREMENT_TIME_MS) {}
+                           Y550_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Yosemitech Y550 object
      */
     ~YosemitechY550() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<Y550_NUM_VARIABLES> _results;
 };
 
 
@@ -242,8 +252,8 @@ class YosemitechY550_COD : public Variable {
                                 const char*     uuid    = "",
                                 const char*     varCode = Y550_COD_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y550_COD_VAR_NUM,
-                   (uint8_t)Y550_COD_RESOLUTION, Y550_COD_VAR_NAME,
-                   Y550_COD_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y550_COD_RESOLUTION, F(Y550_COD_VAR_NAME),
+                   F(Y550_COD_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY550_COD object.
      *
@@ -252,8 +262,8 @@ class YosemitechY550_COD : public Variable {
      */
     YosemitechY550_COD()
         : Variable((const uint8_t)Y550_COD_VAR_NUM,
-                   (uint8_t)Y550_COD_RESOLUTION, Y550_COD_VAR_NAME,
-                   Y550_COD_UNIT_NAME, Y550_COD_DEFAULT_CODE) {}
+                   (uint8_t)Y550_COD_RESOLUTION, F(Y550_COD_VAR_NAME),
+                   F(Y550_COD_UNIT_NAME), Y550_COD_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY550_COD object - no action needed.
      */
@@ -286,8 +296,8 @@ class YosemitechY550_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = Y550_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y550_TEMP_VAR_NUM,
-                   (uint8_t)Y550_TEMP_RESOLUTION, Y550_TEMP_VAR_NAME,
-                   Y550_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y550_TEMP_RESOLUTION, F(Y550_TEMP_VAR_NAME),
+                   F(Y550_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY550_Temp object.
      *
@@ -296,8 +306,8 @@ class YosemitechY550_Temp : public Variable {
      */
     YosemitechY550_Temp()
         : Variable((const uint8_t)Y550_TEMP_VAR_NUM,
-                   (uint8_t)Y550_TEMP_RESOLUTION, Y550_TEMP_VAR_NAME,
-                   Y550_TEMP_UNIT_NAME, Y550_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)Y550_TEMP_RESOLUTION, F(Y550_TEMP_VAR_NAME),
+                   F(Y550_TEMP_UNIT_NAME), Y550_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY550_Temp object - no action needed.
      */
@@ -330,8 +340,8 @@ class YosemitechY550_Turbidity : public Variable {
         YosemitechY550* parentSense, const char* uuid = "",
         const char* varCode = Y550_TURB_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)Y550_TURB_VAR_NUM,
-                   (uint8_t)Y550_TURB_RESOLUTION, Y550_TURB_VAR_NAME,
-                   Y550_TURB_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)Y550_TURB_RESOLUTION, F(Y550_TURB_VAR_NAME),
+                   F(Y550_TURB_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new YosemitechY550_Turbidity object.
      *
@@ -340,8 +350,8 @@ class YosemitechY550_Turbidity : public Variable {
      */
     YosemitechY550_Turbidity()
         : Variable((const uint8_t)Y550_TURB_VAR_NUM,
-                   (uint8_t)Y550_TURB_RESOLUTION, Y550_TURB_VAR_NAME,
-                   Y550_TURB_UNIT_NAME, Y550_TURB_DEFAULT_CODE) {}
+                   (uint8_t)Y550_TURB_RESOLUTION, F(Y550_TURB_VAR_NAME),
+                   F(Y550_TURB_UNIT_NAME), Y550_TURB_DEFAULT_CODE) {}
     /**
      * @brief Destroy the YosemitechY550_Turbidity object - no action needed.
      */
@@ -212,7 +212,9 @@ class ZebraTechDOpto : public SDI12Sensors {
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "ZebraTech D-Opto", DOPTO_NUM_VARIABLES,
                        DOPTO_WARM_UP_TIME_MS, DOPTO_STABILIZATION_TIME_MS,
-                       DOPTO_MEASUREMENT_TIME_MS) {}
+                       DOPTO_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc ZebraTechDOpto::ZebraTechDOpto
      */
@@ -221,7 +223,9 @@ class ZebraTechDOpto : public SDI12Sensors {
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "ZebraTech D-Opto", DOPTO_NUM_VARIABLES,
                        DOPTO_WARM_UP_TIME_MS, DOPTO_STABILIZATION_TIME_MS,
-                       DOPTO_MEASUREMENT_TIME_MS) {}
+                       DOPTO_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @copydoc ZebraTechDOpto::ZebraTechDOpto
      */
@@ -230,11 +234,19 @@ class ZebraTechDOpto : public SDI12Sensors {
         : SDI12Sensors(SDI12address, powerPin, dataPin, measurementsToAverage,
                        "ZebraTech D-Opto", DOPTO_NUM_VARIABLES,
                        DOPTO_WARM_UP_TIME_MS, DOPTO_STABILIZATION_TIME_MS,
-                       DOPTO_MEASUREMENT_TIME_MS) {}
+                       DOPTO_MEASUREMENT_TIME_MS) {
+        setResultArrays(_results);
+    }
     /**
      * @brief Destroy the Zebra-Tech DOpto object
      */
     ~ZebraTechDOpto() {}
+
+ private:
+    /**
+     * @brief The value, count, and variable arrays for this sensor's results.
+     */
+    SensorResultArrays<DOPTO_NUM_VARIABLES> _results;
 };
 
 
@@ -263,8 +275,8 @@ class ZebraTechDOpto_Temp : public Variable {
                                  const char*     uuid = "",
                                  const char* varCode  = DOPTO_TEMP_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DOPTO_TEMP_VAR_NUM,
-                   (uint8_t)DOPTO_TEMP_RESOLUTION, DOPTO_TEMP_VAR_NAME,
-                   DOPTO_TEMP_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DOPTO_TEMP_RESOLUTION, F(DOPTO_TEMP_VAR_NAME),
+                   F(DOPTO_TEMP_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ZebraTechDOpto_Temp object.
      *
@@ -273,8 +285,8 @@ class ZebraTechDOpto_Temp : public Variable {
      */
     ZebraTechDOpto_Temp()
         : Variable((const uint8_t)DOPTO_TEMP_VAR_NUM,
-                   (uint8_t)DOPTO_TEMP_RESOLUTION, DOPTO_TEMP_VAR_NAME,
-                   DOPTO_TEMP_UNIT_NAME, DOPTO_TEMP_DEFAULT_CODE) {}
+                   (uint8_t)DOPTO_TEMP_RESOLUTION, F(DOPTO_TEMP_VAR_NAME),
+                   F(DOPTO_TEMP_UNIT_NAME), DOPTO_TEMP_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ZebraTechDOpto_Temp object - no action needed.
      */
@@ -307,8 +319,8 @@ class ZebraTechDOpto_DOpct : public Variable {
         ZebraTechDOpto* parentSense, const char* uuid = "",
         const char* varCode = DOPTO_DOPCT_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DOPTO_DOPCT_VAR_NUM,
-                   (uint8_t)DOPTO_DOPCT_RESOLUTION, DOPTO_DOPCT_VAR_NAME,
-                   DOPTO_DOPCT_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DOPTO_DOPCT_RESOLUTION, F(DOPTO_DOPCT_VAR_NAME),
+                   F(DOPTO_DOPCT_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ZebraTechDOpto_DOpct object.
      *
@@ -317,8 +329,8 @@ class ZebraTechDOpto_DOpct : public Variable {
      */
     ZebraTechDOpto_DOpct()
         : Variable((const uint8_t)DOPTO_DOPCT_VAR_NUM,
-                   (uint8_t)DOPTO_DOPCT_RESOLUTION, DOPTO_DOPCT_VAR_NAME,
-                   DOPTO_DOPCT_UNIT_NAME, DOPTO_DOPCT_DEFAULT_CODE) {}
+                   (uint8_t)DOPTO_DOPCT_RESOLUTION, F(DOPTO_DOPCT_VAR_NAME),
+                   F(DOPTO_DOPCT_UNIT_NAME), DOPTO_DOPCT_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ZebraTechDOpto_DOpct object - no action needed.
      */
@@ -351,8 +363,8 @@ class ZebraTechDOpto_DOmgL : public Variable {
         ZebraTechDOpto* parentSense, const char* uuid = "",
         const char* varCode = DOPTO_DOMGL_DEFAULT_CODE)
         : Variable(parentSense, (const uint8_t)DOPTO_DOMGL_VAR_NUM,
-                   (uint8_t)DOPTO_DOMGL_RESOLUTION, DOPTO_DOMGL_VAR_NAME,
-                   DOPTO_DOMGL_UNIT_NAME, varCode, uuid) {}
+                   (uint8_t)DOPTO_DOMGL_RESOLUTION, F(DOPTO_DOMGL_VAR_NAME),
+                   F(DOPTO_DOMGL_UNIT_NAME), varCode, uuid) {}
     /**
      * @brief Construct a new ZebraTechDOpto_DOmgL object.
      *
@@ -361,8 +373,8 @@ class ZebraTechDOpto_DOmgL : public Variable {
      */
     ZebraTechDOpto_DOmgL()
         : Variable((const uint8_t)DOPTO_DOMGL_VAR_NUM,
-                   (uint8_t)DOPTO_DOMGL_RESOLUTION, DOPTO_DOMGL_VAR_NAME,
-                   DOPTO_DOMGL_UNIT_NAME, DOPTO_DOMGL_DEFAULT_CODE) {}
+                   (uint8_t)DOPTO_DOMGL_RESOLUTION, F(DOPTO_DOMGL_VAR_NAME),
+                   F(DOPTO_DOMGL_UNIT_NAME), DOPTO_DOMGL_DEFAULT_CODE) {}
     /**
      * @brief Destroy the ZebraTechDOpto_DOmgL object - no action needed.
      */
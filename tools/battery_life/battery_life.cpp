@@ -0,0 +1,173 @@
+/**
+ * @file battery_life.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that projects how long a battery will last for a
+ * logger configuration, using EnergyProjection.h and the datasheet currents in
+ * EnergyCurrents.h.
+ *
+ * The configuration is given as name=value pairs; any that are left out take
+ * the default shown:
+ * - `battery=3500` - the usable battery capacity, in mAh;
+ * - `interval=15` - the logging interval, in minutes;
+ * - `awake=10` - the seconds the board is awake each interval, not counting
+ * the time the modem is on;
+ * - `sensors=5` - the average current of the sensors while awake, in mA;
+ * - `modem=xbee3-ltem` - one of none, xbee3-ltem, xbee-3g, xbee-wifi, sim800,
+ * sim7000, or esp8266;
+ * - `modem_time=45` - the seconds the modem is on each time it sends;
+ * - `send_every=1` - the number of intervals between sends;
+ * - `modem_powered=0` - 1 if the modem is never switched off, so it draws its
+ * sleep current between sends.
+ *
+ * The board is an EnviroDIY Mayfly.  The board is awake while the modem is
+ * on, so its awake time includes the modem time.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o battery_life battery_life.cpp
+ * ./battery_life battery=3500 interval=15 modem=sim800 send_every=4
+ * @endcode
+ * It prints the charge each part uses, the projected battery life, and the
+ * battery life at other intervals with the same configuration.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EnergyProjection.h"
+#include "EnergyCurrents.h"
+
+// The currents of one modem
+struct ModemCurrents {
+    const char* name;
+    float       active_mA;
+    float       sleep_mA;
+};
+
+static const ModemCurrents modems[] = {
+    {"none", 0, 0},
+    {"xbee3-ltem", XBEE3_LTEM_ACTIVE_CURRENT_MA, XBEE3_LTEM_SLEEP_CURRENT_MA},
+    {"xbee-3g", XBEE_3G_ACTIVE_CURRENT_MA, XBEE_3G_SLEEP_CURRENT_MA},
+    {"xbee-wifi", XBEE_WIFI_ACTIVE_CURRENT_MA, XBEE_WIFI_SLEEP_CURRENT_MA},
+    {"sim800", SIM800_ACTIVE_CURRENT_MA, SIM800_SLEEP_CURRENT_MA},
+    {"sim7000", SIM7000_ACTIVE_CURRENT_MA, SIM7000_SLEEP_CURRENT_MA},
+    {"esp8266", ESP8266_ACTIVE_CURRENT_MA, ESP8266_SLEEP_CURRENT_MA},
+};
+
+// A logger configuration
+struct Config {
+    float                battery_mAh;
+    uint16_t             interval_min;
+    float                awake_s;
+    float                sensors_mA;
+    const ModemCurrents* modem;
+    float                modemTime_s;
+    uint16_t             sendEvery;
+    bool                 modemPowered;
+};
+
+// The charge each part uses in one interval, in mAh
+struct Charges {
+    float board;
+    float sensors;
+    float modem;
+};
+
+static Charges chargesPerCycle(const Config& c) {
+    Charges charges;
+    // Spread the modem over the intervals between sends
+    float modemAwake_s = c.modemTime_s / c.sendEvery;
+    charges.board = energyChargePerCycle(MAYFLY_AWAKE_CURRENT_MA,
+                                         c.awake_s + modemAwake_s,
+                                         MAYFLY_SLEEP_CURRENT_MA,
+                                         c.interval_min);
+    charges.sensors = energyChargePerCycle(c.sensors_mA, c.awake_s, 0,
+                                           c.interval_min);
+    float modemSleep_mA = c.modemPowered ? c.modem->sleep_mA : 0;
+    charges.modem = energyChargePerCycle(c.modem->active_mA, modemAwake_s,
+                                         modemSleep_mA, c.interval_min);
+    return charges;
+}
+
+static float lifeDays(const Config& c) {
+    Charges charges = chargesPerCycle(c);
+    float   perDay  = energyChargePerDay(
+        charges.board + charges.sensors + charges.modem, c.interval_min);
+    return energyBatteryLifeDays(c.battery_mAh, perDay);
+}
+
+static bool parse(Config* c, const char* arg) {
+    const char* value = strchr(arg, '=');
+    if (value == NULL) { return false; }
+    size_t nameLength = value - arg;
+    value++;
+#define IS(name) \
+    (nameLength == strlen(name) && strncmp(arg, name, nameLength) == 0)
+    if (IS("battery")) {
+        c->battery_mAh = atof(value);
+    } else if (IS("interval")) {
+        c->interval_min = atoi(value);
+    } else if (IS("awake")) {
+        c->awake_s = atof(value);
+    } else if (IS("sensors")) {
+        c->sensors_mA = atof(value);
+    } else if (IS("modem_time")) {
+        c->modemTime_s = atof(value);
+    } else if (IS("send_every")) {
+        c->sendEvery = atoi(value);
+    } else if (IS("modem_powered")) {
+        c->modemPowered = atoi(value) != 0;
+    } else if (IS("modem")) {
+        for (size_t i = 0; i < sizeof(modems) / sizeof(modems[0]); i++) {
+            if (strcmp(value, modems[i].name) == 0) {
+                c->modem = &modems[i];
+                return true;
+            }
+        }
+        return false;
+    } else {
+        return false;
+    }
+#undef IS
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    Config c = {3500, 15, 10, 5, &modems[1], 45, 1, false};
+    for (int i = 1; i < argc; i++) {
+        if (!parse(&c, argv[i])) {
+            printf("Unknown setting: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (c.interval_min == 0 || c.sendEvery == 0) {
+        printf("The interval and send_every must be at least 1\n");
+        return 1;
+    }
+
+    Charges charges  = chargesPerCycle(c);
+    float   perCycle = charges.board + charges.sensors + charges.modem;
+    float   perDay   = energyChargePerDay(perCycle, c.interval_min);
+    printf("Mayfly, %s modem, %u minute interval, sending every %u\n",
+           c.modem->name, c.interval_min, c.sendEvery);
+    printf("  Board:   %8.4f mAh per interval\n", charges.board);
+    printf("  Sensors: %8.4f mAh per interval\n", charges.sensors);
+    printf("  Modem:   %8.4f mAh per interval\n", charges.modem);
+    printf("  Total:   %8.4f mAh per interval, %.1f mAh per day\n", perCycle,
+           perDay);
+    printf("  A %.0f mAh battery lasts about %.0f days\n", c.battery_mAh,
+           energyBatteryLifeDays(c.battery_mAh, perDay));
+
+    printf("At other intervals:\n");
+    const uint16_t intervals[] = {1, 5, 10, 15, 30, 60};
+    for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+        Config other       = c;
+        other.interval_min = intervals[i];
+        printf("  %3u minutes: %6.0f days\n", intervals[i], lifeDays(other));
+    }
+    return 0;
+}
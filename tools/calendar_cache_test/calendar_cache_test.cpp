@@ -0,0 +1,164 @@
+/**
+ * @file calendar_cache_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that checks the date conversion and the timestamp
+ * strings of the CalendarCache against the C library's gmtime().
+ *
+ * It checks:
+ * - the ISO8601 string for a time about every hour from 1970 to 2100, which
+ * crosses every month end and leap day, and the years 2000 and 2100;
+ * - every second across a few day, month, and year ends, so the same-day
+ * shortcut in setEpoch() is used the way the logger uses it;
+ * - times that go back, to an earlier second, an earlier day, and 1970;
+ * - the "+hh:00" and "-hh:00" endings, and that changing only the time zone
+ * or only the milliseconds makes a new string;
+ * - the CSV string, with and without milliseconds.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o calendar_cache_test calendar_cache_test.cpp \
+ *     ../../src/CalendarCache.cpp
+ * ./calendar_cache_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "CalendarCache.h"
+
+static uint32_t failures = 0;
+
+static void check(const char* what, uint32_t epochTime, const char* got,
+                  const char* expected) {
+    if (strcmp(got, expected) == 0) { return; }
+    if (failures < 20) {
+        printf("FAIL %s at %lu: got \"%s\", expected \"%s\"\n", what,
+               (unsigned long)epochTime, got, expected);
+    }
+    failures++;
+}
+
+// The date and time as gmtime() gives it, with the separator between them
+static void expectedDateTime(char* buffer, size_t size, uint32_t epochTime,
+                             char separator) {
+    time_t    t = epochTime;
+    struct tm parts;
+    gmtime_r(&t, &parts);
+    char format[] = "%Y-%m-%d?%H:%M:%S";
+    format[8]     = separator;
+    strftime(buffer, size, format, &parts);
+}
+
+static void expectedISO8601(char* buffer, size_t size, uint32_t epochTime,
+                            int8_t timeZone) {
+    char dateTime[32];
+    expectedDateTime(dateTime, sizeof(dateTime), epochTime, 'T');
+    if (timeZone == 0) {
+        snprintf(buffer, size, "%sZ", dateTime);
+    } else {
+        snprintf(buffer, size, "%s%c%02d:00", dateTime,
+                 timeZone > 0 ? '+' : '-', timeZone > 0 ? timeZone : -timeZone);
+    }
+}
+
+static void checkISO8601(CalendarCache& calendar, uint32_t epochTime,
+                         int8_t timeZone) {
+    char expected[40];
+    expectedISO8601(expected, sizeof(expected), epochTime, timeZone);
+    check("formatISO8601", epochTime,
+          calendar.formatISO8601(epochTime, timeZone), expected);
+}
+
+static void testSweep(void) {
+    CalendarCache calendar;
+    // Not a whole number of hours, so the time of day moves around too
+    for (uint32_t t = 0; t < 4102444800UL; t += 3599 + t % 7) {
+        checkISO8601(calendar, t, 0);
+    }
+}
+
+static void testEverySecond(void) {
+    // The last minutes of a day, a month, a leap day, and a year
+    const uint32_t ends[] = {
+        1577923200UL,  // 2020-01-02
+        1583020800UL,  // 2020-03-01, after a leap day
+        1609459200UL,  // 2021-01-01
+        951868800UL,   // 2000-03-01, after a leap day
+        4107542400UL,  // 2100-03-01, with no leap day
+    };
+    for (uint8_t i = 0; i < sizeof(ends) / sizeof(ends[0]); i++) {
+        CalendarCache calendar;
+        for (uint32_t t = ends[i] - 600; t < ends[i] + 600; t++) {
+            checkISO8601(calendar, t, 0);
+        }
+    }
+}
+
+static void testBackwards(void) {
+    CalendarCache calendar;
+    const uint32_t times[] = {1600000000UL, 1599999999UL, 1599955200UL,
+                              1599955199UL, 1500000000UL, 0,
+                              1600000000UL, 86399UL,      86400UL};
+    for (uint8_t i = 0; i < sizeof(times) / sizeof(times[0]); i++) {
+        checkISO8601(calendar, times[i], 0);
+    }
+}
+
+static void testTimeZones(void) {
+    CalendarCache calendar;
+    const int8_t zones[] = {0, -5, 10, -12, 14, 1, -1, 0};
+    for (uint8_t i = 0; i < sizeof(zones) / sizeof(zones[0]); i++) {
+        // The same time each call, so only the time zone changes
+        checkISO8601(calendar, 1600000000UL, zones[i]);
+    }
+
+    check("milliseconds", 1600000000UL,
+          calendar.formatISO8601(1600000000UL, -5, 42, true),
+          "2020-09-13T12:26:40.042-05:00");
+    check("other milliseconds", 1600000000UL,
+          calendar.formatISO8601(1600000000UL, -5, 999, true),
+          "2020-09-13T12:26:40.999-05:00");
+    check("milliseconds left off", 1600000000UL,
+          calendar.formatISO8601(1600000000UL, -5, 999, false),
+          "2020-09-13T12:26:40-05:00");
+}
+
+static void testCSV(void) {
+    CalendarCache calendar;
+    char          expected[40];
+    for (uint32_t t = 1577836800UL - 100; t < 1577836800UL + 100; t++) {
+        expectedDateTime(expected, sizeof(expected), t, ' ');
+        check("formatCSV", t, calendar.formatCSV(t), expected);
+    }
+    check("CSV milliseconds", 1600000001UL,
+          calendar.formatCSV(1600000001UL, 7, true),
+          "2020-09-13 12:26:41.007");
+    check("CSV milliseconds left off", 1600000001UL,
+          calendar.formatCSV(1600000001UL, 7, false), "2020-09-13 12:26:41");
+
+    // Both strings can be asked for in turn without one spoiling the other
+    check("ISO8601 after CSV", 1600000002UL,
+          calendar.formatISO8601(1600000002UL, 0), "2020-09-13T12:26:42Z");
+    check("CSV after ISO8601", 1600000002UL, calendar.formatCSV(1600000002UL),
+          "2020-09-13 12:26:42");
+}
+
+int main(void) {
+    testSweep();
+    testEverySecond();
+    testBackwards();
+    testTimeZones();
+    testCSV();
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All calendar cache checks passed\n");
+    return 0;
+}
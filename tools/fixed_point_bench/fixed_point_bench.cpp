@@ -0,0 +1,177 @@
+/**
+ * @file fixed_point_bench.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that times the fixed-point conversion kernels in
+ * FixedPointMath.h against the float code they replace.
+ *
+ * It times, for every reading the ADC can return:
+ * - ExternalVoltage: counts to volts times a gain;
+ * - CampbellOBS3: counts to volts and the A*V^2 + B*V + C calibration;
+ * - ProcessorStats: the battery reading times the volts per count;
+ * - AnalogElecConductivity: the reading to µS/cm.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o fixed_point_bench fixed_point_bench.cpp
+ * ./fixed_point_bench
+ * @endcode
+ * It prints the nanoseconds per conversion for each kernel both ways.
+ *
+ * @note A desktop processor has a floating point unit, so float math there is
+ * as fast as integer math and these numbers say little about an 8-bit AVR.
+ * To time the kernels on a board, build the same loops into a sketch and time
+ * them with micros(), or count cycles in a simulator like simavr.  The program
+ * is kept so that the loops are the ones the checks in fixed_point_test use.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "FixedPointMath.h"
+
+// The number of passes over the readings for each kernel
+#define PASSES 200
+
+// Results are summed into this so the compiler can't drop the loops
+static volatile float sink = 0;
+
+// Inputs are read from these so the compiler can't fold the constants
+static volatile float gainIn    = 10.0f;
+static volatile float obsA      = 1000.0f;
+static volatile float obsB      = 2000.0f;
+static volatile float obsC      = -12.5f;
+static volatile float batteryIn = (3.3f / 1023.f) * 4.7f;
+static volatile float ecScaleIn = 1000000 / (499 * 2.88f);
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void report(const char* name, double floatNs, double fixedNs,
+                   uint32_t count) {
+    printf("%-24s float %7.2f ns  fixed %7.2f ns\n", name, floatNs / count,
+           fixedNs / count);
+}
+
+static void benchExternalVoltage(void) {
+    float       gain      = gainIn;
+    fixed_q16_t gainFixed = floatToFixed(gain);
+
+    double start = nowNs();
+    float  sum   = 0;
+    for (uint16_t p = 0; p < PASSES; p++) {
+        for (int32_t c = 0; c < 28800; c++) {
+            sum += (c * 0.000125f) * gain;
+        }
+    }
+    double floatNs = nowNs() - start;
+    sink += sum;
+
+    start           = nowNs();
+    fixed_q16_t acc = 0;
+    for (uint16_t p = 0; p < PASSES; p++) {
+        for (int32_t c = 0; c < 28800; c++) {
+            acc += fixedMul(adsGainOneCountsToFixedVolts((int16_t)c),
+                            gainFixed) >>
+                8;
+        }
+    }
+    double fixedNs = nowNs() - start;
+    sink += acc;
+    report("ExternalVoltage", floatNs, fixedNs, PASSES * 28800UL);
+}
+
+static void benchOBS3(void) {
+    float       A = obsA, B = obsB, C = obsC;
+    fixed_q16_t Af = floatToFixed(A), Bf = floatToFixed(B),
+                Cf = floatToFixed(C);
+
+    double start = nowNs();
+    float  sum   = 0;
+    for (uint16_t p = 0; p < PASSES; p++) {
+        for (int32_t c = 0; c < 4800; c++) {
+            float v = c * 0.000125f;
+            sum += A * v * v + B * v + C;
+        }
+    }
+    double floatNs = nowNs() - start;
+    sink += sum;
+
+    start           = nowNs();
+    fixed_q16_t acc = 0;
+    for (uint16_t p = 0; p < PASSES; p++) {
+        for (int32_t c = 0; c < 4800; c++) {
+            fixed_q16_t v = adsGainOneCountsToFixedVolts((int16_t)c);
+            acc += (fixedMul(Af, fixedMul(v, v)) + fixedMul(Bf, v) + Cf) >>
+                16;
+        }
+    }
+    double fixedNs = nowNs() - start;
+    sink += acc;
+    report("CampbellOBS3", floatNs, fixedNs, PASSES * 4800UL);
+}
+
+static void benchBattery(void) {
+    float       multiplier      = batteryIn;
+    fixed_q16_t multiplierFixed = floatToFixed(multiplier);
+
+    double start = nowNs();
+    float  sum   = 0;
+    for (uint16_t p = 0; p < PASSES * 4; p++) {
+        for (uint16_t c = 0; c < 1024; c++) { sum += multiplier * c; }
+    }
+    double floatNs = nowNs() - start;
+    sink += sum;
+
+    start           = nowNs();
+    fixed_q16_t acc = 0;
+    for (uint16_t p = 0; p < PASSES * 4; p++) {
+        for (uint16_t c = 0; c < 1024; c++) {
+            acc += analogCountsToFixed(c, multiplierFixed) >> 8;
+        }
+    }
+    double fixedNs = nowNs() - start;
+    sink += acc;
+    report("ProcessorStats battery", floatNs, fixedNs, PASSES * 4 * 1024UL);
+}
+
+static void benchAnalogEC(void) {
+    uint32_t scaleFixed = analogEcScaleToFixed(ecScaleIn, 1024);
+
+    double start = nowNs();
+    float  sum   = 0;
+    for (uint16_t p = 0; p < PASSES * 4; p++) {
+        for (uint32_t c = 1; c < 1024; c++) {
+            // The float path: the water's resistance, then the conductivity
+            float Rwater = 499 / ((1024.0f / (float)c) - 1);
+            sum += 1000000 / (Rwater * 2.88f);
+        }
+    }
+    double floatNs = nowNs() - start;
+    sink += sum;
+
+    start        = nowNs();
+    uint32_t acc = 0;
+    for (uint16_t p = 0; p < PASSES * 4; p++) {
+        for (uint32_t c = 1; c < 1024; c++) {
+            acc += analogEcFromCounts(c, 1024, scaleFixed) >> 8;
+        }
+    }
+    double fixedNs = nowNs() - start;
+    sink += acc;
+    report("AnalogElecConductivity", floatNs, fixedNs, PASSES * 4 * 1023UL);
+}
+
+int main(void) {
+    benchExternalVoltage();
+    benchOBS3();
+    benchBattery();
+    benchAnalogEC();
+    return 0;
+}
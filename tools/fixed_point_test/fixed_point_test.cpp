@@ -0,0 +1,315 @@
+/**
+ * @file fixed_point_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that checks the Q16.16 helpers in FixedPointMath.h
+ * against double precision math.
+ *
+ * It checks:
+ * - every raw count the ADS1x15 can return, converted to volts;
+ * - the ExternalVoltage and CampbellOBS3 conversions over the whole count
+ * range, including calibrations right at the edge of what fitsInFixed()
+ * allows, so any overflow would show;
+ * - fixedMul() against an exact 64-bit product, with each 16-bit half of
+ * both factors at its extremes, with negative factors, and with products at
+ * the edge of the Q16.16 range;
+ * - rounding of floatToFixed() for negative values and the limits of
+ * fitsInFixed();
+ * - the ProcessorStats battery conversion for every 10- and 12-bit reading,
+ * with the multipliers of each supported board;
+ * - the AnalogElecConductivity conversion for every 10- and 12-bit reading,
+ * with the default and a small series resistance, and that a scale too large
+ * for the product to fit is refused.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o fixed_point_test fixed_point_test.cpp
+ * ./fixed_point_test
+ * g++ -O2 -DMS_USE_ADS1015 -I../../src -o fixed_point_test fixed_point_test.cpp
+ * ./fixed_point_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "FixedPointMath.h"
+
+// One Q16.16 step, in double
+#define LSB (1.0 / 65536.0)
+
+static uint32_t failures = 0;
+
+static void fail(const char* what, double got, double expected) {
+    if (failures < 20) {
+        printf("FAIL %s: got %.9f, expected %.9f\n", what, got, expected);
+    }
+    failures++;
+}
+
+// A small repeatable random number generator (xorshift32)
+static uint32_t rngState = 2463534242UL;
+static uint32_t nextRandom(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// The exact product of two Q16.16 numbers, rounded the way fixedMul rounds:
+// half away from zero
+static int64_t exactMul(fixed_q16_t a, fixed_q16_t b) {
+    int64_t product   = (int64_t)a * (int64_t)b;
+    int64_t magnitude = product < 0 ? -product : product;
+    magnitude         = (magnitude + 0x8000) >> 16;
+    return product < 0 ? -magnitude : magnitude;
+}
+
+// Checks one product against the exact value and against double math
+static void checkMul(fixed_q16_t a, fixed_q16_t b) {
+    int64_t exact = exactMul(a, b);
+    // The caller must keep the product in range; skip pairs that don't fit
+    if (exact > INT32_MAX || exact < -(int64_t)INT32_MAX) { return; }
+    fixed_q16_t got = fixedMul(a, b);
+    if (got != exact) {
+        fail("fixedMul exact", got * LSB, exact * LSB);
+        return;
+    }
+    double expected = ((double)a * LSB) * ((double)b * LSB);
+    double allowed  = 0.5 * LSB + fabs(expected) * 1e-7;
+    if (fabs(fixedToFloat(got) - expected) > allowed) {
+        fail("fixedMul vs double", fixedToFloat(got), expected);
+    }
+}
+
+static void testFixedMul(void) {
+    // Every combination of extreme 16-bit halves, in all four sign pairs
+    const uint32_t halves[] = {0x0000, 0x0001, 0x7FFF, 0x8000, 0xFFFF};
+    for (uint8_t i = 0; i < 5; i++) {
+        for (uint8_t j = 0; j < 5; j++) {
+            for (uint8_t k = 0; k < 5; k++) {
+                for (uint8_t l = 0; l < 5; l++) {
+                    fixed_q16_t a = (fixed_q16_t)((halves[i] & 0x7FFF) << 16 |
+                                                  halves[j]);
+                    fixed_q16_t b = (fixed_q16_t)((halves[k] & 0x7FFF) << 16 |
+                                                  halves[l]);
+                    checkMul(a, b);
+                    checkMul(-a, b);
+                    checkMul(a, -b);
+                    checkMul(-a, -b);
+                }
+            }
+        }
+    }
+
+    // Random factors whose products fit, scaled over many magnitudes
+    for (uint32_t n = 0; n < 2000000UL; n++) {
+        fixed_q16_t a = (fixed_q16_t)(nextRandom() >> (nextRandom() % 31));
+        fixed_q16_t b = (fixed_q16_t)(nextRandom() >> (nextRandom() % 31));
+        if (nextRandom() & 1) { a = -a; }
+        if (nextRandom() & 1) { b = -b; }
+        checkMul(a, b);
+    }
+
+    // Products right at the top of the Q16.16 range
+    checkMul(floatToFixed(181.0f), floatToFixed(181.0f));
+    checkMul(floatToFixed(-181.0f), floatToFixed(181.0f));
+    checkMul(INT32_MAX, FIXED_Q16_ONE);
+    checkMul(-INT32_MAX, FIXED_Q16_ONE);
+    checkMul(FIXED_Q16_ONE / 2, INT32_MAX);
+}
+
+static void testConversions(void) {
+    // Negative values must round away from zero, like positive ones
+    const float values[] = {0.0f,    1.0f,     -1.0f,    0.1f,  -0.1f,
+                            3.6f,    -0.3f,    1e-5f,    -1e-5f, 32766.0f,
+                            -32766.0f};
+    for (uint8_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        float back = fixedToFloat(floatToFixed(values[i]));
+        if (fabs(back - values[i]) > 0.5 * LSB + fabs(values[i]) * 1e-7) {
+            fail("floatToFixed round trip", back, values[i]);
+        }
+    }
+    if (floatToFixed(-0.1f) != -floatToFixed(0.1f)) {
+        fail("floatToFixed symmetry", floatToFixed(-0.1f),
+             -floatToFixed(0.1f));
+    }
+
+    // The range check has to refuse anything a Q16.16 can't hold
+    if (!fitsInFixed(32766.9f)) { fail("fitsInFixed(32766.9)", 0, 1); }
+    if (!fitsInFixed(-32766.9f)) { fail("fitsInFixed(-32766.9)", 0, 1); }
+    if (fitsInFixed(32767.0f)) { fail("fitsInFixed(32767)", 1, 0); }
+    if (fitsInFixed(-32767.0f)) { fail("fitsInFixed(-32767)", 1, 0); }
+    if (fitsInFixed(1e9f)) { fail("fitsInFixed(1e9)", 1, 0); }
+    if (fitsInFixed(NAN)) { fail("fitsInFixed(NAN)", 1, 0); }
+}
+
+// The volts and the count range the ADC can return
+#ifndef MS_USE_ADS1015
+#define ADS_MIN_COUNT -32768L
+#define ADS_MAX_COUNT 32767L
+static double countsToVolts(int32_t counts) {
+    return counts * 0.000125;
+}
+#else
+// The 12-bit result is right-aligned, so it arrives as 0 to 4095
+#define ADS_MIN_COUNT 0L
+#define ADS_MAX_COUNT 4095L
+static double countsToVolts(int32_t counts) {
+    return (counts > 2047 ? counts - 4096 : counts) * 0.002;
+}
+#endif
+
+static void testADS(void) {
+    // Every count the ADC can return; the division truncates, so allow one
+    // step
+    for (int32_t c = ADS_MIN_COUNT; c <= ADS_MAX_COUNT; c++) {
+        double got = fixedToFloat(adsGainOneCountsToFixedVolts((int16_t)c));
+        if (fabs(got - countsToVolts(c)) > LSB) {
+            fail("adsGainOneCountsToFixedVolts", got, countsToVolts(c));
+        }
+    }
+
+    // ExternalVoltage: volts * gain, with gains up to the largest that
+    // fitsInFixed() lets through for a 3.6V reading
+    const float gains[] = {1.0f,  10.0f,    -10.0f,  0.001f,
+                           100.0f, 9101.0f, -9101.0f};
+    for (uint8_t g = 0; g < sizeof(gains) / sizeof(gains[0]); g++) {
+        if (!fitsInFixed(fabs(gains[g]) * 3.6)) {
+            fail("fitsInFixed(gain)", 0, gains[g]);
+            continue;
+        }
+        fixed_q16_t gainFixed = floatToFixed(gains[g]);
+        // Errors: one step in the counts, half a step in the gain, and half
+        // a step in the product
+        double allowed = (fabs(gains[g]) + 3.6 * 0.5 + 0.5) * LSB +
+            fabs(gains[g]) * 3.6 * 1e-7;
+        for (int32_t c = ADS_MIN_COUNT; c <= ADS_MAX_COUNT; c++) {
+            fixed_q16_t volts = adsGainOneCountsToFixedVolts((int16_t)c);
+            // The sensor drops readings outside of -0.3 to 3.6V
+            if (volts >= floatToFixed(3.6) || volts <= floatToFixed(-0.3)) {
+                continue;
+            }
+            double got      = fixedToFloat(fixedMul(volts, gainFixed));
+            double expected = countsToVolts(c) * gains[g];
+            if (fabs(got - expected) > allowed) {
+                fail("ExternalVoltage", got, expected);
+            }
+        }
+    }
+    // A gain past the limit must be refused
+    if (fitsInFixed(9102.0f * 3.6f)) { fail("fitsInFixed(9102*3.6)", 1, 0); }
+
+    // CampbellOBS3: A*V^2 + B*V + C, with a calibration that just fits
+    const float A = 1000.0f, B = 2000.0f, C = -12.5f;
+    if (!fitsInFixed(fabs(A) * 3.6 * 3.6 + fabs(B) * 3.6 + fabs(C))) {
+        fail("fitsInFixed(OBS3)", 0, 1);
+    }
+    fixed_q16_t Af = floatToFixed(A), Bf = floatToFixed(B),
+                Cf = floatToFixed(C);
+    for (int32_t c = ADS_MIN_COUNT; c <= ADS_MAX_COUNT; c++) {
+        fixed_q16_t v = adsGainOneCountsToFixedVolts((int16_t)c);
+        if (v >= floatToFixed(3.6) || v <= floatToFixed(-0.3)) { continue; }
+        double got = fixedToFloat(fixedMul(Af, fixedMul(v, v)) +
+                                  fixedMul(Bf, v) + Cf);
+        double V        = countsToVolts(c);
+        double expected = A * V * V + B * V + C;
+        // The error in the volts is multiplied by the slope of the curve
+        double allowed = ((2 * A * 3.6 + B) * 1.5 + A + 2) * LSB +
+            fabs(expected) * 1e-7;
+        if (fabs(got - expected) > allowed) {
+            fail("CampbellOBS3", got, expected);
+        }
+    }
+}
+
+static void testBattery(void) {
+    // The volts per count ProcessorStats uses on each board
+    const double multipliers[] = {(3.3 / 1023.) * 1.47, (3.3 / 1023.) * 4.7,
+                                  2 * 3.3 / 1024, (3.3 / 1023.) * 2};
+    for (uint8_t m = 0; m < sizeof(multipliers) / sizeof(multipliers[0]);
+         m++) {
+        fixed_q16_t multiplierFixed = floatToFixed((float)multipliers[m]);
+        // Every 10- and 12-bit reading
+        for (uint16_t c = 0; c <= 4095; c++) {
+            fixed_q16_t got = analogCountsToFixed(c, multiplierFixed);
+            if (got != (int64_t)c * multiplierFixed) {
+                fail("analogCountsToFixed overflow", got * LSB,
+                     (double)c * multiplierFixed * LSB);
+                continue;
+            }
+            double expected = c * multipliers[m];
+            // Half a step in the multiplier, for each count
+            double allowed = c * 0.5 * LSB + expected * 1e-7;
+            if (fabs(fixedToFloat(got) - expected) > allowed) {
+                fail("ProcessorStats battery", fixedToFloat(got), expected);
+            }
+        }
+    }
+}
+
+static void testAnalogEC(void) {
+    // The default series resistance and cell constant, a small resistor that
+    // gives about the largest scale a 12-bit reading allows, and one whose
+    // scale has a fraction above one half, so it has to round up
+    const double  resistors[] = {499, 250, 330};
+    const double  constants[] = {2.88, 1.0, 1.0};
+    const uint8_t bits[]      = {10, 12};
+    for (uint8_t r = 0; r < 3; r++) {
+        for (uint8_t b = 0; b < 2; b++) {
+            uint32_t range   = (uint32_t)1 << bits[b];
+            float    ecScale = 1000000 / ((float)resistors[r] *
+                                       (float)constants[r]);
+            uint32_t scaleFixed = analogEcScaleToFixed(ecScale, range);
+            if (scaleFixed == 0) {
+                fail("analogEcScaleToFixed refused", 0, ecScale);
+                continue;
+            }
+            for (uint32_t c = 1; c < range; c++) {
+                double got =
+                    analogEcFromCounts(c, range, scaleFixed) * (1.0 / 256);
+                double ratio    = (double)(range - c) / c;
+                double expected = ratio * 1000000 /
+                    (resistors[r] * constants[r]);
+                // Half a step in the scale (plus a little for working it out
+                // in float) for each unit of the ratio, and one step from the
+                // truncating division
+                double allowed = (ratio * 0.53 + 1) / 256;
+                if (fabs(got - expected) > allowed) {
+                    fail("AnalogElecConductivity", got, expected);
+                }
+            }
+        }
+    }
+    // A scale whose product with a reading won't fit in 32 bits is refused,
+    // as is one that isn't positive
+    if (analogEcScaleToFixed(20000.0f, 1024) != 0) {
+        fail("analogEcScaleToFixed(20000, 1024)", 1, 0);
+    }
+    if (analogEcScaleToFixed(16000.0f, 1024) == 0) {
+        fail("analogEcScaleToFixed(16000, 1024)", 0, 1);
+    }
+    if (analogEcScaleToFixed(4100.0f, 4096) != 0) {
+        fail("analogEcScaleToFixed(4100, 4096)", 1, 0);
+    }
+    if (analogEcScaleToFixed(-1.0f, 1024) != 0) {
+        fail("analogEcScaleToFixed(-1, 1024)", 1, 0);
+    }
+}
+
+int main(void) {
+    testConversions();
+    testFixedMul();
+    testADS();
+    testBattery();
+    testAnalogEC();
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All fixed-point checks passed\n");
+    return 0;
+}
@@ -0,0 +1,287 @@
+/**
+ * @file flash_log_sim.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that cuts the power to a FlashLog at random points
+ * and checks that no committed line is lost or garbled.
+ *
+ * The flash is simulated the way NOR flash behaves: programming can only clear
+ * bits and an erase sets a whole sector back to 0xFF.  The power is cut after
+ * a random number of byte writes; the byte being written when it is cut only
+ * has some of its bits cleared, and a sector being erased is left partly
+ * erased.  After each cut the log is started again from what is in the flash,
+ * the way it would be when the logger restarts.
+ *
+ * Lines are written and, now and then, read back and marked as moved, the way
+ * Logger::copyFallbackToSD() does.  Half the time only the first few lines are
+ * read before they are marked, the way the logger caps the lines it copies in
+ * one cycle.  Half the time they are read into a
+ * buffer and half the time copied to a stream, the way the logger copies
+ * them to the data file.  After each read it checks:
+ * - every line read matches, character for character, a line that was written;
+ * - the lines come back in the order they were written, with none repeated;
+ * - no line is read again once it has been marked moved (a power cut while
+ * marking lines may let them be read again, but never lose them);
+ * - every line whose endRecord() returned true is read back, unless it was
+ * older than every line read because the ring filled and dropped it;
+ * - the log counted every line it dropped.
+ *
+ * It also checks that the erases are spread evenly over the sectors.  A power
+ * cut between erasing a sector and starting it means that sector is erased
+ * again after the restart; those repeats are counted apart.  The run
+ * is repeated for 20 random seeds, both with lines moved often and with lines
+ * left long enough that the ring fills.  After a power cut the log starts a
+ * new sector, so a run of cuts can fill the ring even when lines are moved
+ * often.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -DARDUINO_ARCH_AVR -I../host_arduino -I../../src -o flash_log_sim \
+ *     flash_log_sim.cpp ../../src/FlashLog.cpp ../host_arduino/host_arduino.cpp
+ * ./flash_log_sim
+ * @endcode
+ * The program prints a summary of each run and exits with 1 if any check
+ * failed.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include "FlashLog.h"
+
+#define SECTOR_SIZE 4096
+#define SECTOR_COUNT 4
+
+// Thrown when the simulated power is cut
+struct powerCut {};
+
+// A NOR flash that loses power after a set number of byte writes
+class SimFlash : public FlashDevice {
+ public:
+    std::vector<uint8_t> memory;
+    long                 writesLeft;  // -1 for no power cut
+    long                 erases[SECTOR_COUNT];
+    long                 repeats;
+    int                  lastErased;
+
+    SimFlash()
+        : memory(SECTOR_SIZE * SECTOR_COUNT, 0x37),
+          writesLeft(-1),
+          erases(),
+          repeats(0),
+          lastErased(-1) {}
+
+    bool begin(void) override {
+        return true;
+    }
+    void read(uint32_t address, uint8_t* data, uint16_t length) override {
+        for (uint16_t i = 0; i < length; i++) { data[i] = memory[address + i]; }
+    }
+    bool program(uint32_t address, const uint8_t* data,
+                 uint16_t length) override {
+        for (uint16_t i = 0; i < length; i++) {
+            if (writesLeft == 0) {
+                // Only some of the bits are cleared
+                memory[address + i] &= data[i] | (uint8_t)rand();
+                throw powerCut();
+            }
+            if (writesLeft > 0) { writesLeft--; }
+            memory[address + i] &= data[i];
+        }
+        return true;
+    }
+    bool eraseSector(uint32_t address) override {
+        if (writesLeft == 0) {
+            // Only some of the sector is erased
+            for (uint16_t i = 0; i < SECTOR_SIZE; i += 7) {
+                memory[address + i] |= (uint8_t)rand();
+            }
+            throw powerCut();
+        }
+        if (writesLeft > 0) { writesLeft--; }
+        int sector = address / SECTOR_SIZE;
+        if (sector == lastErased) {
+            repeats++;
+        } else {
+            erases[sector]++;
+        }
+        lastErased = sector;
+        for (uint16_t i = 0; i < SECTOR_SIZE; i++) {
+            memory[address + i] = 0xFF;
+        }
+        return true;
+    }
+    uint16_t getSectorSize(void) override {
+        return SECTOR_SIZE;
+    }
+    uint16_t getSectorCount(void) override {
+        return SECTOR_COUNT;
+    }
+};
+
+// The text of line number n, like a line of the data file
+static void makeLine(char* buffer, unsigned n) {
+    sprintf(buffer, "2020-01-01 00:00:%06u,%u,1.234,5.678,9.0", n, n * 7);
+}
+
+// A stand-in for the data file, for the lines copied straight to it
+class LineCatcher : public Print {
+ public:
+    std::string text;
+    size_t      write(uint8_t c) override {
+        text += static_cast<char>(c);
+        return 1;
+    }
+    using Print::write;
+};
+
+// Reads the next line either into a buffer or copied to a stream the way
+// Logger::copyFallbackToSD() does, and returns its length
+static uint16_t readLine(FlashLog& log, char* buffer, bool toStream) {
+    if (!toStream) {
+        return log.readRecord(buffer, MS_FLASH_LOG_MAX_RECORD + 1);
+    }
+    LineCatcher file;
+    uint16_t    length = log.readRecord(&file);
+    if (file.text.size() != length) { return 0; }
+    strcpy(buffer, file.text.c_str());
+    return length;
+}
+
+static uint32_t failures = 0;
+
+static void fail(const char* what, unsigned n, int round) {
+    if (failures < 20) {
+        printf("FAIL %s: line %u in round %d\n", what, n, round);
+    }
+    failures++;
+}
+
+// Runs one simulation; moveOneIn is the chance of moving the lines after
+// each line is written
+static void simulate(unsigned seed, int moveOneIn) {
+    srand(seed);
+    SimFlash flash;
+    FlashLog log(&flash);
+    log.begin();
+
+    unsigned              next    = 0;
+    unsigned              cuts    = 0;
+    unsigned              moved   = 0;
+    unsigned              dropped = 0;
+    unsigned long         counted = 0;  // Lines the log said it dropped
+    long                  movedTo = -1;  // The last line surely moved
+    std::vector<unsigned> committed;
+
+    for (int round = 0; round < 20000; round++) {
+        // Now and then, cut the power somewhere in the next few hundred
+        // writes
+        if (rand() % 50 == 0) { flash.writesLeft = rand() % 300; }
+        try {
+            if (rand() % moveOneIn != 0) {
+                // Each line gets a new number, even if the last one was cut
+                char line[MS_FLASH_LOG_MAX_RECORD + 1];
+                makeLine(line, next++);
+                if (log.beginRecord()) {
+                    log.print(line);
+                    log.print("\r\n");
+                    if (log.endRecord()) { committed.push_back(next - 1); }
+                }
+            } else {
+                char buffer[MS_FLASH_LOG_MAX_RECORD + 1];
+                char expected[MS_FLASH_LOG_MAX_RECORD + 1];
+                std::vector<unsigned> got;
+                bool                  toStream = rand() % 2 == 0;
+                // Half the time only a few lines are moved, the way the
+                // logger caps the lines it copies in one cycle
+                size_t limit = rand() % 2 == 0 ? 1 + rand() % 8 : SIZE_MAX;
+                log.rewind();
+                while (got.size() < limit &&
+                       readLine(log, buffer, toStream) > 0) {
+                    unsigned n = 0;
+                    sscanf(buffer + 17, "%u", &n);
+                    makeLine(expected, n);
+                    if (strcmp(buffer, expected) != 0) {
+                        fail("garbled", n, round);
+                    }
+                    if (!got.empty() && n <= got.back()) {
+                        fail("out of order", n, round);
+                    }
+                    if ((long)n <= movedTo) { fail("moved twice", n, round); }
+                    got.push_back(n);
+                }
+                // Lines from before the oldest one read may have been
+                // dropped when the ring filled; none after it may be missing.
+                // If the read stopped at the limit, the lines after the last
+                // one read are still waiting.
+                bool                  stopped = got.size() == limit;
+                std::vector<unsigned> waiting;
+                size_t                j = 0;
+                for (size_t k = 0; k < committed.size(); k++) {
+                    if (stopped && committed[k] > got.back()) {
+                        waiting.push_back(committed[k]);
+                        continue;
+                    }
+                    if (got.empty() || committed[k] < got.front()) {
+                        dropped++;
+                        continue;
+                    }
+                    while (j < got.size() && got[j] < committed[k]) { j++; }
+                    if (j == got.size() || got[j] != committed[k]) {
+                        fail("lost", committed[k], round);
+                    }
+                }
+                // Once read, a line is the SD card's; a power cut while
+                // marking it moved can only let it be read again
+                committed = waiting;
+                log.markRead();
+                if (!got.empty()) { movedTo = got.back(); }
+                moved += got.size();
+            }
+        } catch (powerCut&) {
+            // Restart the logger from what is in the flash
+            cuts++;
+            counted += log.getDroppedCount();
+            flash.writesLeft = -1;
+            log              = FlashLog(&flash);
+            log.begin();
+        }
+    }
+
+    long fewest = flash.erases[0];
+    long most   = flash.erases[0];
+    for (uint8_t s = 1; s < SECTOR_COUNT; s++) {
+        if (flash.erases[s] < fewest) { fewest = flash.erases[s]; }
+        if (flash.erases[s] > most) { most = flash.erases[s]; }
+    }
+    if (most - fewest > 1) { fail("uneven erases", most - fewest, 0); }
+    counted += log.getDroppedCount();
+    if (dropped > counted) {
+        fail("dropped without being counted", dropped, 0);
+    }
+
+    printf("seed %u, moving 1 in %d: %u lines, %u power cuts, %u moved, "
+           "%u dropped, erases %ld to %ld (+%ld repeated)\n",
+           seed, moveOneIn, next, cuts, moved, dropped, fewest, most,
+           flash.repeats);
+}
+
+int main(void) {
+    for (unsigned seed = 1; seed <= 20; seed++) {
+        // Moved often; the ring only fills after a run of power cuts
+        simulate(seed, 5);
+        // Left long enough that it does
+        simulate(seed, 200);
+    }
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All flash log checks passed\n");
+    return 0;
+}
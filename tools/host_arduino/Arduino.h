@@ -0,0 +1,247 @@
+/**
+ * @file Arduino.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A small stand-in for the Arduino core, so library files can be
+ * compiled into the host test programs in the tools folder.
+ *
+ * Only what those programs use is here.  Serial writes to stdout.  millis()
+ * is a virtual clock: it moves forward 1 ms each time it is read and by the
+ * full time of each delay(), so the library's waits end at once.  Programs
+ * using it are built with -DARDUINO_ARCH_AVR, so the library picks its AVR
+ * code, and link host_arduino.cpp.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_ARDUINO_ARDUINO_H_
+#define TOOLS_HOST_ARDUINO_ARDUINO_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define PSTR(s) (s)
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+
+template <typename T, typename U>
+inline T min(T a, U b) {
+    return a < b ? a : (T)b;
+}
+template <typename T, typename U>
+inline T max(T a, U b) {
+    return a > b ? a : (T)b;
+}
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+
+inline uint8_t pgm_read_byte(const void* p) {
+    return *static_cast<const uint8_t*>(p);
+}
+inline size_t strlen_P(const char* s) {
+    return strlen(s);
+}
+inline char* strcpy_P(char* d, const char* s) {
+    return strcpy(d, s);
+}
+inline char* strcat_P(char* d, const char* s) {
+    return strcat(d, s);
+}
+inline char* strncpy_P(char* d, const char* s, size_t n) {
+    return strncpy(d, s, n);
+}
+
+char* itoa(int value, char* buffer, int base);
+char* ltoa(long value, char* buffer, int base);
+char* ultoa(unsigned long value, char* buffer, int base);
+char* dtostrf(double value, signed char width, unsigned char precision,
+              char* buffer);
+
+uint32_t millis(void);
+uint32_t micros(void);
+void     delay(uint32_t ms);
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t value);
+int      digitalRead(uint8_t pin);
+
+// Every pin reads from the same register, which is always low
+extern volatile uint8_t hostPortRegister;
+#define digitalPinToBitMask(pin) ((uint8_t)1)
+#define digitalPinToPort(pin) ((uint8_t)0)
+#define portInputRegister(port) (&hostPortRegister)
+
+// The Arduino String, kept in a std::string
+class String {
+ public:
+    String(const char* s = "") : _s(s ? s : "") {}
+    String(const __FlashStringHelper* s)
+        : _s(reinterpret_cast<const char*>(s)) {}
+    explicit String(char c) : _s(1, c) {}
+    String(int n, unsigned char base = DEC) {
+        char b[34];
+        _s = ltoa(n, b, base);
+    }
+    String(unsigned int n, unsigned char base = DEC) {
+        char b[34];
+        _s = ultoa(n, b, base);
+    }
+    String(long n, unsigned char base = DEC) {
+        char b[34];
+        _s = ltoa(n, b, base);
+    }
+    String(unsigned long n, unsigned char base = DEC) {
+        char b[34];
+        _s = ultoa(n, b, base);
+    }
+    String(double n, unsigned char decimalPlaces = 2) {
+        char b[40];
+        _s = dtostrf(n, 1, decimalPlaces, b);
+    }
+
+    const char* c_str(void) const {
+        return _s.c_str();
+    }
+    unsigned int length(void) const {
+        return _s.length();
+    }
+    char operator[](unsigned int index) const {
+        return index < _s.length() ? _s[index] : 0;
+    }
+    void toCharArray(char* buffer, unsigned int size) const {
+        if (size == 0) { return; }
+        strncpy(buffer, _s.c_str(), size - 1);
+        buffer[size - 1] = '\0';
+    }
+    String& operator+=(const String& s) {
+        _s += s._s;
+        return *this;
+    }
+    bool operator==(const String& s) const {
+        return _s == s._s;
+    }
+    bool operator==(const char* s) const {
+        return _s == s;
+    }
+
+ private:
+    std::string _s;
+};
+
+inline String operator+(const String& a, const String& b) {
+    String s = a;
+    s += b;
+    return s;
+}
+
+class Print {
+ public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t         write(const char* s) {
+        return write(reinterpret_cast<const uint8_t*>(s), strlen(s));
+    }
+    size_t write(const char* buffer, size_t size) {
+        return write(reinterpret_cast<const uint8_t*>(buffer), size);
+    }
+    virtual void flush(void) {}
+
+    size_t print(const __FlashStringHelper* s);
+    size_t print(const String& s);
+    size_t print(const char s[]);
+    size_t print(char c);
+    size_t print(unsigned char n, int base = DEC);
+    size_t print(int n, int base = DEC);
+    size_t print(unsigned int n, int base = DEC);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println(void);
+    template <typename T>
+    size_t println(T value) {
+        return print(value) + println();
+    }
+    template <typename T>
+    size_t println(T value, int format) {
+        return print(value, format) + println();
+    }
+};
+
+class Stream : public Print {
+ public:
+    virtual int available(void) = 0;
+    virtual int read(void)      = 0;
+    virtual int peek(void)      = 0;
+
+    void setTimeout(unsigned long timeout) {
+        _timeout = timeout;
+    }
+    size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        return readBytes(reinterpret_cast<char*>(buffer), length);
+    }
+
+ protected:
+    unsigned long _timeout = 1000;
+};
+
+// A serial port that prints to stdout and never receives anything
+class HardwareSerial : public Stream {
+ public:
+    void begin(unsigned long) {}
+    int  available(void) override {
+        return 0;
+    }
+    int read(void) override {
+        return -1;
+    }
+    int peek(void) override {
+        return -1;
+    }
+    size_t write(uint8_t c) override {
+        return putchar(c) == EOF ? 0 : 1;
+    }
+    using Print::write;
+    operator bool() {
+        return true;
+    }
+};
+extern HardwareSerial Serial;
+
+class IPAddress {
+ public:
+    IPAddress() : _address(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : _address(((uint32_t)a << 24) | ((uint32_t)b << 16) |
+                   ((uint32_t)c << 8) | d) {}
+    uint8_t operator[](int i) const {
+        return _address >> (24 - 8 * i);
+    }
+
+ private:
+    uint32_t _address;
+};
+
+#endif  // TOOLS_HOST_ARDUINO_ARDUINO_H_
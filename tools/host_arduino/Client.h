@@ -0,0 +1,32 @@
+/**
+ * @file Client.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief The Arduino Client interface, for the host test programs.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_ARDUINO_CLIENT_H_
+#define TOOLS_HOST_ARDUINO_CLIENT_H_
+
+#include "Arduino.h"
+
+class Client : public Stream {
+ public:
+    virtual int     connect(IPAddress ip, uint16_t port)        = 0;
+    virtual int     connect(const char* host, uint16_t port)    = 0;
+    virtual size_t  write(uint8_t c)                            = 0;
+    virtual size_t  write(const uint8_t* buffer, size_t size)   = 0;
+    virtual int     available(void)                             = 0;
+    virtual int     read(void)                                  = 0;
+    virtual int     read(uint8_t* buffer, size_t size)          = 0;
+    virtual int     peek(void)                                  = 0;
+    virtual void    flush(void)                                 = 0;
+    virtual void    stop(void)                                  = 0;
+    virtual uint8_t connected(void)                             = 0;
+    virtual         operator bool()                             = 0;
+    using Print::write;
+};
+
+#endif  // TOOLS_HOST_ARDUINO_CLIENT_H_
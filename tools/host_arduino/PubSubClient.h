@@ -0,0 +1,37 @@
+/**
+ * @file PubSubClient.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief An MQTT client that never connects, for the host test programs.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_ARDUINO_PUBSUBCLIENT_H_
+#define TOOLS_HOST_ARDUINO_PUBSUBCLIENT_H_
+
+#include "Client.h"
+
+#define MQTT_DISCONNECTED -1
+
+class PubSubClient {
+ public:
+    PubSubClient& setClient(Client&) {
+        return *this;
+    }
+    PubSubClient& setServer(const char*, uint16_t) {
+        return *this;
+    }
+    bool connect(const char*, const char*, const char*) {
+        return false;
+    }
+    bool publish(const char*, const char*) {
+        return false;
+    }
+    void disconnect(void) {}
+    int  state(void) {
+        return MQTT_DISCONNECTED;
+    }
+};
+
+#endif  // TOOLS_HOST_ARDUINO_PUBSUBCLIENT_H_
@@ -0,0 +1,36 @@
+/**
+ * @file SdFat.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Just enough of SdFat to declare a Logger, for the host test
+ * programs.  Nothing here reads or writes a card.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_ARDUINO_SDFAT_H_
+#define TOOLS_HOST_ARDUINO_SDFAT_H_
+
+#include "Arduino.h"
+
+class File : public Stream {
+ public:
+    int available(void) override {
+        return 0;
+    }
+    int read(void) override {
+        return -1;
+    }
+    int peek(void) override {
+        return -1;
+    }
+    size_t write(uint8_t) override {
+        return 1;
+    }
+    using Print::write;
+};
+typedef File SdFile;
+
+class SdFat {};
+
+#endif  // TOOLS_HOST_ARDUINO_SDFAT_H_
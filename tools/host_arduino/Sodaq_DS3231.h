@@ -0,0 +1,18 @@
+/**
+ * @file Sodaq_DS3231.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief Just enough of Sodaq_DS3231 to declare a Logger, for the host test
+ * programs.
+ */
+
+// Header Guards
+#ifndef TOOLS_HOST_ARDUINO_SODAQ_DS3231_H_
+#define TOOLS_HOST_ARDUINO_SODAQ_DS3231_H_
+
+#include "Arduino.h"
+
+class DateTime;
+
+#endif  // TOOLS_HOST_ARDUINO_SODAQ_DS3231_H_
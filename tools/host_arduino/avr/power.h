@@ -0,0 +1,7 @@
+/**
+ * @file power.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief An empty stand-in for avr/power.h, for the host test programs.
+ */
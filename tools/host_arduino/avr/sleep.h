@@ -0,0 +1,7 @@
+/**
+ * @file sleep.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief An empty stand-in for avr/sleep.h, for the host test programs.
+ */
@@ -0,0 +1,115 @@
+/**
+ * @file host_arduino.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief The functions of the stand-in Arduino core in Arduino.h.
+ */
+
+#include "Arduino.h"
+
+HardwareSerial Serial;
+
+// The virtual clock
+static uint32_t hostMillis = 0;
+
+uint32_t millis(void) {
+    return hostMillis++;
+}
+uint32_t micros(void) {
+    return hostMillis * 1000;
+}
+void delay(uint32_t ms) {
+    hostMillis += ms;
+}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int  digitalRead(uint8_t) {
+    return LOW;
+}
+volatile uint8_t hostPortRegister = 0;
+
+
+char* ultoa(unsigned long value, char* buffer, int base) {
+    char  digits[34];
+    char* p = digits;
+    do {
+        int d  = value % base;
+        *p++   = d < 10 ? '0' + d : 'A' + d - 10;
+        value /= base;
+    } while (value > 0);
+    char* out = buffer;
+    while (p > digits) { *out++ = *--p; }
+    *out = '\0';
+    return buffer;
+}
+char* ltoa(long value, char* buffer, int base) {
+    if (value < 0 && base == 10) {
+        buffer[0] = '-';
+        ultoa(-(unsigned long)value, buffer + 1, base);
+        return buffer;
+    }
+    return ultoa((unsigned long)value, buffer, base);
+}
+char* itoa(int value, char* buffer, int base) {
+    return ltoa(value, buffer, base);
+}
+char* dtostrf(double value, signed char width, unsigned char precision,
+              char* buffer) {
+    sprintf(buffer, "%*.*f", width, precision, value);
+    return buffer;
+}
+
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) { n += write(*buffer++); }
+    return n;
+}
+size_t Print::print(const __FlashStringHelper* s) {
+    return write(reinterpret_cast<const char*>(s));
+}
+size_t Print::print(const String& s) {
+    return write(s.c_str());
+}
+size_t Print::print(const char s[]) {
+    return write(s);
+}
+size_t Print::print(char c) {
+    return write((uint8_t)c);
+}
+size_t Print::print(unsigned char n, int base) {
+    return print((unsigned long)n, base);
+}
+size_t Print::print(int n, int base) {
+    return print((long)n, base);
+}
+size_t Print::print(unsigned int n, int base) {
+    return print((unsigned long)n, base);
+}
+size_t Print::print(long n, int base) {
+    char b[34];
+    return write(ltoa(n, b, base));
+}
+size_t Print::print(unsigned long n, int base) {
+    char b[34];
+    return write(ultoa(n, b, base));
+}
+size_t Print::print(double n, int digits) {
+    char b[40];
+    return write(dtostrf(n, 1, digits, b));
+}
+size_t Print::println(void) {
+    return write("\r\n");
+}
+
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t   count = 0;
+    uint32_t start = millis();
+    while (count < length && millis() - start < _timeout) {
+        int c = read();
+        if (c >= 0) { buffer[count++] = (char)c; }
+    }
+    return count;
+}
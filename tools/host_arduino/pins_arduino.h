@@ -0,0 +1,8 @@
+/**
+ * @file pins_arduino.h
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief An empty stand-in for the board pin definitions, for the host test
+ * programs.
+ */
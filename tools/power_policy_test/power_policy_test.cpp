@@ -0,0 +1,124 @@
+/**
+ * @file power_policy_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that checks the battery power tier selection in
+ * PowerPolicy.h.
+ *
+ * It checks:
+ * - the tier on either side of each threshold, falling and rising;
+ * - that a rise only moves back up a tier once it clears the hysteresis;
+ * - that a fall or rise across several thresholds moves straight to the
+ * right tier;
+ * - that bad readings leave the tier alone;
+ * - that a simulated discharge, with the battery sagging under load and
+ * recovering at rest on every reading, only ever moves down the tiers.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o power_policy_test power_policy_test.cpp
+ * ./power_policy_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "PowerPolicy.h"
+
+static uint32_t failures = 0;
+
+static void check(const char* what, float volts, powerTier got,
+                  powerTier expected) {
+    if (got == expected) { return; }
+    if (failures < 20) {
+        printf("FAIL %s at %.3f V: got tier %d, expected tier %d\n", what,
+               volts, got, expected);
+    }
+    failures++;
+}
+
+static const powerTierThresholds thresholds = {
+    MS_POWER_SD_ONLY_V, MS_POWER_REDUCED_V, MS_POWER_CRITICAL_V,
+    MS_POWER_HYSTERESIS_V};
+
+static void testThresholds(void) {
+    const float below[] = {MS_POWER_SD_ONLY_V, MS_POWER_REDUCED_V,
+                           MS_POWER_CRITICAL_V};
+    for (uint8_t i = 0; i < 3; i++) {
+        powerTier upper = (powerTier)i;
+        powerTier lower = (powerTier)(i + 1);
+        // Falling: the threshold itself is still the upper tier
+        check("at threshold", below[i],
+              selectPowerTier(upper, below[i], &thresholds), upper);
+        check("just below", below[i] - 0.001f,
+              selectPowerTier(upper, below[i] - 0.001f, &thresholds), lower);
+        // Rising: nothing changes until the hysteresis is cleared
+        float v = below[i] + MS_POWER_HYSTERESIS_V - 0.005f;
+        check("inside hysteresis", v, selectPowerTier(lower, v, &thresholds),
+              lower);
+        v = below[i] + MS_POWER_HYSTERESIS_V + 0.005f;
+        check("past hysteresis", v, selectPowerTier(lower, v, &thresholds),
+              upper);
+    }
+
+    // A large fall or rise moves more than one tier at once
+    check("full to critical", 3.0f,
+          selectPowerTier(POWER_TIER_FULL, 3.0f, &thresholds),
+          POWER_TIER_CRITICAL);
+    check("critical to full", 4.1f,
+          selectPowerTier(POWER_TIER_CRITICAL, 4.1f, &thresholds),
+          POWER_TIER_FULL);
+    // A rise that only clears the hysteresis of the lower thresholds stops
+    // below the higher ones
+    float v = MS_POWER_REDUCED_V + MS_POWER_HYSTERESIS_V + 0.005f;
+    check("critical to sd only", v,
+          selectPowerTier(POWER_TIER_CRITICAL, v, &thresholds),
+          v - MS_POWER_HYSTERESIS_V < MS_POWER_SD_ONLY_V ? POWER_TIER_SD_ONLY
+                                                          : POWER_TIER_FULL);
+
+    // Bad readings change nothing
+    for (uint8_t t = POWER_TIER_FULL; t <= POWER_TIER_CRITICAL; t++) {
+        check("-9999", -9999, selectPowerTier((powerTier)t, -9999, &thresholds),
+              (powerTier)t);
+        check("0 V", 0, selectPowerTier((powerTier)t, 0, &thresholds),
+              (powerTier)t);
+    }
+}
+
+static void testDischarge(void) {
+    // A battery falling 1 mV a reading, read alternately under load (down to
+    // 80 mV low) and at rest.  The sag is inside the hysteresis, so the tier
+    // must never move back up.
+    powerTier tier     = POWER_TIER_FULL;
+    uint8_t   changes  = 0;
+    powerTier previous = tier;
+    for (uint16_t n = 0; n < 1400; n++) {
+        float rest = 4.2f - n * 0.001f;
+        float v    = (n % 2 == 0) ? rest - 0.08f : rest;
+        tier       = selectPowerTier(tier, v, &thresholds);
+        if (tier < previous) {
+            check("recovered during discharge", v, tier, previous);
+        }
+        if (tier != previous) { changes++; }
+        previous = tier;
+    }
+    check("end of discharge", 2.8f, tier, POWER_TIER_CRITICAL);
+    if (changes != 3) {
+        printf("FAIL discharge changed tier %u times, expected 3\n", changes);
+        failures++;
+    }
+}
+
+int main(void) {
+    testThresholds();
+    testDischarge();
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All power policy checks passed\n");
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file power_schedule_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that checks the sensor power planning arithmetic in
+ * PowerSchedule.h.
+ *
+ * It runs a set of sensors sharing two power rails through an update in
+ * virtual time, one millisecond at a time, and checks:
+ * - that every sensor planned with powerScheduleLatestStart() gets its last
+ * result exactly when the slowest sensor does, and never before its rail has
+ * warmed it up;
+ * - that the charge powerScheduleChargeSaved() estimates matches the charge
+ * added up from the simulated currents.
+ *
+ * It also checks powerScheduleInrushLoad() at the edges of the settling time
+ * and with rails that are not yet scheduled or have no inrush.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o power_schedule_test power_schedule_test.cpp
+ * ./power_schedule_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "PowerSchedule.h"
+
+static uint32_t failures = 0;
+
+static void check(const char* what, double got, double expected,
+                  double allowed) {
+    if (fabs(got - expected) <= allowed) { return; }
+    if (failures < 20) {
+        printf("FAIL %s: got %.6f, expected %.6f\n", what, got, expected);
+    }
+    failures++;
+}
+
+// A simulated sensor
+struct testSensor {
+    const char* name;
+    uint8_t     rail;
+    uint32_t    warmUp_ms;
+    uint32_t    stabilization_ms;
+    uint32_t    measurement_ms;
+    uint8_t     nMeasurements;
+    float       active_mA;
+    float       idle_mA;
+};
+
+static const testSensor sensors[] = {
+    {"slow turbidity", 0, 500, 20000, 1000, 10, 40, 5},
+    {"CTD", 0, 500, 500, 1000, 5, 10, 2},
+    {"pressure", 1, 100, 0, 300, 1, 1.5, 0.5},
+    {"temperature", 1, 275, 0, 750, 5, 1, 0.1},
+};
+#define N_SENSORS (sizeof(sensors) / sizeof(sensors[0]))
+#define N_RAILS 2
+
+static void testPlan(void) {
+    // Plan the update the way VariableArray::completeUpdate() does
+    uint32_t active[N_SENSORS];
+    uint32_t railOn[N_RAILS] = {0, 0};
+    uint32_t cycle           = 0;
+    for (uint8_t i = 0; i < N_SENSORS; i++) {
+        active[i] = powerScheduleActiveTime(sensors[i].stabilization_ms,
+                                            sensors[i].measurement_ms,
+                                            sensors[i].nMeasurements);
+        uint32_t onTime = sensors[i].warmUp_ms + active[i];
+        if (onTime > railOn[sensors[i].rail]) {
+            railOn[sensors[i].rail] = onTime;
+        }
+        if (onTime > cycle) { cycle = onTime; }
+    }
+    uint32_t railStart[N_RAILS];
+    for (uint8_t r = 0; r < N_RAILS; r++) {
+        railStart[r] = powerScheduleLatestStart(cycle, railOn[r]);
+    }
+    uint32_t wake[N_SENSORS];
+    double   estimated_mAh = 0;
+    for (uint8_t i = 0; i < N_SENSORS; i++) {
+        wake[i] = powerScheduleLatestStart(cycle, active[i]);
+        bool warm = wake[i] >=
+            railStart[sensors[i].rail] + sensors[i].warmUp_ms;
+        check("woken once warm", warm, 1, 0);
+        check("finishes with the slowest", wake[i] + active[i], cycle, 0);
+        estimated_mAh += powerScheduleChargeSaved(
+            railStart[sensors[i].rail], wake[i] - sensors[i].warmUp_ms,
+            sensors[i].active_mA, sensors[i].idle_mA);
+    }
+
+    // Run the update both ways in virtual time.  Before, every rail was
+    // switched on at the start and every sensor woken once warm; each stays
+    // awake to the end of the update.
+    double before_mAms = 0;
+    double after_mAms  = 0;
+    for (uint32_t t = 0; t < cycle; t++) {
+        for (uint8_t i = 0; i < N_SENSORS; i++) {
+            const testSensor& s = sensors[i];
+            before_mAms += t >= s.warmUp_ms ? s.active_mA : s.idle_mA;
+            if (t >= wake[i]) {
+                after_mAms += s.active_mA;
+            } else if (t >= railStart[s.rail]) {
+                after_mAms += s.idle_mA;
+            }
+        }
+    }
+    double simulated_mAh = (before_mAms - after_mAms) / 3600000.0;
+    check("charge saved", estimated_mAh, simulated_mAh, 1e-6);
+    printf("Update of %lu ms saves %.5f mAh\n", (unsigned long)cycle,
+           simulated_mAh);
+
+    // A step longer than the update starts right away
+    check("longer than the update", powerScheduleLatestStart(1000, 5000), 0,
+          0);
+}
+
+static void testInrush(void) {
+    const uint32_t starts[]    = {1000, 1100, 2000, 5000};
+    const uint8_t  inrush[]    = {2, 3, 0, 4};
+    const bool     scheduled[] = {true, true, true, false};
+    uint32_t       first;
+    uint32_t       settled;
+
+    // 1050 overlaps the rails switched on at 1000 and 1100
+    check("overlapping load",
+          powerScheduleInrushLoad(1050, 4, starts, inrush, scheduled, 100,
+                                  &first, &settled),
+          5, 0);
+    check("first start", first, 1000, 0);
+    check("last settled", settled, 1200, 0);
+
+    // Exactly one settling time after a rail it no longer overlaps
+    check("after settling",
+          powerScheduleInrushLoad(1200, 4, starts, inrush, scheduled, 100,
+                                  &first, &settled),
+          0, 0);
+    check("no overlap first", first, 1200, 0);
+    check("no overlap settled", settled, 1200, 0);
+    // Nor exactly one settling time before
+    check("before settling",
+          powerScheduleInrushLoad(900, 4, starts, inrush, scheduled, 100,
+                                  &first, &settled),
+          0, 0);
+    check("just inside",
+          powerScheduleInrushLoad(901, 4, starts, inrush, scheduled, 100,
+                                  &first, &settled),
+          2, 0);
+
+    // Rails without inrush or without a start yet are ignored
+    check("no inrush",
+          powerScheduleInrushLoad(2000, 4, starts, inrush, scheduled, 100,
+                                  &first, &settled),
+          0, 0);
+    check("unscheduled",
+          powerScheduleInrushLoad(5000, 4, starts, inrush, scheduled, 100,
+                                  &first, &settled),
+          0, 0);
+
+    // Moving a start to one settling time before the first overlapping rail
+    // clears the overlap
+    powerScheduleInrushLoad(1050, 4, starts, inrush, scheduled, 100, &first,
+                            &settled);
+    check("moved earlier",
+          powerScheduleInrushLoad(first - 100, 4, starts, inrush, scheduled,
+                                  100, &first, &settled),
+          0, 0);
+}
+
+int main(void) {
+    testPlan();
+    testInrush();
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All power schedule checks passed\n");
+    return 0;
+}
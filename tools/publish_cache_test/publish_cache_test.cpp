@@ -0,0 +1,336 @@
+/**
+ * @file publish_cache_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that checks the cache of records a logger keeps for
+ * publishers that only send every few logging intervals.
+ *
+ * The real dataPublisher is used, so its send cursor, isSendDue(), and
+ * checkSendFrequency() are the library's.  The logger is a stand-in that keeps
+ * its records in a ring with the arithmetic in PublishCache.h, the way
+ * Logger::cacheRecord() and Logger::replayCachedRecord() do, so its functions
+ * used by the publisher are defined here instead of linking LoggerBase.cpp.
+ * Each record's marked time is its record number, so the publisher can tell
+ * which record it was given.
+ *
+ * It checks:
+ * - the number of records that fit for every variable count, including none
+ * and more variables than values;
+ * - the slot of every record for ring sizes 1 to 8, across many wraparounds;
+ * - the oldest record kept and the first record a publisher still has to send;
+ * - for several variable counts, every send frequency from 1 to 8, and every
+ * offset, over 300 logging intervals: each record is sent once and in order,
+ * none is sent twice, and a record is only skipped if it was replaced before
+ * the publisher could send it;
+ * - that no records are skipped when sendEveryX fits in the cache and nothing
+ * fails, that exactly the expected records are lost when it doesn't, and
+ * that checkSendFrequency() prints its warning exactly when it doesn't;
+ * - the same with one record in three refused, so the send stops there and
+ * that record and the ones after it carry over to the next send.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -DARDUINO_ARCH_AVR -I../host_arduino -I../../src \
+ *     -o publish_cache_test publish_cache_test.cpp \
+ *     ../../src/dataPublisherBase.cpp ../../src/TaskWatch.cpp \
+ *     ../host_arduino/host_arduino.cpp
+ * ./publish_cache_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "dataPublisherBase.h"
+
+static uint32_t failures = 0;
+
+static void check(const std::string& what, bool ok) {
+    if (ok) { return; }
+    if (failures < 20) { printf("FAIL %s\n", what.c_str()); }
+    failures++;
+}
+
+static std::string describe(const char* what, uint8_t nVars, uint8_t every,
+                            uint8_t offset, bool failing) {
+    char buffer[96];
+    snprintf(buffer, sizeof(buffer),
+             "%s (%u variables, every %u, offset %u%s)", what, nVars, every,
+             offset, failing ? ", failing" : "");
+    return buffer;
+}
+
+// Runs checkSendFrequency() with the serial port, which is stdout, going to a
+// file instead, and returns what was printed
+static std::string checkQuietly(dataPublisher& publisher, bool* result) {
+    fflush(stdout);
+    FILE* file  = tmpfile();
+    int   saved = dup(fileno(stdout));
+    dup2(fileno(file), fileno(stdout));
+    *result = publisher.checkSendFrequency();
+    fflush(stdout);
+    dup2(saved, fileno(stdout));
+    close(saved);
+
+    std::string printed;
+    rewind(file);
+    for (int c = fgetc(file); c != EOF; c = fgetc(file)) { printed += c; }
+    fclose(file);
+    return printed;
+}
+
+// ============================================================================
+//  The stand-in logger
+// ============================================================================
+
+// The logging interval, in minutes
+#define INTERVAL 5
+
+static uint8_t  varCount    = 10;
+static uint32_t recordCount = 0;
+static uint32_t liveEpoch   = 0;
+// The marked time of the record in each slot; the record number
+static uint32_t slotEpoch[MS_PUBLISH_CACHE_RECORDS];
+
+uint32_t Logger::markedEpochTime = 0;
+
+Logger::Logger() {
+    _loggingIntervalMinutes = INTERVAL;
+    _internalArray          = NULL;
+}
+Logger::~Logger() {}
+void Logger::printFileHeader(Stream*) {}
+void Logger::testingMode() {}
+void Logger::streamingMode(streamFormat, uint16_t, uint32_t) {}
+void Logger::begin(const char*, uint16_t, VariableArray*) {}
+// Only the array's presence matters; the stand-in counts the variables itself
+void Logger::begin(VariableArray* inputArray) {
+    _internalArray = inputArray;
+}
+void Logger::begin() {}
+void Logger::logData(void) {}
+void Logger::registerDataPublisher(dataPublisher*) {}
+uint8_t Logger::getArrayVarCount() {
+    return varCount;
+}
+uint8_t Logger::getCacheCapacity(void) {
+    return publishCacheCapacity(varCount, MS_PUBLISH_CACHE_RECORDS,
+                                MS_PUBLISH_CACHE_VALUES);
+}
+void Logger::cacheRecord(void) {
+    uint8_t capacity = getCacheCapacity();
+    if (capacity == 0) { return; }
+    slotEpoch[publishCacheSlot(recordCount + 1, capacity)] =
+        Logger::markedEpochTime;
+    recordCount++;
+}
+uint32_t Logger::getOldestCachedRecord(void) {
+    return publishCacheOldest(recordCount, getCacheCapacity());
+}
+uint32_t Logger::getNewestCachedRecord(void) {
+    return getCacheCapacity() == 0 ? 0 : recordCount;
+}
+bool Logger::replayCachedRecord(uint32_t recordNumber) {
+    if (recordNumber == 0 || recordNumber < getOldestCachedRecord() ||
+        recordNumber > getNewestCachedRecord()) {
+        return false;
+    }
+    Logger::markedEpochTime =
+        slotEpoch[publishCacheSlot(recordNumber, getCacheCapacity())];
+    return true;
+}
+void Logger::endReplay(void) {
+    Logger::markedEpochTime = liveEpoch;
+}
+
+extendedWatchDogAVR::extendedWatchDogAVR() {}
+extendedWatchDogAVR::~extendedWatchDogAVR() {}
+
+// ============================================================================
+//  The stand-in publisher
+// ============================================================================
+
+// Keeps the record number of each record it is given, and refuses every
+// third record it is given when failing
+class StandInPublisher : public dataPublisher {
+ public:
+    std::vector<uint32_t> taken;
+    bool                  failing  = false;
+    bool                  refused  = false;
+    uint32_t              attempts = 0;
+
+    String getEndpoint(void) override {
+        return String("stand-in");
+    }
+    int16_t publishData(Client*) override {
+        return publishData();
+    }
+    int16_t publishData(void) override {
+        uint32_t record = Logger::markedEpochTime / (60UL * INTERVAL);
+        if (failing && ++attempts % 3 == 0) {
+            refused = true;
+            return 504;
+        }
+        taken.push_back(record);
+        return 201;
+    }
+    int16_t publishCachedData(void) override {
+        refused = false;
+        return dataPublisher::publishCachedData();
+    }
+};
+
+// ============================================================================
+//  The checks
+// ============================================================================
+
+static void testArithmetic(void) {
+    check("no variables", publishCacheCapacity(0, 4, 64) == 0);
+    for (uint16_t n = 1; n <= 255; n++) {
+        uint16_t expected = 64 / n < 4 ? 64 / n : 4;
+        check("capacity", publishCacheCapacity(n, 4, 64) == expected);
+    }
+    check("more variables than values", publishCacheCapacity(65, 4, 64) == 0);
+    check("large cache", publishCacheCapacity(3, 200, 1000) == 200);
+
+    for (uint8_t capacity = 1; capacity <= 8; capacity++) {
+        // Records 1 to capacity fill the slots in order, then wrap around
+        for (uint32_t n = 1; n <= 1000; n++) {
+            check("slot", publishCacheSlot(n, capacity) == (n - 1) % capacity);
+        }
+        check("slot past 2^16", publishCacheSlot(70000, capacity) ==
+                                    69999 % capacity);
+        check("oldest when empty", publishCacheOldest(0, capacity) == 0);
+        for (uint32_t count = 1; count <= 50; count++) {
+            uint32_t expected = count > capacity ? count - capacity + 1 : 1;
+            check("oldest", publishCacheOldest(count, capacity) == expected);
+        }
+    }
+    check("oldest with no room", publishCacheOldest(5, 0) == 0);
+
+    // A publisher starts after the last record it sent, unless that record
+    // has been replaced
+    check("first send", publishCacheFirstToSend(1, 0) == 1);
+    check("after the last sent", publishCacheFirstToSend(3, 5) == 6);
+    check("just kept", publishCacheFirstToSend(6, 5) == 6);
+    check("replaced", publishCacheFirstToSend(9, 5) == 9);
+}
+
+static void simulate(uint8_t nVars, uint8_t every, uint8_t offset,
+                     bool failing) {
+    varCount    = nVars;
+    recordCount = 0;
+    Logger           logger;
+    VariableArray*   array = NULL;
+    StandInPublisher publisher;
+    publisher.failing = failing;
+    publisher.attachToLogger(logger);
+    publisher.setSendFrequency(every, offset);
+
+    uint8_t capacity = publishCacheCapacity(nVars, MS_PUBLISH_CACHE_RECORDS,
+                                            MS_PUBLISH_CACHE_VALUES);
+    // Without variables set the logger can't be checked yet
+    check(describe("no warning before the variables", nVars, every, offset,
+                   failing),
+          publisher.checkSendFrequency());
+    // Any non-NULL array will do
+    logger.begin(reinterpret_cast<VariableArray*>(&array));
+    bool fits = every <= 1 || every <= capacity;
+    bool        result;
+    std::string printed = checkQuietly(publisher, &result);
+    check(describe("checkSendFrequency", nVars, every, offset, failing),
+          result == fits);
+    check(describe("warning printed", nVars, every, offset, failing),
+          (printed.find("WARNING!") != std::string::npos) == !fits);
+
+    uint32_t lastTaken = 0;
+    uint32_t lost      = 0;
+    uint32_t lostTo    = 0;  // The newest record counted as lost
+    uint32_t firstSend = 0;
+    uint32_t sendCount = 0;
+    for (uint32_t interval = 1; interval <= 300; interval++) {
+        liveEpoch = Logger::markedEpochTime = interval * 60UL * INTERVAL;
+        logger.cacheRecord();
+        if (!publisher.isSendDue()) { continue; }
+        if (firstSend == 0) { firstSend = interval; }
+        sendCount++;
+
+        // Anything after the last record taken that is no longer kept is lost
+        uint32_t oldest = logger.getOldestCachedRecord();
+        uint32_t done   = lastTaken > lostTo ? lastTaken : lostTo;
+        if (capacity > 0 && oldest > done + 1) {
+            lost += oldest - done - 1;
+            lostTo = oldest - 1;
+        }
+        size_t before = publisher.taken.size();
+        publisher.publishCachedData();
+        check(describe("live time put back", nVars, every, offset, failing),
+              Logger::markedEpochTime == liveEpoch);
+
+        bool refused = publisher.refused;
+        if (capacity == 0) {
+            // With no cache, only the live values can be sent
+            check(describe("live values", nVars, every, offset, failing),
+                  refused || publisher.taken.back() == interval);
+            continue;
+        }
+        // What was taken follows straight on from what was taken before
+        for (size_t i = before; i < publisher.taken.size(); i++) {
+            uint32_t expected = i == before
+                ? publishCacheFirstToSend(oldest, lastTaken)
+                : lastTaken + 1;
+            check(describe("in order, once", nVars, every, offset, failing),
+                  publisher.taken[i] == expected);
+            lastTaken = publisher.taken[i];
+        }
+        // Unless it was refused, everything up to now was taken
+        check(describe("all sent", nVars, every, offset, failing),
+              refused || lastTaken == interval);
+    }
+
+    uint32_t pending = recordCount - (lastTaken > lostTo ? lastTaken : lostTo);
+    check(describe("every record accounted for", nVars, every, offset,
+                   failing),
+          capacity == 0 ||
+              publisher.taken.size() + lost + pending == recordCount);
+    if (capacity > 0 && fits && !failing) {
+        check(describe("nothing lost", nVars, every, offset, failing),
+              lost == 0);
+    }
+    if (capacity > 0 && !fits && !failing) {
+        // The first send loses what didn't fit of the records before it,
+        // and each send after it loses what didn't fit of a whole round
+        uint32_t expected = firstSend > capacity ? firstSend - capacity : 0;
+        expected += (sendCount - 1) * (every - capacity);
+        check(describe("lost what didn't fit", nVars, every, offset, failing),
+              lost == expected);
+    }
+}
+
+int main(void) {
+    testArithmetic();
+    // 4, 16, and 64 variables fill the cache exactly; 20 and 40 don't; 65
+    // leaves no room at all
+    const uint8_t varCounts[] = {4, 16, 20, 40, 64, 65};
+    for (uint8_t v = 0; v < sizeof(varCounts); v++) {
+        for (uint8_t every = 1; every <= 8; every++) {
+            for (uint8_t offset = 0; offset < every; offset++) {
+                simulate(varCounts[v], every, offset, false);
+                simulate(varCounts[v], every, offset, true);
+            }
+        }
+    }
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All publish cache checks passed\n");
+    return 0;
+}
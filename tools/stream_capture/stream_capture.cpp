@@ -0,0 +1,246 @@
+/**
+ * @file stream_capture.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program for Linux that reads the records sent by
+ * Logger::streamingMode() and shows live statistics for each variable.
+ *
+ * Both the CSV and the binary formats are understood.  Binary frames are
+ * decoded with the same StreamFrame.h used by the logger; frames with a bad
+ * CRC are counted and dropped, and gaps in the sequence numbers are counted as
+ * lost records.  Any other text, such as the logger's own messages, is passed
+ * through to stderr.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o stream_capture stream_capture.cpp
+ * ./stream_capture /dev/ttyUSB0 115200
+ * @endcode
+ * Use "-" in place of the port to read a saved capture from stdin.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "StreamFrame.h"
+
+// The running statistics for one variable, using Welford's method
+struct columnStats {
+    char     name[32];
+    uint32_t n;
+    double   mean;
+    double   m2;
+    float    min;
+    float    max;
+};
+
+static columnStats columns[STREAM_MAX_VALUES];
+static uint8_t     nColumns     = 0;
+static uint32_t    nRecords     = 0;
+static uint32_t    nLost        = 0;
+static uint32_t    lastSequence = 0;
+static bool        haveSequence = false;
+
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+static void resetStats(void) {
+    for (uint8_t i = 0; i < STREAM_MAX_VALUES; i++) {
+        columns[i].n    = 0;
+        columns[i].mean = 0;
+        columns[i].m2   = 0;
+        columns[i].min  = 0;
+        columns[i].max  = 0;
+    }
+    nRecords     = 0;
+    nLost        = 0;
+    haveSequence = false;
+}
+
+
+// Take the column names from the header line the logger sends first
+static void readHeader(char* line) {
+    resetStats();
+    nColumns   = 0;
+    char* name = strtok(line, ",");
+    // Skip the sequence and time columns
+    for (uint8_t skip = 0; name != NULL && skip < 2; skip++) {
+        name = strtok(NULL, ",");
+    }
+    while (name != NULL && nColumns < STREAM_MAX_VALUES) {
+        snprintf(columns[nColumns].name, sizeof(columns[nColumns].name), "%s",
+                 name);
+        nColumns++;
+        name = strtok(NULL, ",");
+    }
+}
+
+
+static void addRecord(uint16_t sequence, const float values[], uint8_t count) {
+    if (haveSequence) {
+        nLost += (uint16_t)(sequence - lastSequence - 1);
+    }
+    lastSequence = sequence;
+    haveSequence = true;
+    nRecords++;
+
+    for (uint8_t i = 0; i < count && i < STREAM_MAX_VALUES; i++) {
+        float        v = values[i];
+        columnStats* c = &columns[i];
+        if (v == -9999 || isnan(v)) { continue; }
+        if (c->n == 0 || v < c->min) { c->min = v; }
+        if (c->n == 0 || v > c->max) { c->max = v; }
+        c->n++;
+        double delta = v - c->mean;
+        c->mean += delta / c->n;
+        c->m2 += delta * (v - c->mean);
+    }
+    if (count > nColumns) {
+        for (uint8_t i = nColumns; i < count && i < STREAM_MAX_VALUES; i++) {
+            snprintf(columns[i].name, sizeof(columns[i].name), "value%u", i);
+        }
+        nColumns = count < STREAM_MAX_VALUES ? count : STREAM_MAX_VALUES;
+    }
+}
+
+
+// Handle a line of text: the header, a CSV record, or anything else
+static void readLine(char* line) {
+    if (strncmp(line, "sequence,millis", 15) == 0) {
+        readHeader(line);
+        return;
+    }
+    if (line[0] >= '0' && line[0] <= '9' && strchr(line, ',') != NULL) {
+        float    values[STREAM_MAX_VALUES];
+        uint8_t  count    = 0;
+        char*    field    = strtok(line, ",");
+        uint16_t sequence = (uint16_t)strtoul(field, NULL, 10);
+        field             = strtok(NULL, ",");  // the time
+        while ((field = strtok(NULL, ",")) != NULL &&
+               count < STREAM_MAX_VALUES) {
+            values[count++] = strtof(field, NULL);
+        }
+        addRecord(sequence, values, count);
+        return;
+    }
+    fprintf(stderr, "%s\n", line);
+}
+
+
+static void printStats(double elapsed_s, uint32_t badFrames) {
+    printf("\n%u records in %.1f s (%.1f/s), %u lost, %u bad frames\n",
+           nRecords, elapsed_s, elapsed_s > 0 ? nRecords / elapsed_s : 0.0,
+           nLost, badFrames);
+    printf("%-24s %8s %14s %14s %14s %14s\n", "variable", "n", "mean",
+           "std dev", "min", "max");
+    for (uint8_t i = 0; i < nColumns; i++) {
+        const columnStats* c  = &columns[i];
+        double             sd = c->n > 1 ? sqrt(c->m2 / (c->n - 1)) : 0;
+        printf("%-24s %8u %14.6g %14.6g %14.6g %14.6g\n", c->name, c->n,
+               c->mean, sd, c->min, c->max);
+    }
+    fflush(stdout);
+}
+
+
+static speed_t baudConstant(long baud) {
+    switch (baud) {
+        case 9600: return B9600;
+        case 19200: return B19200;
+        case 38400: return B38400;
+        case 57600: return B57600;
+        case 115200: return B115200;
+        case 230400: return B230400;
+        case 460800: return B460800;
+        case 921600: return B921600;
+        default: return 0;
+    }
+}
+
+
+static int openPort(const char* path, long baud) {
+    if (strcmp(path, "-") == 0) { return STDIN_FILENO; }
+    int fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+        fprintf(stderr, "Could not open %s: %s\n", path, strerror(errno));
+        return -1;
+    }
+    speed_t        speed = baudConstant(baud);
+    struct termios tty;
+    if (speed == 0 || tcgetattr(fd, &tty) != 0) {
+        fprintf(stderr, "Could not set %s to %ld baud\n", path, baud);
+        close(fd);
+        return -1;
+    }
+    cfmakeraw(&tty);
+    cfsetispeed(&tty, speed);
+    cfsetospeed(&tty, speed);
+    tty.c_cc[VMIN]  = 1;
+    tty.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tty);
+    return fd;
+}
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <serial port | -> [baud]\n", argv[0]);
+        return 1;
+    }
+    long baud = argc > 2 ? strtol(argv[2], NULL, 10) : 115200;
+    int  fd   = openPort(argv[1], baud);
+    if (fd < 0) { return 1; }
+
+    static streamDecoder decoder;
+    streamDecoderReset(&decoder);
+    resetStats();
+
+    char     line[1024];
+    uint16_t lineLength = 0;
+    double   start      = nowSeconds();
+    double   lastPrint  = start;
+    uint8_t  buffer[256];
+    ssize_t  nRead;
+    while ((nRead = read(fd, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t i = 0; i < nRead; i++) {
+            uint8_t data = buffer[i];
+            if (streamDecodeByte(&decoder, data)) {
+                addRecord(decoder.sequence, decoder.values, decoder.count);
+                lineLength = 0;
+                continue;
+            }
+            // Bytes inside a frame aren't text
+            if (decoder.received > 0) {
+                lineLength = 0;
+                continue;
+            }
+            if (data == '\n') {
+                line[lineLength] = '\0';
+                if (lineLength > 0) { readLine(line); }
+                lineLength = 0;
+            } else if (data != '\r' && lineLength < sizeof(line) - 1) {
+                line[lineLength++] = (char)data;
+            }
+        }
+        double now = nowSeconds();
+        if (now - lastPrint >= 1.0) {
+            printStats(now - start, decoder.badFrames);
+            lastPrint = now;
+        }
+    }
+    printStats(nowSeconds() - start, decoder.badFrames);
+    return 0;
+}
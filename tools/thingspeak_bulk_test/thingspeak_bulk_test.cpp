@@ -0,0 +1,373 @@
+/**
+ * @file thingspeak_bulk_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that sends ThingSpeak bulk updates to a stand-in
+ * server and checks what arrives.
+ *
+ * The real ThingSpeakPublisher and dataPublisher are used.  The logger is a
+ * stand-in that keeps a numbered set of records with made-up values, so its
+ * functions used by the publishers are defined here instead of linking
+ * LoggerBase.cpp.  The server is a Client that takes each request, answers it
+ * with a chosen HTTP status, and keeps it for checking.
+ *
+ * It checks:
+ * - each request's Content-Length, counted by printBulkBody() before sending,
+ * is the length of the body actually sent - including bodies several times
+ * the size of the transmit buffer;
+ * - each body is exactly the JSON expected for the records and the fields of
+ * its channel;
+ * - with two channels, a channel whose update was refused sends the same
+ * records again next time while the other only sends what is new;
+ * - nothing is sent when there is nothing new, everything is sent again after
+ * resetSentRecords() or when the record numbers start over, and a server that
+ * doesn't answer leaves the records to be sent again.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -DARDUINO_ARCH_AVR -I../host_arduino -I../../src \
+ *     -I../../src/publishers -o thingspeak_bulk_test thingspeak_bulk_test.cpp \
+ *     ../../src/publishers/ThingSpeakPublisher.cpp \
+ *     ../../src/dataPublisherBase.cpp ../../src/TaskWatch.cpp \
+ *     ../host_arduino/host_arduino.cpp
+ * ./thingspeak_bulk_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "ThingSpeakPublisher.h"
+
+static uint32_t failures = 0;
+
+static void fail(const std::string& what) {
+    if (failures < 20) { printf("FAIL %s\n", what.c_str()); }
+    failures++;
+}
+static void check(const std::string& what, bool ok) {
+    if (!ok) { fail(what); }
+}
+
+// ============================================================================
+//  The stand-in logger
+// ============================================================================
+
+static uint8_t  varCount      = 10;
+static uint32_t oldestRecord  = 0;
+static uint32_t newestRecord  = 0;
+static uint32_t currentRecord = 0;
+
+// The value of a variable in a record, as the logger would format it
+static std::string valueString(uint32_t record, uint8_t i) {
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%lu.%02u", (unsigned long)record, i);
+    return buffer;
+}
+// The time stamp of a record
+static std::string timestamp(uint32_t record) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "2020-01-01T%02lu:%02lu:00-05:00",
+             (unsigned long)(record / 60) % 24, (unsigned long)record % 60);
+    return buffer;
+}
+
+uint32_t Logger::markedEpochTime = 0;
+
+Logger::Logger() {
+    _loggingIntervalMinutes = 5;
+    _internalArray          = NULL;
+}
+Logger::~Logger() {}
+void Logger::printFileHeader(Stream*) {}
+void Logger::testingMode() {}
+void Logger::streamingMode(streamFormat, uint16_t, uint32_t) {}
+void Logger::begin(const char*, uint16_t, VariableArray*) {}
+void Logger::begin(VariableArray*) {}
+void Logger::begin() {}
+void Logger::logData(void) {}
+void Logger::registerDataPublisher(dataPublisher*) {}
+uint8_t Logger::getArrayVarCount() {
+    return varCount;
+}
+uint8_t Logger::getCacheCapacity(void) {
+    return MS_PUBLISH_CACHE_RECORDS;
+}
+uint32_t Logger::getOldestCachedRecord(void) {
+    return oldestRecord;
+}
+uint32_t Logger::getNewestCachedRecord(void) {
+    return newestRecord;
+}
+bool Logger::replayCachedRecord(uint32_t recordNumber) {
+    if (recordNumber < oldestRecord || recordNumber > newestRecord) {
+        return false;
+    }
+    currentRecord = recordNumber;
+    return true;
+}
+void Logger::endReplay(void) {
+    currentRecord = newestRecord;
+}
+String Logger::getValueStringAtI(uint8_t position_i) {
+    return String(valueString(currentRecord, position_i).c_str());
+}
+const char* Logger::formatMarkedTime_ISO8601(void) {
+    static std::string text;
+    text = timestamp(currentRecord);
+    return text.c_str();
+}
+
+extendedWatchDogAVR::extendedWatchDogAVR() {}
+extendedWatchDogAVR::~extendedWatchDogAVR() {}
+
+// ============================================================================
+//  The stand-in server
+// ============================================================================
+
+// A request as the server got it
+struct request {
+    std::string host;
+    std::string path;
+    std::string headers;
+    std::string body;
+    std::string trailing;
+};
+
+class StandInServer : public Client {
+ public:
+    std::vector<request> requests;
+    int                  status;  // The status to answer with; 0 for none
+
+    StandInServer() : status(202), _connected(false), _replyAt(0) {}
+
+    int connect(IPAddress, uint16_t) override {
+        return 0;
+    }
+    int connect(const char* host, uint16_t) override {
+        _host      = host;
+        _sent      = "";
+        _reply     = "";
+        _replyAt   = 0;
+        _connected = true;
+        return 1;
+    }
+    size_t write(uint8_t c) override {
+        _sent += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        _sent.append(reinterpret_cast<const char*>(buffer), size);
+        return size;
+    }
+    int available(void) override {
+        answer();
+        return _reply.size() - _replyAt;
+    }
+    int read(void) override {
+        answer();
+        return _replyAt < _reply.size() ? (uint8_t)_reply[_replyAt++] : -1;
+    }
+    int read(uint8_t* buffer, size_t size) override {
+        size_t n = 0;
+        while (n < size && available() > 0) { buffer[n++] = read(); }
+        return n;
+    }
+    int peek(void) override {
+        answer();
+        return _replyAt < _reply.size() ? (uint8_t)_reply[_replyAt] : -1;
+    }
+    void flush(void) override {}
+    void stop(void) override {
+        if (!_connected) { return; }
+        _connected = false;
+        // Split the request at the end of its headers and take the number
+        // of bytes the Content-Length says as the body
+        request     r;
+        size_t      end  = _sent.find("\r\n\r\n");
+        std::string line = _sent.substr(0, _sent.find("\r\n"));
+        r.host           = _host;
+        if (line.compare(0, 5, "POST ") == 0) {
+            r.path = line.substr(5, line.rfind(" HTTP/1.1") - 5);
+        }
+        r.headers     = _sent.substr(0, end);
+        size_t found  = r.headers.find("Content-Length: ");
+        size_t length = 0;
+        if (found != std::string::npos) {
+            length = atol(r.headers.c_str() + found + 16);
+        }
+        if (end != std::string::npos) {
+            r.body     = _sent.substr(end + 4, length);
+            r.trailing = _sent.substr(end + 4 + r.body.size());
+        }
+        requests.push_back(r);
+    }
+    uint8_t connected(void) override {
+        return _connected;
+    }
+    operator bool() override {
+        return _connected;
+    }
+
+ private:
+    // Answer once the whole request has been sent
+    void answer(void) {
+        if (!_connected || status == 0 || !_reply.empty()) { return; }
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "HTTP/1.1 %d OK\r\n\r\n", status);
+        _reply = buffer;
+    }
+
+    std::string _host;
+    std::string _sent;
+    std::string _reply;
+    bool        _connected;
+    size_t      _replyAt;
+};
+
+// ============================================================================
+//  The checks
+// ============================================================================
+
+static const char* channelIDs[]  = {"1111111", "2222222"};
+static const char* channelKeys[] = {"KEYONE", "KEYTWO"};
+
+// The body ThingSpeak should get for a channel and a run of records
+static std::string expectedBody(uint8_t channel, uint32_t first,
+                                uint32_t last) {
+    uint8_t     fields = varCount - channel * 8 > 8 ? 8
+                                                     : varCount - channel * 8;
+    std::string body   = "{\"write_api_key\":\"";
+    body += channelKeys[channel];
+    body += "\",\"updates\":[";
+    for (uint32_t n = first; n <= last; n++) {
+        if (n != first) { body += ","; }
+        body += "{\"created_at\":\"" + timestamp(n) + "\"";
+        for (uint8_t i = 0; i < fields; i++) {
+            char field[16];
+            snprintf(field, sizeof(field), ",\"field%u\":", i + 1);
+            body += field + valueString(n, channel * 8 + i);
+        }
+        body += "}";
+    }
+    return body + "]}";
+}
+
+// Checks the requests since the last check were for the given channels and
+// runs of records
+struct expectedUpdate {
+    uint8_t  channel;
+    uint32_t first;
+    uint32_t last;
+};
+static void checkRequests(const char* step, StandInServer& server,
+                          const std::vector<expectedUpdate>& expected) {
+    std::string name = step;
+    check(name + ": number of requests",
+          server.requests.size() == expected.size());
+    for (size_t k = 0; k < server.requests.size() && k < expected.size();
+         k++) {
+        const request&        r = server.requests[k];
+        const expectedUpdate& e = expected[k];
+        std::string           path = "/channels/";
+        path += channelIDs[e.channel];
+        path += "/bulk_update.json";
+        check(name + ": host", r.host == "api.thingspeak.com");
+        check(name + ": path " + r.path, r.path == path);
+        check(name + ": Host header",
+              r.headers.find("\r\nHost: api.thingspeak.com") !=
+                  std::string::npos);
+        check(name + ": content type",
+              r.headers.find("\r\nContent-Type: application/json") !=
+                  std::string::npos);
+        check(name + ": body", r.body == expectedBody(e.channel, e.first,
+                                                      e.last));
+        // Anything after the counted body means the count was short
+        check(name + ": Content-Length",
+              r.trailing.find_first_not_of("\r\n") == std::string::npos);
+    }
+    server.requests.clear();
+}
+
+// A server that takes the first update and refuses the rest with 500
+class RefuseSecond : public StandInServer {
+ public:
+    void stop(void) override {
+        StandInServer::stop();
+        status = 500;
+    }
+};
+
+int main(void) {
+    Logger              logger;
+    StandInServer       server;
+    ThingSpeakPublisher publisher(logger, &server, "MQTTKEY", channelIDs[0],
+                                  channelKeys[0]);
+    publisher.addChannel(channelIDs[1], channelKeys[1]);
+    publisher.setBulkUpdate(true);
+
+    // Everything kept goes to both channels
+    oldestRecord = 1;
+    newestRecord = 5;
+    publisher.publishCachedData();
+    checkRequests("first send", server, {{0, 1, 5}, {1, 1, 5}});
+
+    // Nothing new, nothing sent
+    publisher.publishCachedData();
+    checkRequests("nothing new", server, {});
+
+    // Only what is new is sent
+    newestRecord = 7;
+    publisher.publishCachedData();
+    checkRequests("new records", server, {{0, 6, 7}, {1, 6, 7}});
+
+    // The second channel's update is refused, so only the first moves on
+    RefuseSecond refusing;
+    publisher.setClient(&refusing);
+    newestRecord = 9;
+    publisher.publishCachedData();
+    checkRequests("second refused", refusing, {{0, 8, 9}, {1, 8, 9}});
+    publisher.setClient(&server);
+    newestRecord = 10;
+    publisher.publishCachedData();
+    checkRequests("refused records again", server, {{0, 10, 10}, {1, 8, 10}});
+
+    // A server that doesn't answer leaves everything for next time
+    newestRecord  = 11;
+    server.status = 0;
+    publisher.publishCachedData();
+    checkRequests("no answer", server, {{0, 11, 11}, {1, 11, 11}});
+    server.status = 202;
+    publisher.publishCachedData();
+    checkRequests("after no answer", server, {{0, 11, 11}, {1, 11, 11}});
+
+    // Starting over sends everything kept again
+    publisher.resetSentRecords();
+    publisher.publishCachedData();
+    checkRequests("reset", server, {{0, 1, 11}, {1, 1, 11}});
+
+    // So does a cache whose record numbers start over
+    oldestRecord = 1;
+    newestRecord = 3;
+    publisher.publishCachedData();
+    checkRequests("cache restarted", server, {{0, 1, 3}, {1, 1, 3}});
+
+    // A body several times the size of the transmit buffer
+    oldestRecord = 4;
+    newestRecord = 60;
+    check("large body is larger than the buffer",
+          expectedBody(0, 4, 60).size() > 3 * MS_SEND_BUFFER_SIZE);
+    publisher.publishCachedData();
+    checkRequests("large body", server, {{0, 4, 60}, {1, 4, 60}});
+
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All ThingSpeak bulk update checks passed\n");
+    return 0;
+}
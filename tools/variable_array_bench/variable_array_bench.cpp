@@ -0,0 +1,151 @@
+/**
+ * @file variable_array_bench.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that measures what the sensor table of a
+ * StaticVariableArray saves over the String comparison of a plain
+ * VariableArray.
+ *
+ * Each loop over the sensors - setup, waking, updating, and sleeping - asks
+ * isLastVarFromSensor() about every variable once, which is what
+ * VariableArray::getSensorCount() does.  For arrays of a few sizes it
+ * measures, per pass:
+ * - the heap allocations, counted by replacing operator new;
+ * - the time;
+ * - the RAM the table takes on an AVR.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -DARDUINO_ARCH_AVR -I../host_arduino -I../../src \
+ *     -o variable_array_bench variable_array_bench.cpp \
+ *     ../../src/VariableArray.cpp ../../src/VariableBase.cpp \
+ *     ../../src/SensorBase.cpp ../../src/TaskWatch.cpp \
+ *     ../host_arduino/host_arduino.cpp
+ * ./variable_array_bench
+ * @endcode
+ *
+ * @note The host String is a std::string, which keeps short text without
+ * allocating; the AVR String always allocates, so the allocation counts here
+ * are a lower bound for a board.  The times are from a desktop processor and
+ * only show how the two grow with the number of variables.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <new>
+
+#include "VariableArray.h"
+
+// The number of passes timed for each array
+#define PASSES 2000
+
+static uint32_t allocations = 0;
+
+// These are kept out of line so the compiler doesn't pair the malloc() and
+// free() inside them with the new and delete outside
+__attribute__((noinline)) void* operator new(size_t size) {
+    allocations++;
+    void* p = malloc(size);
+    if (p == NULL) { throw std::bad_alloc(); }
+    return p;
+}
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    free(p);
+}
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// A sensor with three values and a location like a pin-connected sensor's
+class BenchSensor : public Sensor {
+ public:
+    explicit BenchSensor(int8_t dataPin)
+        : Sensor("BenchSensor", 3, 0, 0, 0, -1, dataPin) {
+        setResultArrays(_results);
+    }
+    bool addSingleMeasurementResult(void) override {
+        return true;
+    }
+
+ private:
+    SensorResultArrays<3> _results;
+};
+
+static float calculated(void) {
+    return 0;
+}
+
+// Up to 12 sensors of 3 variables each, plus 2 calculated variables
+#define MAX_SENSORS 12
+#define MAX_VARIABLES (MAX_SENSORS * 3 + 2)
+
+static volatile uint8_t sink = 0;
+
+template <uint8_t N>
+static void bench(Variable* (&variables)[N], uint8_t nSensors) {
+    VariableArray          plain(N, variables);
+    StaticVariableArray<N> table(variables);
+
+    uint32_t before = allocations;
+    sink += plain.getSensorCount();
+    uint32_t plainAllocs = allocations - before;
+    before               = allocations;
+    sink += table.getSensorCount();
+    uint32_t tableAllocs = allocations - before;
+
+    double start = nowNs();
+    for (uint16_t p = 0; p < PASSES; p++) { sink += plain.getSensorCount(); }
+    double plainNs = (nowNs() - start) / PASSES;
+    start          = nowNs();
+    for (uint16_t p = 0; p < PASSES; p++) { sink += table.getSensorCount(); }
+    double tableNs = (nowNs() - start) / PASSES;
+
+    // The table is one bool per variable; a bool is a byte on an AVR
+    printf("%2u sensors, %2u variables: allocations %4lu -> %lu, "
+           "%8.0f ns -> %4.0f ns, table %u bytes\n",
+           nSensors, N, (unsigned long)plainAllocs,
+           (unsigned long)tableAllocs, plainNs, tableNs, N);
+}
+
+int main(void) {
+    static BenchSensor* sensors[MAX_SENSORS];
+    static Variable*    all[MAX_VARIABLES];
+    uint8_t             n = 0;
+    for (uint8_t s = 0; s < MAX_SENSORS; s++) {
+        sensors[s] = new BenchSensor(10 + s);
+        for (uint8_t v = 0; v < 3; v++) {
+            all[n++] = new Variable(sensors[s], v, 2, "name", "unit", "code",
+                                    "");
+        }
+    }
+    all[n++] = new Variable(calculated, 2, "name", "unit", "code", "");
+    all[n++] = new Variable(calculated, 2, "name", "unit", "code", "");
+
+    printf("Per pass over the sensors, plain VariableArray -> "
+           "StaticVariableArray:\n");
+    // The calculated variables go last in each array
+    Variable* v5[5]   = {all[0], all[1], all[2], all[36], all[37]};
+    Variable* v14[14] = {};
+    Variable* v26[26] = {};
+    Variable* v38[38] = {};
+    for (uint8_t i = 0; i < 12; i++) { v14[i] = all[i]; }
+    for (uint8_t i = 0; i < 24; i++) { v26[i] = all[i]; }
+    for (uint8_t i = 0; i < 36; i++) { v38[i] = all[i]; }
+    v14[12] = v26[24] = v38[36] = all[36];
+    v14[13] = v26[25] = v38[37] = all[37];
+    bench(v5, 1);
+    bench(v14, 4);
+    bench(v26, 8);
+    bench(v38, 12);
+    return 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file wake_alarm_test.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that checks the choice of RTC alarm time in
+ * WakeAlarm.h, which Logger::getNextIntervalEpoch(),
+ * Logger::setWakeAlarm(), and LoggerGroup use.
+ *
+ * It checks:
+ * - the next interval from every second around interval boundaries, for
+ * the intervals a logger is commonly set to;
+ * - that an interval of 0 falls back to 1 minute;
+ * - that a 1 minute interval, a clock that isn't sane, and an interval that
+ * is too close to arm all fall back to waking every minute;
+ * - that the alarm is moved into the timezone of the RTC, for offsets both
+ * east and west of it;
+ * - that a wake time that has already passed falls back to waking every
+ * minute;
+ * - that a group of loggers with intervals that are not multiples of each
+ * other wakes at every interval of every logger, and only then, and that one
+ * logger on a 1 minute interval makes the whole group wake every minute.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -I../../src -o wake_alarm_test wake_alarm_test.cpp
+ * ./wake_alarm_test
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "WakeAlarm.h"
+
+static uint32_t failures = 0;
+
+static void check(const char* what, uint32_t got, uint32_t expected) {
+    if (got == expected) { return; }
+    if (failures < 20) {
+        printf("FAIL %s: got %lu, expected %lu\n", what, (unsigned long)got,
+               (unsigned long)expected);
+    }
+    failures++;
+}
+
+// 2020-01-01 00:00:00, which is an even interval of every rate tested
+#define BASE_EPOCH 1577836800UL
+
+static void testNextInterval(void) {
+    const uint16_t intervals[] = {1, 2, 5, 10, 15, 30, 60, 120, 1440};
+    for (uint8_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+        uint32_t interval_s = (uint32_t)intervals[i] * 60;
+        // Every second from just before one boundary to just after the next
+        for (uint32_t t = BASE_EPOCH - 5; t <= BASE_EPOCH + interval_s + 5;
+             t++) {
+            uint32_t expected;
+            if (t < BASE_EPOCH) {
+                expected = BASE_EPOCH;
+            } else if (t < BASE_EPOCH + interval_s) {
+                expected = BASE_EPOCH + interval_s;
+            } else {
+                expected = BASE_EPOCH + 2 * interval_s;
+            }
+            check("wakeAlarmNextInterval",
+                  wakeAlarmNextInterval(t, intervals[i]), expected);
+        }
+    }
+
+    // A time exactly on a boundary moves on to the next one
+    check("on a boundary", wakeAlarmNextInterval(BASE_EPOCH, 15),
+          BASE_EPOCH + 900);
+    // An interval of 0 is treated as 1 minute
+    check("0 minutes", wakeAlarmNextInterval(BASE_EPOCH + 1, 0),
+          BASE_EPOCH + 60);
+    check("0 minutes on a boundary", wakeAlarmNextInterval(BASE_EPOCH, 0),
+          BASE_EPOCH + 60);
+}
+
+static void testAlarm(void) {
+    // A 1 minute (or 0) interval always wakes every minute
+    check("1 minute", wakeAlarmEpoch(BASE_EPOCH + 10, 1, true, 0), 0);
+    check("0 minutes", wakeAlarmEpoch(BASE_EPOCH + 10, 0, true, 0), 0);
+    // So does a clock that isn't sane
+    check("insane clock", wakeAlarmEpoch(BASE_EPOCH + 10, 15, false, 0), 0);
+
+    // Too close to the next interval to arm the alarm in time
+    for (uint32_t lead = 1; lead < WAKE_ALARM_MIN_LEAD_S; lead++) {
+        check("too close", wakeAlarmEpoch(BASE_EPOCH - lead, 15, true, 0), 0);
+    }
+    check("just far enough",
+          wakeAlarmEpoch(BASE_EPOCH - WAKE_ALARM_MIN_LEAD_S, 15, true, 0),
+          BASE_EPOCH);
+    // Right on an interval, the next one is a whole interval away
+    check("on a boundary", wakeAlarmEpoch(BASE_EPOCH, 15, true, 0),
+          BASE_EPOCH + 900);
+
+    // The alarm is in the timezone of the RTC: a logger 5 hours west of its
+    // RTC (offset -5) has to wake 5 hours later by the RTC
+    check("offset -5", wakeAlarmEpoch(BASE_EPOCH + 10, 15, true, -5),
+          BASE_EPOCH + 900 + 5 * 3600UL);
+    check("offset +3", wakeAlarmEpoch(BASE_EPOCH + 10, 15, true, 3),
+          BASE_EPOCH + 900 - 3 * 3600UL);
+    check("offset -12", wakeAlarmEpoch(BASE_EPOCH + 10, 60, true, -12),
+          BASE_EPOCH + 3600 + 12 * 3600UL);
+    check("offset +14", wakeAlarmEpoch(BASE_EPOCH + 10, 60, true, 14),
+          BASE_EPOCH + 3600 - 14 * 3600UL);
+    // The interval is found in the logger's timezone, so a 2 hour interval
+    // with a 1 hour offset still wakes on even hours of local time
+    check("2 hours, offset -1",
+          wakeAlarmEpoch(BASE_EPOCH + 10, 120, true, -1),
+          BASE_EPOCH + 7200 + 3600);
+}
+
+static void testGroup(void) {
+    // A wake time that is already here or gone wakes every minute
+    check("passed", wakeAlarmEpochAt(BASE_EPOCH + 10, BASE_EPOCH, true, 0), 0);
+    check("now", wakeAlarmEpochAt(BASE_EPOCH, BASE_EPOCH, true, 0), 0);
+    check("every minute", wakeAlarmEpochAt(BASE_EPOCH, 0, true, 0), 0);
+
+    // Three loggers on 10, 15, and 7 minutes, none a multiple of the first.
+    // Waking at the earliest next interval of any of them must land on every
+    // interval of every logger over a day, and on nothing else.
+    const uint16_t intervals[]  = {10, 15, 7};
+    const uint8_t  loggerCount  = sizeof(intervals) / sizeof(intervals[0]);
+    uint32_t       t            = BASE_EPOCH;
+    uint32_t       wakes        = 0;
+    uint32_t       expectedWake = 0;
+    for (uint32_t s = BASE_EPOCH + 1; s <= BASE_EPOCH + 86400UL; s++) {
+        for (uint8_t i = 0; i < loggerCount; i++) {
+            if ((s - BASE_EPOCH) % (intervals[i] * 60UL) == 0) {
+                expectedWake++;
+                break;
+            }
+        }
+    }
+    while (t < BASE_EPOCH + 86400UL) {
+        uint32_t next = wakeAlarmNextWake(t, intervals[0]);
+        for (uint8_t i = 1; i < loggerCount; i++) {
+            next = wakeAlarmEarliest(next, wakeAlarmNextWake(t, intervals[i]));
+        }
+        // Nothing is due between now and the chosen wake time
+        for (uint8_t i = 0; i < loggerCount; i++) {
+            check("group skips no interval",
+                  wakeAlarmNextInterval(t, intervals[i]) >= next, 1);
+        }
+        t = next;
+        wakes++;
+    }
+    check("group wakes", wakes, expectedWake);
+
+    // A logger on a 1 minute interval wakes the whole group every minute
+    check("1 minute in a group",
+          wakeAlarmEarliest(wakeAlarmNextWake(BASE_EPOCH + 10, 15),
+                            wakeAlarmNextWake(BASE_EPOCH + 10, 1)),
+          0);
+    check("1 minute first in a group",
+          wakeAlarmEarliest(wakeAlarmNextWake(BASE_EPOCH + 10, 1),
+                            wakeAlarmNextWake(BASE_EPOCH + 10, 15)),
+          0);
+}
+
+int main(void) {
+    testNextInterval();
+    testAlarm();
+    testGroup();
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All wake alarm checks passed\n");
+    return 0;
+}
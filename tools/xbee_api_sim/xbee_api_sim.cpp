@@ -0,0 +1,603 @@
+/**
+ * @file xbee_api_sim.cpp
+ * @copyright 2020 Stroud Water Research Center
+ * Part of the EnviroDIY ModularSensors library for Arduino
+ *
+ * @brief A host program that runs DigiXBeeAPI and DigiXBeeAPIClient against a
+ * simulated XBee and checks the frames that pass between them.
+ *
+ * The simulated XBee is a Stream.  It starts in transparent mode or in an API
+ * mode, keeps its settings in a table, answers AT command frames from that
+ * table, and keeps the socket data sent to it.  After each piece of socket
+ * data it can answer with data of its own, full of the bytes that have to be
+ * escaped.  It decodes the frames from the library byte by byte, as the radio
+ * would, so a wrong length, checksum, or escape shows as a bad frame.
+ *
+ * For both API mode 1 and API mode 2 it checks:
+ * - an XBee in transparent mode is switched into API mode once, with the
+ * guard time before "+++", the setting is saved, and later calls go straight
+ * to frames;
+ * - AT responses are matched to their commands when collected out of order,
+ * numbers are sent in as few bytes as they fit in and read back, and
+ * setParameters() sets more commands than can wait at once;
+ * - sending more commands than can wait drops only the oldest responses, and
+ * frame IDs wrap around without ever using 0;
+ * - socket data of every size, including writes longer than a frame, reaches
+ * the XBee in order and unchanged, and what the server sends back is read
+ * back unchanged;
+ * - socket data beyond the receive buffer is dropped, an AT response with a
+ * bad checksum is ignored, and the frame after one with a bad checksum is
+ * read;
+ * - a refused or unanswered send closes the client, stop() closes the socket,
+ * and a failed name lookup fails connect().
+ *
+ * In API mode 2 it also checks that no byte that must be escaped is ever sent
+ * bare, that the frame after one cut off part way is read, and
+ * that an XBee left in API mode 1 is changed to mode 2.
+ *
+ * Build and run with:
+ * @code{.sh}
+ * g++ -O2 -DARDUINO_ARCH_AVR -I../host_arduino -I../../src \
+ *     -I../../src/modems -o xbee_api_sim xbee_api_sim.cpp \
+ *     ../../src/modems/DigiXBeeAPI.cpp ../../src/TaskWatch.cpp \
+ *     ../host_arduino/host_arduino.cpp
+ * ./xbee_api_sim
+ * @endcode
+ * The program prints each failure and exits with 1 if there were any.
+ */
+
+#include <stdio.h>
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "DigiXBeeAPI.h"
+
+static uint32_t failures = 0;
+static int      testMode = 0;
+
+static void check(const char* what, bool ok) {
+    if (ok) { return; }
+    if (failures < 20) { printf("FAIL in API mode %d: %s\n", testMode, what); }
+    failures++;
+}
+
+typedef std::vector<uint8_t> Bytes;
+
+// ============================================================================
+//  The simulated XBee
+// ============================================================================
+
+class SimXBee : public Stream {
+ public:
+    // 0 for transparent mode, or the API mode
+    uint8_t                          apiMode;
+    std::map<std::string, uint32_t>  settings;
+    std::vector<std::string>         commands;
+    std::map<std::string, uint8_t>   parameterLengths;
+    std::deque<uint8_t>              toLogger;
+
+    // What the library has done, for checking
+    unsigned goodFrames;
+    unsigned badFrames;
+    unsigned bareEscapes;
+    unsigned zeroFrameIds;
+    unsigned commandModeEntries;
+    bool     guardTimeKept;
+
+    // The socket
+    Bytes    received;
+    uint8_t  lastAddress[4];
+    uint16_t lastPort;
+    uint8_t  lastProtocol;
+    uint16_t biggestPayload;
+    unsigned socketFrames;
+    unsigned closes;
+    // The TX status to answer with, or -1 not to answer
+    int   txStatus;
+    Bytes reply;
+    bool  lookupWorks;
+    // True to spoil the checksum of the next frame sent to the logger
+    bool corruptNextFrame;
+
+    explicit SimXBee(uint8_t mode)
+        : apiMode(mode),
+          goodFrames(0),
+          badFrames(0),
+          bareEscapes(0),
+          zeroFrameIds(0),
+          commandModeEntries(0),
+          guardTimeKept(false),
+          lastPort(0),
+          lastProtocol(0),
+          biggestPayload(0),
+          socketFrames(0),
+          closes(0),
+          txStatus(0),
+          lookupWorks(true),
+          corruptNextFrame(false),
+          _inFrame(false),
+          _escaped(false),
+          _commandMode(false),
+          _pluses(0),
+          _lastByteTime(0) {
+        settings["AP"] = mode;
+        settings["DB"] = 0x59;
+        settings["TP"] = 0xFFFB;
+    }
+
+    int available(void) override {
+        return toLogger.size();
+    }
+    int read(void) override {
+        if (toLogger.empty()) { return -1; }
+        int c = toLogger.front();
+        toLogger.pop_front();
+        return c;
+    }
+    int peek(void) override {
+        return toLogger.empty() ? -1 : toLogger.front();
+    }
+    size_t write(uint8_t c) override {
+        if (apiMode == 0 || _commandMode) {
+            receiveText(c);
+        } else {
+            receiveFrameByte(c);
+        }
+        _lastByteTime = millis();
+        return 1;
+    }
+    using Print::write;
+
+    // Sends a frame to the logger, escaped for the API mode
+    void sendFrame(const Bytes& frame) {
+        Bytes body;
+        body.push_back(frame.size() >> 8);
+        body.push_back(frame.size() & 0xFF);
+        uint8_t sum = 0;
+        for (size_t i = 0; i < frame.size(); i++) {
+            body.push_back(frame[i]);
+            sum += frame[i];
+        }
+        body.push_back(0xFF - sum);
+        if (corruptNextFrame) {
+            body.back() ^= 0x01;
+            corruptNextFrame = false;
+        }
+        toLogger.push_back(0x7E);
+        for (size_t i = 0; i < body.size(); i++) {
+            uint8_t c = body[i];
+            if (apiMode == 2 &&
+                (c == 0x7E || c == 0x7D || c == 0x11 || c == 0x13)) {
+                toLogger.push_back(0x7D);
+                toLogger.push_back(c ^ 0x20);
+            } else {
+                toLogger.push_back(c);
+            }
+        }
+    }
+
+    // Sends socket data to the logger in an RX Packet: IPv4 frame
+    void sendSocketData(const Bytes& data) {
+        Bytes frame = {0xB0,
+                       lastAddress[0],
+                       lastAddress[1],
+                       lastAddress[2],
+                       lastAddress[3],
+                       0xC0,
+                       0x01,
+                       static_cast<uint8_t>(lastPort >> 8),
+                       static_cast<uint8_t>(lastPort & 0xFF),
+                       lastProtocol,
+                       0};
+        frame.insert(frame.end(), data.begin(), data.end());
+        sendFrame(frame);
+    }
+
+ private:
+    Bytes    _frame;
+    bool     _inFrame;
+    bool     _escaped;
+    bool     _commandMode;
+    uint8_t  _pluses;
+    uint32_t _lastByteTime;
+    std::string _line;
+
+    void answer(const char* text) {
+        while (*text) { toLogger.push_back(*text++); }
+    }
+
+    // Transparent mode: only watch for "+++", then take command mode lines
+    void receiveText(uint8_t c) {
+        if (!_commandMode) {
+            if (c != '+') {
+                _pluses = 0;
+                return;
+            }
+            if (_pluses == 0) {
+                guardTimeKept = millis() - _lastByteTime >= 1000;
+            }
+            if (++_pluses == 3 && guardTimeKept) {
+                _commandMode = true;
+                commandModeEntries++;
+                _line.clear();
+                answer("OK\r");
+            }
+            return;
+        }
+        if (c != '\r') {
+            _line += static_cast<char>(c);
+            return;
+        }
+        if (_line.compare(0, 4, "ATAP") == 0) {
+            settings["AP"] = _line[4] - '0';
+            commands.push_back("AP");
+        } else if (_line == "ATWR" || _line == "ATCN") {
+            commands.push_back(_line.substr(2));
+        } else {
+            answer("ERROR\r");
+            _line.clear();
+            return;
+        }
+        answer("OK\r");
+        if (_line == "ATCN") {
+            _commandMode = false;
+            apiMode      = settings["AP"];
+        }
+        _line.clear();
+    }
+
+    void receiveFrameByte(uint8_t c) {
+        if (apiMode == 2) {
+            if (c == 0x7E) {
+                if (_inFrame) { badFrames++; }
+                startFrame();
+                return;
+            }
+            if (!_inFrame) { return; }
+            if (c == 0x11 || c == 0x13) { bareEscapes++; }
+            if (c == 0x7D) {
+                _escaped = true;
+                return;
+            }
+            if (_escaped) {
+                c ^= 0x20;
+                _escaped = false;
+            }
+        } else if (!_inFrame) {
+            if (c == 0x7E) { startFrame(); }
+            return;
+        }
+        _frame.push_back(c);
+        if (_frame.size() < 2) { return; }
+        size_t length = (_frame[0] << 8) | _frame[1];
+        if (_frame.size() < length + 3) { return; }
+        _inFrame    = false;
+        uint8_t sum = 0;
+        for (size_t i = 2; i < _frame.size(); i++) { sum += _frame[i]; }
+        if (sum != 0xFF) {
+            badFrames++;
+            return;
+        }
+        goodFrames++;
+        handleFrame(Bytes(_frame.begin() + 2, _frame.end() - 1));
+    }
+
+    void startFrame(void) {
+        _frame.clear();
+        _inFrame = true;
+        _escaped = false;
+    }
+
+    void handleFrame(const Bytes& f) {
+        if (f.size() >= 2 && f[1] == 0) { zeroFrameIds++; }
+        if (f[0] == 0x08 && f.size() >= 4) {
+            handleATCommand(f);
+        } else if (f[0] == 0x20 && f.size() >= 12) {
+            handleTransmit(f);
+        }
+    }
+
+    static bool known(const std::string& command) {
+        static const char* const table[] = {
+            "AP", "WR", "LA", "DB", "TP", "TM", "SO", "SM", "DO",
+            "D5", "D7", "D8", "D9", "P0", "P1", "C0"};
+        for (size_t i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+            if (command == table[i]) { return true; }
+        }
+        return false;
+    }
+
+    void handleATCommand(const Bytes& f) {
+        std::string command(f.begin() + 2, f.begin() + 4);
+        Bytes       parameter(f.begin() + 4, f.end());
+        Bytes       response = {0x88, f[1], f[2], f[3], 0};
+        commands.push_back(command);
+        uint8_t newMode = apiMode;
+        if (!known(command)) {
+            // Invalid command
+            response[4] = 2;
+        } else if (command == "LA") {
+            if (lookupWorks) {
+                // An address full of bytes that have to be escaped
+                Bytes address = {10, 0x7E, 0x11, 0x13};
+                response.insert(response.end(), address.begin(),
+                                address.end());
+            } else {
+                response[4] = 1;
+            }
+        } else if (!parameter.empty()) {
+            uint32_t value = 0;
+            for (size_t i = 0; i < parameter.size(); i++) {
+                value = (value << 8) | parameter[i];
+            }
+            settings[command]         = value;
+            parameterLengths[command] = parameter.size();
+            // The new mode applies to the frames after this response
+            if (command == "AP") { newMode = value; }
+        } else if (settings.count(command)) {
+            uint32_t value   = settings[command];
+            bool     started = false;
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                uint8_t b = value >> shift;
+                if (started || b != 0 || shift == 0) {
+                    response.push_back(b);
+                    started = true;
+                }
+            }
+        }
+        sendFrame(response);
+        apiMode = newMode;
+    }
+
+    void handleTransmit(const Bytes& f) {
+        for (uint8_t i = 0; i < 4; i++) { lastAddress[i] = f[2 + i]; }
+        lastPort     = (f[6] << 8) | f[7];
+        lastProtocol = f[10];
+        Bytes payload(f.begin() + 12, f.end());
+        socketFrames++;
+        if (payload.size() > biggestPayload) {
+            biggestPayload = payload.size();
+        }
+        if (txStatus < 0) { return; }
+        sendFrame({0x89, f[1], static_cast<uint8_t>(txStatus)});
+        if (txStatus != 0) { return; }
+        received.insert(received.end(), payload.begin(), payload.end());
+        if (f[11] & 0x02) { closes++; }
+        if (!payload.empty() && !reply.empty()) { sendSocketData(reply); }
+    }
+};
+
+// ============================================================================
+//  The checks
+// ============================================================================
+
+static Bytes pattern(size_t length, unsigned seed) {
+    // Cycles through every byte value, so every escaped byte is included
+    Bytes data(length);
+    for (size_t i = 0; i < length; i++) { data[i] = (i * 7 + seed) & 0xFF; }
+    return data;
+}
+
+static bool endsWith(const Bytes& data, const Bytes& end) {
+    return data.size() >= end.size() &&
+        Bytes(data.end() - end.size(), data.end()) == end;
+}
+
+static void testSwitchToAPI(SimXBee& xbee, DigiXBeeAPI& api) {
+    check("enableAPIMode() from transparent mode", api.enableAPIMode());
+    check("the guard time was kept before +++", xbee.guardTimeKept);
+    check("the XBee is in the API mode asked for", xbee.apiMode == testMode);
+    check("the API mode was saved and applied",
+          xbee.commands.size() >= 3 && xbee.commands[0] == "AP" &&
+              xbee.commands[1] == "WR" && xbee.commands[2] == "CN");
+    check("enableAPIMode() again", api.enableAPIMode());
+    check("command mode used only once", xbee.commandModeEntries == 1);
+}
+
+static void testATCommands(SimXBee& xbee, DigiXBeeAPI& api) {
+    uint8_t data[MS_XBEE_API_RESPONSE_SIZE];
+    uint8_t length = 0;
+
+    // Collect the responses in the other order from how they were asked for
+    uint8_t signalId = api.sendATCommand("DB");
+    uint8_t tempId   = api.sendATCommand("TP");
+    check("TP answered", api.waitATResponse(tempId, data, &length));
+    check("TP read as -5",
+          static_cast<int16_t>(DigiXBeeAPI::toNumber(data, length)) == -5);
+    check("DB answered", api.waitATResponse(signalId, data, &length));
+    check("DB read as 0x59", DigiXBeeAPI::toNumber(data, length) == 0x59);
+    check("an unknown command fails", !api.setParameter("ZZ", 1));
+    // A response with a bad checksum is never taken as the answer
+    uint32_t value        = 0;
+    xbee.corruptNextFrame = true;
+    check("bad checksum response ignored", !api.getParameter("DB", value));
+    check("next response read", api.getParameter("DB", value) &&
+                                    value == 0x59);
+
+    check("set a 4 byte value", api.setParameter("TM", 0x01234567));
+    check("4 byte value kept", xbee.settings["TM"] == 0x01234567 &&
+                                   xbee.parameterLengths["TM"] == 4);
+    check("set 0", api.setParameter("SO", 0));
+    check("0 sent as one byte", xbee.settings["SO"] == 0 &&
+                                    xbee.parameterLengths["SO"] == 1);
+    check("get a value", api.getParameter("TM", value) &&
+                             value == 0x01234567);
+
+    // More settings than can wait at once
+    const char* const names[]  = {"D8", "D9", "D7", "D5", "P0", "SM",
+                                 "SO", "DO", "P1", "TM", "C0"};
+    const uint32_t    values[] = {1, 1, 1, 1, 1, 1, 0, 0, 0, 0x64, 0x7E11};
+    const uint8_t     count    = sizeof(values) / sizeof(values[0]);
+    check("setParameters()", api.setParameters(names, values, count));
+    for (uint8_t i = 0; i < count; i++) {
+        check("setParameters() value", xbee.settings[names[i]] == values[i]);
+    }
+}
+
+static void testPendingAndFrameIds(SimXBee& xbee, DigiXBeeAPI& api) {
+    // More commands than can wait; the oldest responses are dropped
+    uint8_t ids[MS_XBEE_API_MAX_PENDING + 2];
+    for (uint8_t i = 0; i < MS_XBEE_API_MAX_PENDING + 2; i++) {
+        ids[i] = api.sendATCommand("DB");
+    }
+    check("oldest response dropped", !api.waitATResponse(ids[0]));
+    check("second oldest response dropped", !api.waitATResponse(ids[1]));
+    for (uint8_t i = 2; i < MS_XBEE_API_MAX_PENDING + 2; i++) {
+        check("newer responses kept", api.waitATResponse(ids[i]));
+    }
+
+    // Enough commands to wrap the frame IDs around twice
+    bool allAnswered = true;
+    for (uint16_t i = 0; i < 600; i++) {
+        allAnswered &= api.waitATResponse(api.sendATCommand("DB"));
+    }
+    check("every command answered across the frame ID wrap", allAnswered);
+    check("no frame ID of 0", xbee.zeroFrameIds == 0);
+}
+
+static void testSocket(SimXBee& xbee, DigiXBeeAPI& api) {
+    DigiXBeeAPIClient client(api);
+    xbee.reply = pattern(48, 3);
+
+    check("connect by name", client.connect("example.com", 80) == 1);
+    check("connected", client.connected());
+
+    Bytes expected;
+    // Writes of one byte, a buffer's worth, and more than a frame's worth
+    const size_t sizes[] = {1,   5,    MS_XBEE_API_TX_BUFFER - 1,
+                            200, 3000, MS_XBEE_API_TX_BUFFER,
+                            17};
+    for (uint8_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        Bytes data = pattern(sizes[i], i);
+        check("all bytes written",
+              client.write(data.data(), data.size()) == data.size());
+        expected.insert(expected.end(), data.begin(), data.end());
+    }
+    client.print("GET / HTTP/1.1\r\n");
+    const char* text = "GET / HTTP/1.1\r\n";
+    expected.insert(expected.end(), text, text + strlen(text));
+    client.flush();
+
+    check("socket data arrived unchanged", xbee.received == expected);
+    check("no frame longer than allowed",
+          xbee.biggestPayload <= XBEE_API_MAX_PAYLOAD);
+    check("sent to the looked up address",
+          xbee.lastAddress[0] == 10 && xbee.lastAddress[1] == 0x7E &&
+              xbee.lastAddress[2] == 0x11 && xbee.lastAddress[3] == 0x13);
+    check("sent to the port", xbee.lastPort == 80);
+    check("sent over TCP", xbee.lastProtocol == 0x01);
+
+    // Each frame sent was answered, so the replies have piled up past the
+    // receive buffer; only the first bufferful is kept
+    Bytes   got;
+    uint8_t buffer[20];
+    int     n;
+    while ((n = client.read(buffer, sizeof(buffer))) > 0) {
+        got.insert(got.end(), buffer, buffer + n);
+    }
+    Bytes replies;
+    while (replies.size() < MS_XBEE_API_RX_BUFFER) {
+        replies.insert(replies.end(), xbee.reply.begin(), xbee.reply.end());
+    }
+    replies.resize(MS_XBEE_API_RX_BUFFER);
+    check("reply read back unchanged up to the buffer size", got == replies);
+
+    // Socket data is kept as it arrives, before the checksum, so a spoiled
+    // frame's bytes may be read; the frame after it must still be read whole
+    client.write('x');
+    client.flush();
+    while (client.read() >= 0) {}
+    xbee.corruptNextFrame = true;
+    xbee.sendSocketData(pattern(5, 1));
+    xbee.sendSocketData(pattern(5, 2));
+    got.clear();
+    while ((n = client.read()) >= 0) { got.push_back(n); }
+    check("frame after a bad checksum read", endsWith(got, pattern(5, 2)));
+
+    if (testMode == 2) {
+        // After a frame cut off part way, the next frame is found again
+        xbee.sendSocketData(pattern(30, 4));
+        xbee.toLogger.resize(xbee.toLogger.size() - 10);
+        xbee.sendSocketData(pattern(5, 5));
+        got.clear();
+        while ((n = client.read()) >= 0) { got.push_back(n); }
+        check("frame after a cut off one read", endsWith(got, pattern(5, 5)));
+        check("cut off frame not read whole", got.size() < 35);
+    }
+
+    unsigned closes = xbee.closes;
+    client.stop();
+    check("stop() closes the socket", xbee.closes == closes + 1);
+    check("not connected after stop()", !client.connected());
+}
+
+static void testSocketFailures(SimXBee& xbee, DigiXBeeAPI& api) {
+    xbee.reply.clear();
+
+    DigiXBeeAPIClient client(api);
+    Bytes             data = pattern(100, 9);
+    check("connect by address",
+          client.connect(IPAddress(192, 168, 1, 2), 8080) == 1);
+    xbee.txStatus = 0x21;
+    check("refused write not counted",
+          client.write(data.data(), data.size()) == 0);
+    check("refused write closes the client", !client.connected());
+
+    xbee.txStatus = -1;
+    client.connect(IPAddress(192, 168, 1, 2), 8080);
+    check("unanswered write not counted",
+          client.write(data.data(), data.size()) == 0);
+    check("unanswered write closes the client", !client.connected());
+    xbee.txStatus = 0;
+
+    xbee.lookupWorks = false;
+    check("failed lookup fails connect()",
+          client.connect("nowhere.invalid", 80) == 0);
+    xbee.lookupWorks = true;
+}
+
+static void runMode(uint8_t mode) {
+    testMode = mode;
+    SimXBee     xbee(0);
+    DigiXBeeAPI api(&xbee, mode);
+
+    testSwitchToAPI(xbee, api);
+    testATCommands(xbee, api);
+    testPendingAndFrameIds(xbee, api);
+    testSocket(xbee, api);
+    testSocketFailures(xbee, api);
+
+    check("no bad frames", xbee.badFrames == 0);
+    check("no bytes left unescaped", xbee.bareEscapes == 0);
+    printf("API mode %d: %u frames, %u socket frames, %lu socket bytes\n",
+           mode, xbee.goodFrames, xbee.socketFrames,
+           (unsigned long)xbee.received.size());
+}
+
+static void testChangeMode(void) {
+    // An XBee left in API mode 1 is moved to API mode 2 with frames
+    testMode = 2;
+    SimXBee     xbee(1);
+    DigiXBeeAPI api(&xbee, 2);
+    check("enableAPIMode() from API mode 1", api.enableAPIMode());
+    check("changed to API mode 2", xbee.apiMode == 2);
+    check("no command mode needed", xbee.commandModeEntries == 0);
+    check("the API mode was saved",
+          !xbee.commands.empty() && xbee.commands.back() == "WR");
+    check("no bad frames after the change", xbee.badFrames == 0);
+}
+
+int main(void) {
+    runMode(1);
+    runMode(2);
+    testChangeMode();
+    if (failures > 0) {
+        printf("%lu failures\n", (unsigned long)failures);
+        return 1;
+    }
+    printf("All XBee API checks passed\n");
+    return 0;
+}